@@ -0,0 +1,68 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Réception ESP-NOW (Interface)
+  -----------------------
+
+  Réception des commandes datées de la station sol par ESP-NOW (trames
+  CommandFrame de communication/protocols.h), transmises à la file des
+  commandes datées (control/command_scheduler.h).
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Tâche réseau, une fois la pile WiFi démarrée :
+
+    if (!espnowManagerIsReady()) espnowManagerInit();
+    EspNowStats stats = espnowManagerGetStats();
+
+  Principales fonctionnalités exposées :
+  - espnowManagerInit() : Démarrage d'ESP-NOW et du rappel de réception
+  - espnowManagerGetStats() : Compteurs de réception
+
+  Contraintes techniques :
+  - Le rappel de réception s'exécute dans la tâche WiFi : il décode et met
+    en file, sans attente ni exécution de la commande
+  - Les trames adressées à un autre kite (unitId non nul et différent) sont
+    ignorées ; executeAtMs est dans l'horloge du kite, que la station sol
+    lit dans le timestampMs de la télémétrie
+*/
+
+#ifndef ESPNOW_MANAGER_H
+#define ESPNOW_MANAGER_H
+
+#include <Arduino.h>
+
+// === DÉFINITION DES TYPES ===
+
+// Compteurs de réception
+typedef struct {
+  uint32_t received;           // Trames reçues
+  uint32_t invalid;            // Trames rejetées au décodage
+  uint32_t otherUnit;          // Trames adressées à un autre kite
+  uint32_t queued;             // Commandes mises en file
+  uint32_t rejected;           // Commandes refusées par la file
+} EspNowStats;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Démarre ESP-NOW (pile WiFi déjà démarrée)
+ * @return false si ESP-NOW n'a pas pu démarrer
+ */
+bool espnowManagerInit();
+
+/**
+ * ESP-NOW démarré
+ * @return true après un espnowManagerInit() réussi
+ */
+bool espnowManagerIsReady();
+
+/**
+ * Copie les compteurs de réception
+ * @return Compteurs
+ */
+EspNowStats espnowManagerGetStats();
+
+#endif // ESPNOW_MANAGER_H
@@ -15,6 +15,7 @@
 #define KITE_WEBSERVER_H
 
 #include <ESPAsyncWebServer.h>
+#include "utils/timer_wheel.h"
 
 // Fonction pour obtenir le port du serveur - version optimisée
 uint16_t getServerPort(AsyncWebServer* server);
@@ -26,6 +27,9 @@ void setWebServerMode(bool useFiles);
 // Configuration des routes du serveur web avec optimisations
 void setupServerRoutes(AsyncWebServer* server);
 
+// Expiration périodique du cache HTML, exécutée par la tâche propriétaire de la roue
+bool webServerScheduleCacheRefresh(TimerWheel* wheel);
+
 // Fonction optimisée pour obtenir l'état du système sous forme de chaîne
 // Utilise une mise en cache interne pour éviter les régénérations fréquentes
 String getSystemStatusString();
@@ -0,0 +1,272 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Format de télémétrie (Interface)
+  -----------------------
+
+  Trame binaire de télémétrie émise par le firmware (UDP, port série) et
+  décodée par la station sol (native/ground). Cet en-tête est partagé par
+  les deux côtés : il ne dépend que de la bibliothèque C standard.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Émission (firmware) et réception (station sol) :
+
+    TelemetryFrame frame = {};
+    frame.unitId = 3;
+    frame.values[TELEMETRY_FIELD_PITCH] = imu.orientation[0];
+    uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+    size_t length = telemetryEncode(&frame, buffer, sizeof(buffer));
+
+    // Datagramme complet
+    telemetryDecode(buffer, length, &frame);
+
+    // Flux d'octets (port série mêlé au journal texte)
+    if (telemetryParserFeed(&parser, byte, &frame)) { ... }
+
+  Principales fonctionnalités exposées :
+  - telemetryEncode() / telemetryDecode() : Trame <-> structure
+  - telemetryParserFeed() : Resynchronisation sur un flux d'octets
+  - telemetryCrc16() : CRC-16/CCITT de la trame
+  - TELEMETRY_FIELD_NAMES : Noms des champs (colonnes, en-têtes CSV)
+  - commandEncode() / commandDecode() : Commande datée (station sol, ESP-NOW)
+  - taskSnapshotEncode() / taskSnapshotDecode() : Table des tâches FreeRTOS
+
+  Format (petit-boutiste, sans alignement) :
+    0   magic       u16   TELEMETRY_MAGIC ("KT")
+    2   version     u8    TELEMETRY_VERSION
+    3   fieldCount  u8    Nombre de valeurs qui suivent
+    4   unitId      u16   Identifiant du kite émetteur
+    6   flags       u16   Mode de l'autopilote (octet bas)
+    8   sequence    u32   Numéro de trame de l'émetteur
+    12  timestampMs u32   millis() de l'émetteur
+    16  values      f32 × fieldCount
+    ..  crc         u16   CRC-16/CCITT de tout ce qui précède
+
+  Commande datée (taille fixe, même CRC) :
+    0   magic       u16   COMMAND_MAGIC ("KC")
+    2   version     u8    COMMAND_VERSION
+    3   type        u8    CommandType
+    4   unitId      u16   Kite visé (0 : tous)
+    6   latePolicy  u8    CommandLatePolicy
+    7   target      u8    Mode de l'autopilote ou identifiant du paramètre
+    8   sequence    u32   Numéro de commande de l'émetteur
+    12  executeAtMs u32   Instant d'exécution, horloge du kite (timestampMs de sa télémétrie)
+    16  value       f32   Valeur du paramètre ou vitesse du treuil (m/s)
+    20  crc         u16
+
+  Instantané des tâches (longueur selon taskCount, même CRC) :
+    0   magic       u16   TASK_SNAPSHOT_MAGIC ("KS")
+    2   version     u8    TASK_SNAPSHOT_VERSION
+    3   taskCount   u8    Nombre d'entrées qui suivent
+    4   timestampMs u32   millis() de la capture
+    8   intervalMs  u32   Écart avec la capture précédente
+    12  runTimeTotal u32  Même écart au compteur des statistiques (0 : désactivées)
+    16  entrées     × taskCount, 29 octets chacune :
+          0  name[16]  texte terminé par des zéros
+          16 state u8, 17 priority u8, 18 core i8 (-1 : sans affinité)
+          19 stackFreeBytes u32, 23 runTime u32, 27 cpuPermille u16
+    ..  crc         u16
+
+  Contraintes techniques :
+  - Les champs sont ajoutés en fin d'énumération : un décodeur ignore les
+    valeurs qu'il ne connaît pas et met NAN dans celles qui manquent
+  - Une trame invalide (magic, version, longueur ou CRC) est rejetée sans
+    état : le flux reprend à l'octet suivant
+*/
+
+#ifndef PROTOCOLS_H
+#define PROTOCOLS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// === CONSTANTES ===
+#define TELEMETRY_MAGIC            0x544B  // "KT" sur le fil
+#define TELEMETRY_VERSION          1
+#define TELEMETRY_UDP_PORT         4210    // Port de diffusion des trames
+#define TELEMETRY_HEADER_SIZE      16
+#define TELEMETRY_CRC_SIZE         2
+#define TELEMETRY_MAX_FIELDS       32      // Limite de fieldCount acceptée au décodage
+
+#define COMMAND_MAGIC              0x434B  // "KC" sur le fil
+#define COMMAND_VERSION            1
+#define COMMAND_FRAME_SIZE         22
+
+#define TASK_SNAPSHOT_MAGIC        0x534B  // "KS" sur le fil
+#define TASK_SNAPSHOT_VERSION      1
+#define TASK_SNAPSHOT_HEADER_SIZE  16
+#define TASK_SNAPSHOT_ENTRY_SIZE   29
+#define TASK_SNAPSHOT_NAME_LENGTH  16      // configMAX_TASK_NAME_LEN de l'ESP-IDF
+#define TASK_SNAPSHOT_MAX_TASKS    24
+#define TASK_SNAPSHOT_MAX_FRAME_SIZE \
+  (TASK_SNAPSHOT_HEADER_SIZE + TASK_SNAPSHOT_MAX_TASKS * TASK_SNAPSHOT_ENTRY_SIZE + TELEMETRY_CRC_SIZE)
+
+// === DÉFINITION DES TYPES ===
+
+// Champs transmis, dans l'ordre du fil
+typedef enum {
+  TELEMETRY_FIELD_PITCH = 0,       // Tangage (degrés)
+  TELEMETRY_FIELD_ROLL,            // Roulis (degrés)
+  TELEMETRY_FIELD_YAW,             // Lacet (degrés)
+  TELEMETRY_FIELD_LINE_TENSION,    // Tension des lignes (kg)
+  TELEMETRY_FIELD_LINE_LENGTH,     // Longueur des lignes (cm)
+  TELEMETRY_FIELD_WIND_SPEED,      // Vitesse du vent (m/s)
+  TELEMETRY_FIELD_WIND_DIRECTION,  // Direction du vent (degrés)
+  TELEMETRY_FIELD_POWER,           // Puissance instantanée (W)
+  TELEMETRY_FIELD_DIRECTION,       // Angle de direction (degrés)
+  TELEMETRY_FIELD_TRIM,            // Angle de trim (degrés)
+  TELEMETRY_FIELD_COUNT
+} TelemetryField;
+
+#define TELEMETRY_MAX_FRAME_SIZE \
+  (TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_FIELDS * sizeof(float) + TELEMETRY_CRC_SIZE)
+
+// Trame décodée
+typedef struct {
+  uint16_t unitId;                 // Kite émetteur
+  uint16_t flags;                  // Mode de l'autopilote (octet bas)
+  uint32_t sequence;               // Numéro de trame de l'émetteur
+  uint32_t timestampMs;            // millis() de l'émetteur
+  float values[TELEMETRY_FIELD_COUNT];
+} TelemetryFrame;
+
+// Extracteur de trames d'un flux d'octets
+typedef struct {
+  uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+  size_t length;                   // Octets en attente dans buffer
+  uint32_t frames;                 // Trames valides extraites
+  uint32_t crcErrors;              // Trames complètes au CRC faux
+  uint32_t skipped;                // Octets écartés hors trame (journal texte)
+} TelemetryParser;
+
+// Nature d'une commande datée
+typedef enum {
+  COMMAND_TYPE_MODE = 0,           // Mode de l'autopilote (target)
+  COMMAND_TYPE_PARAMETER,          // Paramètre de l'autopilote (target = AutopilotParamId, value)
+  COMMAND_TYPE_WINCH,              // Vitesse du treuil (value, m/s, positive en sortie)
+  COMMAND_TYPE_COUNT
+} CommandType;
+
+// Commande arrivée à échéance après son cycle de contrôle
+typedef enum {
+  COMMAND_LATE_EXECUTE = 0,        // Exécutée quand même, comptée en retard
+  COMMAND_LATE_DROP,               // Abandonnée : n'a de sens qu'à l'instant prévu
+  COMMAND_LATE_POLICY_COUNT
+} CommandLatePolicy;
+
+// Commande datée décodée
+typedef struct {
+  uint16_t unitId;                 // Kite visé (0 : tous)
+  uint8_t type;                    // CommandType
+  uint8_t latePolicy;              // CommandLatePolicy
+  uint8_t target;                  // Mode ou paramètre
+  uint32_t sequence;               // Numéro de commande de l'émetteur
+  uint32_t executeAtMs;            // Instant d'exécution (horloge du kite)
+  float value;
+} CommandFrame;
+
+// Tâche d'un instantané
+typedef struct {
+  char name[TASK_SNAPSHOT_NAME_LENGTH];  // Terminé par un zéro
+  uint8_t state;                   // eTaskState (0 en cours, 1 prête, 2 bloquée, 3 suspendue, 4 supprimée)
+  uint8_t priority;                // Priorité courante
+  int8_t core;                     // Cœur imposé, -1 sans affinité
+  uint32_t stackFreeBytes;         // Plus petite marge de pile observée
+  uint32_t runTime;                // Temps d'exécution sur l'intervalle (unités du compteur)
+  uint16_t cpuPermille;            // Part d'un cœur sur l'intervalle (‰)
+} TaskSnapshotEntry;
+
+// Table des tâches à un instant
+typedef struct {
+  uint32_t timestampMs;            // millis() de la capture
+  uint32_t intervalMs;             // Écart avec la capture précédente (depuis le démarrage pour la première)
+  uint32_t runTimeTotal;           // Écart au compteur des statistiques, 0 si désactivées
+  uint8_t taskCount;
+  TaskSnapshotEntry tasks[TASK_SNAPSHOT_MAX_TASKS];
+} TaskSnapshot;
+
+extern const char* const TELEMETRY_FIELD_NAMES[TELEMETRY_FIELD_COUNT];
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * CRC-16/CCITT (polynôme 0x1021, valeur initiale 0xFFFF)
+ * @param data Octets
+ * @param length Nombre d'octets
+ * @return CRC
+ */
+uint16_t telemetryCrc16(const uint8_t* data, size_t length);
+
+/**
+ * Encode une trame avec tous les champs connus
+ * @param frame Trame à encoder
+ * @param buffer Destination
+ * @param capacity Taille de la destination
+ * @return Longueur de la trame, 0 si la destination est trop petite
+ */
+size_t telemetryEncode(const TelemetryFrame* frame, uint8_t* buffer, size_t capacity);
+
+/**
+ * Décode une trame complète (datagramme)
+ * @param buffer Octets reçus
+ * @param length Nombre d'octets reçus
+ * @param frame Trame décodée
+ * @return Longueur de la trame décodée, 0 si elle est invalide ou incomplète
+ */
+size_t telemetryDecode(const uint8_t* buffer, size_t length, TelemetryFrame* frame);
+
+/**
+ * Réinitialise un extracteur de trames
+ * @param parser Extracteur
+ */
+void telemetryParserInit(TelemetryParser* parser);
+
+/**
+ * Ajoute un octet du flux
+ * @param parser Extracteur
+ * @param byte Octet reçu
+ * @param frame Trame décodée quand la fonction renvoie true
+ * @return true si l'octet complète une trame valide
+ */
+bool telemetryParserFeed(TelemetryParser* parser, uint8_t byte, TelemetryFrame* frame);
+
+/**
+ * Encode une commande datée
+ * @param command Commande
+ * @param buffer Destination
+ * @param capacity Taille de la destination
+ * @return COMMAND_FRAME_SIZE, 0 si la destination est trop petite
+ */
+size_t commandEncode(const CommandFrame* command, uint8_t* buffer, size_t capacity);
+
+/**
+ * Décode une commande datée (datagramme ESP-NOW ou UDP)
+ * @param buffer Octets reçus
+ * @param length Nombre d'octets reçus
+ * @param command Commande décodée
+ * @return false si la trame est invalide (magic, version, longueur, CRC ou type)
+ */
+bool commandDecode(const uint8_t* buffer, size_t length, CommandFrame* command);
+
+/**
+ * Encode un instantané des tâches
+ * @param snapshot Instantané (taskCount <= TASK_SNAPSHOT_MAX_TASKS)
+ * @param buffer Destination
+ * @param capacity Taille de la destination
+ * @return Longueur de la trame, 0 si la destination est trop petite
+ */
+size_t taskSnapshotEncode(const TaskSnapshot* snapshot, uint8_t* buffer, size_t capacity);
+
+/**
+ * Décode un instantané des tâches
+ * @param buffer Octets reçus
+ * @param length Nombre d'octets reçus
+ * @param snapshot Instantané décodé
+ * @return false si la trame est invalide (magic, version, longueur ou CRC)
+ */
+bool taskSnapshotDecode(const uint8_t* buffer, size_t length, TaskSnapshot* snapshot);
+
+#endif // PROTOCOLS_H
@@ -16,6 +16,7 @@
 #include <Arduino.h>
 #include "../hardware/sensors/imu.h"
 #include "../core/config.h"
+#include "pid.h"
 
 // === CONSTANTES ===
 
@@ -43,28 +44,38 @@ typedef struct {
   uint8_t maxWindSpeed;        // Vitesse de vent maximale autorisée (en km/h)
 } AutopilotParameters;
 
+// Paramètres réglables un à un (plans de vol, commandes datées)
+typedef enum {
+  AUTOPILOT_PARAM_FIGURE8_WIDTH = 0,
+  AUTOPILOT_PARAM_FIGURE8_HEIGHT,
+  AUTOPILOT_PARAM_TURN_SPEED,
+  AUTOPILOT_PARAM_AGGRESSIVENESS,
+  AUTOPILOT_PARAM_WIND_ADAPTATION,
+  AUTOPILOT_PARAM_MAX_WIND_SPEED,
+  AUTOPILOT_PARAM_COUNT
+} AutopilotParamId;
+
 // === DÉFINITION DES CONSTANTES DE CONTRÔLE ===
 #define MIN_ANGLE -45        // Angle minimum en degrés pour le contrôle de direction
 #define MAX_ANGLE 45         // Angle maximum en degrés pour le contrôle de direction
 #define DEFAULT_SPEED 1.0    // Vitesse par défaut pour les mouvements du kite
-
-// Structure pour les paramètres PID du pilote automatique
-typedef struct {
-    // Paramètres du contrôleur PID
-    float Kp;               // Gain proportionnel - Réactivité immédiate aux erreurs
-    float Ki;               // Gain intégral - Correction des erreurs persistantes
-    float Kd;               // Gain dérivé - Anticipation des changements d'erreur
-    
-    // Limites de sécurité
-    float maxOutput;        // Sortie maximale du contrôleur
-    float minOutput;        // Sortie minimale du contrôleur
-    float maxIntegral;      // Limite d'accumulation de l'erreur intégrale
-    
-    // Variables d'état
-    float lastError;        // Dernière erreur mesurée pour calcul dérivé
-    float integral;         // Accumulation des erreurs pour terme intégral
-    float setpoint;        // Point de consigne désiré
-} PIDParams;
+#define AUTOPILOT_UPDATE_INTERVAL 50  // Période minimale entre deux mises à jour (ms)
+#define AUTOPILOT_IMU_MAX_AGE_MS (3 * IMU_PUBLISH_PERIOD_MS)  // Âge maximal du dernier échantillon IMU reçu (ms)
+
+// Gains par défaut du PID de direction
+#define AUTOPILOT_PID_KP 1.2f
+#define AUTOPILOT_PID_KI 0.1f
+#define AUTOPILOT_PID_KD 0.3f
+#define AUTOPILOT_PID_MAX_INTEGRAL 50.0f
+#define AUTOPILOT_PID_DERIVATIVE_FILTER 0.2f  // Passe-bas de la dérivée (bruit du cap IMU)
+
+// Guidage dans la fenêtre de vent
+// Convention : l'IMU est fixée au kite, axe vertical aligné sur les lignes.
+// orientation[0] = élévation des lignes, orientation[1] = azimut (positif à droite
+// pour le pilote regardant le kite), orientation[2] = cap du kite dans la fenêtre
+// (0 = vers le zénith, 90 = vers la droite).
+#define AUTOPILOT_FIGURE8_ELEVATION 25.0f  // Élévation du centre de la figure en 8 (degrés)
+#define AUTOPILOT_HOVER_ELEVATION   90.0f  // Élévation visée en vol stationnaire et en urgence (zénith)
 
 // État de l'autopilote
 typedef struct {
@@ -80,7 +91,15 @@ typedef struct {
   float targetAngle;            // Angle cible pour le contrôle de direction
   float currentAngle;           // Angle actuel mesuré
   float windSpeed;              // Vitesse du vent actuelle
-  float lineLength;             // Longueur actuelle des lignes
+  float predictedWindSpeed;     // Vent prévu à GUST_HORIZON_MS (m/s)
+  float predictedWindUpper;     // Haut de la bande de confiance de la prévision (m/s)
+  float gustDepower;            // Réduction de puissance anticipée [0-1]
+  float lineLength;             // Longueur actuelle des lignes (cm)
+  float windowPosition[2];      // Position dans la fenêtre de vent [azimut, élévation] (degrés)
+  float windowTarget[2];        // Point visé dans la fenêtre [azimut, élévation] (degrés)
+  float envelopeDistance;       // Distance du kite à la limite de l'enveloppe de vol (degrés)
+  float steeringCommand;        // Commande de direction envoyée au servo (degrés)
+  int8_t figure8Side;           // Point de virage visé en figure en 8 (-1 gauche, +1 droite)
   PIDParams pidParams;          // Paramètres du contrôleur PID
 } AutopilotState;
 
@@ -101,9 +120,15 @@ void autopilotUpdate(const IMUData& imuData);
 // Régler les paramètres de l'autopilote
 bool setAutopilotParameters(const AutopilotParameters& params);
 
+// Régler un seul paramètre (copie de la version courante, même validation)
+bool setAutopilotParameter(AutopilotParamId id, int32_t value);
+
 // Obtenir les paramètres actuels de l'autopilote
 AutopilotParameters getAutopilotParameters();
 
+// Obtenir la version des paramètres publiée (incrémentée à chaque réglage)
+uint32_t getAutopilotParametersVersion();
+
 // Obtenir l'état actuel de l'autopilote
 AutopilotState getAutopilotState();
 
@@ -128,9 +153,16 @@ void updatePIDParams(const PIDParams* params);
 // Calcul de la commande de contrôle
 float computeControlCommand(float currentAngle, float targetAngle);
 
-// Mise à jour de l'état du pilote automatique
+// Mise à jour de l'état du pilote automatique (vent en m/s, longueur en cm)
 void updateAutopilotState(float windSpeed, float lineLength);
 
+// Cycle complet de la boucle fermée, appelé à chaque cycle quel que soit le mode :
+// vérification de l'échantillon IMU reçu du bus (BUS_TOPIC_IMU, nullptr si aucun
+// depuis le cycle précédent : le dernier sert tant qu'il a moins de
+// AUTOPILOT_IMU_MAX_AGE_MS), lecture du vent et de la longueur, prévision des
+// rafales, autopilotUpdate() puis commande du servo de direction si l'autopilote est actif
+bool autopilotControlStep(const IMUData* imuSample);
+
 // Fonction de sécurité pour vérifier les limites
 bool checkSafetyLimits();
 
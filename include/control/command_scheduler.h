@@ -0,0 +1,143 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Commandes datées (Interface)
+  -----------------------
+
+  File à priorité des commandes portant un instant d'exécution (changement
+  de mode, réglage d'un paramètre, vitesse du treuil) : une commande
+  s'exécute au premier cycle de contrôle qui atteint son instant, et des
+  commandes de même instant s'exécutent dans le même cycle, dans l'ordre de
+  leur réception. L'autopilote et le treuil peuvent ainsi agir ensemble à
+  la milliseconde près.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Réception (serveur web, ESP-NOW) et exécution (tâche de contrôle) :
+
+    CommandFrame command = {};
+    command.type = COMMAND_TYPE_MODE;
+    command.target = AUTOPILOT_HOVER;
+    command.executeAtMs = millis() + 2000;
+    command.latePolicy = COMMAND_LATE_DROP;
+    uint32_t id;
+    commandSchedulerSubmit(&command, COMMAND_SOURCE_REST, millis(), &id);
+
+    commandSchedulerService(millis());     // À chaque cycle, avant missionStep()
+
+  Principales fonctionnalités exposées :
+  - commandSchedulerSubmit() : Vérification et mise en file, O(log n)
+  - commandSchedulerCancel() : Retrait d'une commande en attente
+  - commandSchedulerService() : Exécution des commandes échues du cycle
+  - commandSchedulerSetWinchHandler() : Pilote du treuil qui exécute les commandes COMMAND_TYPE_WINCH
+
+  Contraintes techniques :
+  - Tas binaire de COMMAND_SCHEDULER_CAPACITY commandes, sans allocation ;
+    instants comparés modulo 2^32 (passage à zéro de millis())
+  - Une commande est à l'heure si elle s'exécute moins d'une période de
+    contrôle après son instant ; au-delà, sa politique de retard décide
+    (exécution comptée en retard ou abandon)
+  - Instant au-delà de COMMAND_MAX_HORIZON_MS (avant ou après) refusé :
+    horloge de l'émetteur non synchronisée sur celle du kite
+  - Soumission et retrait depuis n'importe quelle tâche (section critique
+    courte) ; exécution depuis la seule tâche de contrôle, hors section critique
+*/
+
+#ifndef COMMAND_SCHEDULER_H
+#define COMMAND_SCHEDULER_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "../communication/protocols.h"
+
+// === DÉFINITION DES TYPES ===
+
+// Origine d'une commande
+typedef enum {
+  COMMAND_SOURCE_LOCAL = 0,      // Firmware, simulation
+  COMMAND_SOURCE_REST,           // Serveur web (/api/commands)
+  COMMAND_SOURCE_ESPNOW          // Station sol par ESP-NOW
+} CommandSource;
+
+// Résultat d'une soumission
+typedef enum {
+  COMMAND_QUEUED = 0,            // En file
+  COMMAND_REJECTED_INVALID,      // Type, politique, mode ou paramètre inconnu
+  COMMAND_REJECTED_UNSUPPORTED,  // Aucun pilote de treuil
+  COMMAND_REJECTED_LATE,         // Instant déjà passé et politique COMMAND_LATE_DROP
+  COMMAND_REJECTED_HORIZON,      // Instant trop éloigné de l'horloge du kite
+  COMMAND_REJECTED_FULL          // File pleine
+} CommandSubmitResult;
+
+// Pilote du treuil (vitesse en m/s, positive en sortie)
+typedef bool (*CommandWinchHandler)(float speed);
+
+// Statistiques
+typedef struct {
+  uint32_t submitted;            // Commandes mises en file
+  uint32_t rejected;             // Soumissions refusées
+  uint32_t executed;             // Commandes exécutées (à l'heure ou en retard)
+  uint32_t late;                 // Exécutées plus d'une période après leur instant
+  uint32_t dropped;              // Abandonnées en retard (COMMAND_LATE_DROP)
+  uint32_t failed;               // Refusées à l'exécution (autopilote, treuil)
+  uint32_t cancelled;            // Retirées avant leur instant
+  uint32_t maxLatenessMs;        // Plus grand écart entre instant prévu et exécution
+  uint16_t pending;              // Commandes en attente
+  uint32_t nextExecuteAtMs;      // Instant de la prochaine commande (si pending > 0)
+} CommandSchedulerStats;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Vide la file et remet les statistiques à zéro
+ * @param tickMs Période de la tâche qui appelle commandSchedulerService() (ms)
+ */
+void commandSchedulerInit(uint32_t tickMs);
+
+/**
+ * Déclare le pilote du treuil (nullptr : commandes du treuil refusées)
+ * @param handler Fonction appelée dans la tâche de contrôle
+ */
+void commandSchedulerSetWinchHandler(CommandWinchHandler handler);
+
+/**
+ * Vérifie et met une commande en file (toute tâche)
+ * @param command Commande (unitId ignoré : filtré par le récepteur)
+ * @param source Origine, pour le journal
+ * @param nowMs Instant de réception, horloge du kite (ms)
+ * @param id Identifiant attribué (pour commandSchedulerCancel()), peut être nullptr
+ * @return COMMAND_QUEUED ou la cause du refus
+ */
+CommandSubmitResult commandSchedulerSubmit(const CommandFrame* command, CommandSource source,
+                                           uint32_t nowMs, uint32_t* id);
+
+/**
+ * Retire une commande en attente (toute tâche)
+ * @param id Identifiant rendu par commandSchedulerSubmit()
+ * @return false si la commande est inconnue ou déjà exécutée
+ */
+bool commandSchedulerCancel(uint32_t id);
+
+/**
+ * Exécute les commandes dont l'instant est atteint, dans l'ordre des instants
+ * @param nowMs Instant du cycle (ms)
+ * @return Nombre de commandes exécutées
+ */
+int commandSchedulerService(uint32_t nowMs);
+
+/**
+ * Copie les statistiques
+ * @return Statistiques
+ */
+CommandSchedulerStats commandSchedulerGetStats();
+
+/**
+ * Nom d'un résultat de soumission
+ * @param result Résultat
+ * @return Nom constant
+ */
+const char* commandSubmitResultName(CommandSubmitResult result);
+
+#endif // COMMAND_SCHEDULER_H
@@ -0,0 +1,137 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Bilan énergétique (Interface)
+  -----------------------
+
+  Intégration en ligne de la puissance mécanique au treuil (tension x vitesse
+  de déroulement) et de la puissance électrique, découpée par cycle de
+  pompage : phase de traction (déroulement, énergie produite) puis phase de
+  retour (enroulement, énergie consommée). Rendement de chaque cycle et
+  statistiques glissantes sur les derniers cycles.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  La tâche des capteurs fournit chaque échantillon horodaté, les autres
+  tâches lisent le bilan :
+
+    energyInit();
+    energyAddSample(millis(), tensionRead(), reelSpeed, NAN);  // NAN : pas de mesure électrique
+    EnergyStats stats;
+    energyGetStats(&stats);
+    lifetimeStatsAddEnergy(energyTakeProduced());
+
+  Principales fonctionnalités exposées :
+  - energyAddSample() : Intégration trapézoïdale sur l'horodatage des échantillons
+  - energyGetStats() : Puissances, totaux, cycle en cours, dernier cycle, statistiques glissantes
+  - energyTakeProduced() : Énergie produite depuis l'appel précédent (compteurs de vie)
+
+  Modèle :
+  - Puissance mécanique P = T.v (positive en déroulement) ; chaque intervalle
+    est intégré en trapèze et partagé au passage par zéro entre énergie
+    produite et énergie consommée
+  - Phase reconnue quand la vitesse dépasse ±ENERGY_REEL_SPEED_THRESHOLD
+    pendant ENERGY_MIN_PHASE_MS ; l'énergie de cette attente est rendue au
+    cycle suivant quand elle ouvre une nouvelle traction
+  - Un cycle va d'un début de traction au suivant ; rendement de pompage =
+    énergie nette / énergie de traction, rendement électrique = énergie
+    électrique / énergie mécanique nette
+
+  Contraintes techniques :
+  - energyAddSample() depuis une seule tâche ; lectures par copie sous section critique
+  - Deux échantillons séparés de plus de ENERGY_MAX_SAMPLE_GAP_MS (capteur
+    absent, horloge revenue en arrière) ne sont pas intégrés
+  - Un cycle plus long que ENERGY_MAX_CYCLE_MS (kite posé) est abandonné
+  - Aucune allocation ; totaux en double pour ne pas perdre les petits
+    incréments après des heures de fonctionnement
+*/
+
+#ifndef ENERGY_H
+#define ENERGY_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === DÉFINITION DES TYPES ===
+
+// Phase du cycle de pompage
+typedef enum {
+  ENERGY_PHASE_UNKNOWN = 0,   // Aucune phase encore reconnue
+  ENERGY_PHASE_REEL_OUT,      // Traction : la ligne se déroule sous tension
+  ENERGY_PHASE_REEL_IN        // Retour : le treuil enroule la ligne
+} EnergyPhase;
+
+// Bilan d'un cycle de pompage
+typedef struct {
+  uint32_t startMs;           // Début de la traction
+  uint32_t durationMs;        // Durée du cycle
+  uint32_t reelOutMs;         // Durée de la traction
+  float reelOutJ;             // Énergie mécanique produite (J)
+  float reelInJ;              // Énergie mécanique consommée (J, positive)
+  float netJ;                 // Énergie mécanique nette (J)
+  float electricalJ;          // Énergie électrique nette (J)
+  bool electricalMeasured;    // Puissance électrique mesurée pendant le cycle
+  float efficiency;           // Rendement de pompage : net / produite
+  float electricalEfficiency; // Électrique / mécanique nette (0 sans mesure)
+  float averagePowerW;        // Puissance nette moyenne du cycle (W)
+} EnergyCycle;
+
+// Bilan courant
+typedef struct {
+  EnergyPhase phase;          // Phase reconnue
+  float mechanicalPowerW;     // Dernière puissance mécanique (W)
+  float electricalPowerW;     // Dernière puissance électrique (W, 0 sans mesure)
+  double mechanicalJ;         // Énergie mécanique nette depuis energyInit() (J)
+  double electricalJ;         // Énergie électrique nette depuis energyInit() (J)
+  uint32_t samples;           // Échantillons reçus
+  uint32_t gaps;              // Intervalles non intégrés
+  uint32_t cycleCount;        // Cycles achevés
+  uint32_t abandonedCycles;   // Cycles abandonnés (trop longs)
+  bool cycleActive;           // Un cycle est en cours
+  EnergyCycle current;        // Cycle en cours (bilan partiel)
+  EnergyCycle last;           // Dernier cycle achevé
+  // Statistiques glissantes sur les ENERGY_CYCLE_HISTORY derniers cycles
+  uint8_t windowCycles;       // Cycles dans la fenêtre
+  float meanNetJ;             // Énergie nette moyenne (J)
+  float stdNetJ;              // Écart type de l'énergie nette (J)
+  float meanPowerW;           // Puissance nette moyenne (W, énergie / durée totale)
+  float meanDurationMs;       // Durée moyenne d'un cycle (ms)
+  float meanEfficiency;       // Rendement de pompage moyen
+  float minEfficiency;        // Pire rendement de la fenêtre
+  float maxEfficiency;        // Meilleur rendement de la fenêtre
+} EnergyStats;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Remet le bilan à zéro
+ */
+void energyInit();
+
+/**
+ * Intègre un échantillon depuis le précédent
+ * @param timestampMs Instant de la mesure (ms)
+ * @param tensionN Tension de la ligne au sol (N)
+ * @param reelSpeed Vitesse de déroulement (m/s, positive en sortie)
+ * @param electricalW Puissance électrique (W, positive en production), NAN si non mesurée
+ * @return true si l'échantillon achève un cycle de pompage
+ */
+bool energyAddSample(uint32_t timestampMs, float tensionN, float reelSpeed, float electricalW);
+
+/**
+ * Copie le bilan courant
+ * @param stats Structure recevant le bilan
+ */
+void energyGetStats(EnergyStats* stats);
+
+/**
+ * Énergie produite depuis l'appel précédent : électrique quand elle est
+ * mesurée, mécanique sinon. Un solde négatif (retour en cours) est conservé
+ * et retranché de la production suivante
+ * @return Énergie (J, positive ou nulle)
+ */
+float energyTakeProduced();
+
+#endif // ENERGY_H
@@ -0,0 +1,95 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Prévision des rafales (Interface)
+  -----------------------
+
+  Prévision à court terme de la vitesse du vent à partir de ses statistiques
+  glissantes et d'un petit modèle autorégressif ajusté en continu : vitesse
+  attendue GUST_HORIZON_MS plus tard et bande de confiance. Deux secondes
+  d'avance suffisent pour sortir le kite de la zone de puissance avant que
+  la rafale ne charge les lignes.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  La tâche de contrôle fournit chaque lecture valide de l'anémomètre puis lit
+  la prévision :
+
+    gustPredictorInit();
+    gustPredictorUpdate(wind.speed, millis());
+    GustPrediction prediction;
+    gustPredictorGetPrediction(&prediction);
+    if (prediction.ready && prediction.upperBound * 3.6f > maxWindSpeed) { ... }
+
+  Principales fonctionnalités exposées :
+  - gustPredictorUpdate() : Ajout d'une lecture, nouvelle prévision à chaque période du modèle
+  - gustPredictorGetPrediction() : Dernière prévision, statistiques et qualité mesurée
+
+  Modèle :
+  - Moyenne et variance glissantes (pondération exponentielle) du vent
+  - Écart à la moyenne modélisé par un AR(GUST_AR_ORDER) ajusté par moindres
+    carrés récursifs avec oubli, itéré jusqu'à l'horizon
+  - Bande de confiance : variance des résidus à un pas propagée sur l'horizon
+    par les coefficients du modèle
+  - Chaque prévision est comparée à la mesure arrivée à l'horizon : erreur
+    quadratique, erreur de la prévision naïve (vent constant), couverture de la bande
+
+  Contraintes techniques :
+  - Appelé depuis la seule tâche de contrôle (aucun verrou)
+  - Une horloge qui recule (redémarrage de la simulation) oublie l'historique
+  - Aucune allocation dynamique, calcul borné (quelques centaines d'opérations flottantes)
+*/
+
+#ifndef GUST_PREDICTOR_H
+#define GUST_PREDICTOR_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define GUST_AR_ORDER         3                                         // Ordre du modèle autorégressif
+#define GUST_HORIZON_STEPS    (GUST_HORIZON_MS / GUST_SAMPLE_INTERVAL_MS)  // Pas de prévision
+
+// === DÉFINITION DES TYPES ===
+
+// Prévision courante
+typedef struct {
+  bool ready;                         // Modèle assez entraîné pour prévoir
+  float meanSpeed;                    // Moyenne glissante du vent (m/s)
+  float stdDev;                       // Écart type glissant du vent (m/s)
+  float predictedSpeed;               // Vent attendu à l'horizon (m/s)
+  float lowerBound;                   // Bas de la bande de confiance (m/s)
+  float upperBound;                   // Haut de la bande de confiance (m/s)
+  float residualStd;                  // Écart type des résidus à un pas (m/s)
+  float coefficients[GUST_AR_ORDER];  // Coefficients du modèle
+  float predictionRms;                // Erreur RMS mesurée à l'horizon (m/s)
+  float persistenceRms;               // Erreur RMS de la prévision « vent constant » (m/s)
+  float coverage;                     // Part des mesures tombées dans la bande [0-1]
+  uint32_t samples;                   // Périodes du modèle écoulées
+  uint32_t timestampMs;               // Instant de la prévision
+} GustPrediction;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Oublie l'historique et remet le modèle à zéro
+ */
+void gustPredictorInit();
+
+/**
+ * Ajoute une lecture valide de l'anémomètre
+ * @param windSpeed Vitesse du vent (m/s)
+ * @param nowMs Instant de la lecture (ms)
+ * @return true si une période du modèle s'est achevée (prévision renouvelée)
+ */
+bool gustPredictorUpdate(float windSpeed, uint32_t nowMs);
+
+/**
+ * Copie la dernière prévision
+ * @param prediction Structure recevant la prévision
+ */
+void gustPredictorGetPrediction(GustPrediction* prediction);
+
+#endif // GUST_PREDICTOR_H
@@ -0,0 +1,149 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Séquenceur de décollage et d'atterrissage (Interface)
+  -----------------------
+
+  Profils d'élévation et de longueur de ligne précalculés au lancement d'une
+  séquence : courbes en S à jerk limité, parcourues par lecture de table à
+  chaque cycle de contrôle. L'écart entre le vol mesuré et le profil est
+  surveillé ; un écart persistant abandonne la séquence vers un état sûr.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  L'autopilote lance la séquence au passage en AUTOPILOT_TAKEOFF ou
+  AUTOPILOT_LANDING, puis suit la consigne à chaque cycle :
+
+    launchSequenceStart(LAUNCH_TAKEOFF, millis(), elevation, lineLength,
+                        LAUNCH_TAKEOFF_ELEVATION, lineLength + LAUNCH_TAKEOFF_REEL_OUT_CM);
+    LaunchSetpoint setpoint;
+    switch (launchSequenceUpdate(millis(), elevation, lineLength, &setpoint)) {
+      case LAUNCH_RUNNING:  windowTarget[1] = setpoint.elevation; break;
+      case LAUNCH_COMPLETE: ...                                   // Mode suivant
+      case LAUNCH_ABORTED:  setAutopilotMode(AUTOPILOT_EMERGENCY);
+    }
+
+  Principales fonctionnalités exposées :
+  - launchSequenceStart() : Calcul des tables, durée fixée par les limites de l'axe le plus lent
+  - launchSequenceUpdate() : Consigne du cycle, commande du treuil, surveillance de l'écart
+  - launchSequenceCancel() : Arrêt (changement de mode), treuil arrêté
+  - launchSequenceGetState() : Progression et écarts (toute tâche)
+
+  Profil :
+  - Forme normalisée à sept segments (jerk +, accélération constante, jerk -,
+    vitesse constante, puis symétrique), calculée une fois et exacte aux
+    points de la table (jerk constant entre deux points)
+  - La durée est la plus petite qui respecte vitesse, accélération et jerk
+    maximaux sur les deux axes ; les deux axes partagent la même durée
+  - Treuil : vitesse du profil plus correction proportionnelle de l'écart de longueur
+
+  Contraintes techniques :
+  - Appelé depuis la seule tâche de contrôle ; état lu par copie sous section critique
+  - Un écart au-delà de LAUNCH_MAX_ELEVATION_ERROR ou LAUNCH_MAX_LENGTH_ERROR_CM
+    pendant LAUNCH_DEVIATION_MS, ou une cible non atteinte LAUNCH_SETTLE_MS
+    après la fin du profil, abandonne la séquence et arrête le treuil
+  - Aucune allocation ; un cycle coûte une interpolation par axe
+*/
+
+#ifndef LAUNCH_SEQUENCER_H
+#define LAUNCH_SEQUENCER_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "command_scheduler.h"
+
+// === CONSTANTES ===
+#define LAUNCH_PROFILE_POINTS  81     // Points des tables (segments de la forme alignés sur les points)
+
+// === DÉFINITION DES TYPES ===
+
+// Séquence
+typedef enum {
+  LAUNCH_TAKEOFF = 0,
+  LAUNCH_LANDING
+} LaunchKind;
+
+// État de la séquence
+typedef enum {
+  LAUNCH_IDLE = 0,            // Aucune séquence
+  LAUNCH_RUNNING,             // Profil en cours ou cible en approche
+  LAUNCH_COMPLETE,            // Cible atteinte
+  LAUNCH_ABORTED              // Écart persistant ou cible non atteinte
+} LaunchStatus;
+
+// Cause d'un abandon
+typedef enum {
+  LAUNCH_ABORT_NONE = 0,
+  LAUNCH_ABORT_ELEVATION,     // Le kite ne suit pas l'élévation du profil
+  LAUNCH_ABORT_LINE_LENGTH,   // Le treuil ne suit pas la longueur du profil
+  LAUNCH_ABORT_TIMEOUT        // Cible non atteinte après la fin du profil
+} LaunchAbortReason;
+
+// Consigne d'un cycle
+typedef struct {
+  float elevation;            // Élévation visée (degrés)
+  float lineLengthCm;         // Longueur de ligne visée (cm)
+  float reelSpeed;            // Commande du treuil (m/s, positive en sortie)
+} LaunchSetpoint;
+
+// Progression
+typedef struct {
+  LaunchKind kind;
+  LaunchStatus status;
+  LaunchAbortReason abortReason;
+  uint32_t startMs;           // Début de la séquence
+  uint32_t durationMs;        // Durée du profil
+  float progress;             // Avancement du profil [0-1]
+  LaunchSetpoint setpoint;    // Dernière consigne
+  float elevationError;       // Écart mesuré - profil (degrés)
+  float lengthErrorCm;        // Écart mesuré - profil (cm)
+  float maxElevationError;    // Plus grand écart d'élévation de la séquence (degrés)
+  float maxLengthErrorCm;     // Plus grand écart de longueur de la séquence (cm)
+} LaunchSequenceState;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Déclare le pilote du treuil (nullptr : profil de longueur suivi sans treuil)
+ * @param handler Fonction appelée dans la tâche de contrôle
+ */
+void launchSequenceSetWinchHandler(CommandWinchHandler handler);
+
+/**
+ * Calcule les profils et démarre une séquence
+ * @param kind Décollage ou atterrissage
+ * @param nowMs Instant de départ (ms)
+ * @param elevation Élévation mesurée au départ (degrés)
+ * @param lineLengthCm Longueur mesurée au départ (cm)
+ * @param targetElevation Élévation visée en fin de séquence (degrés)
+ * @param targetLengthCm Longueur visée en fin de séquence (cm)
+ * @return false si une valeur n'est pas finie
+ */
+bool launchSequenceStart(LaunchKind kind, uint32_t nowMs, float elevation, float lineLengthCm,
+                         float targetElevation, float targetLengthCm);
+
+/**
+ * Consigne du cycle, commande du treuil et surveillance de l'écart au profil
+ * @param nowMs Instant courant (ms)
+ * @param elevation Élévation mesurée (degrés)
+ * @param lineLengthCm Longueur mesurée (cm)
+ * @param setpoint Consigne du cycle (inchangée hors LAUNCH_RUNNING)
+ * @return État après ce cycle
+ */
+LaunchStatus launchSequenceUpdate(uint32_t nowMs, float elevation, float lineLengthCm,
+                                  LaunchSetpoint* setpoint);
+
+/**
+ * Arrête la séquence en cours et le treuil
+ */
+void launchSequenceCancel();
+
+/**
+ * Copie la progression de la dernière séquence
+ * @param state Structure recevant la progression
+ */
+void launchSequenceGetState(LaunchSequenceState* state);
+
+#endif // LAUNCH_SEQUENCER_H
@@ -0,0 +1,136 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Exécution des plans de vol (Interface)
+  -----------------------
+
+  Interpréteur des plans de vol compilés (control/mission_format.h) :
+  enchaînement scripté des modes de l'autopilote, attentes sur les capteurs,
+  boucles de figures en 8 et gardes d'abandon, pour des essais répétables
+  sans opérateur.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Plan rangé en flash (control/mission_plans.h, généré par native/mission),
+  exécuté par la tâche de contrôle :
+
+    missionInit();
+    missionStartPlan("perf_trial");
+    missionStep(millis());                 // À chaque cycle, avant autopilotControlStep()
+    MissionStatus status;
+    missionGetStatus(&status);
+
+  Principales fonctionnalités exposées :
+  - missionLoad() : Vérification complète d'un plan compilé (en-tête, CRC, instructions, boucles)
+  - missionStartPlan() : Démarrage d'un plan intégré au firmware (serveur web)
+  - missionStep() : Exécution bornée d'un cycle
+  - missionAbort() : Interruption par l'opérateur
+
+  Contraintes techniques :
+  - Au plus MISSION_MAX_INSTRUCTIONS_PER_TICK instructions par cycle : une
+    boucle sans attente s'étale sur plusieurs cycles au lieu de bloquer le contrôle
+  - Le code est vérifié au chargement ; l'exécution ne relit jamais hors du plan
+  - Gardes vérifiées à chaque cycle avant les instructions ; un passage en
+    urgence décidé par l'autopilote abandonne aussi le plan
+  - Le code est lu en place (flash), aucune allocation dynamique
+  - missionLoad(), missionStart() et missionStep() depuis la seule tâche de
+    contrôle ; missionStartPlan() et missionAbort() depuis n'importe quelle
+    tâche (demande appliquée au cycle suivant), état copié sous section critique
+*/
+
+#ifndef MISSION_H
+#define MISSION_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "mission_format.h"
+
+// === DÉFINITION DES TYPES ===
+
+// État de la mission
+typedef enum {
+  MISSION_IDLE = 0,              // Aucun plan en cours
+  MISSION_RUNNING,               // Plan en cours d'exécution
+  MISSION_COMPLETED,             // Fin du plan atteinte
+  MISSION_ABORTED,               // Garde déclenchée, urgence ou interruption
+  MISSION_FAILED                 // Délai dépassé ou mode refusé par l'autopilote
+} MissionState;
+
+// État publié
+typedef struct {
+  MissionState state;
+  const char* planName;          // Plan intégré en cours (nullptr pour un plan chargé)
+  const char* reason;            // Cause de l'abandon ou de l'échec
+  uint16_t pc;                   // Décalage de l'instruction courante
+  uint8_t lastMark;              // Dernier repère d'essai franchi
+  uint32_t instructions;         // Instructions exécutées depuis le démarrage
+  uint32_t startedAtMs;          // Démarrage du plan
+  uint32_t elapsedMs;            // Durée d'exécution
+} MissionStatus;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Arrête toute mission et oublie le plan chargé
+ */
+void missionInit();
+
+/**
+ * Vérifie et charge un plan compilé (lu en place, doit rester valide)
+ * @param code Plan compilé
+ * @param size Taille du plan (octets)
+ * @return false si le plan est invalide ou si une mission est en cours
+ */
+bool missionLoad(const uint8_t* code, size_t size);
+
+/**
+ * Démarre le plan chargé
+ * @param nowMs Instant de démarrage (ms)
+ * @return false sans plan chargé ou si une mission est déjà en cours
+ */
+bool missionStart(uint32_t nowMs);
+
+/**
+ * Demande le démarrage d'un plan intégré au firmware (toute tâche) ;
+ * le plan démarre au cycle suivant de missionStep()
+ * @param name Nom du plan (voir missionGetPlan())
+ * @return false si le plan est inconnu, invalide ou si une mission est en cours
+ */
+bool missionStartPlan(const char* name);
+
+/**
+ * Exécute un cycle de la mission en cours
+ * @param nowMs Instant du cycle (ms)
+ * @return État après le cycle
+ */
+MissionState missionStep(uint32_t nowMs);
+
+/**
+ * Demande l'interruption de la mission en cours (toute tâche), appliquée au
+ * cycle suivant ; le mode de l'autopilote est conservé
+ */
+void missionAbort();
+
+/**
+ * Copie l'état de la mission
+ * @param status Structure recevant l'état
+ */
+void missionGetStatus(MissionStatus* status);
+
+/**
+ * Plans intégrés au firmware
+ * @param index Rang du plan
+ * @return Plan, nullptr au-delà du dernier
+ */
+const MissionPlan* missionGetPlan(int index);
+
+/**
+ * Nom d'un état de mission
+ * @param state État
+ * @return Nom constant
+ */
+const char* missionStateName(MissionState state);
+
+#endif // MISSION_H
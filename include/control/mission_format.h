@@ -0,0 +1,129 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Format du code des plans de vol (Interface)
+  -----------------------
+
+  Code compact produit par le compilateur de plans de vol de l'hôte
+  (native/mission) et exécuté par l'interpréteur du firmware (control/mission.h).
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Un plan compilé :
+
+    magic       u32   MISSION_MAGIC
+    version     u8    MISSION_FORMAT_VERSION
+    reserved    u8    0
+    codeLength  u16   Octets d'instructions
+    code        ...   Instructions, la dernière est MISSION_OP_HALT
+    crc         u16   CRC-16/CCITT de tout ce qui précède (telemetryCrc16)
+
+  Entiers en petit-boutiste. Chaque instruction est un code opération
+  suivi d'opérandes de taille fixe (MISSION_OP_*_SIZE, code compris) :
+
+    HALT                                    Fin du plan
+    MODE        mode u8                     Change le mode de l'autopilote
+    WAIT        durée u16                   Attente (dixièmes de seconde)
+    WAIT_UNTIL  cond u8, seuil i16, délai u16
+                                            Attente d'une condition capteur, échec au délai (0 : aucun)
+    WAIT_CYCLES nombre u16, délai u16       Attente de figures en 8 complètes
+    REPEAT      nombre u16, fin u16         Boucle : fin = décalage après le END correspondant
+    END                                     Fin de boucle
+    ABORT_IF    cond u8, seuil i16, mode u8 Garde : abandon et mode de repli si la condition devient vraie
+    SET         paramètre u8, valeur i16    Réglage d'un paramètre de l'autopilote
+    MARK        repère u8                   Repère d'essai (journal, état de la mission)
+
+  cond = capteur << 2 | comparaison ; seuils en dixièmes de l'unité du capteur.
+
+  Contraintes techniques :
+  - Sans dépendance Arduino : compilé aussi par les outils de l'hôte
+*/
+
+#ifndef MISSION_FORMAT_H
+#define MISSION_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// === CONSTANTES ===
+#define MISSION_MAGIC            0x4E534D4B  // "KMSN"
+#define MISSION_FORMAT_VERSION   1
+#define MISSION_HEADER_SIZE      8
+#define MISSION_CRC_SIZE         2
+#define MISSION_MAX_CODE_SIZE    1024        // Octets d'instructions d'un plan
+#define MISSION_MAX_DEPTH        4           // Boucles imbriquées
+#define MISSION_MAX_GUARDS       4           // Gardes ABORT_IF d'un plan
+
+// Codes opération
+typedef enum {
+  MISSION_OP_HALT = 0,
+  MISSION_OP_MODE,
+  MISSION_OP_WAIT,
+  MISSION_OP_WAIT_UNTIL,
+  MISSION_OP_WAIT_CYCLES,
+  MISSION_OP_REPEAT,
+  MISSION_OP_END,
+  MISSION_OP_ABORT_IF,
+  MISSION_OP_SET,
+  MISSION_OP_MARK,
+  MISSION_OP_COUNT
+} MissionOpcode;
+
+// Taille de chaque instruction, code opération compris
+#define MISSION_OP_HALT_SIZE         1
+#define MISSION_OP_MODE_SIZE         2
+#define MISSION_OP_WAIT_SIZE         3
+#define MISSION_OP_WAIT_UNTIL_SIZE   6
+#define MISSION_OP_WAIT_CYCLES_SIZE  5
+#define MISSION_OP_REPEAT_SIZE       5
+#define MISSION_OP_END_SIZE          1
+#define MISSION_OP_ABORT_IF_SIZE     5
+#define MISSION_OP_SET_SIZE          4
+#define MISSION_OP_MARK_SIZE         2
+
+// Capteurs des conditions
+typedef enum {
+  MISSION_SENSOR_ELEVATION = 0,   // Élévation du kite (degrés)
+  MISSION_SENSOR_AZIMUTH,         // Azimut du kite (degrés)
+  MISSION_SENSOR_WIND,            // Vent mesuré (m/s)
+  MISSION_SENSOR_GUST,            // Haut de la bande de la prévision du vent (m/s)
+  MISSION_SENSOR_LINE,            // Longueur de ligne (m)
+  MISSION_SENSOR_CONFIDENCE,      // Confiance de l'autopilote [0-100]
+  MISSION_SENSOR_COUNT
+} MissionSensor;
+
+// Comparaisons des conditions
+typedef enum {
+  MISSION_CMP_LT = 0,
+  MISSION_CMP_LE,
+  MISSION_CMP_GT,
+  MISSION_CMP_GE,
+  MISSION_CMP_COUNT
+} MissionComparison;
+
+// Paramètres réglables par SET (la sécurité ne peut pas être désactivée par un plan)
+typedef enum {
+  MISSION_PARAM_FIGURE8_WIDTH = 0,
+  MISSION_PARAM_FIGURE8_HEIGHT,
+  MISSION_PARAM_TURN_SPEED,
+  MISSION_PARAM_AGGRESSIVENESS,
+  MISSION_PARAM_WIND_ADAPTATION,
+  MISSION_PARAM_MAX_WIND_SPEED,
+  MISSION_PARAM_COUNT
+} MissionParam;
+
+// Modes de l'autopilote (valeurs de AutopilotMode)
+#define MISSION_MODE_COUNT       7
+
+// === DÉFINITION DES TYPES ===
+
+// Plan compilé rangé en flash (control/mission_plans.h)
+typedef struct {
+  const char* name;
+  const uint8_t* code;
+  size_t size;
+} MissionPlan;
+
+#endif // MISSION_FORMAT_H
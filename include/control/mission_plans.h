@@ -0,0 +1,45 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Plans de vol intégrés (généré)
+  -----------------------
+
+  Généré par native/mission à partir des plans texte, ne pas modifier :
+    cd native/mission/plans && ../../../.pio/build/native_mission/program header *.kpl \
+        --out ../../../include/control/mission_plans.h
+
+  Tableaux constants : rangés en flash, lus en place par l'interpréteur.
+  Inclus par src/control/mission.cpp uniquement.
+*/
+
+#ifndef MISSION_PLANS_H
+#define MISSION_PLANS_H
+
+#include "mission_format.h"
+
+// figure8_check (45 octets)
+static const uint8_t MISSION_PLAN_FIGURE8_CHECK[] = {
+  0x4B, 0x4D, 0x53, 0x4E, 0x01, 0x00, 0x23, 0x00, 0x07, 0x0E, 0x69, 0x00,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x58, 0x02, 0x2C, 0x01, 0x02, 0x1E, 0x00,
+  0x01, 0x01, 0x05, 0x03, 0x00, 0x1D, 0x00, 0x04, 0x01, 0x00, 0x90, 0x01,
+  0x06, 0x01, 0x02, 0x02, 0x32, 0x00, 0x00, 0x91, 0xAE
+};
+
+// perf_trial (78 octets)
+static const uint8_t MISSION_PLAN_PERF_TRIAL[] = {
+  0x4B, 0x4D, 0x53, 0x4E, 0x01, 0x00, 0x44, 0x00, 0x07, 0x0E, 0x69, 0x00,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x58, 0x02, 0x2C, 0x01, 0x07, 0x00, 0xC8,
+  0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x58, 0x02, 0x08, 0x02, 0x04,
+  0x00, 0x09, 0x01, 0x04, 0x05, 0x00, 0xDC, 0x05, 0x08, 0x02, 0x06, 0x00,
+  0x09, 0x02, 0x04, 0x05, 0x00, 0xDC, 0x05, 0x08, 0x02, 0x08, 0x00, 0x09,
+  0x03, 0x04, 0x05, 0x00, 0xDC, 0x05, 0x08, 0x02, 0x05, 0x00, 0x01, 0x02,
+  0x02, 0x32, 0x00, 0x00, 0xCA, 0x42
+};
+
+static const MissionPlan MISSION_PLANS[] = {
+  { "figure8_check", MISSION_PLAN_FIGURE8_CHECK, sizeof(MISSION_PLAN_FIGURE8_CHECK) },
+  { "perf_trial", MISSION_PLAN_PERF_TRIAL, sizeof(MISSION_PLAN_PERF_TRIAL) },
+};
+
+#define MISSION_PLAN_COUNT  (sizeof(MISSION_PLANS) / sizeof(MISSION_PLANS[0]))
+
+#endif // MISSION_PLANS_H
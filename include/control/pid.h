@@ -0,0 +1,95 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module PID (Interface)
+  -----------------------
+  
+  Interface du contrôleur PID utilisé par l'autopilote.
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== INTERFACE PUBLIQUE =====
+  Ce fichier définit la structure PIDParams (gains, limites et état du contrôleur)
+  et les fonctions de calcul associées.
+  
+  Principales fonctionnalités exposées :
+  - pidInit() : Configuration des gains et des limites, remise à zéro de l'état
+  - pidReset() : Remise à zéro de l'intégrale et de la mémoire d'erreur
+  - pidCompute() : Calcul d'une commande à partir de la consigne et de la mesure
+  
+  Contraintes techniques :
+  - Anti-windup : l'intégrale est bornée à ±maxIntegral et n'est pas accumulée
+    lorsque la sortie est saturée dans le sens de l'erreur
+  - La dérivée peut être filtrée (passe-bas du premier ordre) pour ne pas
+    amplifier le bruit de mesure
+  - Aucune allocation, aucun appel système : utilisable dans une boucle de contrôle
+*/
+
+#ifndef PID_H
+#define PID_H
+
+#include <Arduino.h>
+
+// === DÉFINITION DES TYPES ===
+
+// Structure pour les paramètres PID du pilote automatique
+typedef struct {
+    // Paramètres du contrôleur PID
+    float Kp;               // Gain proportionnel - Réactivité immédiate aux erreurs
+    float Ki;               // Gain intégral - Correction des erreurs persistantes
+    float Kd;               // Gain dérivé - Anticipation des changements d'erreur
+    
+    // Limites de sécurité
+    float maxOutput;        // Sortie maximale du contrôleur
+    float minOutput;        // Sortie minimale du contrôleur
+    float maxIntegral;      // Limite d'accumulation de l'erreur intégrale
+    
+    // Variables d'état
+    float lastError;        // Dernière erreur mesurée pour calcul dérivé
+    float integral;         // Accumulation des erreurs pour terme intégral
+    float setpoint;        // Point de consigne désiré
+    
+    // Filtre de la dérivée
+    float derivativeFilter;    // Coefficient du passe-bas de la dérivée (0-1, 1 = sans filtre)
+    float filteredDerivative;  // Dérivée filtrée du pas précédent
+} PIDParams;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Configure un contrôleur PID et remet son état à zéro
+ * @param pid Contrôleur à configurer
+ * @param kp Gain proportionnel
+ * @param ki Gain intégral (par seconde)
+ * @param kd Gain dérivé (en secondes)
+ * @param minOutput Sortie minimale
+ * @param maxOutput Sortie maximale
+ * @param maxIntegral Borne absolue du terme intégral accumulé
+ */
+void pidInit(PIDParams* pid, float kp, float ki, float kd,
+             float minOutput, float maxOutput, float maxIntegral);
+
+/**
+ * Remet à zéro l'état du contrôleur (intégrale, dernière erreur et dérivée filtrée)
+ * @param pid Contrôleur
+ */
+void pidReset(PIDParams* pid);
+
+/**
+ * Définit le filtre passe-bas appliqué au terme dérivé
+ * @param pid Contrôleur
+ * @param coefficient Poids de la nouvelle dérivée, borné à [0.01, 1] (1 = sans filtre)
+ */
+void pidSetDerivativeFilter(PIDParams* pid, float coefficient);
+
+/**
+ * Calcule la commande du contrôleur
+ * @param pid Contrôleur (la consigne utilisée est pid->setpoint)
+ * @param measurement Valeur mesurée
+ * @param dt Pas de temps en secondes (> 0)
+ * @return Commande bornée à [minOutput, maxOutput]
+ */
+float pidCompute(PIDParams* pid, float measurement, float dt);
+
+#endif // PID_H
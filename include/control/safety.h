@@ -0,0 +1,141 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Enveloppe de vol (Interface)
+  -----------------------
+
+  Zone de vol autorisée dans l'espace azimut / élévation / longueur de ligne :
+  polygones de la fenêtre de vent (zone permise, zones interdites comme un
+  bâtiment ou une route) précompilés en grille de distances signées, plus
+  les limites de longueur de ligne et d'altitude. Chaque vérification coûte
+  quatre lectures de table et une interpolation, et donne la distance à la
+  limite pour écarter le point visé avant que la sécurité ne déclenche.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Compilation au démarrage (enveloppe par défaut ou propre au site), puis
+  vérification à chaque cycle de l'autopilote :
+
+    safetyEnvelopeInit();                           // Fenêtre par défaut
+    SafetyLimits limits = {0, params.maxLineLength, params.maxAltitude};
+    SafetyCheck check;
+    safetyEnvelopeCheck(azimuth, elevation, lineLength, limits, &check);
+    if (!check.inside) { ... }                     // Limite franchie
+    if (check.boundaryDistance < SAFETY_SOFT_MARGIN_DEG) {
+      target[0] += check.inwardAzimuth * (SAFETY_SOFT_MARGIN_DEG - check.boundaryDistance);
+    }
+
+  Principales fonctionnalités exposées :
+  - safetyEnvelopeCompile() : Polygones → grille de distances signées
+  - safetyEnvelopeCheck() : Appartenance, distance à la limite, direction de retour, marges
+  - safetyEnvelopeInit() : Compilation de la fenêtre par défaut
+
+  Modèle :
+  - Distances mesurées dans le plan (azimut, élévation) en degrés, aux nœuds
+    d'une grille de SAFETY_GRID_STEP_DEG couvrant ±90° d'azimut et 0-90°
+    d'élévation ; positives dans la zone permise, négatives dehors
+  - Zone permise : union des polygones permis moins les polygones interdits ;
+    la distance est celle de l'arête la plus proche, les polygones ne doivent
+    donc pas se chevaucher
+  - La vérification interpole les quatre nœuds voisins (erreur d'une fraction
+    de pas sur la position de la limite) ; le gradient de l'interpolation
+    donne la direction qui éloigne de la limite
+  - Altitude : longueur x sinus de l'élévation, sinus tabulé par ligne de la grille
+
+  Contraintes techniques :
+  - Grille de SAFETY_GRID_NODES octets (distance au demi-degré, saturée à ±63°)
+  - safetyEnvelopeCompile() avant le démarrage de la tâche de contrôle (pas
+    de double tampon) ; safetyEnvelopeCheck() sans verrou ni allocation
+  - Hors de la grille, la distance est celle du bord de la grille le plus proche
+*/
+
+#ifndef SAFETY_H
+#define SAFETY_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define SAFETY_AZIMUTH_MIN         -90.0f
+#define SAFETY_AZIMUTH_MAX         90.0f
+#define SAFETY_ELEVATION_MIN       0.0f
+#define SAFETY_ELEVATION_MAX       90.0f
+#define SAFETY_GRID_COLUMNS        ((int)((SAFETY_AZIMUTH_MAX - SAFETY_AZIMUTH_MIN) / SAFETY_GRID_STEP_DEG) + 1)
+#define SAFETY_GRID_ROWS           ((int)((SAFETY_ELEVATION_MAX - SAFETY_ELEVATION_MIN) / SAFETY_GRID_STEP_DEG) + 1)
+#define SAFETY_GRID_NODES          (SAFETY_GRID_COLUMNS * SAFETY_GRID_ROWS)
+#define SAFETY_DISTANCE_RESOLUTION 0.5f    // Degrés par unité de la grille
+#define SAFETY_MAX_VERTICES        16      // Sommets par polygone au plus
+
+// === DÉFINITION DES TYPES ===
+
+// Sommet d'un polygone de la fenêtre
+typedef struct {
+  float azimuth;              // Degrés, positif à droite
+  float elevation;            // Degrés
+} SafetyVertex;
+
+// Polygone de la fenêtre
+typedef struct {
+  const SafetyVertex* vertices;
+  uint8_t count;              // 3 à SAFETY_MAX_VERTICES
+  bool keepOut;               // Zone interdite (sinon zone permise)
+} SafetyPolygon;
+
+// Limites hors polygones, lues à chaque vérification (paramètres de l'autopilote)
+typedef struct {
+  float minLineLengthCm;      // Longueur minimale (cm)
+  float maxLineLengthCm;      // Longueur maximale (cm)
+  float maxAltitude;          // Altitude maximale (m)
+} SafetyLimits;
+
+// Limite franchie
+typedef enum {
+  SAFETY_OK = 0,
+  SAFETY_OUTSIDE_WINDOW,      // Hors de la zone permise ou dans une zone interdite
+  SAFETY_LINE_TOO_SHORT,
+  SAFETY_LINE_TOO_LONG,
+  SAFETY_ALTITUDE
+} SafetyViolation;
+
+// Résultat d'une vérification
+typedef struct {
+  bool inside;                // Aucune limite franchie
+  SafetyViolation violation;  // Première limite franchie (fenêtre, longueur, altitude)
+  float boundaryDistance;     // Distance à la limite des polygones (degrés, négative dehors)
+  float inwardAzimuth;        // Direction qui éloigne de la limite (vecteur unitaire)
+  float inwardElevation;
+  float lineMarginCm;         // Marge à la limite de longueur la plus proche (cm, négative dehors)
+  float altitudeMargin;       // Marge à l'altitude maximale (m, négative dehors)
+} SafetyCheck;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Compile la fenêtre par défaut (toute la fenêtre sauf le bas et les bords
+ * où le kite manque de vent pour rester en l'air)
+ * @return true si la compilation a réussi
+ */
+bool safetyEnvelopeInit();
+
+/**
+ * Précalcule la grille des distances signées des polygones
+ * @param polygons Polygones (au moins un polygone permis)
+ * @param count Nombre de polygones
+ * @return false si un polygone est invalide (grille précédente conservée)
+ */
+bool safetyEnvelopeCompile(const SafetyPolygon* polygons, uint8_t count);
+
+/**
+ * Vérifie un point de l'espace azimut / élévation / longueur
+ * @param azimuth Azimut (degrés)
+ * @param elevation Élévation (degrés)
+ * @param lineLengthCm Longueur de ligne (cm)
+ * @param limits Limites de longueur et d'altitude
+ * @param check Résultat
+ */
+void safetyEnvelopeCheck(float azimuth, float elevation, float lineLengthCm,
+                         const SafetyLimits& limits, SafetyCheck* check);
+
+#endif // SAFETY_H
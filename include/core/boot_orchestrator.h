@@ -0,0 +1,111 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Orchestrateur de démarrage (Interface)
+  -----------------------
+
+  Initialisation des modules selon leur graphe de dépendances : les modules
+  indépendants sont initialisés en parallèle sur les deux cœurs et le chemin
+  critique (plus longue chaîne de dépendances) est rapporté.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Chaque Module déclare ses dépendances par Module::dependsOn() et son
+  initialisation par Module::init(). Les fonctions d'initialisation existantes
+  s'adaptent avec InitFunctionModule :
+
+    static InitFunctionModule lcdModule("lcd", initLcd);
+    static InitFunctionModule uiModule("ui", initUi);
+    uiModule.dependsOn("lcd");
+    Module* modules[] = { &lcdModule, &uiModule };
+    bootOrchestratorRun(modules, 2, &report);
+
+  Principales fonctionnalités exposées :
+  - bootOrchestratorRun() : Initialisation parallèle, chronologie et chemin critique
+  - bootOrchestratorPrintReport() : Modules, cœurs, durées et chemin critique
+
+  Contraintes techniques :
+  - Deux exécutants : la tâche appelante sur son cœur et une tâche sur
+    l'autre cœur ; si la tâche ne peut être créée (ou en natif), l'appelant
+    initialise seul les modules dans l'ordre des dépendances
+  - Deux modules partageant une ressource (bus I2C, écran) doivent être reliés
+    par une dépendance pour ne pas s'exécuter simultanément
+  - Un module dont une dépendance a échoué n'est pas initialisé
+  - Au plus BOOT_ORCHESTRATOR_MAX_MODULES modules et MODULE_MAX_DEPENDENCIES
+    dépendances par module (tableaux fixes), sans allocation
+*/
+
+#ifndef BOOT_ORCHESTRATOR_H
+#define BOOT_ORCHESTRATOR_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "module.h"
+
+// === CONSTANTES ===
+#define BOOT_ORCHESTRATOR_MAX_MODULES 16
+
+static_assert(MODULE_MAX_DEPENDENCIES < BOOT_ORCHESTRATOR_MAX_MODULES,
+              "Un module ne peut dépendre que des autres modules du graphe");
+
+// === DÉFINITION DES TYPES ===
+
+// Adaptateur d'une fonction d'initialisation existante en Module
+class InitFunctionModule : public Module {
+public:
+    InitFunctionModule(const char* name, bool (*initFunction)(), const char* description = "")
+        : Module(name), _initFunction(initFunction), _description(description) {}
+    bool init() override { return _initFunction == nullptr || _initFunction(); }
+    const char* description() const override { return _description; }
+private:
+    bool (*_initFunction)();
+    const char* _description;
+};
+
+// Initialisation d'un module
+typedef struct {
+  Module* module;
+  uint32_t startUs;             // micros() au début de init()
+  uint32_t endUs;               // micros() à la fin de init()
+  int8_t core;                  // Cœur d'exécution (-1 : non initialisé)
+  bool ok;                      // init() a réussi (ou module désactivé)
+  bool skipped;                 // Non initialisé : une dépendance a échoué
+} BootInitRecord;
+
+// Rapport d'orchestration
+typedef struct {
+  BootInitRecord records[BOOT_ORCHESTRATOR_MAX_MODULES];  // Dans l'ordre des modules fournis
+  uint8_t count;
+  uint8_t criticalPath[BOOT_ORCHESTRATOR_MAX_MODULES];    // Indices, de la racine à la fin
+  uint8_t criticalLength;
+  uint32_t criticalPathUs;      // Somme des durées du chemin critique
+  uint32_t serialUs;            // Somme de toutes les durées (démarrage séquentiel)
+  uint32_t startUs;             // micros() au début de l'orchestration
+  uint32_t wallUs;              // Durée réelle de l'orchestration
+  uint8_t workers;              // Exécutants utilisés (1 ou 2)
+  uint8_t failures;             // Modules en échec ou non initialisés
+} BootInitReport;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise les modules dans l'ordre de leurs dépendances, en parallèle
+ * lorsque c'est possible
+ * @param modules Modules à initialiser
+ * @param count Nombre de modules
+ * @param report Reçoit la chronologie et le chemin critique
+ * @return false si le graphe est invalide (dépendance inconnue, cycle, trop de
+ *         modules ; rien n'est initialisé), si un module a échoué ou si
+ *         l'initialisation dépasse BOOT_INIT_TIMEOUT_MS
+ */
+bool bootOrchestratorRun(Module* const* modules, int count, BootInitReport* report);
+
+/**
+ * Affiche les modules (cœur, début, durée, état) et le chemin critique
+ * @param report Rapport d'orchestration
+ */
+void bootOrchestratorPrintReport(const BootInitReport* report);
+
+#endif // BOOT_ORCHESTRATOR_H
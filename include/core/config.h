@@ -102,6 +102,11 @@ extern bool moduleWinchEnabled;
 #define SERVER_PORT        80               // Port HTTP du serveur web
 #define WIFI_TIMEOUT_MS    10000            // Durée max (ms) pour se connecter au WiFi
 
+// Télémétrie vers la station sol (format : communication/protocols.h)
+#define TELEMETRY_UNIT_ID         0        // Identifiant du kite, 0 : dérivé de l'adresse MAC
+#define TELEMETRY_UDP_ENABLED     1        // Diffusion UDP sur le réseau WiFi (port TELEMETRY_UDP_PORT)
+#define TELEMETRY_SERIAL_ENABLED  0        // Trames binaires aussi sur le port série, mêlées au journal
+
 // === CONFIGURATION INTERFACE ===
 
 // Caractères spéciaux pour LCD
@@ -138,6 +143,158 @@ extern bool moduleWinchEnabled;
 // Configuration de l'affichage
 #define DISPLAY_UPDATE_THROTTLE    200    // Limite de mise à jour d'affichage (ms)
 
+// Démarrage et calibration persistée
+#define FAST_BOOT_ENABLED          1      // Démarrage rapide si une calibration valide est en NVS
+#define SPLASH_SCREEN_DURATION     2000   // Durée de l'écran d'accueil au démarrage à froid (ms)
+#define CALIBRATION_NVS_NAMESPACE  "kite_calib"  // Espace de noms NVS de la calibration
+
+// Compteurs de vie (utils/lifetime_stats.h)
+#define LIFETIME_NVS_NAMESPACE     "kite_life"   // Espace de noms NVS des compteurs cumulés
+#define LIFETIME_CHECKPOINT_INTERVAL_MS   600000 // Sauvegarde périodique si un compteur a changé (10 min)
+#define LIFETIME_MIN_CHECKPOINT_SPACING_MS 60000 // Écart minimal des sauvegardes sur événement (fin de vol)
+#define LIFETIME_LANDED_HOLD_MS    10000  // Durée au sol (élévation mesurée) avant de clore un vol (ms)
+
+// Enregistrement des sessions de vol
+#ifndef SESSION_STORAGE_ROOT
+#define SESSION_STORAGE_ROOT       "/littlefs/sessions"  // Répertoire des sessions (VFS)
+#endif
+#define SESSION_SAMPLE_INTERVAL    100    // Période d'échantillonnage des sessions (ms)
+#define SESSION_MAX_COUNT          8      // Nombre maximal de sessions conservées
+#define SESSION_OVERVIEW_L0_MS     1000   // Durée d'un seau d'aperçu niveau 0 (ms)
+#define SESSION_OVERVIEW_L1_MS     10000  // Durée d'un seau d'aperçu niveau 1 (ms)
+#define SESSION_OVERVIEW_L2_MS     60000  // Durée d'un seau d'aperçu niveau 2 (ms)
+
+// Mesures de performance (micro-benchmarks)
+#ifndef BENCHMARK_ENABLED
+#define BENCHMARK_ENABLED          0      // Exécute la suite de mesures au démarrage
+#endif
+#ifndef BENCHMARK_UPDATE_BASELINE
+#define BENCHMARK_UPDATE_BASELINE  0      // Remplace la référence par les nouvelles mesures
+#endif
+#define BENCHMARK_BASELINE_PATH    "/littlefs/bench_baseline.txt"  // Référence des mesures (VFS)
+#define BENCHMARK_REGRESSION_PERCENT 10   // Écart de médiane signalé comme régression (%)
+
+// Profilage du démarrage
+#ifndef BOOT_PROFILER_ENABLED
+#define BOOT_PROFILER_ENABLED      1      // Cascade du démarrage et comparaison à la référence
+#endif
+#ifndef BOOT_PROFILE_UPDATE_BASELINE
+#define BOOT_PROFILE_UPDATE_BASELINE 0    // Remplace la référence par le démarrage courant
+#endif
+#define BOOT_PROFILE_BASELINE_PATH "/littlefs/boot_baseline.txt"  // Référence des étapes (VFS)
+#define BOOT_TARGET_MS             1000   // Objectif de durée du démarrage (ms)
+#define BOOT_INIT_TIMEOUT_MS       10000  // Attente maximale de l'initialisation des modules (ms)
+
+// Gestion de l'énergie (vol / au sol)
+#define POWER_FLIGHT_CPU_MHZ       240    // Fréquence CPU en vol (verrou esp_pm tenu)
+#define POWER_IDLE_CPU_MHZ         80     // Fréquence minimale au sol (APB 80 MHz : WiFi conservé)
+#ifndef POWER_LIGHT_SLEEP_ENABLED
+#define POWER_LIGHT_SLEEP_ENABLED  1      // Sommeil léger automatique au sol (tickless idle)
+#endif
+#define POWER_GROUNDED_ELEVATION   10.0f  // Élévation sous laquelle le kite est posé (degrés)
+#define POWER_GROUNDED_HOLD_MS     30000  // Durée au sol, autopilote OFF, avant l'économie d'énergie (ms)
+#define POWER_ELEVATION_MAX_AGE_MS (3 * SESSION_SAMPLE_INTERVAL)  // Âge maximal de l'élévation mesurée (ms)
+#ifndef POWER_CURRENT_SENSE_PIN
+#define POWER_CURRENT_SENSE_PIN    -1     // Entrée ADC d'un capteur de courant (-1 : absent)
+#endif
+#define POWER_CURRENT_SENSE_MV_PER_A  100.0f  // Sensibilité du capteur de courant (mV/A)
+#define POWER_CURRENT_SENSE_OFFSET_MV 0.0f    // Tension du capteur à courant nul (mV)
+
+// Temporisateurs (roue hiérarchique, une roue par tâche)
+#define TIMER_WHEEL_MAX_TIMERS     8      // Temporisateurs armés simultanément par roue
+#define TIMER_WHEEL_MAX_IDLE_MS    1000   // Sommeil maximal d'une tâche sans échéance proche (ms)
+#define SYSTEM_INFO_UPDATE_INTERVAL 1000  // Rafraîchissement des informations système (ms)
+#define WEB_HTML_CACHE_TTL         5000   // Durée de vie de la page HTML en cache (ms)
+#define DASHBOARD_PUBLISH_INTERVAL 200    // Agrégation des trames du tableau de bord (ms)
+
+// Bus de messages (publication/abonnement par sujets)
+#define BUS_POOL_BLOCKS            16     // Blocs de charge utile partagés entre sujets
+#define BUS_BLOCK_SIZE             160    // Taille d'un bloc, au moins celle du plus grand message (octets)
+#define BUS_MAX_SUBSCRIBERS        8      // Abonnés, tous sujets confondus
+#define BUS_RATE_WINDOW_MS         1000   // Fenêtre de calcul du débit par sujet (ms)
+#define BUS_IMU_QUEUE_DEPTH        8      // File des abonnés aux échantillons IMU (100 ms à 50 Hz, plus marge)
+#define IMU_PUBLISH_PERIOD_MS      CONTROL_TASK_PERIOD_MS  // Diffusion des échantillons IMU, au rythme du contrôle (ms)
+
+// Serveur de paramètres (instantanés RCU)
+#define PARAM_SERVER_MAX_READERS   3      // Tâches lectrices par jeu de paramètres
+#define PARAM_SERVER_MAX_SIZE      32     // Taille maximale d'un jeu de paramètres (octets)
+
+// Surveillance de santé (détection des défaillances)
+#define HEALTH_CHECK_INTERVAL      100    // Période de la surveillance de santé (ms)
+#define HEALTH_TASK_TIMEOUT        500    // Tâche considérée bloquée sans battement de cœur (ms)
+#define HEALTH_SENSOR_STUCK_SAMPLES 10    // Lectures identiques consécutives = capteur figé
+#define HEALTH_BUS_FAILURES        3      // Échecs I2C consécutifs = bus en défaut
+#define HEALTH_MIN_FREE_HEAP       16384  // Tas libre minimal avant passage en mode sécurisé (octets)
+#define HEALTH_RECOVERY_INTERVAL   500    // Intervalle entre deux tentatives de récupération (ms)
+
+// Analyse vibratoire (spectre de l'accélération, flottement des lignes, oscillation des servos)
+#define VIBRATION_SAMPLE_RATE_HZ   200    // Lecture de l'accéléromètre par la tâche des capteurs (Hz)
+#define VIBRATION_FFT_SIZE         256    // Échantillons par bloc analysé (puissance de 2)
+#define VIBRATION_HOP              128    // Avance entre deux blocs (recouvrement de moitié)
+#define VIBRATION_RING_SIZE        1024   // Anneau des échantillons (puissance de 2, >= 2 blocs)
+#define VIBRATION_CPU_BUDGET_US    3000   // Temps d'analyse maximal par cycle de surveillance (us)
+#define VIBRATION_ANOMALY_RATIO    4.0f   // Énergie d'une bande / référence apprise = anomalie
+#define VIBRATION_MIN_RMS          0.02f  // Valeur efficace en dessous de laquelle une bande est calme (g)
+#define VIBRATION_ANOMALY_BLOCKS   3      // Blocs anormaux consécutifs avant signalement
+#define VIBRATION_LEARN_BLOCKS     16     // Blocs d'apprentissage de la référence au démarrage
+
+// Prévision des rafales (statistiques du vent, modèle autorégressif)
+#define GUST_SAMPLE_INTERVAL_MS    250    // Période du modèle : moyenne des lectures du vent (ms)
+#define GUST_HORIZON_MS            2000   // Horizon de prévision (ms, multiple de la période)
+#define GUST_MEAN_ALPHA            0.02f  // Poids de la moyenne et de la variance glissantes (~12 s)
+#define GUST_RLS_FORGETTING        0.99f   // Facteur d'oubli de l'ajustement du modèle (~25 s)
+#define GUST_RESIDUAL_ALPHA        0.05f  // Poids de la variance des résidus à un pas
+#define GUST_CONFIDENCE_Z          2.0f   // Demi-largeur de la bande de confiance (écarts types)
+#define GUST_DEVIATION_LIMIT       4.0f   // Écart prévu maximal à la moyenne (écarts types)
+#define GUST_WARMUP_SAMPLES        24     // Échantillons avant la première prévision (6 s)
+#define GUST_DEPOWER_START         0.8f   // Fraction du vent maximal où la réduction de puissance commence
+#define GUST_DEPOWER_ELEVATION     30.0f  // Remontée maximale de la figure en 8 vers le zénith (degrés)
+
+// Plans de vol (interpréteur de code compact, voir control/mission.h)
+#define MISSION_MAX_INSTRUCTIONS_PER_TICK 16  // Instructions exécutées au plus par cycle de contrôle
+
+// Commandes datées (file à priorité, voir control/command_scheduler.h)
+#define COMMAND_SCHEDULER_CAPACITY 32     // Commandes en attente au plus
+#define COMMAND_MAX_HORIZON_MS     600000 // Écart maximal à l'horloge du kite (10 min)
+
+// Bilan énergétique (intégration de la puissance, cycles de pompage, voir control/energy.h)
+#define ENERGY_REEL_SPEED_THRESHOLD 0.25f // Vitesse du treuil au-delà de laquelle une phase change (m/s)
+#define ENERGY_MIN_PHASE_MS        1000   // Durée minimale d'une phase avant de la reconnaître (ms)
+#define ENERGY_MAX_SAMPLE_GAP_MS   1000   // Intervalle au-delà duquel deux échantillons ne sont pas intégrés (ms)
+#define ENERGY_MAX_CYCLE_MS        300000 // Cycle abandonné au-delà (kite posé, treuil à l'arrêt) (ms)
+#define ENERGY_CYCLE_HISTORY       8      // Cycles des statistiques glissantes
+
+// Décollage et atterrissage profilés (courbes en S à jerk limité, voir control/launch_sequencer.h)
+#define LAUNCH_TAKEOFF_ELEVATION   65.0f  // Élévation en fin de décollage (degrés)
+#define LAUNCH_TAKEOFF_REEL_OUT_CM 2000   // Ligne déroulée pendant le décollage (cm)
+#define LAUNCH_ALTITUDE_MARGIN     0.9f   // Fraction de l'altitude maximale visée en fin de décollage
+#define LAUNCH_LANDING_ELEVATION   20.0f  // Élévation en fin d'atterrissage, ligne courte (degrés)
+#define LAUNCH_LANDING_LINE_CM     6000   // Longueur de ligne en fin d'atterrissage (cm)
+#define LAUNCH_ELEVATION_RATE_MAX  8.0f   // Vitesse maximale de l'élévation visée (degrés/s)
+#define LAUNCH_ELEVATION_ACCEL_MAX 6.0f   // Accélération maximale (degrés/s2)
+#define LAUNCH_ELEVATION_JERK_MAX  10.0f  // Jerk maximal (degrés/s3)
+#define LAUNCH_REEL_SPEED_MAX      1.5f   // Vitesse maximale du treuil (m/s)
+#define LAUNCH_REEL_ACCEL_MAX      1.0f   // Accélération maximale du treuil (m/s2)
+#define LAUNCH_REEL_JERK_MAX       2.0f   // Jerk maximal du treuil (m/s3)
+#define LAUNCH_LENGTH_GAIN         0.5f   // Correction du treuil par cm d'écart, en cm/s par cm (1/s)
+#define LAUNCH_MAX_ELEVATION_ERROR 20.0f  // Écart d'élévation toléré au profil (degrés)
+#define LAUNCH_MAX_LENGTH_ERROR_CM 200    // Écart de longueur toléré au profil (cm)
+#define LAUNCH_DEVIATION_MS        1500   // Durée d'un écart avant abandon de la séquence (ms)
+#define LAUNCH_SETTLE_ELEVATION_ERROR 5.0f // Écart d'élévation pour déclarer la séquence achevée (degrés)
+#define LAUNCH_SETTLE_LENGTH_CM    50     // Écart de longueur pour déclarer la séquence achevée (cm)
+#define LAUNCH_SETTLE_MS           8000   // Délai après la fin du profil pour atteindre la cible (ms)
+
+// Enveloppe de vol (polygones de la fenêtre précompilés en grille, voir control/safety.h)
+#define SAFETY_GRID_STEP_DEG       2.0f   // Pas de la grille en azimut et en élévation (degrés)
+#define SAFETY_SOFT_MARGIN_DEG     8.0f   // Distance à la limite où le point visé commence à s'en écarter (degrés)
+#define SAFETY_MIN_LINE_LENGTH_CM  0      // Longueur minimale en vol (cm), 0 : sans capteur de longueur
+
+// Injection de fautes (validation des récupérations)
+#ifndef FAULT_INJECTION_ENABLED
+#define FAULT_INJECTION_ENABLED    0      // Active les points d'injection et le scénario
+#endif
+#define FAULT_INJECTION_SCRIPT_PATH "/littlefs/faults.txt"  // Scénario chargé au démarrage (VFS)
+
 // === CONFIGURATION JOURNALISATION ===
 
 // Niveaux de journalisation
@@ -185,6 +342,7 @@ extern bool moduleWinchEnabled;
 #define LOGGING_TASK_STACK_SIZE   2048    // Tâche pour la journalisation
 #define IMU_TASK_STACK_SIZE       3072    // Tâche pour le capteur IMU
 #define WINCH_TASK_STACK_SIZE     3072    // Tâche pour le treuil
+#define BOOT_INIT_TASK_STACK_SIZE 4096    // Tâche d'initialisation des modules (second cœur)
 
 // Priorités des tâches FreeRTOS (0-24, 24 étant la plus haute)
 #define DISPLAY_TASK_PRIORITY      2      // Priorité tâche affichage
@@ -196,6 +354,17 @@ extern bool moduleWinchEnabled;
 #define LOGGING_TASK_PRIORITY      1      // Priorité tâche journalisation
 #define IMU_TASK_PRIORITY          3      // Priorité tâche IMU
 #define WINCH_TASK_PRIORITY        3      // Priorité tâche treuil
+#define BOOT_INIT_TASK_PRIORITY    1      // Priorité tâche d'initialisation des modules
+
+// Périodes des tâches FreeRTOS
+#define CONTROL_TASK_PERIOD_MS     20     // Tâche de contrôle (50 Hz), pas des commandes datées
+
+// Placement du code chaud en IRAM (core/hot_path.h)
+#define IRAM_HOT_PATH_BUDGET       8192   // Code du projet marqué HOT_PATH (octets, vérifié à la compilation)
+#define HOT_PATH_OVERRUN_PERCENT   150    // Écart entre cycles de contrôle compté comme dépassement (% de la période)
+
+// Instantané des tâches FreeRTOS (utils/task_snapshot.h)
+#define TASK_SNAPSHOT_INTERVAL_MS  2000   // Période de capture par la tâche de surveillance
 
 // Configuration de FreeRTOS
 #define configMAX_TASKS            15     // Nombre max de tâches autorisées
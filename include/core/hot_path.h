@@ -0,0 +1,103 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Placement du code chaud (Interface)
+  -----------------------
+
+  Marquage du code exécuté à chaque cycle de contrôle (placé en IRAM, sans
+  défaut de cache flash) et du code rare (serveur web, gardé en flash),
+  budget IRAM et régularité de la tâche de contrôle.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Marquage des définitions :
+
+    HOT_PATH float pidCompute(PIDParams* pid, float measurement, float dt) { ... }
+    static COLD_PATH void handleApiInfo(AsyncWebServerRequest* request) { ... }
+
+  Tâche de contrôle, autour du travail de chaque cycle :
+
+    uint32_t startUs = micros();
+    ...
+    hotPathRecordControlCycle(startUs, micros());
+
+  Principales fonctionnalités exposées :
+  - HOT_PATH : Fonction rangée en IRAM (IRAM_ATTR, sections .iram1.*)
+  - COLD_PATH : Fonction rare, rangée en flash et optimisée pour la taille
+  - hotPathRecordControlCycle() : Période et durée des cycles de contrôle
+  - hotPathGetReport() / hotPathLogReport() : Occupation IRAM et régularité
+
+  Contraintes techniques :
+  - L'IRAM de l'ESP32 (128 Ko, SOC_IRAM_LOW..SOC_IRAM_HIGH) est partagée
+    avec le framework ; le code du projet marqué HOT_PATH doit tenir dans
+    IRAM_HOT_PATH_BUDGET (vérifié à la compilation par scripts/iram_report.py)
+  - Une écriture en flash (OTA, sessions LittleFS, NVS) suspend le cache des
+    deux cœurs : seules les interruptions IRAM continuent. Le code chaud en
+    IRAM ne recharge aucune ligne de cache après l'écriture et n'est pas
+    évincé par le code du serveur web
+  - Sur l'hôte (NATIVE_BUILD), HOT_PATH est vide et le rapport IRAM est nul
+*/
+
+#ifndef HOT_PATH_H
+#define HOT_PATH_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#ifndef NATIVE_BUILD
+#include <esp_attr.h>
+#endif
+
+// === CONSTANTES ===
+
+#ifdef NATIVE_BUILD
+#define HOT_PATH
+#else
+#define HOT_PATH   IRAM_ATTR
+#endif
+
+#define COLD_PATH  __attribute__((cold))
+
+// === DÉFINITION DES TYPES ===
+
+// Occupation de l'IRAM et régularité de la tâche de contrôle
+typedef struct {
+  uint32_t iramTotal;            // Région IRAM du code (octets)
+  uint32_t iramUsed;             // Code rangé en IRAM (framework et projet)
+  uint32_t iramHeapFree;         // IRAM restante, allouable (MALLOC_CAP_EXEC)
+  uint8_t hotFunctions;          // Fonctions chaudes vérifiées
+  uint8_t hotInIram;             // Dont rangées en IRAM
+  uint32_t cycles;               // Cycles de contrôle mesurés
+  uint32_t maxPeriodUs;          // Plus grand écart entre deux cycles
+  uint32_t maxWorkUs;            // Plus longue durée de travail d'un cycle
+  uint32_t overruns;             // Écarts au-delà de HOT_PATH_OVERRUN_PERCENT de la période
+} HotPathReport;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Enregistre un cycle de la tâche de contrôle
+ * @param startUs Début du travail du cycle (micros())
+ * @param endUs Fin du travail du cycle (micros())
+ */
+void hotPathRecordControlCycle(uint32_t startUs, uint32_t endUs);
+
+/**
+ * Remet à zéro les mesures des cycles (p. ex. au début d'une mise à jour OTA)
+ */
+void hotPathResetControlStats();
+
+/**
+ * Occupation IRAM, placement des fonctions chaudes et régularité des cycles
+ * @return Rapport
+ */
+HotPathReport hotPathGetReport();
+
+/**
+ * Journalise le rapport (démarrage, fin de mise à jour OTA)
+ */
+void hotPathLogReport();
+
+#endif // HOT_PATH_H
@@ -2,6 +2,10 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <stdint.h>
+
+// Dépendances d'initialisation déclarées au plus par module (tableau fixe)
+#define MODULE_MAX_DEPENDENCIES 8
 
 /**
  * Classe de base pour tous les modules dynamiques du système.
@@ -18,7 +22,8 @@ public:
     };
 
     Module(const char* name, bool enabledByDefault = true)
-        : _name(name), _enabled(enabledByDefault), _state(enabledByDefault ? State::MODULE_ENABLED : State::MODULE_DISABLED) {}
+        : _name(name), _enabled(enabledByDefault), _state(enabledByDefault ? State::MODULE_ENABLED : State::MODULE_DISABLED),
+          _dependencyCount(0), _dependencyOverflow(false) {}
 
     virtual ~Module() {}
 
@@ -49,6 +54,33 @@ public:
     // Pour affichage LCD/web : description courte
     virtual const char* description() const { return ""; }
 
+    // Dépendances d'initialisation : modules (par nom) à initialiser avant celui-ci ;
+    // au-delà de MODULE_MAX_DEPENDENCIES, false et le graphe sera refusé
+    bool dependsOn(const char* moduleName) {
+        if (_dependencyCount >= MODULE_MAX_DEPENDENCIES) {
+            _dependencyOverflow = true;
+            return false;
+        }
+        _dependencies[_dependencyCount++] = moduleName;
+        return true;
+    }
+    uint8_t dependencyCount() const { return _dependencyCount; }
+    const char* dependency(uint8_t index) const { return _dependencies[index]; }
+    bool dependencyOverflow() const { return _dependencyOverflow; }
+
+    // Initialisation au démarrage, appelée une seule fois par l'orchestrateur
+    // (éventuellement sur l'autre cœur) ; false = module en erreur
+    virtual bool init() { return true; }
+
+    // Exécute init() en tenant l'état à jour ; un module désactivé n'est pas initialisé
+    bool runInit() {
+        if (!_enabled) return true;
+        _state = State::MODULE_ENABLING;
+        bool ok = init();
+        _state = ok ? State::MODULE_ENABLED : State::MODULE_ERROR;
+        return ok;
+    }
+
 protected:
     // Surchargeable pour actions spécifiques
     virtual void onEnable()  {}
@@ -59,6 +91,9 @@ private:
     const char* _name;
     bool _enabled;
     State _state;
+    const char* _dependencies[MODULE_MAX_DEPENDENCIES];
+    uint8_t _dependencyCount;
+    bool _dependencyOverflow;
 };
 
 /**
@@ -0,0 +1,117 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Gestion de l'énergie (Interface)
+  -----------------------
+
+  Politique d'énergie basée sur esp_pm : pleine vitesse tenue par verrous
+  pendant le vol, fréquence réduite et sommeil léger automatique lorsque
+  l'autopilote est sur OFF et le kite posé.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Principales fonctionnalités exposées :
+  - powerManagerInit() : Configuration esp_pm et verrous de vol
+  - powerManagerEvaluate() : Profil voulu selon le mode et la position du kite
+  - powerManagerApplyProfile() : Prise ou libération des verrous (horloges)
+  - powerManagerRecordCurrent() : Mesure de courant, moyennée par profil
+  - powerManagerPrintReport() : Temps et courant moyen par profil, écart
+
+  Contraintes techniques :
+  - esp_pm n'agit que si le sdkconfig active CONFIG_PM_ENABLE ; le sommeil
+    léger automatique exige en plus CONFIG_FREERTOS_USE_TICKLESS_IDLE. Sans
+    esp_pm, la fréquence est réglée par setCpuFrequencyMhz() sans sommeil
+  - Le passage en vol est immédiat ; le retour au sol n'est accepté qu'après
+    POWER_GROUNDED_HOLD_MS de conditions stables
+  - Le courant est lu sur POWER_CURRENT_SENSE_PIN s'il est câblé, ou fourni
+    par un autre capteur via powerManagerRecordCurrent()
+*/
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "control/autopilot.h"
+
+// === DÉFINITION DES TYPES ===
+
+typedef enum {
+  POWER_PROFILE_FLIGHT = 0,       // Pleine vitesse, pas de sommeil léger
+  POWER_PROFILE_GROUNDED_IDLE,    // Fréquence réduite, sommeil léger automatique
+  POWER_PROFILE_COUNT
+} PowerProfile;
+
+// Statistiques par profil
+typedef struct {
+  PowerProfile profile;
+  bool pmSupported;                           // esp_pm configuré (sinon setCpuFrequencyMhz)
+  bool lightSleep;                            // Sommeil léger automatique autorisé au sol
+  uint32_t transitions;
+  uint32_t timeInProfileMs[POWER_PROFILE_COUNT];
+  float currentSumMa[POWER_PROFILE_COUNT];
+  uint32_t currentSamples[POWER_PROFILE_COUNT];
+} PowerStats;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Configure esp_pm (fréquences, sommeil léger), crée les verrous de vol et
+ * démarre en profil vol
+ * @return true si esp_pm est disponible, false si repli sur setCpuFrequencyMhz()
+ */
+bool powerManagerInit();
+
+/**
+ * Indique si le kite est posé
+ * @param elevation Élévation des lignes (degrés, NAN si inconnue)
+ * @return true sous POWER_GROUNDED_ELEVATION, false si l'élévation est inconnue
+ */
+bool powerManagerIsGrounded(float elevation);
+
+/**
+ * Profil voulu : économie d'énergie après POWER_GROUNDED_HOLD_MS avec
+ * l'autopilote sur OFF et le kite posé, vol dès que l'une des conditions cesse
+ * @param mode Mode de l'autopilote
+ * @param elevation Élévation mesurée des lignes (degrés, NAN si inconnue ou périmée : vol)
+ * @return Profil à appliquer
+ */
+PowerProfile powerManagerEvaluate(AutopilotMode mode, float elevation);
+
+/**
+ * Applique un profil : verrous esp_pm tenus en vol, libérés au sol
+ * @param profile Profil voulu (sans effet s'il est déjà actif)
+ */
+void powerManagerApplyProfile(PowerProfile profile);
+
+/**
+ * Profil actif
+ * @return Profil courant
+ */
+PowerProfile powerManagerGetProfile();
+
+/**
+ * Lit le capteur de courant s'il est câblé (POWER_CURRENT_SENSE_PIN)
+ */
+void powerManagerSampleCurrent();
+
+/**
+ * Ajoute une mesure de courant au profil actif
+ * @param milliamps Courant consommé (mA)
+ */
+void powerManagerRecordCurrent(float milliamps);
+
+/**
+ * Statistiques de consommation
+ * @return Statistiques (temps du profil actif inclus jusqu'à maintenant)
+ */
+PowerStats powerManagerGetStats();
+
+/**
+ * Affiche le temps et le courant moyen de chaque profil et leur écart
+ */
+void powerManagerPrintReport();
+
+#endif // POWER_MANAGER_H
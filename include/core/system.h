@@ -20,6 +20,7 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "../utils/timer_wheel.h"
 #include "../hardware/actuators/servo.h"  // Ajout pour accéder aux fonctions servo
 
 // === CONSTANTES ===
@@ -76,6 +77,9 @@ SystemInfo getSystemInfo();
 // Mettre à jour les informations système
 void updateSystemInfo();
 
+// Programmer le rafraîchissement périodique des informations système
+bool systemScheduleInfoUpdates(TimerWheel* wheel);
+
 // Redémarrer le système avec un délai facultatif
 void systemRestart(unsigned long delayMs = 0);
 
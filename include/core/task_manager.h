@@ -41,16 +41,10 @@
 #include "config.h"
 #include "hardware/io/ui_manager.h"
 #include "communication/wifi_manager.h"
+#include "utils/message_bus.h"
 
 // === STRUCTURES ===
 
-// Structure pour les messages
-typedef struct {
-    uint8_t level;     // Niveau de log
-    char tag[16];      // Tag du message
-    char message[128]; // Contenu du message
-} Message;
-
 // Structure pour les métriques des tâches.
 
 /**
@@ -124,7 +118,6 @@ private:
     TaskStat taskStats[MAX_TASKS];       // Tableau des statistiques des tâches
     
     // Ressources partagées
-    static QueueHandle_t messageQueue;      // File de messages partagée
     static SemaphoreHandle_t displayMutex;  // Mutex pour l'affichage
     static UIManager* uiManager;            // Pointeur vers le gestionnaire d'interface utilisateur
     static WiFiManager* wifiManager;        // Pointeur vers le gestionnaire WiFi
@@ -138,6 +131,13 @@ private:
     static void monitorTask(void* parameters);  // Fonction pour la tâche de surveillance
     static void sensorTask(void* parameters);   // Fonction pour la tâche des capteurs
     
+    // Action de récupération de l'écran (surveillance de santé)
+    static bool recoverDisplay();
+    
+    // Rappels des temporisateurs de la tâche d'affichage (écran protégé par displayMutex)
+    static void onDisplayRefresh(void* context);
+    static void onDisplayCheck(void* context);
+    
 public:
     // Constructeur et destructeur
     TaskManager();  // Constructeur du gestionnaire de tâches
@@ -72,6 +72,9 @@ private:
     // Méthode pour mettre à jour uniquement les caractères modifiés
     void updateLCDDiff();
 
+    // Accès du banc de mesures à updateLCDDiff() (utils/benchmark_suite.cpp)
+    friend struct DisplayBenchmarkAccess;
+
 public:
     // Constructeur et destructeur
     DisplayManager();
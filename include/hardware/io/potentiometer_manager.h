@@ -14,7 +14,8 @@
 #define POTENTIOMETER_MANAGER_H
 
 #include <Arduino.h>
-#include "config.h"  // Fichier de configuration centralisé
+#include "../../core/config.h"  // Fichier de configuration centralisé
+#include "../../utils/timer_wheel.h"
 
 // Constantes pour la gestion des potentiomètres
 #define ADC_RESOLUTION 4095
@@ -44,7 +45,8 @@ class PotentiometerManager {
     void begin();
     
     // Fonctions de lecture des potentiomètres
-    bool updatePotentiometers(); // Modification de void à bool pour correspondre à l'implémentation
+    bool updatePotentiometers(); // Lecture immédiate
+    bool scheduleReads(TimerWheel* wheel); // Lecture périodique (POT_READ_INTERVAL) sur la roue de la tâche
     
     // Vérification de l'initialisation
     bool isInitialized() { return true; }
@@ -64,6 +66,7 @@ class PotentiometerManager {
     // Calibration
     void calibrate();
     void setCalibrationValues(int dirMin, int dirMax, int trimMin, int trimMax, int lengthMin, int lengthMax);
+    bool saveCalibration();  // Persiste les valeurs de calibration en NVS
     
     // Gestion du pilote automatique
     void setAutoPilotMode(bool enabled);
@@ -83,7 +86,7 @@ class PotentiometerManager {
     int lineLengthMin;     // Valeur minimale du potentiomètre de longueur de ligne
     int lineLengthMax;     // Valeur maximale du potentiomètre de longueur de ligne
     
-    unsigned long lastUpdateTime;  // Horodatage de la dernière mise à jour
+    TimerHandle readTimer;         // Temporisateur de lecture périodique
     
     // Variables pour le pilote automatique
     bool autoPilotEnabled;        // État du pilote automatique
@@ -95,6 +98,7 @@ class PotentiometerManager {
     int readPotentiometer(uint8_t pin);  // Lecture d'un potentiomètre
     int applyDeadzone(int value, int center = ADC_RESOLUTION / 2);  // Applique une zone morte
     int smoothValue(int newValue, int oldValue);  // Lissage des valeurs
+    static void onReadTimer(void* context);  // Rappel du temporisateur de lecture
 };
 
 #endif // POTENTIOMETER_MANAGER_H
\ No newline at end of file
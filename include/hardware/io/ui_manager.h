@@ -56,7 +56,7 @@ public:
     ~UIManager();
     
     // Initialisation
-    bool begin();
+    bool begin(bool showSplash = true);
     
     // Gestion de l'affichage
     void clear();
@@ -115,11 +115,8 @@ private:
     bool lastButtonStates[MAX_BUTTONS];
     unsigned long lastDebounceTime[MAX_BUTTONS];
     
-    // Horodatages pour les vérifications périodiques
-    unsigned long lastDisplayUpdate;
-    unsigned long lastButtonCheck;
+    // Les vérifications périodiques sont programmées par les tâches (roue de temporisateurs)
     unsigned long lastButtonCheckTime; // Pour l'anti-rebond des boutons
-    unsigned long lastDisplayCheck;    // Pour la vérification de l'état de l'écran
 };
 
 // Instance globale
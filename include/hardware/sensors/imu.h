@@ -76,6 +76,26 @@ bool imuInit(const IMUConfig* config = nullptr);
  */
 bool imuCalibrate();
 
+/**
+ * Recharge des biais de calibration déjà connus (calibration persistée)
+ * @param gyroBias Biais gyroscope [x, y, z] en deg/s
+ * @param accelBias Biais accéléromètre [x, y, z] en g
+ */
+void imuSetBiases(const float gyroBias[3], const float accelBias[3]);
+
+/**
+ * Obtient les biais de calibration courants
+ * @param gyroBias Tableau recevant les biais gyroscope en deg/s
+ * @param accelBias Tableau recevant les biais accéléromètre en g
+ */
+void imuGetBiases(float gyroBias[3], float accelBias[3]);
+
+/**
+ * Obtient l'état de calibration de l'IMU
+ * @return État de calibration courant
+ */
+IMUCalibrationState imuGetCalibrationState();
+
 /**
  * Lit les données brutes de l'IMU
  * @param data Structure pour stocker les données brutes
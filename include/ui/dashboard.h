@@ -5,6 +5,12 @@
   
   Interface pour le tableau de bord du système Kite PiloteV3.
   
+  Les producteurs (tâches capteurs, réseau, surveillance) écrivent dans un
+  tampon arrière ; dashboardPublish(), appelé à chaque tick d'agrégation,
+  en fait une trame complète numérotée. Les lecteurs ne voient que des
+  trames publiées, jamais une mise à jour à moitié appliquée, et comparent
+  le numéro de trame pour détecter un changement.
+  
   Version: 1.0.0
   Date: 2 mai 2025
   Auteurs: Équipe Kite PiloteV3
@@ -31,7 +37,7 @@ typedef struct {
   // Données kite
   float kiteAltitude;             // Altitude estimée du kite (mètres)
   float kiteSpeed;                // Vitesse estimée du kite (m/s)
-  float kitePower;                // Puissance estimée du kite (watts)
+  float kitePower;                // Puissance mécanique au treuil (watts)
   
   // Données vent
   float windSpeed;                // Vitesse du vent (m/s)
@@ -48,7 +54,7 @@ typedef struct {
   uint32_t totalEnergy;           // Énergie totale générée (watt-heures)
   float currentPower;             // Puissance instantanée (watts)
   float peakPower;                // Puissance maximale atteinte (watts)
-  float efficiency;               // Efficacité (0.0-1.0)
+  float efficiency;               // Rendement de pompage moyen (0.0-1.0, control/energy.h)
   
   // État autopilote
   AutopilotMode autopilotMode;    // Mode de l'autopilote
@@ -61,6 +67,13 @@ typedef struct {
   bool hasError;                  // Présence d'erreur
 } DashboardData;
 
+// Trame publiée du tableau de bord
+typedef struct {
+  uint32_t sequence;              // Numéro de trame (incrémenté à chaque changement publié)
+  uint32_t timestampMs;           // Instant de publication
+  DashboardData data;
+} DashboardFrame;
+
 // Type de mise à jour du tableau de bord
 typedef enum {
   DASH_UPDATE_FULL = 0,           // Mise à jour complète
@@ -87,11 +100,31 @@ bool dashboardInit();
 bool dashboardUpdate(DashboardUpdateType updateType = DASH_UPDATE_FULL);
 
 /**
- * Obtient les données actuelles du tableau de bord
+ * Obtient les données de la dernière trame publiée
  * @return Structure contenant les données du tableau de bord
  */
 DashboardData dashboardGetData();
 
+/**
+ * Publie le tampon arrière comme nouvelle trame (tick d'agrégation)
+ * Un seul appelant : la tâche qui agrège le tableau de bord
+ * @return true si une trame a été publiée, false si rien n'a changé
+ */
+bool dashboardPublish();
+
+/**
+ * Copie la dernière trame publiée, toujours complète et cohérente
+ * @param frame Destination
+ * @return true si une trame est disponible
+ */
+bool dashboardGetFrame(DashboardFrame* frame);
+
+/**
+ * Numéro de la dernière trame publiée (détection de changement)
+ * @return Numéro de trame, 0 avant l'initialisation
+ */
+uint32_t dashboardGetSequence();
+
 /**
  * Met à jour les données système dans le tableau de bord
  * @param uptime Temps depuis le démarrage (secondes)
@@ -149,10 +182,11 @@ bool dashboardUpdateStatus(uint8_t status, const char* message,
                          bool hasWarning = false, bool hasError = false);
 
 /**
- * Génère une représentation JSON des données du tableau de bord
+ * Génère une représentation JSON de la dernière trame publiée
  * @param updateType Type de mise à jour à inclure
+ * @param sequence Numéro de la trame sérialisée (optionnel)
  * @return Chaîne JSON des données
  */
-String dashboardToJson(DashboardUpdateType updateType = DASH_UPDATE_FULL);
+String dashboardToJson(DashboardUpdateType updateType = DASH_UPDATE_FULL, uint32_t* sequence = nullptr);
 
 #endif // DASHBOARD_H
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de micro-benchmarks (Interface)
+  -----------------------
+
+  Mesure du coût des fonctions critiques, sur la cible et sur l'hôte.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Ce fichier définit le banc de mesures utilisé pour chiffrer chaque
+  optimisation de performance.
+
+  Principales fonctionnalités exposées :
+  - benchmarkNow() : Compteur haute résolution (cycles CPU sur la cible, ns sur l'hôte)
+  - benchmarkRun() : Exécution d'un cas de mesure et calcul des statistiques
+  - benchmarkLoadBaseline() / benchmarkSaveBaseline() : Fichier de référence
+  - benchmarkCompare() : Comparaison d'un résultat avec la référence
+  - benchmarkRunSuite() : Suite standard des fonctions critiques du firmware
+
+  Contraintes techniques :
+  - Seule la section run() d'un cas est chronométrée ; prepare() et cleanup()
+    servent à remettre l'état à zéro entre deux itérations
+  - Les statistiques retenues sont la médiane et le 99e centile (robustes aux
+    interruptions et aux préemptions)
+  - Une référence n'est comparable qu'avec des mesures de même unité
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define BENCHMARK_MAX_SAMPLES         512   // Échantillons conservés par cas
+#define BENCHMARK_DEFAULT_ITERATIONS  300   // Itérations si le cas n'en précise pas
+#define BENCHMARK_WARMUP_ITERATIONS   8     // Itérations de chauffe (caches, allocations)
+#define BENCHMARK_NAME_LENGTH         32    // Longueur maximale d'un nom de cas
+#define BENCHMARK_MAX_BASELINE        32    // Entrées maximales d'un fichier de référence
+#define BENCHMARK_MIN_DELTA           20    // Écart absolu de médiane ignoré (bruit de mesure)
+
+// === DÉFINITION DES TYPES ===
+
+// Fonction d'un cas de mesure
+typedef void (*BenchmarkFunction)(void* context);
+
+// Description d'un cas de mesure
+typedef struct {
+  const char* name;              // Nom (identifiant dans la référence)
+  BenchmarkFunction run;         // Section chronométrée
+  BenchmarkFunction prepare;     // Avant chaque itération, non chronométré (optionnel)
+  BenchmarkFunction cleanup;     // Après chaque itération, non chronométré (optionnel)
+  void* context;                 // Contexte transmis aux fonctions
+  uint16_t iterations;           // Nombre d'itérations (0 = valeur par défaut)
+} BenchmarkCase;
+
+// Statistiques d'un cas (unité : benchmarkUnit())
+typedef struct {
+  char name[BENCHMARK_NAME_LENGTH];
+  uint32_t iterations;           // Itérations mesurées
+  uint32_t min;                  // Minimum
+  uint32_t median;               // Médiane
+  uint32_t p99;                  // 99e centile
+  uint32_t max;                  // Maximum
+  uint32_t mean;                 // Moyenne
+} BenchmarkResult;
+
+// Entrée du fichier de référence
+typedef struct {
+  char name[BENCHMARK_NAME_LENGTH];
+  uint32_t median;
+  uint32_t p99;
+} BenchmarkBaselineEntry;
+
+// Verdict de comparaison avec la référence
+typedef enum {
+  BENCH_NEW = 0,                 // Absent de la référence
+  BENCH_UNCHANGED,               // Dans la tolérance
+  BENCH_IMPROVED,                // Plus rapide que la référence
+  BENCH_REGRESSED                // Plus lent que la référence
+} BenchmarkVerdict;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Lit le compteur haute résolution
+ * @return Cycles CPU (cible) ou nanosecondes (hôte), sur 32 bits
+ */
+uint32_t benchmarkNow();
+
+/**
+ * Unité des mesures de cette plateforme
+ * @return "cycles" sur la cible, "ns" sur l'hôte
+ */
+const char* benchmarkUnit();
+
+/**
+ * Exécute un cas de mesure
+ * @param benchCase Cas à mesurer
+ * @param result Structure recevant les statistiques
+ * @return true si succès, false si le cas est invalide
+ */
+bool benchmarkRun(const BenchmarkCase& benchCase, BenchmarkResult* result);
+
+/**
+ * Charge un fichier de référence
+ * @param path Chemin du fichier
+ * @param entries Tableau recevant les entrées
+ * @param maxEntries Taille du tableau
+ * @param unit Unité attendue (nullptr = benchmarkUnit())
+ * @return Nombre d'entrées lues, -1 si le fichier est absent ou d'une autre unité
+ */
+int benchmarkLoadBaseline(const char* path, BenchmarkBaselineEntry* entries, int maxEntries,
+                          const char* unit = nullptr);
+
+/**
+ * Enregistre des résultats comme nouvelle référence
+ * @param path Chemin du fichier
+ * @param results Résultats à enregistrer
+ * @param count Nombre de résultats
+ * @param unit Unité des résultats (nullptr = benchmarkUnit())
+ * @return true si succès
+ */
+bool benchmarkSaveBaseline(const char* path, const BenchmarkResult* results, int count,
+                           const char* unit = nullptr);
+
+/**
+ * Compare un résultat avec la référence (sur la médiane, au-delà de
+ * BENCHMARK_REGRESSION_PERCENT et de BENCHMARK_MIN_DELTA)
+ * @param result Résultat mesuré
+ * @param baseline Entrées de référence
+ * @param baselineCount Nombre d'entrées
+ * @param deltaPercent Écart relatif de la médiane en % (optionnel)
+ * @return Verdict de comparaison
+ */
+BenchmarkVerdict benchmarkCompare(const BenchmarkResult& result, const BenchmarkBaselineEntry* baseline,
+                                  int baselineCount, float* deltaPercent = nullptr);
+
+/**
+ * Affiche un tableau des résultats et de leur écart à la référence
+ * @param results Résultats mesurés
+ * @param count Nombre de résultats
+ * @param baseline Entrées de référence (peut être nullptr)
+ * @param baselineCount Nombre d'entrées de référence
+ * @return Nombre de régressions détectées
+ */
+int benchmarkPrintReport(const BenchmarkResult* results, int count,
+                         const BenchmarkBaselineEntry* baseline, int baselineCount);
+
+/**
+ * Exécute la suite standard (journalisation, LCD, autopilote, erreurs,
+ * pool d'objets, JSON du tableau de bord) et la compare à la référence
+ * @param baselinePath Fichier de référence
+ * @param updateBaseline true pour remplacer la référence par les nouvelles mesures
+ * @return Nombre de régressions détectées, -1 en cas d'erreur
+ */
+int benchmarkRunSuite(const char* baselinePath, bool updateBaseline);
+
+#endif // BENCHMARK_H
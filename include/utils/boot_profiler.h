@@ -0,0 +1,137 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de profilage du démarrage (Interface)
+  -----------------------
+
+  Chronologie des étapes d'initialisation à la microseconde, conservée en
+  mémoire RTC, affichée en cascade et comparée à une référence.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Principales fonctionnalités exposées :
+  - bootProfilerBegin() : Début du démarrage (conserve la chronologie précédente)
+  - bootProfilerStepBegin() / bootProfilerStepEnd() : Étape, imbricable
+  - bootProfilerAddStep() : Étape mesurée ailleurs (initialisation parallèle)
+  - bootProfilerFinish() : Fin du démarrage
+  - bootProfilerPrintWaterfall() : Cascade des étapes
+  - bootProfilerCompareBaseline() : Régressions par étape et totale
+
+  Contraintes techniques :
+  - La chronologie est en RTC_NOINIT_ATTR : elle survit à un redémarrage
+    logiciel ou du chien de garde, ce qui désigne l'étape où un démarrage
+    s'est bloqué. Elle est invalide après une mise sous tension (nombre magique)
+  - Temps en µs depuis le lancement de l'application (micros()) : le
+    chargeur de démarrage n'est pas compté
+  - Appelé par une seule tâche (tâche d'initialisation), sans allocation ;
+    les étapes exécutées sur l'autre cœur sont ajoutées après coup
+  - La référence utilise le format des micro-benchmarks (unité "us")
+*/
+
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define BOOT_PROFILER_MAX_STEPS    32
+#define BOOT_PROFILER_NAME_LENGTH  20
+#define BOOT_PROFILER_BAR_WIDTH    40    // Largeur de la cascade (caractères)
+#define BOOT_PROFILER_NO_STEP      0xFF  // Étape refusée (chronologie pleine)
+#define BOOT_PROFILER_MIN_DELTA_US 1000  // Écart absolu ignoré par la comparaison (gigue du démarrage)
+
+// === DÉFINITION DES TYPES ===
+
+// Étape d'initialisation
+typedef struct {
+  char name[BOOT_PROFILER_NAME_LENGTH];
+  uint32_t startUs;             // Début (µs depuis le lancement)
+  uint32_t endUs;               // Fin (µs depuis le lancement)
+  uint8_t depth;                // Niveau d'imbrication
+  bool finished;                // false : étape inachevée (démarrage interrompu)
+} BootStep;
+
+// Chronologie d'un démarrage
+typedef struct {
+  uint32_t magic;
+  uint32_t bootCount;           // Démarrages depuis la mise sous tension
+  uint32_t totalUs;             // Durée totale (0 tant que le démarrage n'est pas terminé)
+  uint8_t stepCount;
+  uint8_t openDepth;            // Étapes ouvertes
+  bool complete;
+  BootStep steps[BOOT_PROFILER_MAX_STEPS];
+} BootTimeline;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Démarre une nouvelle chronologie ; la précédente (si valide) reste
+ * consultable par bootProfilerGetPreviousTimeline()
+ */
+void bootProfilerBegin();
+
+/**
+ * Ouvre une étape (imbriquée dans l'étape ouverte courante)
+ * @param name Nom de l'étape (tronqué à BOOT_PROFILER_NAME_LENGTH - 1)
+ * @return Identifiant à passer à bootProfilerStepEnd(), BOOT_PROFILER_NO_STEP si pleine
+ */
+uint8_t bootProfilerStepBegin(const char* name);
+
+/**
+ * Ferme une étape
+ * @param step Identifiant renvoyé par bootProfilerStepBegin()
+ */
+void bootProfilerStepEnd(uint8_t step);
+
+/**
+ * Ajoute une étape déjà mesurée (p. ex. exécutée sur l'autre cœur),
+ * imbriquée dans l'étape ouverte courante
+ * @param name Nom de l'étape
+ * @param startUs Début (micros())
+ * @param endUs Fin (micros())
+ */
+void bootProfilerAddStep(const char* name, uint32_t startUs, uint32_t endUs);
+
+/**
+ * Termine la chronologie (durée totale)
+ */
+void bootProfilerFinish();
+
+/**
+ * Chronologie du démarrage courant
+ * @return Chronologie (jamais nullptr)
+ */
+const BootTimeline* bootProfilerGetTimeline();
+
+/**
+ * Chronologie du démarrage précédent (avant le dernier redémarrage à chaud)
+ * @return Chronologie, nullptr si aucune n'était conservée
+ */
+const BootTimeline* bootProfilerGetPreviousTimeline();
+
+/**
+ * Nom de l'étape dans laquelle un démarrage s'est arrêté
+ * @param timeline Chronologie
+ * @return Nom de la dernière étape inachevée, nullptr si le démarrage est complet
+ */
+const char* bootProfilerStalledStep(const BootTimeline* timeline);
+
+/**
+ * Affiche la cascade des étapes (début, durée, barre proportionnelle)
+ * @param timeline Chronologie
+ */
+void bootProfilerPrintWaterfall(const BootTimeline* timeline);
+
+/**
+ * Compare chaque étape et la durée totale avec la référence
+ * @param timeline Chronologie terminée
+ * @param baselinePath Fichier de référence
+ * @param updateBaseline true pour remplacer la référence
+ * @return Nombre de régressions (étapes ou total), -1 si la chronologie est incomplète
+ */
+int bootProfilerCompareBaseline(const BootTimeline* timeline, const char* baselinePath, bool updateBaseline);
+
+#endif // BOOT_PROFILER_H
@@ -0,0 +1,102 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de stockage des données (Interface)
+  -----------------------
+
+  Interface de persistance des données de calibration en mémoire non volatile (NVS).
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Ce fichier définit l'interface de sauvegarde et de chargement des résultats
+  de calibration (potentiomètres, biais IMU, trims des servomoteurs).
+
+  Principales fonctionnalités exposées :
+  - dataStorageInit() : Ouverture de l'espace de noms NVS
+  - dataStorageLoadCalibration() : Chargement et validation (magic, version, CRC32)
+  - dataStorageSaveCalibration() : Calcul du CRC32 puis écriture en NVS
+  - dataStorageInvalidateCalibration() : Effacement (force une recalibration)
+
+  Contraintes techniques :
+  - La structure CalibrationData est écrite telle quelle : toute modification
+    de son contenu doit incrémenter CALIBRATION_DATA_VERSION
+  - Un bloc dont le CRC ne correspond pas est considéré comme absent
+*/
+
+#ifndef DATA_STORAGE_H
+#define DATA_STORAGE_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define CALIBRATION_DATA_MAGIC    0x4B43414C  // "KCAL"
+#define CALIBRATION_DATA_VERSION  1           // Version du format de la structure
+
+// Indicateurs des parties de calibration présentes dans le bloc
+#define CALIB_FLAG_POTS    0x01   // Min/max des potentiomètres
+#define CALIB_FLAG_IMU     0x02   // Biais gyroscope/accéléromètre
+#define CALIB_FLAG_SERVOS  0x04   // Trims des servomoteurs (réservé : aucun pilote ne les applique)
+
+// === DÉFINITION DES TYPES ===
+
+// Bloc de calibration persisté (l'ordre des champs fixe le format en NVS)
+typedef struct {
+  uint32_t magic;            // CALIBRATION_DATA_MAGIC
+  uint16_t version;          // CALIBRATION_DATA_VERSION
+  uint16_t flags;            // Combinaison de CALIB_FLAG_*
+  int16_t potMin[3];         // Min ADC [direction, trim, longueur]
+  int16_t potMax[3];         // Max ADC [direction, trim, longueur]
+  float gyroBias[3];         // Biais gyroscope [x, y, z] en deg/s
+  float accelBias[3];        // Biais accéléromètre [x, y, z] en g
+  int8_t servoTrim[3];       // Décalage neutre des servos [direction, trim, modulation] en degrés (réservé)
+  uint8_t reserved;          // Alignement
+  uint32_t crc;              // CRC32 de tous les champs précédents
+} CalibrationData;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise le stockage persistant
+ * @return true si la NVS est accessible, false sinon
+ */
+bool dataStorageInit();
+
+/**
+ * Remplit une structure de calibration avec les valeurs par défaut (plage ADC complète, biais nuls)
+ * @param data Structure à remplir
+ */
+void dataStorageDefaultCalibration(CalibrationData* data);
+
+/**
+ * Charge la calibration persistée
+ * @param data Structure recevant les données (non modifiée en cas d'échec)
+ * @return true si un bloc valide (magic, version et CRC corrects) a été chargé
+ */
+bool dataStorageLoadCalibration(CalibrationData* data);
+
+/**
+ * Sauvegarde la calibration (magic, version et CRC sont renseignés ici)
+ * @param data Données à sauvegarder
+ * @return true si succès, false si échec d'écriture
+ */
+bool dataStorageSaveCalibration(CalibrationData* data);
+
+/**
+ * Efface la calibration persistée, le prochain démarrage sera un démarrage à froid
+ * @return true si succès, false sinon
+ */
+bool dataStorageInvalidateCalibration();
+
+/**
+ * Calcule un CRC32 (polynôme IEEE 802.3, réfléchi)
+ * @param data Données
+ * @param length Taille en octets
+ * @param crc Valeur initiale (pour un calcul incrémental)
+ * @return CRC32 calculé
+ */
+uint32_t dataStorageCrc32(const void* data, size_t length, uint32_t crc = 0);
+
+#endif // DATA_STORAGE_H
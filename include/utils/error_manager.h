@@ -87,6 +87,21 @@ struct ErrorDetails {
     bool resolved;                  // L'erreur a-t-elle été résolue?
 };
 
+/**
+ * Action de récupération fournie par le module propriétaire d'un composant
+ * @param code Code d'erreur à traiter
+ * @param strategy Stratégie configurée pour ce code
+ * @return true si le composant est de nouveau opérationnel (l'erreur est résolue)
+ */
+typedef bool (*RecoveryHandler)(ErrorCode code, RecoveryStrategy strategy);
+
+/**
+ * Observateur des erreurs (signalement et résolution), pour la mesure des
+ * latences de détection et de récupération
+ * @param error Erreur signalée ou résolue (error.resolved distingue les deux)
+ */
+typedef void (*ErrorObserver)(const ErrorDetails& error);
+
 /**
  * Gestionnaire d'erreurs centralisé
  * Implémente un pattern Singleton pour assurer une instance unique
@@ -105,8 +120,11 @@ private:
     // Mutex pour la protection des accès concurrents
     SemaphoreHandle_t errorMutex;
     
+    // Nombre de codes d'erreur indexables (jusqu'au dernier code défini)
+    static const int ERROR_CODE_COUNT = static_cast<int>(ErrorCode::MUTEX_ERROR) + 1;
+    
     // Compteur d'erreurs par code
-    uint32_t errorCounts[static_cast<int>(ErrorCode::TASK_CREATION_ERROR) + 1];
+    uint32_t errorCounts[ERROR_CODE_COUNT];
     
     // Callback pour les erreurs critiques
     void (*criticalErrorCallback)(const ErrorDetails& error);
@@ -115,7 +133,13 @@ private:
     ErrorManager();
     
     // Stratégies de récupération pour chaque code d'erreur
-    RecoveryStrategy recoveryStrategies[static_cast<int>(ErrorCode::TASK_CREATION_ERROR) + 1];
+    RecoveryStrategy recoveryStrategies[ERROR_CODE_COUNT];
+    
+    // Actions de récupération enregistrées par les modules (nullptr = aucune)
+    RecoveryHandler recoveryHandlers[ERROR_CODE_COUNT];
+    
+    // Observateur des signalements et résolutions (nullptr = aucun)
+    ErrorObserver errorObserver;
 
     std::map<ErrorCode, std::string> errorMessages;
 
@@ -161,6 +185,27 @@ public:
      */
     void setRecoveryStrategy(ErrorCode code, RecoveryStrategy strategy);
     
+    /**
+     * Enregistre l'action de récupération d'un code d'erreur. Sans action,
+     * la stratégie est seulement journalisée et l'erreur considérée résolue.
+     * @param code Code d'erreur
+     * @param handler Action de récupération (nullptr pour la retirer)
+     */
+    void setRecoveryHandler(ErrorCode code, RecoveryHandler handler);
+    
+    /**
+     * Définit l'observateur appelé à chaque signalement et à chaque résolution
+     * @param observer Fonction à appeler (nullptr pour le retirer)
+     */
+    void setErrorObserver(ErrorObserver observer);
+    
+    /**
+     * Relance la récupération des erreurs non résolues qui ont une action
+     * enregistrée (une tentative par code)
+     * @return Nombre d'erreurs résolues par cet appel
+     */
+    int processPendingRecoveries();
+    
     /**
      * Définit un callback pour les erreurs critiques
      * @param callback Fonction à appeler lors d'une erreur critique
@@ -180,6 +225,12 @@ public:
      */
     uint32_t getErrorCount(ErrorCode code);
     
+    /**
+     * Récupère le nombre total d'erreurs signalées depuis le démarrage
+     * @return Somme des occurrences de tous les codes
+     */
+    uint32_t getTotalErrorCount();
+    
     /**
      * Marque une erreur comme résolue
      * @param code Code d'erreur à marquer comme résolu
@@ -0,0 +1,192 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module d'injection de fautes (Interface)
+  -----------------------
+
+  Injection scénarisée de fautes (NAK I2C, capteur figé ou bruité, tâche
+  bloquée, tas épuisé) et mesure des latences de détection et de récupération.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Un scénario est une liste d'événements, une ligne par événement :
+
+    # temps(ms) type cible durée(ms) [amplitude]
+    2000  i2c_nak 0x27    1500
+    5000  stuck   imu     2000
+    9000  noise   imu     2000  30
+    12000 stall   control 800
+    15000 heap    -       3000  8192
+
+  Types : i2c_nak (cible : adresse), stuck et noise (imu, line, wind ;
+  amplitude = écart-type du bruit), stall (control, sensor), heap (amplitude =
+  tas libre restant en octets). Les temps sont relatifs à faultInjectionStart().
+
+  Les modules appellent les points d'injection par les macros FAULT_* qui
+  disparaissent lorsque FAULT_INJECTION_ENABLED vaut 0. Un observateur du
+  ErrorManager date la première détection du canal de santé correspondant
+  après l'injection et sa résolution après la fin de la faute.
+
+  Principales fonctionnalités exposées :
+  - faultInjectionParseScript() / faultInjectionLoadScript() : Scénario
+  - faultInjectionUpdate() : Activation et fin des fautes selon l'horloge
+  - faultInjectionPrintReport() : Latences de détection et de récupération
+
+  Contraintes techniques :
+  - Au plus FAULT_INJECTION_MAX_EVENTS événements, aucune allocation hors
+    faute de tas
+  - faultInjectionUpdate() est appelé par la tâche de surveillance
+*/
+
+#ifndef FAULT_INJECTION_H
+#define FAULT_INJECTION_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "health_monitor.h"
+
+// === CONSTANTES ===
+#define FAULT_INJECTION_MAX_EVENTS  16
+#define FAULT_HEAP_BLOCK_SIZE       1024  // Taille des blocs réservés par une faute de tas (octets)
+#define FAULT_HEAP_MAX_BLOCKS       256
+
+// === DÉFINITION DES TYPES ===
+
+typedef enum {
+  FAULT_I2C_NAK = 0,            // Le périphérique ne répond plus
+  FAULT_SENSOR_STUCK,           // Le capteur renvoie sa dernière valeur
+  FAULT_SENSOR_NOISE,           // Bruit gaussien ajouté à la lecture
+  FAULT_TASK_STALL,             // La tâche cesse de progresser
+  FAULT_HEAP_EXHAUSTION         // Le tas libre tombe à l'amplitude demandée
+} FaultType;
+
+typedef enum {
+  FAULT_SENSOR_IMU = 0,
+  FAULT_SENSOR_LINE_LENGTH,
+  FAULT_SENSOR_WIND,
+  FAULT_SENSOR_COUNT
+} FaultSensor;
+
+typedef enum {
+  FAULT_TASK_CONTROL = 0,
+  FAULT_TASK_SENSOR,
+  FAULT_TASK_COUNT
+} FaultTask;
+
+// Événement du scénario et mesures associées
+typedef struct {
+  uint32_t startTime;           // Début relatif au démarrage du scénario (ms)
+  uint32_t duration;            // Durée de la faute (ms)
+  FaultType type;
+  uint8_t target;               // Adresse I2C, FaultSensor ou FaultTask
+  float amplitude;
+  HealthChannel channel;        // Canal censé détecter la faute (HEALTH_CHANNEL_COUNT si aucun)
+
+  bool active;
+  bool done;
+  bool detected;
+  bool recovered;
+  unsigned long injectedAt;     // millis() à l'injection
+  unsigned long clearedAt;      // millis() à la fin de la faute
+  unsigned long detectedAt;     // Premier signalement du canal après l'injection
+  unsigned long recoveredAt;    // Résolution du canal après la fin de la faute
+} FaultEvent;
+
+// === POINTS D'INJECTION ===
+#if FAULT_INJECTION_ENABLED
+#define FAULT_I2C_NAK_ACTIVE(address)            faultI2cNak(address)
+#define FAULT_FILTER_SENSOR(sensor, axis, value) faultFilterSensor(sensor, axis, value)
+#define FAULT_TASK_STALLED(task)                 faultTaskStalled(task)
+#else
+#define FAULT_I2C_NAK_ACTIVE(address)            false
+#define FAULT_FILTER_SENSOR(sensor, axis, value) (value)
+#define FAULT_TASK_STALLED(task)                 false
+#endif
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Vide le scénario, libère une éventuelle faute de tas et installe
+ * l'observateur du ErrorManager
+ */
+void faultInjectionInit();
+
+/**
+ * Ajoute un événement au scénario
+ * @param type Type de faute
+ * @param target Adresse I2C, FaultSensor ou FaultTask
+ * @param startTime Début relatif au démarrage du scénario (ms)
+ * @param duration Durée (ms)
+ * @param amplitude Écart-type du bruit ou tas libre restant
+ * @return true si l'événement a été ajouté
+ */
+bool faultInjectionAdd(FaultType type, uint8_t target, uint32_t startTime, uint32_t duration, float amplitude);
+
+/**
+ * Ajoute les événements d'un scénario texte
+ * @param text Scénario (une ligne par événement, # pour les commentaires)
+ * @return Nombre d'événements ajoutés, -1 si une ligne est invalide
+ */
+int faultInjectionParseScript(const char* text);
+
+/**
+ * Charge un scénario depuis un fichier
+ * @param path Chemin (VFS sur la cible)
+ * @return Nombre d'événements ajoutés, -1 si le fichier est absent ou invalide
+ */
+int faultInjectionLoadScript(const char* path);
+
+/**
+ * Démarre le scénario (origine des temps des événements)
+ */
+void faultInjectionStart();
+
+/**
+ * Active et termine les fautes selon l'horloge
+ */
+void faultInjectionUpdate();
+
+/**
+ * Indique si des fautes restent à injecter ou sont en cours
+ * @return true si le scénario n'est pas terminé
+ */
+bool faultInjectionIsRunning();
+
+/**
+ * NAK forcé sur une adresse I2C
+ * @param address Adresse du périphérique
+ * @return true si la transaction doit échouer
+ */
+bool faultI2cNak(uint8_t address);
+
+/**
+ * Applique les fautes actives à une lecture de capteur
+ * @param sensor Capteur
+ * @param axis Composante de la lecture (0 à 2)
+ * @param value Valeur lue
+ * @return Valeur éventuellement figée ou bruitée
+ */
+float faultFilterSensor(FaultSensor sensor, uint8_t axis, float value);
+
+/**
+ * Indique si une tâche doit rester bloquée
+ * @param task Tâche
+ * @return true tant que la faute est active
+ */
+bool faultTaskStalled(FaultTask task);
+
+/**
+ * Accès aux événements et à leurs mesures
+ * @param events Reçoit le tableau des événements
+ * @return Nombre d'événements
+ */
+int faultInjectionGetEvents(const FaultEvent** events);
+
+/**
+ * Affiche les latences de détection et de récupération de chaque faute
+ */
+void faultInjectionPrintReport();
+
+#endif // FAULT_INJECTION_H
@@ -0,0 +1,134 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compression Gorilla des échantillons (Interface)
+  -----------------------
+
+  Compression sans perte de séries d'échantillons horodatés à plusieurs
+  canaux flottants, dans un bloc de taille fixe : delta de delta pour les
+  horodatages, XOR avec la valeur précédente pour chaque canal.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Encodage dans un bloc, puis décodage (firmware ou station sol) :
+
+    GorillaEncoder encoder;
+    gorillaEncoderInit(&encoder, block, sizeof(block), SESSION_CHANNEL_COUNT);
+    if (!gorillaEncoderAppend(&encoder, sample.timestampMs, sample.values)) {
+      // Bloc plein : l'écrire, puis recommencer un bloc avec cet échantillon
+    }
+
+    GorillaDecoder decoder;
+    gorillaDecoderInit(&decoder, block, gorillaEncoderSize(&encoder), channels, count);
+    while (gorillaDecoderNext(&decoder, &timestampMs, values)) { ... }
+
+  Principales fonctionnalités exposées :
+  - gorillaEncoderAppend() : Ajout d'un échantillon s'il tient dans le bloc
+  - gorillaDecoderNext() : Échantillon suivant d'un bloc
+
+  Codage (bits de poids fort en premier) :
+  - Premier échantillon du bloc : horodatage et valeurs sur 32 bits
+  - Horodatage : delta de delta D, '0' si nul, sinon '10' + 7 bits,
+    '110' + 9 bits, '1110' + 12 bits ou '1111' + 32 bits (complément à deux)
+  - Valeur : XOR X avec la précédente, '0' si nul ; '10' + bits utiles si
+    X tient dans la fenêtre (zéros de tête et de queue) du canal, sinon
+    '11' + 5 bits de zéros de tête + 5 bits de longueur - 1 + bits utiles
+
+  Contraintes techniques :
+  - Chaque bloc se décode seul (l'état repart du premier échantillon)
+  - Un ajout refusé laisse le bloc intact : la place est vérifiée avant
+    l'écriture pour le pire cas (36 + 44 bits par canal)
+  - Sans dépendance Arduino : compilé aussi par la station sol
+*/
+
+#ifndef GORILLA_H
+#define GORILLA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// === CONSTANTES ===
+#define GORILLA_MAX_CHANNELS   16
+
+// === DÉFINITION DES TYPES ===
+
+// État de l'encodeur d'un bloc
+typedef struct {
+  uint8_t* buffer;
+  size_t capacityBits;
+  size_t bitCount;                            // Bits écrits
+  uint16_t count;                             // Échantillons du bloc
+  uint8_t channels;
+  uint32_t previousTs;
+  uint32_t previousDelta;
+  uint32_t previousBits[GORILLA_MAX_CHANNELS];
+  uint8_t leading[GORILLA_MAX_CHANNELS];      // Fenêtre courante de chaque canal
+  uint8_t trailing[GORILLA_MAX_CHANNELS];
+} GorillaEncoder;
+
+// État du décodeur d'un bloc
+typedef struct {
+  const uint8_t* buffer;
+  size_t lengthBits;
+  size_t bitCount;                            // Bits lus
+  uint16_t remaining;                         // Échantillons restants
+  uint16_t decoded;
+  uint8_t channels;
+  bool error;                                 // Bloc tronqué ou corrompu
+  uint32_t previousTs;
+  uint32_t previousDelta;
+  uint32_t previousBits[GORILLA_MAX_CHANNELS];
+  uint8_t leading[GORILLA_MAX_CHANNELS];
+  uint8_t trailing[GORILLA_MAX_CHANNELS];
+} GorillaDecoder;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Démarre un bloc vide (le tampon est remis à zéro)
+ * @param encoder Encodeur
+ * @param buffer Bloc de destination
+ * @param capacity Taille du bloc (octets)
+ * @param channels Canaux par échantillon (au plus GORILLA_MAX_CHANNELS)
+ */
+void gorillaEncoderInit(GorillaEncoder* encoder, uint8_t* buffer, size_t capacity, uint8_t channels);
+
+/**
+ * Ajoute un échantillon au bloc
+ * @param encoder Encodeur
+ * @param timestampMs Horodatage (non décroissant dans le bloc)
+ * @param values Valeurs des canaux
+ * @return false si le bloc est plein (rien n'est écrit)
+ */
+bool gorillaEncoderAppend(GorillaEncoder* encoder, uint32_t timestampMs, const float* values);
+
+/**
+ * Taille utile du bloc
+ * @param encoder Encodeur
+ * @return Octets occupés (dernier octet partiel compris)
+ */
+size_t gorillaEncoderSize(const GorillaEncoder* encoder);
+
+/**
+ * Prépare la lecture d'un bloc
+ * @param decoder Décodeur
+ * @param buffer Bloc encodé
+ * @param length Octets utiles du bloc
+ * @param channels Canaux par échantillon
+ * @param count Nombre d'échantillons du bloc
+ */
+void gorillaDecoderInit(GorillaDecoder* decoder, const uint8_t* buffer, size_t length,
+                        uint8_t channels, uint16_t count);
+
+/**
+ * Décode l'échantillon suivant
+ * @param decoder Décodeur
+ * @param timestampMs Horodatage décodé
+ * @param values Valeurs décodées (channels valeurs)
+ * @return false en fin de bloc ou si le bloc est corrompu (decoder->error)
+ */
+bool gorillaDecoderNext(GorillaDecoder* decoder, uint32_t* timestampMs, float* values);
+
+#endif // GORILLA_H
@@ -0,0 +1,140 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de surveillance de santé (Interface)
+  -----------------------
+
+  Détection des défaillances (tâches bloquées, capteurs figés ou bruités,
+  bus I2C muet, tas épuisé) et déclenchement des récupérations.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Chaque composant surveillé est un canal. Les modules alimentent les canaux
+  (battement de cœur, lecture capteur, résultat d'une transaction I2C) ;
+  healthMonitorUpdate() vérifie les délais et le tas. Une défaillance est
+  signalée au ErrorManager avec la stratégie du canal (RETRY, REINITIALIZE,
+  SAFE_MODE) ; le retour à la normale résout l'erreur.
+
+  Principales fonctionnalités exposées :
+  - healthMonitorInit() : Stratégies et actions de récupération du ErrorManager
+  - healthMonitorHeartbeat() : Battement de cœur d'une tâche
+  - healthMonitorCheckSensor() : Vraisemblance d'une lecture (figée, saut)
+  - healthMonitorRearmSensor() : Reprise des lectures après une interruption
+  - healthMonitorReportBus() : Résultat d'une transaction sur un bus
+  - healthMonitorReportCondition() : État d'un composant jugé par son module
+  - healthMonitorUpdate() : Délais des tâches, tas libre, récupérations en attente
+  - healthMonitorSetRecoveryAction() : Action d'un module pour son canal
+
+  Contraintes techniques :
+  - Un canal n'est alimenté que par une seule tâche ; healthMonitorUpdate()
+    est appelé par la tâche de surveillance
+  - Une tâche n'est surveillée qu'après son premier battement de cœur
+  - Aucune allocation dynamique
+*/
+
+#ifndef HEALTH_MONITOR_H
+#define HEALTH_MONITOR_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define HEALTH_PLAUSIBLE_SAMPLES 5    // Lectures vraisemblables consécutives pour déclarer un capteur rétabli
+#define HEALTH_HEAP_HYSTERESIS   4096 // Marge au-dessus du seuil pour déclarer le tas rétabli (octets)
+
+// === DÉFINITION DES TYPES ===
+
+// Composants surveillés
+typedef enum {
+  HEALTH_TASK_CONTROL = 0,      // Tâche de contrôle (battement de cœur)
+  HEALTH_TASK_SENSOR,           // Tâche des capteurs (battement de cœur)
+  HEALTH_SENSOR_IMU,            // IMU (élévation)
+  HEALTH_SENSOR_LINE_LENGTH,    // Longueur de ligne
+  HEALTH_SENSOR_WIND,           // Anémomètre
+  HEALTH_BUS_DISPLAY,           // Écran LCD sur le bus I2C
+  HEALTH_HEAP,                  // Tas libre
+  HEALTH_VIBRATION,             // Vibrations de la structure (analyse spectrale)
+  HEALTH_CHANNEL_COUNT
+} HealthChannel;
+
+// Action de récupération propre à un module (true si l'action a abouti)
+typedef bool (*HealthRecoveryAction)();
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Remet les canaux à l'état sain et configure le ErrorManager (stratégie et
+ * action de récupération de chaque code surveillé). Les actions enregistrées
+ * par les modules sont conservées.
+ */
+void healthMonitorInit();
+
+/**
+ * Enregistre l'action exécutée lors des tentatives de récupération d'un canal
+ * @param channel Canal concerné
+ * @param action Action du module (nullptr pour la retirer)
+ */
+void healthMonitorSetRecoveryAction(HealthChannel channel, HealthRecoveryAction action);
+
+/**
+ * Signale qu'une tâche surveillée est vivante
+ * @param channel Canal de la tâche
+ */
+void healthMonitorHeartbeat(HealthChannel channel);
+
+/**
+ * Vérifie la vraisemblance d'une lecture de capteur : valeur identique trop
+ * longtemps (capteur figé) ou saut supérieur à la variation physique maximale
+ * @param channel Canal du capteur
+ * @param value Valeur lue
+ * @return true si le capteur est considéré sain
+ */
+bool healthMonitorCheckSensor(HealthChannel channel, float value);
+
+/**
+ * Oublie la dernière lecture d'un capteur dont la surveillance a été
+ * interrompue : la lecture suivante sert de référence, sans saut ni valeur
+ * figée constatés par rapport à l'ancienne. Une défaillance en cours est conservée.
+ * @param channel Canal du capteur
+ */
+void healthMonitorRearmSensor(HealthChannel channel);
+
+/**
+ * Signale le résultat d'une transaction sur un bus
+ * @param channel Canal du périphérique
+ * @param success true si le périphérique a répondu (ACK)
+ */
+void healthMonitorReportBus(HealthChannel channel, bool success);
+
+/**
+ * Signale l'état d'un composant dont le module fait lui-même le diagnostic
+ * (hystérésis comprise) : seules les transitions sont rapportées
+ * @param channel Canal du composant
+ * @param nominal true si le composant fonctionne normalement
+ * @param description Cause de la défaillance
+ */
+void healthMonitorReportCondition(HealthChannel channel, bool nominal, const char* description);
+
+/**
+ * Vérifie les délais des tâches et le tas libre, puis relance les
+ * récupérations en attente (au plus toutes les HEALTH_RECOVERY_INTERVAL ms)
+ */
+void healthMonitorUpdate();
+
+/**
+ * Indique si un canal est sain
+ * @param channel Canal
+ * @return true si aucune défaillance n'est en cours
+ */
+bool healthMonitorIsHealthy(HealthChannel channel);
+
+/**
+ * Nom d'un canal (module rapporté au ErrorManager)
+ * @param channel Canal
+ * @return Nom constant
+ */
+const char* healthMonitorChannelName(HealthChannel channel);
+
+#endif // HEALTH_MONITOR_H
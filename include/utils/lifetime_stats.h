@@ -0,0 +1,109 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compteurs de vie (Interface)
+  -----------------------
+
+  Compteurs cumulés sur toute la vie du kite (démarrages, temps de
+  fonctionnement et de vol, énergie produite, erreurs, pires temps de la
+  boucle de contrôle), tenus en RAM et sauvegardés en NVS à un rythme
+  compatible avec l'usure de la flash. Base des comparaisons entre kites.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Tâche de surveillance :
+
+    lifetimeStatsInit(millis());                 // Reprise et démarrage compté
+    ...
+    lifetimeStatsAddEnergy(energyTakeProduced());  // Énergie produite (J, control/energy.h)
+    lifetimeStatsUpdate(millis(), flying);       // Élévation mesurée, vols manuels compris
+
+  Avant un redémarrage volontaire : lifetimeStatsCheckpoint();
+
+  Principales fonctionnalités exposées :
+  - lifetimeStatsInit() : Relecture de la NVS, démarrage compté et sauvegardé
+  - lifetimeStatsUpdate() : Temps, vols, erreurs, boucle de contrôle ; sauvegarde si due
+  - lifetimeStatsAddEnergy() : Énergie produite
+  - lifetimeStatsCheckpoint() : Sauvegarde immédiate
+  - lifetimeStatsGet() : Copie des compteurs (toute tâche)
+
+  Contraintes techniques :
+  - Un bloc unique (magic, version, CRC32) écrit en une opération NVS : une
+    coupure pendant l'écriture laisse le bloc précédent intact. Un bloc
+    invalide repart de zéro
+  - Sauvegarde toutes les LIFETIME_CHECKPOINT_INTERVAL_MS si un compteur a
+    changé, et en fin de vol au plus une fois par
+    LIFETIME_MIN_CHECKPOINT_SPACING_MS. Le bloc de 72 octets occupe 5
+    entrées NVS de 32 octets ; avec 4 pages utiles de 126 entrées, chaque
+    page est effacée environ toutes les 100 sauvegardes, soit toutes les
+    17 h de fonctionnement : 100 000 cycles d'effacement couvrent plus de
+    150 ans
+  - Perte au pire : l'intervalle depuis la dernière sauvegarde (coupure
+    brutale de l'alimentation)
+*/
+
+#ifndef LIFETIME_STATS_H
+#define LIFETIME_STATS_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define LIFETIME_STATS_MAGIC    0x4C494645u  // "LIFE"
+#define LIFETIME_STATS_VERSION  1
+
+// === DÉFINITION DES TYPES ===
+
+// Compteurs cumulés
+typedef struct {
+  uint32_t bootCount;              // Démarrages
+  uint32_t flightCount;            // Vols (décollages mesurés, autopilote ou manuel)
+  uint64_t uptimeMs;               // Temps de fonctionnement
+  uint64_t flightMs;               // Temps de vol (kite en l'air)
+  uint64_t energyMilliJoules;      // Énergie produite
+  uint32_t errorCount;             // Erreurs signalées au gestionnaire d'erreurs
+  uint32_t controlOverruns;        // Cycles de contrôle en retard (core/hot_path.h)
+  uint32_t worstControlWorkUs;     // Plus long travail d'un cycle de contrôle
+  uint32_t worstControlPeriodUs;   // Plus grand écart entre deux cycles
+  uint32_t checkpointCount;        // Sauvegardes NVS (suivi de l'usure)
+} LifetimeCounters;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Relit les compteurs en NVS, compte le démarrage et le sauvegarde
+ * @param nowMs Instant courant (ms)
+ * @return false si la NVS est inaccessible (compteurs en RAM seulement)
+ */
+bool lifetimeStatsInit(uint32_t nowMs);
+
+/**
+ * Cumule le temps écoulé, les vols, les erreurs et les mesures de la boucle
+ * de contrôle, puis sauvegarde si l'échéance est atteinte
+ * @param nowMs Instant courant (ms)
+ * @param flying Kite en l'air, d'après l'élévation mesurée (pas le mode de l'autopilote)
+ * @return true si une sauvegarde a eu lieu
+ */
+bool lifetimeStatsUpdate(uint32_t nowMs, bool flying);
+
+/**
+ * Ajoute de l'énergie produite (valeurs négatives ignorées)
+ * @param joules Énergie (J)
+ */
+void lifetimeStatsAddEnergy(float joules);
+
+/**
+ * Sauvegarde immédiate (avant un redémarrage volontaire)
+ * @return false si l'écriture a échoué
+ */
+bool lifetimeStatsCheckpoint();
+
+/**
+ * Copie des compteurs
+ * @return Compteurs
+ */
+LifetimeCounters lifetimeStatsGet();
+
+#endif // LIFETIME_STATS_H
@@ -0,0 +1,191 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Bus de messages par sujets (Interface)
+  -----------------------
+
+  Publication/abonnement entre tâches : les charges utiles sont écrites une
+  seule fois dans un bloc d'un pool statique, les files FreeRTOS des abonnés
+  ne transportent que le pointeur du bloc, compté par référence.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Un échantillon publié par la tâche des capteurs est reçu par chaque
+  abonné sans copie :
+
+    // Producteur
+    BusMessage* msg = busAcquire(BUS_TOPIC_IMU, sizeof(IMUData));
+    imuReadProcessedData((IMUData*)busPayload(msg));
+    busPublish(msg);
+
+    // Abonné (une file par abonné)
+    static BusSubscriber* recorder = busSubscribe(BUS_TOPIC_IMU, 4, "recorder");
+    while ((msg = busReceive(recorder, 0)) != nullptr) {
+      recordSample((const IMUData*)busPayload(msg));
+      busRelease(msg);
+    }
+
+  Principales fonctionnalités exposées :
+  - busSubscribe() : Création de la file d'un abonné à un sujet
+  - busAcquire() / busPublish() : Écriture en place puis diffusion du pointeur
+  - busPublishCopy() : Publication d'une charge utile existante (une copie)
+  - busReceive() / busRelease() : Réception d'une référence et restitution
+  - busGetTopicStats() : Débit et pertes par sujet
+
+  Contraintes techniques :
+  - BUS_POOL_BLOCKS blocs de BUS_BLOCK_SIZE octets, aucune allocation après
+    busInit() ; un bloc revient au pool quand sa dernière référence est rendue
+  - Un abonné dont la file est pleine perd le message (compté), le
+    producteur n'est jamais bloqué
+  - Les abonnements se font à l'initialisation des tâches et ne sont pas
+    retirés ; un abonné ne reçoit que les publications postérieures
+  - Un message reçu est en lecture seule : il est partagé entre abonnés
+*/
+
+#ifndef MESSAGE_BUS_H
+#define MESSAGE_BUS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "../core/config.h"
+
+// === DÉFINITION DES TYPES ===
+
+// Sujets du bus
+typedef enum {
+  BUS_TOPIC_LOG = 0,            // Messages de journal (Message)
+  BUS_TOPIC_IMU,                // Échantillons IMU de la tâche des capteurs (IMUData)
+  BUS_TOPIC_COUNT
+} BusTopic;
+
+// Charge utile du sujet BUS_TOPIC_LOG
+typedef struct {
+  uint8_t level;                // Niveau de log
+  char tag[16];                 // Tag du message
+  char message[128];            // Contenu du message
+} Message;
+
+// Bloc du pool : en-tête et charge utile
+typedef struct {
+  uint32_t sequence;            // Numéro de publication dans le sujet
+  uint32_t timestampMs;         // Instant de publication
+  uint16_t size;                // Octets utiles de la charge
+  uint8_t topic;
+  uint8_t refCount;             // Références détenues (producteur, abonnés)
+  int16_t nextFree;             // Chaînage du pool libre
+  alignas(8) uint8_t payload[BUS_BLOCK_SIZE];
+} BusMessage;
+
+// Abonné : file de pointeurs vers les blocs
+typedef struct {
+  QueueHandle_t queue;
+  const char* name;
+  uint8_t topic;
+  uint32_t received;            // Messages livrés dans la file
+  uint32_t dropped;             // Messages perdus (file pleine)
+} BusSubscriber;
+
+// Statistiques d'un sujet
+typedef struct {
+  uint32_t published;           // Publications
+  uint32_t delivered;           // Livraisons (une par abonné)
+  uint32_t dropped;             // Livraisons perdues (file d'abonné pleine)
+  uint32_t exhausted;           // Publications refusées (pool vide ou charge trop grande)
+  uint32_t bytes;               // Octets publiés
+  float rateHz;                 // Publications par seconde sur la dernière fenêtre
+  uint8_t subscribers;
+} BusTopicStats;
+
+static_assert(sizeof(Message) <= BUS_BLOCK_SIZE, "BUS_BLOCK_SIZE trop petit pour Message");
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise le pool, les sujets et la table des abonnés
+ * Les abonnés existants sont oubliés (leurs files sont supprimées)
+ */
+void busInit();
+
+/**
+ * Abonne une tâche à un sujet
+ * @param topic Sujet à recevoir
+ * @param depth Profondeur de la file de l'abonné (messages en attente)
+ * @param name Nom de l'abonné (statistiques)
+ * @return Abonné, ou nullptr si la table est pleine ou la file non créée
+ */
+BusSubscriber* busSubscribe(BusTopic topic, uint8_t depth, const char* name);
+
+/**
+ * Réserve un bloc pour une publication
+ * @param topic Sujet de la publication
+ * @param size Taille de la charge utile (au plus BUS_BLOCK_SIZE)
+ * @return Bloc détenu par l'appelant, ou nullptr si le pool est vide
+ */
+BusMessage* busAcquire(BusTopic topic, size_t size);
+
+/**
+ * Charge utile d'un bloc
+ * @param msg Bloc réservé ou reçu
+ * @return Adresse de la charge utile
+ */
+inline void* busPayload(BusMessage* msg) { return msg->payload; }
+
+/**
+ * Diffuse un bloc réservé à tous les abonnés de son sujet
+ * La référence de l'appelant est consommée, même sans abonné
+ * @param msg Bloc obtenu par busAcquire()
+ * @return Nombre d'abonnés qui ont reçu le message
+ */
+int busPublish(BusMessage* msg);
+
+/**
+ * Copie une charge utile dans un bloc et la diffuse
+ * @param topic Sujet de la publication
+ * @param data Charge utile
+ * @param size Taille de la charge utile
+ * @return Nombre d'abonnés servis, -1 si aucun bloc n'est disponible
+ */
+int busPublishCopy(BusTopic topic, const void* data, size_t size);
+
+/**
+ * Reçoit le prochain message d'un abonné
+ * @param subscriber Abonné
+ * @param ticksToWait Attente maximale (ticks FreeRTOS)
+ * @return Message dont l'appelant détient une référence, ou nullptr
+ */
+BusMessage* busReceive(BusSubscriber* subscriber, TickType_t ticksToWait);
+
+/**
+ * Ajoute une référence à un message (conservation au-delà du traitement)
+ * @param msg Message détenu par l'appelant
+ */
+void busRetain(BusMessage* msg);
+
+/**
+ * Rend une référence ; le bloc revient au pool à la dernière
+ * @param msg Message reçu, réservé ou retenu
+ */
+void busRelease(BusMessage* msg);
+
+/**
+ * Statistiques d'un sujet
+ * @param topic Sujet à consulter
+ * @return Compteurs depuis busInit() et débit de la dernière fenêtre
+ */
+BusTopicStats busGetTopicStats(BusTopic topic);
+
+/**
+ * Nombre de blocs libres du pool
+ * @return Blocs disponibles pour des publications
+ */
+int busFreeBlocks();
+
+/**
+ * Journalise les statistiques de chaque sujet et de chaque abonné
+ */
+void busPrintStats();
+
+#endif // MESSAGE_BUS_H
@@ -0,0 +1,140 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Serveur de paramètres RCU (Interface)
+  -----------------------
+
+  Publication de jeux de paramètres sous forme d'instantanés immuables et
+  versionnés (read-copy-update) : un rédacteur prépare une nouvelle copie
+  puis échange le pointeur courant, les lecteurs prennent ce pointeur une
+  fois par cycle, sans verrou ni copie.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Lecteur (boucle de contrôle) et rédacteur (réglage depuis le web) :
+
+    // Lecture : un pointeur par cycle, valable jusqu'à la lecture suivante
+    const AutopilotParameters* p =
+        (const AutopilotParameters*)paramServerRead(&server, reader, nullptr);
+
+    // Écriture : copie complète, échange du pointeur courant
+    paramServerPublish(&server, &newParams);
+
+  Principales fonctionnalités exposées :
+  - paramServerInit() : Instantané initial et verrou des rédacteurs
+  - paramServerRegisterReader() : Attribution d'un emplacement de lecteur
+  - paramServerRead() / paramServerRelease() : Prise et abandon d'un instantané
+  - paramServerPublish() : Nouvelle version, les lecteurs la voient au cycle suivant
+  - paramServerCopy() : Copie de la version courante (hors boucle de contrôle)
+
+  Contraintes techniques :
+  - Les lecteurs ne bloquent jamais et ne voient jamais un instantané en
+    cours d'écriture : une version publiée n'est plus modifiée
+  - Un instantané est récupéré après sa période de grâce, quand aucun
+    lecteur ne l'annonce plus (lecture suivante ou abandon de chaque lecteur)
+  - PARAM_SERVER_SLOTS = lecteurs + 2 emplacements : la publication échoue
+    (sans attendre) seulement si tous sont retenus, ce qui ne peut arriver
+    qu'avec des lecteurs non enregistrés
+  - Les rédacteurs sont sérialisés par un mutex que les lecteurs ignorent
+*/
+
+#ifndef PARAM_SERVER_H
+#define PARAM_SERVER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define PARAM_SERVER_SLOTS    (PARAM_SERVER_MAX_READERS + 2)
+#define PARAM_READER_NONE     -1
+
+// === DÉFINITION DES TYPES ===
+
+// Instantané immuable une fois publié
+typedef struct {
+  uint32_t version;             // Numéro de publication, 0 : emplacement libre
+  alignas(8) uint8_t data[PARAM_SERVER_MAX_SIZE];
+} ParamSnapshot;
+
+// Statistiques du serveur
+typedef struct {
+  uint32_t version;             // Version courante
+  uint32_t published;           // Publications réussies
+  uint32_t reclaimed;           // Instantanés récupérés après leur période de grâce
+  uint32_t busy;                // Publications refusées (emplacements tous retenus)
+  uint32_t readRetries;         // Lectures recommencées (publication concurrente)
+} ParamServerStats;
+
+// Serveur d'un jeu de paramètres
+typedef struct {
+  ParamSnapshot slots[PARAM_SERVER_SLOTS];
+  ParamSnapshot* current;                             // Accès atomique
+  ParamSnapshot* announced[PARAM_SERVER_MAX_READERS]; // Instantané tenu par chaque lecteur
+  uint8_t readerCount;
+  uint16_t size;
+  SemaphoreHandle_t writeLock;
+  ParamServerStats stats;
+} ParamServer;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise le serveur avec la version 1
+ * @param server Serveur à initialiser
+ * @param initial Valeurs initiales
+ * @param size Taille du jeu de paramètres (au plus PARAM_SERVER_MAX_SIZE)
+ * @return true si le serveur est prêt
+ */
+bool paramServerInit(ParamServer* server, const void* initial, size_t size);
+
+/**
+ * Attribue un emplacement de lecteur (une tâche lectrice chacun)
+ * @param server Serveur
+ * @return Identifiant du lecteur, ou PARAM_READER_NONE si la table est pleine
+ */
+int paramServerRegisterReader(ParamServer* server);
+
+/**
+ * Prend l'instantané courant ; le précédent du même lecteur est abandonné
+ * @param server Serveur
+ * @param reader Identifiant du lecteur
+ * @param version Version de l'instantané (optionnel)
+ * @return Paramètres, valables jusqu'à la lecture ou l'abandon suivant
+ */
+const void* paramServerRead(ParamServer* server, int reader, uint32_t* version);
+
+/**
+ * Abandonne l'instantané d'un lecteur (lecteur inactif)
+ * @param server Serveur
+ * @param reader Identifiant du lecteur
+ */
+void paramServerRelease(ParamServer* server, int reader);
+
+/**
+ * Publie une nouvelle version
+ * @param server Serveur
+ * @param data Jeu de paramètres complet
+ * @return Version publiée, 0 si aucun emplacement n'est libre
+ */
+uint32_t paramServerPublish(ParamServer* server, const void* data);
+
+/**
+ * Copie la version courante (tâches qui ne lisent qu'occasionnellement)
+ * @param server Serveur
+ * @param out Destination (size octets)
+ * @return Version copiée
+ */
+uint32_t paramServerCopy(ParamServer* server, void* out);
+
+/**
+ * Statistiques du serveur
+ * @param server Serveur
+ * @return Compteurs depuis paramServerInit()
+ */
+ParamServerStats paramServerGetStats(const ParamServer* server);
+
+#endif // PARAM_SERVER_H
@@ -0,0 +1,88 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Format des fichiers de session (Interface)
+  -----------------------
+
+  Structures écrites sur la flash par l'enregistreur de sessions, partagées
+  avec les outils de la station sol qui relisent les fichiers <id>.dat.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Lecture d'un bloc de données compressé :
+
+    SessionChunkHeader* header = (SessionChunkHeader*)block;
+    if (header->magic == SESSION_CHUNK_MAGIC_GORILLA) {
+      gorillaDecoderInit(&decoder, block + sizeof(SessionChunkHeader),
+                         header->encodedBytes, SESSION_CHANNEL_COUNT, header->count);
+    }
+
+  Principales fonctionnalités exposées :
+  - SessionChunkHeader : En-tête d'un bloc de SESSION_CHUNK_SIZE octets
+  - SessionIndexEntry : Entrée du fichier <id>.idx
+  - FlightSample : Échantillon décodé
+
+  Contraintes techniques :
+  - Blocs SESSION_CHUNK_MAGIC_GORILLA : en-tête puis échantillons compressés
+    (utils/gorilla.h), chaque bloc se décode seul
+  - Blocs SESSION_CHUNK_MAGIC (sessions antérieures) : en-tête puis
+    FlightSample bruts, toujours lisibles
+  - Sans dépendance Arduino : compilé aussi par la station sol
+*/
+
+#ifndef SESSION_FORMAT_H
+#define SESSION_FORMAT_H
+
+#include <stdint.h>
+
+// === CONSTANTES ===
+#define SESSION_CHUNK_MAGIC          0x4B43484B  // "KCHK" : échantillons bruts
+#define SESSION_CHUNK_MAGIC_GORILLA  0x4B434847  // "KCHG" : échantillons compressés
+#define SESSION_CHUNK_SIZE           4096        // Taille d'un bloc (un secteur flash)
+
+// Canaux enregistrés dans chaque échantillon
+typedef enum {
+  SESSION_CH_PITCH = 0,          // Tangage (degrés)
+  SESSION_CH_ROLL,               // Roulis (degrés)
+  SESSION_CH_YAW,                // Lacet (degrés)
+  SESSION_CH_LINE_TENSION,       // Tension des lignes (kg)
+  SESSION_CH_LINE_LENGTH,        // Longueur des lignes (cm)
+  SESSION_CH_WIND_SPEED,         // Vitesse du vent (m/s)
+  SESSION_CH_POWER,              // Puissance instantanée (W)
+  SESSION_CH_DIRECTION,          // Angle de direction (degrés)
+  SESSION_CHANNEL_COUNT
+} SessionChannel;
+
+// === DÉFINITION DES TYPES ===
+
+// Échantillon de vol
+typedef struct {
+  uint32_t timestampMs;                   // Horodatage (ms)
+  float values[SESSION_CHANNEL_COUNT];    // Valeurs des canaux
+} FlightSample;
+
+// En-tête d'un bloc du fichier de données
+typedef struct {
+  uint32_t magic;                // SESSION_CHUNK_MAGIC_GORILLA (ou SESSION_CHUNK_MAGIC)
+  uint32_t firstTs;              // Horodatage du premier échantillon
+  uint32_t lastTs;               // Horodatage du dernier échantillon
+  uint16_t count;                // Nombre d'échantillons dans le bloc
+  uint16_t encodedBytes;         // Octets compressés après l'en-tête (0 pour un bloc brut)
+} SessionChunkHeader;
+
+#define SESSION_CHUNK_DATA_SIZE    (SESSION_CHUNK_SIZE - sizeof(SessionChunkHeader))
+
+// Capacité d'un bloc brut (format SESSION_CHUNK_MAGIC)
+#define SESSION_SAMPLES_PER_CHUNK  (SESSION_CHUNK_DATA_SIZE / sizeof(FlightSample))
+
+// Entrée d'index : intervalle de temps couvert par un bloc et position dans le fichier
+typedef struct {
+  uint32_t firstTs;              // Horodatage du premier échantillon du bloc
+  uint32_t lastTs;               // Horodatage du dernier échantillon (clé de recherche)
+  uint32_t offset;               // Décalage du bloc dans le fichier de données
+  uint32_t count;                // Nombre d'échantillons du bloc
+} SessionIndexEntry;
+
+#endif // SESSION_FORMAT_H
@@ -0,0 +1,171 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module d'enregistrement des sessions de vol (Interface)
+  -----------------------
+
+  Interface d'enregistrement des sessions de vol sur la flash (LittleFS).
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Ce fichier définit l'interface d'enregistrement et de relecture des sessions de vol.
+  Chaque session est découpée en blocs de taille fixe, indexés par le temps, et
+  accompagnée d'aperçus (min/max/moyenne) pré-calculés à plusieurs niveaux de zoom.
+
+  Principales fonctionnalités exposées :
+  - sessionStorageInit() : Montage du système de fichiers et préparation du répertoire
+  - sessionStorageStart() / sessionStorageStop() : Début et fin d'une session
+  - sessionStorageAppend() : Ajout d'un échantillon (mise à jour incrémentale des aperçus)
+  - sessionStorageReadRange() : Lecture des échantillons bruts d'un intervalle de temps
+  - sessionStorageReadOverview() : Lecture des aperçus d'un niveau de zoom
+  - sessionStorageSelectLevel() : Choix du niveau adapté à une fenêtre d'affichage
+
+  Organisation sur la flash (répertoire SESSION_STORAGE_ROOT) :
+  - <id>.dat  : Blocs de SESSION_CHUNK_SIZE octets (en-tête + échantillons
+                compressés, voir utils/session_format.h)
+  - <id>.idx  : Une entrée SessionIndexEntry par bloc (temps -> décalage)
+  - <id>.o0.. : Un fichier d'aperçus SessionOverviewBucket par niveau
+  - <id>.meta : Description SessionInfo de la session
+
+  Contraintes techniques :
+  - Les horodatages d'une session doivent être croissants
+  - Les recherches se font par dichotomie sur des enregistrements de taille fixe (O(log n))
+  - Seuls les blocs et seaux clos sont visibles en lecture pendant l'enregistrement
+*/
+
+#ifndef SESSION_STORAGE_H
+#define SESSION_STORAGE_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "session_format.h"
+
+// === CONSTANTES ===
+#define SESSION_META_MAGIC         0x4B534553  // "KSES"
+#define SESSION_OVERVIEW_LEVELS    3           // Nombre de niveaux d'aperçu
+#define SESSION_LEVEL_RAW          0xFF        // Niveau "données brutes" (pas d'aperçu)
+
+// === DÉFINITION DES TYPES ===
+
+// Seau d'aperçu : statistiques d'une tranche de temps
+typedef struct {
+  uint32_t startTs;                       // Début de la tranche
+  uint32_t lastTs;                        // Dernier échantillon agrégé (clé de recherche)
+  uint32_t count;                         // Nombre d'échantillons agrégés
+  float minValue[SESSION_CHANNEL_COUNT];  // Minimum par canal
+  float maxValue[SESSION_CHANNEL_COUNT];  // Maximum par canal
+  float meanValue[SESSION_CHANNEL_COUNT]; // Moyenne par canal
+} SessionOverviewBucket;
+
+// Description d'une session
+typedef struct {
+  uint32_t magic;                                  // SESSION_META_MAGIC
+  uint16_t id;                                     // Identifiant de session
+  uint16_t channelCount;                           // SESSION_CHANNEL_COUNT à l'enregistrement
+  uint32_t startTs;                                // Premier horodatage
+  uint32_t endTs;                                  // Dernier horodatage
+  uint32_t sampleCount;                            // Échantillons écrits
+  uint32_t chunkCount;                             // Blocs écrits
+  uint32_t bucketCount[SESSION_OVERVIEW_LEVELS];   // Seaux écrits par niveau
+  bool active;                                     // Session en cours d'enregistrement
+} SessionInfo;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise le stockage des sessions (montage LittleFS, création du répertoire)
+ * @return true si succès, false si échec
+ */
+bool sessionStorageInit();
+
+/**
+ * Démarre une nouvelle session (les plus anciennes sont supprimées au-delà de SESSION_MAX_COUNT)
+ * @return Identifiant de la session, 0 en cas d'échec
+ */
+uint16_t sessionStorageStart();
+
+/**
+ * Ajoute un échantillon à la session en cours
+ * @param sample Échantillon (horodatage croissant)
+ * @return true si succès, false si aucune session active ou erreur d'écriture
+ */
+bool sessionStorageAppend(const FlightSample& sample);
+
+/**
+ * Termine la session en cours (écrit le bloc et les seaux partiels)
+ * @return true si succès, false sinon
+ */
+bool sessionStorageStop();
+
+/**
+ * Indique si une session est en cours d'enregistrement
+ * @return true si une session est active
+ */
+bool sessionStorageIsRecording();
+
+/**
+ * Liste les sessions présentes sur la flash
+ * @param sessions Tableau recevant les descriptions
+ * @param maxSessions Taille du tableau
+ * @return Nombre de sessions écrites dans le tableau
+ */
+int sessionStorageList(SessionInfo* sessions, int maxSessions);
+
+/**
+ * Obtient la description d'une session
+ * @param id Identifiant de session
+ * @param info Structure recevant la description
+ * @return true si la session existe
+ */
+bool sessionStorageGetInfo(uint16_t id, SessionInfo* info);
+
+/**
+ * Lit les échantillons bruts d'un intervalle de temps
+ * @param id Identifiant de session
+ * @param fromMs Début de l'intervalle (inclus)
+ * @param toMs Fin de l'intervalle (inclus)
+ * @param samples Tableau recevant les échantillons
+ * @param maxSamples Taille du tableau
+ * @return Nombre d'échantillons lus, -1 en cas d'erreur
+ */
+int sessionStorageReadRange(uint16_t id, uint32_t fromMs, uint32_t toMs,
+                            FlightSample* samples, int maxSamples);
+
+/**
+ * Lit les seaux d'aperçu d'un niveau sur un intervalle de temps
+ * @param id Identifiant de session
+ * @param level Niveau d'aperçu (0 = le plus fin)
+ * @param fromMs Début de l'intervalle (inclus)
+ * @param toMs Fin de l'intervalle (inclus)
+ * @param buckets Tableau recevant les seaux
+ * @param maxBuckets Taille du tableau
+ * @return Nombre de seaux lus, -1 en cas d'erreur
+ */
+int sessionStorageReadOverview(uint16_t id, uint8_t level, uint32_t fromMs, uint32_t toMs,
+                               SessionOverviewBucket* buckets, int maxBuckets);
+
+/**
+ * Choisit le niveau le plus fin qui tient dans le nombre de points demandé
+ * @param spanMs Durée de la fenêtre affichée
+ * @param maxPoints Nombre maximal de points souhaité
+ * @return Niveau d'aperçu, ou SESSION_LEVEL_RAW si les données brutes conviennent
+ */
+uint8_t sessionStorageSelectLevel(uint32_t spanMs, int maxPoints);
+
+/**
+ * Durée d'un seau pour un niveau d'aperçu
+ * @param level Niveau d'aperçu
+ * @return Durée en ms, 0 si le niveau est invalide
+ */
+uint32_t sessionStorageBucketDuration(uint8_t level);
+
+/**
+ * Supprime une session et tous ses fichiers
+ * @param id Identifiant de session
+ * @return true si succès
+ */
+bool sessionStorageDelete(uint16_t id);
+
+#endif // SESSION_STORAGE_H
@@ -0,0 +1,92 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Instantané des tâches FreeRTOS (Interface)
+  -----------------------
+
+  Table des tâches capturée par uxTaskGetSystemState() dans un tableau
+  préalloué : état, priorité, cœur, marge de pile et temps d'exécution
+  depuis la capture précédente. Restituée en trame binaire
+  (communication/protocols.h) ou en JSON pour le tableau de bord.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Capture périodique dans la tâche de surveillance, lecture par le serveur web :
+
+    taskSnapshotScheduleCapture(&wheel);   // Toutes les TASK_SNAPSHOT_INTERVAL_MS
+
+    TaskSnapshot snapshot;
+    if (taskSnapshotGetLatest(&snapshot)) {
+      size_t length = taskSnapshotToJson(&snapshot, json, sizeof(json));
+    }
+
+  Principales fonctionnalités exposées :
+  - taskSnapshotCapture() : Capture et écarts avec la capture précédente
+  - taskSnapshotGetLatest() : Copie de la dernière capture (toute tâche)
+  - taskSnapshotToJson() : Table des tâches en JSON
+  - taskSnapshotEncode() (protocols.h) : Même table en trame binaire
+
+  Contraintes techniques :
+  - Aucune allocation : tableau de TASK_SNAPSHOT_MAX_TASKS TaskStatus_t ;
+    au-delà, uxTaskGetSystemState() ne renvoie rien et la capture est refusée
+  - Les temps d'exécution exigent CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS ;
+    sinon runTimeTotal vaut 0 et les parts de CPU aussi
+  - cpuPermille est la part d'un cœur : la somme des tâches atteint 2000 ‰
+    sur les deux cœurs de l'ESP32 (tâches IDLE comprises)
+  - taskSnapshotCapture() depuis une seule tâche ; la capture suspend
+    brièvement l'ordonnanceur, bien moins que le texte de vTaskList()
+*/
+
+#ifndef TASK_SNAPSHOT_H
+#define TASK_SNAPSHOT_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+#include "../communication/protocols.h"
+#include "timer_wheel.h"
+
+// === CONSTANTES ===
+#define TASK_SNAPSHOT_JSON_SIZE    3456    // TASK_SNAPSHOT_MAX_TASKS entrées au plus long
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Capture la table des tâches et la publie comme dernière capture
+ * @param nowMs Instant de la capture (ms)
+ * @return false si le nombre de tâches dépasse TASK_SNAPSHOT_MAX_TASKS
+ */
+bool taskSnapshotCapture(uint32_t nowMs);
+
+/**
+ * Copie la dernière capture
+ * @param snapshot Destination
+ * @return false si aucune capture n'a encore eu lieu
+ */
+bool taskSnapshotGetLatest(TaskSnapshot* snapshot);
+
+/**
+ * Table des tâches en JSON
+ * @param snapshot Capture
+ * @param buffer Destination
+ * @param size Taille de la destination (TASK_SNAPSHOT_JSON_SIZE suffit toujours)
+ * @return Longueur écrite, 0 si la destination est trop petite
+ */
+size_t taskSnapshotToJson(const TaskSnapshot* snapshot, char* buffer, size_t size);
+
+/**
+ * Programme la capture toutes les TASK_SNAPSHOT_INTERVAL_MS
+ * @param wheel Roue de la tâche de surveillance
+ * @return false si la roue est pleine
+ */
+bool taskSnapshotScheduleCapture(TimerWheel* wheel);
+
+/**
+ * Nom d'un état de tâche
+ * @param state eTaskState
+ * @return Nom constant
+ */
+const char* taskSnapshotStateName(uint8_t state);
+
+#endif // TASK_SNAPSHOT_H
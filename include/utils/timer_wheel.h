@@ -0,0 +1,168 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Roue de temporisateurs hiérarchique (Interface)
+  -----------------------
+
+  Service de temporisation remplaçant les tests `millis() - last > INTERVAL`
+  répétés à chaque cycle : les modules programment leurs traitements, la
+  tâche propriétaire de la roue les exécute à l'échéance et dort jusqu'à la
+  suivante.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Chaque tâche possède sa roue et y arme les traitements qu'elle exécute :
+
+    static TimerWheel wheel;
+    timerWheelInit(&wheel, millis());
+    timerWheelSchedule(&wheel, POT_READ_INTERVAL, POT_READ_INTERVAL, readPots, &potManager);
+    for (;;) {
+      vTaskDelay(pdMS_TO_TICKS(timerWheelService(&wheel)));
+    }
+
+  Principales fonctionnalités exposées :
+  - timerWheelSchedule() : Temporisateur unique ou périodique, O(1)
+  - timerWheelCancel() : Désarmement, O(1)
+  - timerWheelAdvance() : Exécution des échéances jusqu'à un instant donné
+  - timerWheelNextDelay() : Attente jusqu'à la prochaine échéance
+  - timerWheelService() : Avance à millis() et retourne le sommeil possible
+
+  Contraintes techniques :
+  - Pas de 1 ms, trois niveaux de 64 cases (64 ms, 4 s, 262 s) et une liste
+    de débordement au-delà ; un temporisateur descend d'un niveau au passage
+    de sa case (cascade), coût amorti O(1)
+  - Les rappels s'exécutent dans la tâche qui appelle timerWheelAdvance() ;
+    une roue n'est manipulée que par sa tâche (pas de verrou)
+  - Un rappel peut armer ou désarmer des temporisateurs, y compris le sien
+  - Un temporisateur périodique en retard de plus d'une période saute les
+    échéances manquées (comptées) au lieu de s'exécuter en rafale
+  - Au plus TIMER_WHEEL_MAX_TIMERS temporisateurs par roue, sans allocation
+*/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define TIMER_WHEEL_LEVELS    3
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS     (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_HANDLE_NONE     0
+
+// === DÉFINITION DES TYPES ===
+
+// Traitement exécuté à l'échéance
+typedef void (*TimerCallback)(void* context);
+
+// Identifiant d'un temporisateur (indice et génération : un identifiant
+// périmé ne désarme jamais le temporisateur qui a repris son emplacement)
+typedef uint32_t TimerHandle;
+
+// Temporisateur (liste doublement chaînée par indices dans sa case)
+typedef struct {
+  TimerCallback callback;
+  void* context;
+  uint32_t expiry;              // Échéance absolue (ms)
+  uint32_t period;              // Période (ms), 0 : unique
+  int16_t next;
+  int16_t prev;
+  uint8_t level;                // Niveau, débordement, libre ou en cours d'exécution
+  uint8_t slot;
+  uint16_t generation;
+} TimerEntry;
+
+// Statistiques d'une roue
+typedef struct {
+  uint32_t fired;               // Rappels exécutés
+  uint32_t cascaded;            // Descentes d'un niveau à l'autre
+  uint32_t missed;              // Échéances périodiques sautées
+  uint32_t maxLatenessMs;       // Retard maximal d'un rappel sur son échéance
+  uint16_t active;              // Temporisateurs armés
+  uint16_t peakActive;
+  uint16_t exhausted;           // Armements refusés (roue pleine)
+} TimerWheelStats;
+
+// Roue de temporisateurs
+typedef struct {
+  TimerEntry timers[TIMER_WHEEL_MAX_TIMERS];
+  int16_t slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];   // Têtes de liste
+  uint64_t occupied[TIMER_WHEEL_LEVELS];                  // Cases non vides
+  int16_t overflow;             // Échéances au-delà du dernier niveau
+  int16_t freeList;
+  uint32_t tick;                // Dernier instant traité (ms)
+  uint32_t target;              // Instant visé par l'avance en cours
+  TimerWheelStats stats;
+} TimerWheel;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Initialise une roue vide
+ * @param wheel Roue à initialiser
+ * @param nowMs Instant courant (millis())
+ */
+void timerWheelInit(TimerWheel* wheel, uint32_t nowMs);
+
+/**
+ * Arme un temporisateur
+ * @param wheel Roue de la tâche qui exécutera le rappel
+ * @param delayMs Délai avant la première échéance (au moins 1 ms)
+ * @param periodMs Période des échéances suivantes, 0 pour un temporisateur unique
+ * @param callback Traitement à exécuter
+ * @param context Argument du traitement
+ * @return Identifiant, ou TIMER_HANDLE_NONE si la roue est pleine
+ */
+TimerHandle timerWheelSchedule(TimerWheel* wheel, uint32_t delayMs, uint32_t periodMs,
+                               TimerCallback callback, void* context);
+
+/**
+ * Désarme un temporisateur
+ * @param wheel Roue du temporisateur
+ * @param handle Identifiant retourné par timerWheelSchedule()
+ * @return true si le temporisateur était armé
+ */
+bool timerWheelCancel(TimerWheel* wheel, TimerHandle handle);
+
+/**
+ * Indique si un temporisateur est armé
+ * @param wheel Roue du temporisateur
+ * @param handle Identifiant retourné par timerWheelSchedule()
+ * @return true s'il n'a pas expiré (unique) ni été désarmé
+ */
+bool timerWheelIsActive(const TimerWheel* wheel, TimerHandle handle);
+
+/**
+ * Exécute, dans l'ordre, les rappels échus jusqu'à nowMs inclus
+ * @param wheel Roue à avancer
+ * @param nowMs Instant courant (millis())
+ * @return Nombre de rappels exécutés
+ */
+int timerWheelAdvance(TimerWheel* wheel, uint32_t nowMs);
+
+/**
+ * Délai jusqu'à la prochaine échéance (temps de sommeil d'une tâche)
+ * @param wheel Roue à consulter
+ * @param nowMs Instant courant (millis())
+ * @return Délai (ms), 0 si une échéance est due, au plus TIMER_WHEEL_MAX_IDLE_MS
+ */
+uint32_t timerWheelNextDelay(const TimerWheel* wheel, uint32_t nowMs);
+
+/**
+ * Avance la roue à millis() puis calcule le sommeil possible
+ * @param wheel Roue de la tâche appelante
+ * @return Délai (ms) jusqu'à la prochaine échéance
+ */
+uint32_t timerWheelService(TimerWheel* wheel);
+
+/**
+ * Statistiques de la roue
+ * @param wheel Roue à consulter
+ * @return Compteurs depuis timerWheelInit()
+ */
+TimerWheelStats timerWheelGetStats(const TimerWheel* wheel);
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,119 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Analyse vibratoire de l'IMU (Interface)
+  -----------------------
+
+  Spectre de l'accélération mesurée par l'IMU : fréquences dominantes,
+  énergie par bande et détection des vibrations anormales (flottement des
+  lignes, oscillation d'un servo).
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  La tâche des capteurs alimente l'anneau à VIBRATION_SAMPLE_RATE_HZ, une
+  tâche de faible priorité analyse les blocs dans un budget de temps fixe :
+
+    vibrationInit();
+    vibrationPushSample(imu.accel);                    // Tâche des capteurs
+    vibrationProcess(VIBRATION_CPU_BUDGET_US);         // Tâche de surveillance
+    if (vibrationIsAnomalous()) { ... }                // Autopilote
+
+  Principales fonctionnalités exposées :
+  - vibrationPushSample() : Ajout d'un échantillon d'accélération (producteur unique)
+  - vibrationProcess() : Analyse des blocs en attente dans le budget donné
+  - vibrationGetStatus() : Dernier spectre résumé (pics, bandes, anomalie)
+  - vibrationIsAnomalous() : Indicateur lu par l'autopilote à chaque cycle
+
+  Bandes analysées (valeur efficace de l'accélération, en g) :
+  - PILOTAGE  0,5 - 3 Hz  : manœuvres du kite
+  - SERVO     3 - 12 Hz   : oscillation de la direction
+  - LIGNES    12 - 40 Hz  : flottement des lignes
+  - STRUCTURE 40 - 100 Hz : moteur, fixations
+
+  Contraintes techniques :
+  - Les blocs (VIBRATION_FFT_SIZE échantillons, fenêtre de Hann, recouvrement
+    de moitié) sont lus en place dans l'anneau ; un bloc écrasé pendant son
+    analyse est écarté, un retard de plus d'un anneau saute au bloc le plus récent
+  - FFT radix-2 d'esp-dsp sur la cible, équivalent portable sur l'hôte
+  - Aucune allocation dynamique
+*/
+
+#ifndef VIBRATION_H
+#define VIBRATION_H
+
+#include <Arduino.h>
+#include "../core/config.h"
+
+// === CONSTANTES ===
+#define VIBRATION_PEAK_COUNT   3      // Fréquences dominantes suivies
+
+// Bandes de fréquence
+typedef enum {
+  VIBRATION_BAND_PILOTING = 0,
+  VIBRATION_BAND_SERVO,
+  VIBRATION_BAND_LINES,
+  VIBRATION_BAND_STRUCTURE,
+  VIBRATION_BAND_COUNT
+} VibrationBand;
+
+// === DÉFINITION DES TYPES ===
+
+// Résumé du dernier bloc analysé
+typedef struct {
+  float peakHz[VIBRATION_PEAK_COUNT];           // Fréquences dominantes (par amplitude décroissante)
+  float peakAmplitude[VIBRATION_PEAK_COUNT];    // Amplitude crête des pics (g)
+  float bandRms[VIBRATION_BAND_COUNT];          // Valeur efficace par bande (g)
+  float baselineRms[VIBRATION_BAND_COUNT];      // Référence apprise par bande (g)
+  float anomalyRatio;                           // Plus grand rapport d'énergie bande / référence
+  uint8_t anomalyBand;                          // Bande de ce rapport
+  bool anomalous;                               // Anomalie confirmée (VIBRATION_ANOMALY_BLOCKS)
+  bool learning;                                // Référence en cours d'apprentissage
+  uint32_t blocks;                              // Blocs analysés
+  uint32_t skipped;                             // Blocs sautés (retard de l'analyse)
+  uint32_t overruns;                            // Blocs écrasés pendant l'analyse
+  uint32_t blockUs;                             // Durée d'analyse d'un bloc (moyenne glissante)
+  uint32_t timestampMs;                         // Analyse du dernier bloc
+} VibrationStatus;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Prépare la FFT et la fenêtre, vide l'anneau et oublie la référence
+ */
+void vibrationInit();
+
+/**
+ * Ajoute un échantillon d'accélération (appelé par une seule tâche)
+ * @param accel Accélération calibrée [x, y, z] en g
+ */
+void vibrationPushSample(const float accel[3]);
+
+/**
+ * Analyse les blocs complets en attente, sans dépasser le budget (au moins un bloc)
+ * @param budgetUs Temps d'analyse maximal (us)
+ * @return Nombre de blocs analysés
+ */
+int vibrationProcess(uint32_t budgetUs);
+
+/**
+ * Copie le résumé du dernier bloc analysé
+ * @param status Structure recevant le résumé
+ */
+void vibrationGetStatus(VibrationStatus* status);
+
+/**
+ * Indique si une vibration anormale est en cours
+ * @return true si l'anomalie est confirmée
+ */
+bool vibrationIsAnomalous();
+
+/**
+ * Nom d'une bande de fréquence
+ * @param band Bande
+ * @return Nom constant
+ */
+const char* vibrationBandName(uint8_t band);
+
+#endif // VIBRATION_H
@@ -0,0 +1,39 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Micro-benchmarks sur l'hôte (Point d'entrée)
+  -----------------------
+  
+  Exécute la suite de micro-benchmarks avec l'horloge de l'hôte.
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== FONCTIONNEMENT =====
+  pio run -e native_bench && .pio/build/native_bench/program [--update] [référence]
+  
+  - Sans argument, la référence est benchmark_baseline.txt (répertoire courant)
+  - --update remplace la référence par les mesures de l'exécution
+  - Le code de retour est le nombre de régressions (0 = aucune)
+*/
+
+#include <Arduino.h>
+#include "core/logging.h"
+#include "utils/benchmark.h"
+
+int main(int argc, char** argv) {
+  const char* baselinePath = "benchmark_baseline.txt";
+  bool updateBaseline = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--update") == 0) {
+      updateBaseline = true;
+    } else {
+      baselinePath = argv[i];
+    }
+  }
+
+  currentLogLevel = (LogLevel)LOG_LEVEL_WARNING;
+  int regressions = benchmarkRunSuite(baselinePath, updateBaseline);
+  return regressions < 0 ? 1 : regressions;
+}
@@ -0,0 +1,440 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Stockage en colonnes de la station sol (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Un kite est ouvert à sa première trame : ses colonnes existantes sont
+     ramenées au nombre de lignes de la plus courte, puis complétées en ajout
+  2. Chaque trame devient une ligne dans les tampons du kite ; un tampon
+     plein (COLUMN_FLUSH_ROWS lignes) est écrit colonne par colonne, en un
+     appel write() par fichier, puis les entrées d'index correspondantes
+  3. Les séquences de l'émetteur comptent les trames perdues (saut) et
+     retardées (séquence déjà vue) ; un redémarrage de l'émetteur (séquence
+     et millis() qui reculent ensemble) repart sans compter de perte
+  4. Une plage horaire est trouvée par dichotomie dans l'index en mémoire,
+     puis dans au plus COLUMN_INDEX_STRIDE heures lues de time.col
+*/
+
+#include "column_store.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+
+// === CONSTANTES ===
+static const char* const SYSTEM_COLUMN_NAMES[COLUMN_FIRST_FIELD] = {
+  "time", "sequence", "unit_time", "flags"
+};
+static const size_t SYSTEM_COLUMN_SIZES[COLUMN_FIRST_FIELD] = {
+  sizeof(int64_t), sizeof(uint32_t), sizeof(uint32_t), sizeof(uint16_t)
+};
+
+// === FONCTIONS INTERNES ===
+
+static void unitDirectory(char* path, size_t size, const char* root, uint16_t unitId) {
+  snprintf(path, size, "%s/unit_%u", root, unitId);
+}
+
+static void columnPath(char* path, size_t size, const char* dir, const char* name, const char* ext) {
+  snprintf(path, size, "%s/%s.%s", dir, name, ext);
+}
+
+/**
+ * Écrit tout le tampon (write() peut écrire partiellement)
+ */
+static bool writeAll(int fd, const void* data, size_t length) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (length > 0) {
+    ssize_t written = write(fd, p, length);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    p += written;
+    length -= written;
+  }
+  return true;
+}
+
+static bool readAt(int fd, void* data, size_t length, uint64_t offset) {
+  uint8_t* p = (uint8_t*)data;
+  while (length > 0) {
+    ssize_t count = pread(fd, p, length, offset);
+    if (count <= 0) {
+      if (count < 0 && errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    p += count;
+    length -= count;
+    offset += count;
+  }
+  return true;
+}
+
+static int64_t fileSize(const char* path) {
+  struct stat st;
+  return stat(path, &st) == 0 ? (int64_t)st.st_size : -1;
+}
+
+/**
+ * Nombre de lignes complètes d'un kite : celui de sa colonne la plus courte
+ */
+static uint64_t countRows(const char* dir) {
+  uint64_t rows = UINT64_MAX;
+  char path[COLUMN_PATH_MAX];
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    columnPath(path, sizeof(path), dir, columnName(c), "col");
+    int64_t size = fileSize(path);
+    rows = std::min(rows, size < 0 ? 0 : (uint64_t)size / columnSize(c));
+  }
+  return rows;
+}
+
+static ColumnUnit* findUnit(ColumnStore* store, uint16_t unitId) {
+  for (int i = 0; i < store->unitCount; i++) {
+    if (store->units[i].stats.unitId == unitId) {
+      return &store->units[i];
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Ouvre les colonnes d'un kite et reprend une archive existante
+ */
+static ColumnUnit* openUnit(ColumnStore* store, uint16_t unitId) {
+  if (store->unitCount >= COLUMN_MAX_UNITS) {
+    return nullptr;
+  }
+  char dir[COLUMN_PATH_MAX];
+  char path[COLUMN_PATH_MAX];
+  unitDirectory(dir, sizeof(dir), store->root, unitId);
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Répertoire %s non créé : %s\n", dir, strerror(errno));
+    return nullptr;
+  }
+
+  ColumnUnit* unit = &store->units[store->unitCount];
+  memset(unit, 0, sizeof(ColumnUnit));
+  unit->stats.unitId = unitId;
+  unit->indexFd = -1;
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    unit->fds[c] = -1;
+  }
+  uint64_t rows = countRows(dir);
+
+  // Colonnes ramenées à la même longueur (écriture précédente interrompue)
+  bool ok = true;
+  for (int c = 0; c < COLUMN_COUNT && ok; c++) {
+    columnPath(path, sizeof(path), dir, columnName(c), "col");
+    unit->fds[c] = open(path, O_WRONLY | O_CREAT, 0644);
+    ok = unit->fds[c] >= 0 && ftruncate(unit->fds[c], rows * columnSize(c)) == 0 &&
+         lseek(unit->fds[c], 0, SEEK_END) >= 0;
+    unit->buffers[c] = ok ? (uint8_t*)malloc(COLUMN_FLUSH_ROWS * columnSize(c)) : nullptr;
+    ok = ok && unit->buffers[c] != nullptr;
+  }
+  columnPath(path, sizeof(path), dir, "time", "idx");
+  unit->indexFd = ok ? open(path, O_WRONLY | O_CREAT, 0644) : -1;
+  uint64_t indexEntries = (rows + COLUMN_INDEX_STRIDE - 1) / COLUMN_INDEX_STRIDE;
+  ok = ok && unit->indexFd >= 0 && ftruncate(unit->indexFd, indexEntries * sizeof(ColumnIndexEntry)) == 0 &&
+       lseek(unit->indexFd, 0, SEEK_END) >= 0;
+
+  if (ok && rows > 0) {
+    // Reprise : dernière heure archivée, pour garder time.col non décroissante
+    columnPath(path, sizeof(path), dir, "time", "col");
+    int fd = open(path, O_RDONLY);
+    ok = fd >= 0 && readAt(fd, &unit->stats.lastTimeMs, sizeof(int64_t), (rows - 1) * sizeof(int64_t)) &&
+         readAt(fd, &unit->stats.firstTimeMs, sizeof(int64_t), 0);
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  if (!ok) {
+    fprintf(stderr, "Colonnes du kite %u inutilisables : %s\n", unitId, strerror(errno));
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+      if (unit->fds[c] >= 0) {
+        close(unit->fds[c]);
+      }
+      free(unit->buffers[c]);
+    }
+    if (unit->indexFd >= 0) {
+      close(unit->indexFd);
+    }
+    return nullptr;
+  }
+
+  unit->stats.rows = rows;
+  store->unitCount++;
+  return unit;
+}
+
+/**
+ * Écrit les lignes en tampon d'un kite puis leurs entrées d'index
+ */
+static bool flushUnit(ColumnUnit* unit) {
+  if (unit->pending == 0) {
+    return true;
+  }
+  bool ok = true;
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    ok = writeAll(unit->fds[c], unit->buffers[c], unit->pending * columnSize(c)) && ok;
+  }
+
+  uint64_t firstRow = unit->stats.rows - unit->pending;
+  const int64_t* times = (const int64_t*)unit->buffers[COLUMN_TIME];
+  ColumnIndexEntry entries[COLUMN_FLUSH_ROWS / COLUMN_INDEX_STRIDE + 1];
+  size_t count = 0;
+  for (uint64_t row = (firstRow + COLUMN_INDEX_STRIDE - 1) / COLUMN_INDEX_STRIDE * COLUMN_INDEX_STRIDE;
+       row < unit->stats.rows; row += COLUMN_INDEX_STRIDE) {
+    entries[count].timeMs = times[row - firstRow];
+    entries[count].row = row;
+    count++;
+  }
+  ok = writeAll(unit->indexFd, entries, count * sizeof(ColumnIndexEntry)) && ok;
+  unit->pending = 0;
+  return ok;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+size_t columnSize(int column) {
+  return column < COLUMN_FIRST_FIELD ? SYSTEM_COLUMN_SIZES[column] : sizeof(float);
+}
+
+const char* columnName(int column) {
+  return column < COLUMN_FIRST_FIELD ? SYSTEM_COLUMN_NAMES[column]
+                                     : TELEMETRY_FIELD_NAMES[column - COLUMN_FIRST_FIELD];
+}
+
+int columnFind(const char* name) {
+  for (int c = 0; c < COLUMN_COUNT; c++) {
+    if (strcmp(columnName(c), name) == 0) {
+      return c;
+    }
+  }
+  return -1;
+}
+
+bool columnStoreOpen(ColumnStore* store, const char* root) {
+  memset(store, 0, sizeof(ColumnStore));
+  snprintf(store->root, sizeof(store->root), "%s", root);
+  if (mkdir(root, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Répertoire %s non créé : %s\n", root, strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+bool columnStoreAppend(ColumnStore* store, const TelemetryFrame* frame, int64_t receivedMs) {
+  ColumnUnit* unit = findUnit(store, frame->unitId);
+  if (unit == nullptr && (unit = openUnit(store, frame->unitId)) == nullptr) {
+    store->rejected++;
+    return false;
+  }
+
+  ColumnUnitStats* stats = &unit->stats;
+  if (unit->hasSequence) {
+    uint32_t step = frame->sequence - unit->lastSequence;
+    if (step == 0 || step > UINT32_MAX / 2) {
+      // Séquence déjà vue, sauf redémarrage de l'émetteur (son horloge recule aussi)
+      if (frame->timestampMs < unit->lastUnitTime) {
+        unit->lastSequence = frame->sequence;
+      } else {
+        stats->reordered++;
+      }
+    } else {
+      stats->lost += step - 1;
+      unit->lastSequence = frame->sequence;
+    }
+  } else {
+    unit->lastSequence = frame->sequence;
+    unit->hasSequence = true;
+  }
+  unit->lastUnitTime = frame->timestampMs;
+
+  int64_t timeMs = stats->rows > 0 ? std::max(receivedMs, stats->lastTimeMs) : receivedMs;
+  if (stats->rows == 0) {
+    stats->firstTimeMs = timeMs;
+  }
+  stats->lastTimeMs = timeMs;
+
+  size_t row = unit->pending;
+  ((int64_t*)unit->buffers[COLUMN_TIME])[row] = timeMs;
+  ((uint32_t*)unit->buffers[COLUMN_SEQUENCE])[row] = frame->sequence;
+  ((uint32_t*)unit->buffers[COLUMN_UNIT_TIME])[row] = frame->timestampMs;
+  ((uint16_t*)unit->buffers[COLUMN_FLAGS])[row] = frame->flags;
+  for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+    ((float*)unit->buffers[COLUMN_FIRST_FIELD + f])[row] = frame->values[f];
+  }
+  unit->pending++;
+  stats->rows++;
+
+  if (unit->pending == COLUMN_FLUSH_ROWS && !flushUnit(unit)) {
+    store->rejected += COLUMN_FLUSH_ROWS;
+    return false;
+  }
+  return true;
+}
+
+bool columnStoreFlush(ColumnStore* store) {
+  bool ok = true;
+  for (int i = 0; i < store->unitCount; i++) {
+    ok = flushUnit(&store->units[i]) && ok;
+  }
+  return ok;
+}
+
+void columnStoreClose(ColumnStore* store) {
+  columnStoreFlush(store);
+  for (int i = 0; i < store->unitCount; i++) {
+    ColumnUnit* unit = &store->units[i];
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+      close(unit->fds[c]);
+      free(unit->buffers[c]);
+    }
+    close(unit->indexFd);
+  }
+  store->unitCount = 0;
+}
+
+ColumnUnitStats columnStoreUnitStats(const ColumnStore* store, int slot) {
+  return store->units[slot].stats;
+}
+
+int columnListUnits(const char* root, uint16_t* units, int maxUnits) {
+  DIR* dir = opendir(root);
+  if (dir == nullptr) {
+    return 0;
+  }
+  int count = 0;
+  struct dirent* entry;
+  unsigned id;
+  char tail;
+  while ((entry = readdir(dir)) != nullptr && count < maxUnits) {
+    if (sscanf(entry->d_name, "unit_%u%c", &id, &tail) == 1 && id <= UINT16_MAX) {
+      units[count++] = (uint16_t)id;
+    }
+  }
+  closedir(dir);
+  std::sort(units, units + count);
+  return count;
+}
+
+bool columnReaderOpen(ColumnReader* reader, const char* root, uint16_t unitId) {
+  memset(reader, 0, sizeof(ColumnReader));
+  reader->timeFd = -1;
+  reader->unitId = unitId;
+  unitDirectory(reader->dir, sizeof(reader->dir), root, unitId);
+
+  char path[COLUMN_PATH_MAX];
+  columnPath(path, sizeof(path), reader->dir, "time", "col");
+  reader->timeFd = open(path, O_RDONLY);
+  if (reader->timeFd < 0) {
+    return false;
+  }
+  reader->rows = countRows(reader->dir);
+
+  // Index en mémoire, limité aux lignes complètes
+  columnPath(path, sizeof(path), reader->dir, "time", "idx");
+  int64_t size = fileSize(path);
+  size_t entries = size > 0 ? (size_t)size / sizeof(ColumnIndexEntry) : 0;
+  if (entries > 0) {
+    reader->index = (ColumnIndexEntry*)malloc(entries * sizeof(ColumnIndexEntry));
+    int fd = open(path, O_RDONLY);
+    bool ok = reader->index != nullptr && fd >= 0 &&
+              readAt(fd, reader->index, entries * sizeof(ColumnIndexEntry), 0);
+    if (fd >= 0) {
+      close(fd);
+    }
+    if (!ok) {
+      columnReaderClose(reader);
+      return false;
+    }
+  }
+  while (entries > 0 && reader->index[entries - 1].row >= reader->rows) {
+    entries--;
+  }
+  reader->indexCount = entries;
+  return true;
+}
+
+/**
+ * Première ligne reçue à timeMs ou après (reader->rows si aucune)
+ */
+static bool lowerBound(ColumnReader* reader, int64_t timeMs, uint64_t* row) {
+  // Première entrée d'index à timeMs ou après : la ligne cherchée la précède
+  // de moins de COLUMN_INDEX_STRIDE lignes
+  const ColumnIndexEntry* begin = reader->index;
+  const ColumnIndexEntry* end = reader->index + reader->indexCount;
+  const ColumnIndexEntry* entry = std::lower_bound(begin, end, timeMs,
+      [](const ColumnIndexEntry& e, int64_t t) { return e.timeMs < t; });
+  uint64_t scanStart = entry == begin ? 0 : (entry - 1)->row;
+  uint64_t scanEnd = entry == end ? reader->rows : entry->row;
+
+  int64_t times[COLUMN_INDEX_STRIDE];
+  while (scanStart < scanEnd) {
+    size_t count = std::min<uint64_t>(scanEnd - scanStart, COLUMN_INDEX_STRIDE);
+    if (!readAt(reader->timeFd, times, count * sizeof(int64_t), scanStart * sizeof(int64_t))) {
+      return false;
+    }
+    const int64_t* found = std::lower_bound(times, times + count, timeMs);
+    if (found != times + count) {
+      *row = scanStart + (found - times);
+      return true;
+    }
+    scanStart += count;
+  }
+  *row = scanEnd;
+  return true;
+}
+
+bool columnReaderFindRange(ColumnReader* reader, int64_t fromMs, int64_t toMs,
+                           uint64_t* firstRow, uint64_t* endRow) {
+  if (!lowerBound(reader, fromMs, firstRow) || !lowerBound(reader, toMs, endRow)) {
+    return false;
+  }
+  *endRow = std::max(*firstRow, *endRow);
+  return true;
+}
+
+size_t columnReaderRead(ColumnReader* reader, int column, uint64_t firstRow, size_t count, void* out) {
+  if (column < 0 || column >= COLUMN_COUNT || firstRow >= reader->rows) {
+    return 0;
+  }
+  count = std::min<uint64_t>(count, reader->rows - firstRow);
+  char path[COLUMN_PATH_MAX];
+  columnPath(path, sizeof(path), reader->dir, columnName(column), "col");
+  int fd = column == COLUMN_TIME ? reader->timeFd : open(path, O_RDONLY);
+  if (fd < 0) {
+    return 0;
+  }
+  size_t size = columnSize(column);
+  bool ok = readAt(fd, out, count * size, firstRow * size);
+  if (column != COLUMN_TIME) {
+    close(fd);
+  }
+  return ok ? count : 0;
+}
+
+void columnReaderClose(ColumnReader* reader) {
+  if (reader->timeFd >= 0) {
+    close(reader->timeFd);
+  }
+  free(reader->index);
+  reader->index = nullptr;
+  reader->timeFd = -1;
+}
@@ -0,0 +1,229 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Stockage en colonnes de la station sol (Interface)
+  -----------------------
+
+  Archive de la télémétrie reçue de plusieurs kites : un répertoire par
+  kite, un fichier par champ, un index temporel clairsemé pour retrouver
+  une plage horaire sans lire les colonnes.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Écriture (réception) puis lecture d'une plage :
+
+    ColumnStore store;
+    columnStoreOpen(&store, "vols");
+    columnStoreAppend(&store, &frame, receivedMs);   // Trame décodée
+    columnStoreClose(&store);                        // Vide les tampons
+
+    ColumnReader reader;
+    columnReaderOpen(&reader, "vols", 3);
+    uint64_t first, end;
+    columnReaderFindRange(&reader, fromMs, toMs, &first, &end);
+    columnReaderRead(&reader, columnFind("pitch"), first, end - first, pitch);
+
+  Principales fonctionnalités exposées :
+  - columnStoreAppend() / columnStoreFlush() : Ajout en tampon, écriture par blocs
+  - columnReaderFindRange() : Lignes d'une plage horaire (recherche dichotomique)
+  - columnReaderRead() : Lecture d'une colonne sur un intervalle de lignes
+  - columnListUnits() : Kites présents dans une archive
+
+  Organisation sur disque (<racine>/unit_<id>/) :
+  - time.col      : i64, heure de réception (ms depuis l'époque, non décroissante)
+  - sequence.col  : u32, numéro de trame de l'émetteur
+  - unit_time.col : u32, millis() de l'émetteur
+  - flags.col     : u16, mode de l'autopilote
+  - <champ>.col   : f32, un fichier par champ de TELEMETRY_FIELD_NAMES
+  - time.idx      : {i64 heure, u64 ligne} toutes les COLUMN_INDEX_STRIDE lignes
+
+  Contraintes techniques :
+  - Fichiers bruts petit-boutistes, lisibles directement (numpy.fromfile)
+  - Le nombre de lignes d'un kite est celui de sa colonne la plus courte :
+    une écriture interrompue laisse une archive cohérente
+  - Les heures de réception sont rendues non décroissantes par kite, ce qui
+    permet la recherche dichotomique dans l'index et la colonne time
+*/
+
+#ifndef COLUMN_STORE_H
+#define COLUMN_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "communication/protocols.h"
+
+// === CONSTANTES ===
+#define COLUMN_INDEX_STRIDE   256     // Lignes entre deux entrées de l'index temporel
+#define COLUMN_FLUSH_ROWS     1024    // Lignes en tampon par kite avant écriture
+#define COLUMN_MAX_UNITS      64      // Kites suivis simultanément
+#define COLUMN_PATH_MAX       512
+
+// Colonnes d'une ligne : système puis champs de télémétrie
+typedef enum {
+  COLUMN_TIME = 0,
+  COLUMN_SEQUENCE,
+  COLUMN_UNIT_TIME,
+  COLUMN_FLAGS,
+  COLUMN_FIRST_FIELD,
+  COLUMN_COUNT = COLUMN_FIRST_FIELD + TELEMETRY_FIELD_COUNT
+} ColumnId;
+
+// === DÉFINITION DES TYPES ===
+
+// Entrée de l'index temporel
+typedef struct {
+  int64_t timeMs;                // Heure de réception de la ligne
+  uint64_t row;                  // Numéro de ligne
+} ColumnIndexEntry;
+
+// Statistiques de réception d'un kite
+typedef struct {
+  uint16_t unitId;
+  uint64_t rows;                 // Lignes archivées (tampon compris)
+  uint64_t lost;                 // Trames manquantes (sauts de séquence)
+  uint64_t reordered;            // Trames reçues en retard ou en double
+  int64_t firstTimeMs;           // Première et dernière réception
+  int64_t lastTimeMs;
+} ColumnUnitStats;
+
+// Kite en cours d'archivage
+typedef struct {
+  ColumnUnitStats stats;
+  int fds[COLUMN_COUNT];
+  int indexFd;
+  uint8_t* buffers[COLUMN_COUNT]; // COLUMN_FLUSH_ROWS valeurs par colonne
+  size_t pending;                // Lignes en tampon
+  uint32_t lastSequence;         // Dernière séquence en ordre
+  uint32_t lastUnitTime;         // millis() de l'émetteur à la dernière trame
+  bool hasSequence;
+} ColumnUnit;
+
+// Archive ouverte en écriture
+typedef struct {
+  char root[COLUMN_PATH_MAX];
+  ColumnUnit units[COLUMN_MAX_UNITS];
+  int unitCount;
+  uint64_t rejected;             // Trames refusées (table des kites pleine, erreur disque)
+} ColumnStore;
+
+// Kite ouvert en lecture
+typedef struct {
+  char dir[COLUMN_PATH_MAX];
+  uint16_t unitId;
+  uint64_t rows;
+  ColumnIndexEntry* index;
+  size_t indexCount;
+  int timeFd;
+} ColumnReader;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Taille d'une valeur d'une colonne
+ * @param column Colonne
+ * @return Octets par ligne
+ */
+size_t columnSize(int column);
+
+/**
+ * Nom (et nom de fichier) d'une colonne
+ * @param column Colonne
+ * @return Nom, ex. "time" ou "pitch"
+ */
+const char* columnName(int column);
+
+/**
+ * Colonne d'après son nom
+ * @param name Nom de colonne
+ * @return Colonne, ou -1 si le nom est inconnu
+ */
+int columnFind(const char* name);
+
+/**
+ * Ouvre (ou crée) une archive ; les kites existants sont complétés
+ * @param store Archive
+ * @param root Répertoire racine
+ * @return true si le répertoire est utilisable
+ */
+bool columnStoreOpen(ColumnStore* store, const char* root);
+
+/**
+ * Ajoute une trame reçue
+ * @param store Archive
+ * @param frame Trame décodée
+ * @param receivedMs Heure de réception (ms depuis l'époque)
+ * @return true si la ligne est archivée
+ */
+bool columnStoreAppend(ColumnStore* store, const TelemetryFrame* frame, int64_t receivedMs);
+
+/**
+ * Écrit les lignes en tampon de tous les kites
+ * @param store Archive
+ * @return true si toutes les écritures ont réussi
+ */
+bool columnStoreFlush(ColumnStore* store);
+
+/**
+ * Vide les tampons et ferme les fichiers
+ * @param store Archive
+ */
+void columnStoreClose(ColumnStore* store);
+
+/**
+ * Statistiques d'un kite de l'archive ouverte
+ * @param store Archive
+ * @param slot Rang du kite (0 à unitCount - 1)
+ * @return Statistiques de réception
+ */
+ColumnUnitStats columnStoreUnitStats(const ColumnStore* store, int slot);
+
+/**
+ * Liste les kites d'une archive
+ * @param root Répertoire racine
+ * @param units Identifiants trouvés (triés)
+ * @param maxUnits Capacité de units
+ * @return Nombre de kites
+ */
+int columnListUnits(const char* root, uint16_t* units, int maxUnits);
+
+/**
+ * Ouvre un kite en lecture (charge l'index temporel)
+ * @param reader Lecteur
+ * @param root Répertoire racine
+ * @param unitId Kite
+ * @return true si le kite existe
+ */
+bool columnReaderOpen(ColumnReader* reader, const char* root, uint16_t unitId);
+
+/**
+ * Lignes reçues dans [fromMs, toMs)
+ * @param reader Lecteur
+ * @param fromMs Début de la plage (inclus)
+ * @param toMs Fin de la plage (exclue)
+ * @param firstRow Première ligne de la plage
+ * @param endRow Ligne suivant la dernière de la plage
+ * @return true si la lecture a réussi (plage éventuellement vide)
+ */
+bool columnReaderFindRange(ColumnReader* reader, int64_t fromMs, int64_t toMs,
+                           uint64_t* firstRow, uint64_t* endRow);
+
+/**
+ * Lit les valeurs d'une colonne
+ * @param reader Lecteur
+ * @param column Colonne (columnFind())
+ * @param firstRow Première ligne
+ * @param count Nombre de lignes
+ * @param out Destination (count * columnSize(column) octets)
+ * @return Nombre de lignes lues
+ */
+size_t columnReaderRead(ColumnReader* reader, int column, uint64_t firstRow, size_t count, void* out);
+
+/**
+ * Ferme un lecteur
+ * @param reader Lecteur
+ */
+void columnReaderClose(ColumnReader* reader);
+
+#endif // COLUMN_STORE_H
@@ -0,0 +1,709 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Station sol (Point d'entrée)
+  -----------------------
+
+  Réception de la télémétrie d'un ou plusieurs kites (UDP, ports série),
+  archivage en colonnes, requêtes par plage horaire et export CSV.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  pio run -e native_ground && .pio/build/native_ground/program <commande> [options]
+
+  Commandes :
+  ingest --root <dir> [--port <n>] [--serial <tty>[:<bauds>]]...
+         Reçoit les trames (UDP sur --port, défaut TELEMETRY_UDP_PORT, et
+         chaque port série) jusqu'à Ctrl-C ; bilan toutes les 5 s
+  info   --root <dir>
+         Kites archivés, nombre de lignes et plage horaire
+  query  --root <dir> --unit <id> [--from <ms>] [--to <ms>] [--fields a,b,...]
+         Nombre de lignes, minimum, maximum et moyenne de chaque champ
+  export --root <dir> --unit <id> [--from <ms>] [--to <ms>] [--fields a,b,...] [--out <csv>]
+         Lignes de la plage en CSV (sortie standard par défaut)
+  decode --in <id.dat> [--out <csv>]
+         Décompresse une session enregistrée par le kite (fichier <id>.dat
+         copié depuis la flash) en CSV, avec le bilan octets par échantillon
+  send   [--host <ip>] [--port <n>] [--units <n>] [--rate <Hz>] [--duration <s>]
+         Générateur de charge : trames synthétiques de n kites
+
+  Les heures (--from, --to) sont en ms depuis l'époque, heure de réception ;
+  une valeur négative est relative à la dernière réception du kite
+  (--from -60000 : dernière minute).
+
+  Principe de la réception :
+  Une seule boucle poll() sur le socket UDP et les ports série ; le socket
+  est vidé par lots (recvmmsg) à chaque réveil, les ports série passent par
+  l'extracteur de trames du format partagé (communication/protocols.h).
+  Les tampons des kites sont écrits quand ils sont pleins et au moins
+  toutes les GROUND_FLUSH_INTERVAL_MS pour que les requêtes voient les
+  données récentes.
+*/
+
+#include "column_store.h"
+#include "communication/protocols.h"
+#include "utils/gorilla.h"
+#include "utils/session_format.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// === CONSTANTES ===
+#define GROUND_MAX_SERIAL          8
+#define GROUND_UDP_BATCH           64       // Datagrammes par appel recvmmsg
+#define GROUND_UDP_BUFFER          (4 << 20) // Tampon de réception du socket (octets)
+#define GROUND_FLUSH_INTERVAL_MS   1000
+#define GROUND_REPORT_INTERVAL_MS  5000
+#define GROUND_EXPORT_BATCH        4096     // Lignes lues par colonne et par passe
+
+// === DÉFINITION DES TYPES ===
+
+// Port série suivi par la réception
+typedef struct {
+  const char* path;
+  int fd;
+  TelemetryParser parser;
+} SerialInput;
+
+// Options de la ligne de commande
+typedef struct {
+  const char* root;
+  const char* in;
+  const char* host;
+  const char* out;
+  const char* fields;
+  const char* serial[GROUND_MAX_SERIAL];
+  int serialCount;
+  int port;
+  int unit;
+  int units;
+  float rate;
+  float duration;
+  int64_t fromMs;
+  int64_t toMs;
+} GroundOptions;
+
+// === VARIABLES GLOBALES ===
+static const char* const SESSION_CHANNEL_NAMES[SESSION_CHANNEL_COUNT] = {
+  "pitch", "roll", "yaw", "line_tension", "line_length", "wind_speed", "power", "direction"
+};
+
+static volatile sig_atomic_t stopRequested = 0;
+
+// === FONCTIONS INTERNES ===
+
+static int64_t nowMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int64_t monotonicUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void onSignal(int /*signal*/) {
+  stopRequested = 1;
+}
+
+static speed_t baudConstant(long baud) {
+  switch (baud) {
+    case 9600: return B9600;
+    case 57600: return B57600;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    default: return B115200;
+  }
+}
+
+/**
+ * Ouvre un port série en mode brut ("/dev/ttyUSB0:921600", 115200 bauds par défaut)
+ */
+static int openSerial(const char* spec, char* path, size_t size) {
+  snprintf(path, size, "%s", spec);
+  long baud = 115200;
+  char* colon = strrchr(path, ':');
+  if (colon != nullptr) {
+    baud = strtol(colon + 1, nullptr, 10);
+    *colon = '\0';
+  }
+  int fd = open(path, O_RDONLY | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) {
+    return -1;
+  }
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, baudConstant(baud));
+    cfsetospeed(&tio, baudConstant(baud));
+    tio.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+static int openUdp(int port) {
+  int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  int size = GROUND_UDP_BUFFER;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * Vide le socket UDP par lots de GROUND_UDP_BATCH datagrammes
+ * @return Trames invalides rencontrées
+ */
+static uint64_t drainUdp(int fd, ColumnStore* store, uint64_t* frames) {
+  static uint8_t buffers[GROUND_UDP_BATCH][TELEMETRY_MAX_FRAME_SIZE];
+  struct mmsghdr messages[GROUND_UDP_BATCH];
+  struct iovec iovecs[GROUND_UDP_BATCH];
+  uint64_t invalid = 0;
+
+  for (;;) {
+    memset(messages, 0, sizeof(messages));
+    for (int i = 0; i < GROUND_UDP_BATCH; i++) {
+      iovecs[i].iov_base = buffers[i];
+      iovecs[i].iov_len = TELEMETRY_MAX_FRAME_SIZE;
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    int count = recvmmsg(fd, messages, GROUND_UDP_BATCH, MSG_DONTWAIT, nullptr);
+    if (count <= 0) {
+      break;
+    }
+    int64_t receivedMs = nowMs();
+    for (int i = 0; i < count; i++) {
+      TelemetryFrame frame;
+      if (telemetryDecode(buffers[i], messages[i].msg_len, &frame) > 0) {
+        columnStoreAppend(store, &frame, receivedMs);
+        (*frames)++;
+      } else {
+        invalid++;
+      }
+    }
+    if (count < GROUND_UDP_BATCH) {
+      break;
+    }
+  }
+  return invalid;
+}
+
+static void drainSerial(SerialInput* input, ColumnStore* store, uint64_t* frames) {
+  uint8_t buffer[1024];
+  ssize_t count;
+  while ((count = read(input->fd, buffer, sizeof(buffer))) > 0) {
+    int64_t receivedMs = nowMs();
+    TelemetryFrame frame;
+    for (ssize_t i = 0; i < count; i++) {
+      if (telemetryParserFeed(&input->parser, buffer[i], &frame)) {
+        columnStoreAppend(store, &frame, receivedMs);
+        (*frames)++;
+      }
+    }
+  }
+}
+
+static void printIngestReport(const ColumnStore* store, uint64_t frames, uint64_t invalid,
+                              const SerialInput* serials, int serialCount, float seconds) {
+  printf("%.1f trames/s, %llu invalides UDP, %llu refusées, %d kites\n",
+         frames / seconds, (unsigned long long)invalid, (unsigned long long)store->rejected,
+         store->unitCount);
+  for (int i = 0; i < store->unitCount; i++) {
+    ColumnUnitStats stats = columnStoreUnitStats(store, i);
+    printf("  kite %5u : %10llu lignes, %llu perdues, %llu en retard\n", stats.unitId,
+           (unsigned long long)stats.rows, (unsigned long long)stats.lost,
+           (unsigned long long)stats.reordered);
+  }
+  for (int i = 0; i < serialCount; i++) {
+    printf("  %s : %u trames, %u CRC faux, %u octets hors trame\n", serials[i].path,
+           serials[i].parser.frames, serials[i].parser.crcErrors, serials[i].parser.skipped);
+  }
+  fflush(stdout);
+}
+
+static int commandIngest(const GroundOptions* options) {
+  static ColumnStore store;
+  if (!columnStoreOpen(&store, options->root)) {
+    return 1;
+  }
+
+  struct pollfd fds[GROUND_MAX_SERIAL + 1];
+  SerialInput serials[GROUND_MAX_SERIAL];
+  static char serialPaths[GROUND_MAX_SERIAL][256];
+  int udp = openUdp(options->port);
+  if (udp < 0) {
+    fprintf(stderr, "Port UDP %d indisponible : %s\n", options->port, strerror(errno));
+    return 1;
+  }
+  fds[0].fd = udp;
+  fds[0].events = POLLIN;
+  for (int i = 0; i < options->serialCount; i++) {
+    serials[i].fd = openSerial(options->serial[i], serialPaths[i], sizeof(serialPaths[i]));
+    serials[i].path = serialPaths[i];
+    if (serials[i].fd < 0) {
+      fprintf(stderr, "Port série %s indisponible : %s\n", serialPaths[i], strerror(errno));
+      return 1;
+    }
+    telemetryParserInit(&serials[i].parser);
+    fds[i + 1].fd = serials[i].fd;
+    fds[i + 1].events = POLLIN;
+  }
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  printf("Réception UDP :%d et %d port(s) série vers %s\n", options->port, options->serialCount, options->root);
+
+  uint64_t frames = 0;
+  uint64_t invalid = 0;
+  uint64_t reportFrames = 0;
+  int64_t lastFlush = monotonicUs();
+  int64_t lastReport = lastFlush;
+  while (!stopRequested) {
+    int ready = poll(fds, options->serialCount + 1, 100);
+    if (ready < 0 && errno != EINTR) {
+      perror("poll");
+      break;
+    }
+    if (ready > 0) {
+      if (fds[0].revents & POLLIN) {
+        invalid += drainUdp(udp, &store, &frames);
+      }
+      for (int i = 0; i < options->serialCount; i++) {
+        if (fds[i + 1].revents & POLLIN) {
+          drainSerial(&serials[i], &store, &frames);
+        }
+      }
+    }
+
+    int64_t now = monotonicUs();
+    if (now - lastFlush >= GROUND_FLUSH_INTERVAL_MS * 1000LL) {
+      columnStoreFlush(&store);
+      lastFlush = now;
+    }
+    if (now - lastReport >= GROUND_REPORT_INTERVAL_MS * 1000LL) {
+      printIngestReport(&store, frames - reportFrames, invalid, serials, options->serialCount,
+                        (now - lastReport) / 1e6f);
+      reportFrames = frames;
+      lastReport = now;
+    }
+  }
+
+  columnStoreClose(&store);
+  close(udp);
+  for (int i = 0; i < options->serialCount; i++) {
+    close(serials[i].fd);
+  }
+  printf("%llu trames archivées\n", (unsigned long long)frames);
+  return 0;
+}
+
+static int commandInfo(const GroundOptions* options) {
+  uint16_t units[COLUMN_MAX_UNITS * 16];
+  int count = columnListUnits(options->root, units, sizeof(units) / sizeof(units[0]));
+  printf("%d kite(s) dans %s\n", count, options->root);
+  for (int i = 0; i < count; i++) {
+    ColumnReader reader;
+    if (!columnReaderOpen(&reader, options->root, units[i])) {
+      continue;
+    }
+    int64_t first = 0;
+    int64_t last = 0;
+    if (reader.rows > 0) {
+      columnReaderRead(&reader, COLUMN_TIME, 0, 1, &first);
+      columnReaderRead(&reader, COLUMN_TIME, reader.rows - 1, 1, &last);
+    }
+    printf("  kite %5u : %10llu lignes, %lld -> %lld (%.1f s)\n", units[i],
+           (unsigned long long)reader.rows, (long long)first, (long long)last, (last - first) / 1000.0);
+    columnReaderClose(&reader);
+  }
+  return 0;
+}
+
+/**
+ * Colonnes demandées (--fields), tous les champs de télémétrie par défaut
+ */
+static int parseFields(const char* list, int* columns, int maxColumns) {
+  int count = 0;
+  if (list == nullptr) {
+    for (int c = COLUMN_FIRST_FIELD; c < COLUMN_COUNT && count < maxColumns; c++) {
+      columns[count++] = c;
+    }
+    return count;
+  }
+  char buffer[512];
+  snprintf(buffer, sizeof(buffer), "%s", list);
+  for (char* name = strtok(buffer, ","); name != nullptr && count < maxColumns; name = strtok(nullptr, ",")) {
+    int column = columnFind(name);
+    if (column < 0) {
+      fprintf(stderr, "Champ inconnu : %s\n", name);
+      return -1;
+    }
+    columns[count++] = column;
+  }
+  return count;
+}
+
+/**
+ * Ouvre le kite et résout la plage demandée en lignes
+ */
+static bool openRange(const GroundOptions* options, ColumnReader* reader, uint64_t* first, uint64_t* end) {
+  if (options->unit < 0 || !columnReaderOpen(reader, options->root, options->unit)) {
+    fprintf(stderr, "Kite %d absent de %s\n", options->unit, options->root);
+    return false;
+  }
+  int64_t last = 0;
+  if (reader->rows > 0) {
+    columnReaderRead(reader, COLUMN_TIME, reader->rows - 1, 1, &last);
+  }
+  int64_t from = options->fromMs < 0 && options->fromMs != INT64_MIN ? last + options->fromMs : options->fromMs;
+  int64_t to = options->toMs < 0 ? last + options->toMs : options->toMs;
+  if (!columnReaderFindRange(reader, from, to, first, end)) {
+    fprintf(stderr, "Lecture de l'index impossible\n");
+    columnReaderClose(reader);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Valeur d'une ligne d'une colonne lue, convertie en double
+ */
+static double columnValue(int column, const uint8_t* data, size_t row) {
+  switch (column) {
+    case COLUMN_TIME: return (double)((const int64_t*)data)[row];
+    case COLUMN_SEQUENCE:
+    case COLUMN_UNIT_TIME: return ((const uint32_t*)data)[row];
+    case COLUMN_FLAGS: return ((const uint16_t*)data)[row];
+    default: return ((const float*)data)[row];
+  }
+}
+
+static int commandQuery(const GroundOptions* options) {
+  int columns[COLUMN_COUNT];
+  int columnCount = parseFields(options->fields, columns, COLUMN_COUNT);
+  ColumnReader reader;
+  uint64_t first, end;
+  int64_t start = monotonicUs();
+  if (columnCount < 0 || !openRange(options, &reader, &first, &end)) {
+    return 1;
+  }
+  int64_t located = monotonicUs();
+
+  printf("Kite %d : lignes %llu à %llu (%llu), plage trouvée en %lld us\n", options->unit,
+         (unsigned long long)first, (unsigned long long)end, (unsigned long long)(end - first),
+         (long long)(located - start));
+  std::vector<uint8_t> data(GROUND_EXPORT_BATCH * sizeof(int64_t));
+  for (int i = 0; i < columnCount; i++) {
+    double minValue = INFINITY, maxValue = -INFINITY, sum = 0.0;
+    uint64_t valid = 0;
+    for (uint64_t row = first; row < end; row += GROUND_EXPORT_BATCH) {
+      size_t count = columnReaderRead(&reader, columns[i], row,
+                                      std::min<uint64_t>(GROUND_EXPORT_BATCH, end - row), data.data());
+      for (size_t r = 0; r < count; r++) {
+        double value = columnValue(columns[i], data.data(), r);
+        if (!isnan(value)) {
+          minValue = std::min(minValue, value);
+          maxValue = std::max(maxValue, value);
+          sum += value;
+          valid++;
+        }
+      }
+    }
+    printf("  %-15s min %12.3f  max %12.3f  moyenne %12.3f\n", columnName(columns[i]),
+           valid ? minValue : NAN, valid ? maxValue : NAN, valid ? sum / valid : NAN);
+  }
+  printf("Requête en %lld us\n", (long long)(monotonicUs() - start));
+  columnReaderClose(&reader);
+  return 0;
+}
+
+static int commandExport(const GroundOptions* options) {
+  int columns[COLUMN_COUNT + 1];
+  columns[0] = COLUMN_TIME;
+  int columnCount = parseFields(options->fields, columns + 1, COLUMN_COUNT);
+  ColumnReader reader;
+  uint64_t first, end;
+  if (columnCount < 0 || !openRange(options, &reader, &first, &end)) {
+    return 1;
+  }
+  columnCount++;
+
+  FILE* out = options->out != nullptr ? fopen(options->out, "w") : stdout;
+  if (out == nullptr) {
+    fprintf(stderr, "Impossible d'écrire %s\n", options->out);
+    columnReaderClose(&reader);
+    return 1;
+  }
+
+  for (int i = 0; i < columnCount; i++) {
+    fprintf(out, "%s%s", i ? "," : "", columnName(columns[i]));
+  }
+  fputc('\n', out);
+
+  // Lecture par lots de lignes, une passe par colonne, puis écriture ligne à ligne
+  std::vector<std::vector<uint8_t>> data(columnCount, std::vector<uint8_t>(GROUND_EXPORT_BATCH * sizeof(int64_t)));
+  for (uint64_t row = first; row < end; row += GROUND_EXPORT_BATCH) {
+    size_t count = std::min<uint64_t>(GROUND_EXPORT_BATCH, end - row);
+    for (int i = 0; i < columnCount; i++) {
+      count = std::min(count, columnReaderRead(&reader, columns[i], row, count, data[i].data()));
+    }
+    for (size_t r = 0; r < count; r++) {
+      fprintf(out, "%lld", (long long)((const int64_t*)data[0].data())[r]);
+      for (int i = 1; i < columnCount; i++) {
+        fprintf(out, ",%.6g", columnValue(columns[i], data[i].data(), r));
+      }
+      fputc('\n', out);
+    }
+  }
+
+  if (out != stdout) {
+    fclose(out);
+    fprintf(stderr, "%llu lignes exportées vers %s\n", (unsigned long long)(end - first), options->out);
+  }
+  columnReaderClose(&reader);
+  return 0;
+}
+
+/**
+ * Décompresse un fichier de session (<id>.dat) : blocs compressés ou bruts
+ */
+static int commandDecode(const GroundOptions* options) {
+  FILE* in = options->in != nullptr ? fopen(options->in, "rb") : nullptr;
+  if (in == nullptr) {
+    fprintf(stderr, "Impossible de lire %s\n", options->in ? options->in : "(--in manquant)");
+    return 1;
+  }
+  FILE* out = options->out != nullptr ? fopen(options->out, "w") : stdout;
+  if (out == nullptr) {
+    fprintf(stderr, "Impossible d'écrire %s\n", options->out);
+    fclose(in);
+    return 1;
+  }
+
+  fprintf(out, "timestamp_ms");
+  for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+    fprintf(out, ",%s", SESSION_CHANNEL_NAMES[c]);
+  }
+  fputc('\n', out);
+
+  static uint8_t block[SESSION_CHUNK_SIZE];
+  const SessionChunkHeader* header = (const SessionChunkHeader*)block;
+  const uint8_t* data = block + sizeof(SessionChunkHeader);
+  uint64_t samples = 0;
+  uint64_t encodedBytes = 0;
+  uint64_t blocks = 0;
+  int64_t start = monotonicUs();
+  int status = 0;
+
+  while (fread(block, sizeof(block), 1, in) == 1) {
+    bool compressed = header->magic == SESSION_CHUNK_MAGIC_GORILLA;
+    if ((!compressed && header->magic != SESSION_CHUNK_MAGIC) ||
+        (!compressed && header->count > SESSION_SAMPLES_PER_CHUNK) ||
+        (compressed && header->encodedBytes > SESSION_CHUNK_DATA_SIZE)) {
+      fprintf(stderr, "Bloc %llu invalide\n", (unsigned long long)blocks);
+      status = 1;
+      break;
+    }
+
+    GorillaDecoder decoder;
+    gorillaDecoderInit(&decoder, data, header->encodedBytes, SESSION_CHANNEL_COUNT, header->count);
+    for (uint16_t i = 0; i < header->count; i++) {
+      FlightSample sample;
+      if (!compressed) {
+        memcpy(&sample, data + i * sizeof(FlightSample), sizeof(sample));
+      } else if (!gorillaDecoderNext(&decoder, &sample.timestampMs, sample.values)) {
+        fprintf(stderr, "Bloc %llu tronqué à l'échantillon %u\n", (unsigned long long)blocks, i);
+        status = 1;
+        break;
+      }
+      fprintf(out, "%u", sample.timestampMs);
+      for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+        fprintf(out, ",%.9g", sample.values[c]);
+      }
+      fputc('\n', out);
+      samples++;
+    }
+    encodedBytes += compressed ? header->encodedBytes : header->count * sizeof(FlightSample);
+    blocks++;
+  }
+
+  fprintf(stderr, "%llu échantillons, %llu blocs en %lld us : %.2f octets/échantillon compressés, "
+          "%.2f sur la flash (brut : %u)\n", (unsigned long long)samples, (unsigned long long)blocks,
+          (long long)(monotonicUs() - start), samples ? (double)encodedBytes / samples : 0.0,
+          samples ? (double)blocks * SESSION_CHUNK_SIZE / samples : 0.0, (unsigned)sizeof(FlightSample));
+  fclose(in);
+  if (out != stdout) {
+    fclose(out);
+  }
+  return status;
+}
+
+/**
+ * Générateur de charge : options->units kites à options->rate Hz
+ */
+static int commandSend(const GroundOptions* options) {
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(options->port);
+  if (fd < 0 || inet_pton(AF_INET, options->host, &addr.sin_addr) != 1) {
+    fprintf(stderr, "Destination invalide : %s\n", options->host);
+    return 1;
+  }
+
+  const int64_t periodUs = (int64_t)(1e6f / options->rate);
+  const int64_t ticks = (int64_t)(options->duration * options->rate);
+  int64_t start = monotonicUs();
+  uint64_t sent = 0;
+  uint64_t failed = 0;
+  uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+  signal(SIGINT, onSignal);
+
+  for (int64_t tick = 0; tick < ticks && !stopRequested; tick++) {
+    int64_t due = start + tick * periodUs;
+    int64_t wait = due - monotonicUs();
+    if (wait > 0) {
+      usleep(wait);
+    }
+    for (int u = 0; u < options->units; u++) {
+      TelemetryFrame frame = {};
+      frame.unitId = u + 1;
+      frame.sequence = tick + 1;
+      frame.timestampMs = (uint32_t)(tick * periodUs / 1000);
+      float t = tick / options->rate + u;
+      frame.values[TELEMETRY_FIELD_PITCH] = 20.0f * sinf(t);
+      frame.values[TELEMETRY_FIELD_ROLL] = 35.0f * sinf(0.5f * t);
+      frame.values[TELEMETRY_FIELD_YAW] = fmodf(10.0f * t, 360.0f);
+      frame.values[TELEMETRY_FIELD_LINE_TENSION] = 40.0f + 10.0f * sinf(t);
+      frame.values[TELEMETRY_FIELD_LINE_LENGTH] = 10000.0f;
+      frame.values[TELEMETRY_FIELD_WIND_SPEED] = 8.0f + sinf(0.1f * t);
+      frame.values[TELEMETRY_FIELD_WIND_DIRECTION] = 270.0f;
+      frame.values[TELEMETRY_FIELD_POWER] = 400.0f + 100.0f * sinf(t);
+      frame.values[TELEMETRY_FIELD_DIRECTION] = 30.0f * sinf(0.5f * t);
+      frame.values[TELEMETRY_FIELD_TRIM] = 0.0f;
+      size_t length = telemetryEncode(&frame, buffer, sizeof(buffer));
+      if (sendto(fd, buffer, length, 0, (struct sockaddr*)&addr, sizeof(addr)) == (ssize_t)length) {
+        sent++;
+      } else {
+        failed++;
+      }
+    }
+  }
+
+  float elapsed = (monotonicUs() - start) / 1e6f;
+  printf("%llu trames envoyées en %.1f s (%.0f trames/s), %llu échecs\n", (unsigned long long)sent,
+         elapsed, sent / elapsed, (unsigned long long)failed);
+  close(fd);
+  return failed > 0 ? 1 : 0;
+}
+
+static void printUsage() {
+  fprintf(stderr,
+          "Usage : ground_station ingest|info|query|export|decode|send [options]\n"
+          "  --in <id.dat> --root <dir> --port <n> --serial <tty>[:<bauds>] --unit <id>\n"
+          "  --from <ms> --to <ms> --fields a,b,... --out <csv>\n"
+          "  --host <ip> --units <n> --rate <Hz> --duration <s>\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    printUsage();
+    return 2;
+  }
+  GroundOptions options = {};
+  options.root = "ground_data";
+  options.host = "127.0.0.1";
+  options.port = TELEMETRY_UDP_PORT;
+  options.unit = -1;
+  options.units = 20;
+  options.rate = 100.0f;
+  options.duration = 10.0f;
+  options.fromMs = INT64_MIN;
+  options.toMs = INT64_MAX;
+
+  for (int i = 2; i < argc; i++) {
+    const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (value == nullptr) {
+      fprintf(stderr, "Option sans valeur : %s\n", argv[i]);
+      return 2;
+    }
+    if (strcmp(argv[i], "--root") == 0) {
+      options.root = value;
+    } else if (strcmp(argv[i], "--in") == 0) {
+      options.in = value;
+    } else if (strcmp(argv[i], "--port") == 0) {
+      options.port = atoi(value);
+    } else if (strcmp(argv[i], "--serial") == 0 && options.serialCount < GROUND_MAX_SERIAL) {
+      options.serial[options.serialCount++] = value;
+    } else if (strcmp(argv[i], "--unit") == 0) {
+      options.unit = atoi(value);
+    } else if (strcmp(argv[i], "--from") == 0) {
+      options.fromMs = strtoll(value, nullptr, 10);
+    } else if (strcmp(argv[i], "--to") == 0) {
+      options.toMs = strtoll(value, nullptr, 10);
+    } else if (strcmp(argv[i], "--fields") == 0) {
+      options.fields = value;
+    } else if (strcmp(argv[i], "--out") == 0) {
+      options.out = value;
+    } else if (strcmp(argv[i], "--host") == 0) {
+      options.host = value;
+    } else if (strcmp(argv[i], "--units") == 0) {
+      options.units = atoi(value);
+    } else if (strcmp(argv[i], "--rate") == 0) {
+      options.rate = atof(value);
+    } else if (strcmp(argv[i], "--duration") == 0) {
+      options.duration = atof(value);
+    } else {
+      fprintf(stderr, "Option inconnue : %s\n", argv[i]);
+      return 2;
+    }
+    i++;
+  }
+
+  const char* command = argv[1];
+  if (strcmp(command, "ingest") == 0) {
+    return commandIngest(&options);
+  } else if (strcmp(command, "info") == 0) {
+    return commandInfo(&options);
+  } else if (strcmp(command, "query") == 0) {
+    return commandQuery(&options);
+  } else if (strcmp(command, "export") == 0) {
+    return commandExport(&options);
+  } else if (strcmp(command, "decode") == 0) {
+    return commandDecode(&options);
+  } else if (strcmp(command, "send") == 0) {
+    return commandSend(&options);
+  }
+  printUsage();
+  return 2;
+}
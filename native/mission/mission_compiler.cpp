@@ -0,0 +1,454 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compilateur des plans de vol (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Le texte est lu ligne par ligne, découpé en mots (espaces, tabulations),
+     les commentaires retirés ; chaque ligne produit au plus une instruction
+  2. Les repeat ouverts sont empilés ; le end correspondant écrit son
+     décalage de fin dans le REPEAT, ce qui permet de sauter une boucle de 0 tour
+  3. Un HALT termine toujours le code, puis l'en-tête (longueur) et le CRC
+     sont écrits : le plan est directement chargeable par missionLoad()
+  4. Les limites vérifiées par l'interpréteur (taille, imbrication, gardes,
+     plages des opérandes) sont signalées ici avec le numéro de ligne
+*/
+
+#include "mission_compiler.h"
+#include "communication/protocols.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+// === CONSTANTES ===
+#define MAX_LINE_LENGTH   160
+#define MAX_WORDS         10
+
+static const char* const MODE_NAMES[MISSION_MODE_COUNT] = {
+  "off", "figure8", "hover", "landing", "takeoff", "emergency", "calibration"
+};
+static const char* const SENSOR_NAMES[MISSION_SENSOR_COUNT] = {
+  "elevation", "azimuth", "wind", "gust", "line", "confidence"
+};
+static const char* const COMPARISON_NAMES[MISSION_CMP_COUNT] = {
+  "<", "<=", ">", ">="
+};
+static const char* const PARAM_NAMES[MISSION_PARAM_COUNT] = {
+  "figure8Width", "figure8Height", "turnSpeed", "aggressiveness", "windAdaptation", "maxWindSpeed"
+};
+static const char* const OPCODE_NAMES[MISSION_OP_COUNT] = {
+  "halt", "mode", "wait", "wait until", "wait cycles", "repeat", "end", "abort if", "set", "mark"
+};
+
+// === DÉFINITION DES TYPES ===
+
+typedef struct {
+  uint8_t* code;                 // Début des instructions
+  size_t capacity;               // Octets d'instructions disponibles
+  size_t length;
+  size_t openLoops[MISSION_MAX_DEPTH];
+  int openLines[MISSION_MAX_DEPTH];
+  int openCount;
+  int guards;
+  int line;
+  MissionCompileError* error;
+} Compiler;
+
+// === FONCTIONS INTERNES ===
+
+static bool fail(Compiler* compiler, const char* format, ...) {
+  compiler->error->line = compiler->line;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(compiler->error->message, sizeof(compiler->error->message), format, args);
+  va_end(args);
+  return false;
+}
+
+static int findName(const char* word, const char* const* names, int count) {
+  for (int i = 0; i < count; i++) {
+    if (strcmp(word, names[i]) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static bool emit(Compiler* compiler, const uint8_t* bytes, size_t size) {
+  if (compiler->length + size > compiler->capacity) {
+    return fail(compiler, "plan trop long (%d octets au plus)", (int)compiler->capacity);
+  }
+  memcpy(&compiler->code[compiler->length], bytes, size);
+  compiler->length += size;
+  return true;
+}
+
+static void putU16(uint8_t* p, uint16_t value) {
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+}
+
+static uint16_t getU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * Nombre décimal complet dans [minimum, maximum]
+ */
+static bool parseNumber(Compiler* compiler, const char* word, float minimum, float maximum, float* value) {
+  char* end = nullptr;
+  float parsed = strtof(word, &end);
+  if (end == word || *end != '\0' || !isfinite(parsed)) {
+    return fail(compiler, "nombre attendu : '%s'", word);
+  }
+  if (parsed < minimum || parsed > maximum) {
+    return fail(compiler, "%s hors de [%g, %g]", word, minimum, maximum);
+  }
+  *value = parsed;
+  return true;
+}
+
+static bool parseTenths(Compiler* compiler, const char* word, uint16_t* tenths) {
+  float seconds;
+  if (!parseNumber(compiler, word, 0.0f, UINT16_MAX / 10.0f, &seconds)) {
+    return false;
+  }
+  *tenths = (uint16_t)lroundf(seconds * 10.0f);
+  return true;
+}
+
+static bool parseCount(Compiler* compiler, const char* word, uint16_t* count) {
+  float value;
+  if (!parseNumber(compiler, word, 0.0f, UINT16_MAX, &value)) {
+    return false;
+  }
+  if (value != floorf(value)) {
+    return fail(compiler, "entier attendu : '%s'", word);
+  }
+  *count = (uint16_t)value;
+  return true;
+}
+
+static bool parseMode(Compiler* compiler, const char* word, uint8_t* mode) {
+  int index = findName(word, MODE_NAMES, MISSION_MODE_COUNT);
+  if (index < 0) {
+    return fail(compiler, "mode inconnu : '%s'", word);
+  }
+  *mode = (uint8_t)index;
+  return true;
+}
+
+/**
+ * <capteur> <comparaison> <seuil> : cond u8 puis seuil i16 en dixièmes
+ */
+static bool parseCondition(Compiler* compiler, char** words, uint8_t* operands) {
+  int sensor = findName(words[0], SENSOR_NAMES, MISSION_SENSOR_COUNT);
+  if (sensor < 0) {
+    return fail(compiler, "capteur inconnu : '%s'", words[0]);
+  }
+  int comparison = findName(words[1], COMPARISON_NAMES, MISSION_CMP_COUNT);
+  if (comparison < 0) {
+    return fail(compiler, "comparaison inconnue : '%s'", words[1]);
+  }
+  float threshold;
+  if (!parseNumber(compiler, words[2], INT16_MIN / 10.0f, INT16_MAX / 10.0f, &threshold)) {
+    return false;
+  }
+  operands[0] = (uint8_t)(sensor << 2 | comparison);
+  putU16(&operands[1], (uint16_t)(int16_t)lroundf(threshold * 10.0f));
+  return true;
+}
+
+/**
+ * Option finale "<mot-clé> <valeur>" ; absente si le mot-clé manque
+ */
+static bool optionalWord(Compiler* compiler, char** words, int count, int index,
+                         const char* keyword, const char** value) {
+  *value = nullptr;
+  if (count == index) {
+    return true;
+  }
+  if (count != index + 2 || strcmp(words[index], keyword) != 0) {
+    return fail(compiler, "'%s <valeur>' attendu en fin de ligne", keyword);
+  }
+  *value = words[index + 1];
+  return true;
+}
+
+static bool compileLine(Compiler* compiler, char** words, int count) {
+  const char* command = words[0];
+  uint8_t instruction[8] = {};
+  const char* option = nullptr;
+
+  if (strcmp(command, "mode") == 0 && count == 2) {
+    instruction[0] = MISSION_OP_MODE;
+    return parseMode(compiler, words[1], &instruction[1]) && emit(compiler, instruction, MISSION_OP_MODE_SIZE);
+  }
+
+  if (strcmp(command, "wait") == 0 && count >= 3 && strcmp(words[1], "until") == 0) {
+    uint16_t timeout = 0;
+    instruction[0] = MISSION_OP_WAIT_UNTIL;
+    if (count < 5) {
+      return fail(compiler, "wait until <capteur> <comparaison> <seuil> [timeout <s>]");
+    }
+    if (!parseCondition(compiler, &words[2], &instruction[1]) ||
+        !optionalWord(compiler, words, count, 5, "timeout", &option) ||
+        (option != nullptr && !parseTenths(compiler, option, &timeout))) {
+      return false;
+    }
+    putU16(&instruction[4], timeout);
+    return emit(compiler, instruction, MISSION_OP_WAIT_UNTIL_SIZE);
+  }
+
+  if (strcmp(command, "wait") == 0 && count >= 3 && strcmp(words[1], "cycles") == 0) {
+    uint16_t cycles, timeout = 0;
+    instruction[0] = MISSION_OP_WAIT_CYCLES;
+    if (!parseCount(compiler, words[2], &cycles) ||
+        !optionalWord(compiler, words, count, 3, "timeout", &option) ||
+        (option != nullptr && !parseTenths(compiler, option, &timeout))) {
+      return false;
+    }
+    putU16(&instruction[1], cycles);
+    putU16(&instruction[3], timeout);
+    return emit(compiler, instruction, MISSION_OP_WAIT_CYCLES_SIZE);
+  }
+
+  if (strcmp(command, "wait") == 0 && count == 2) {
+    uint16_t duration;
+    instruction[0] = MISSION_OP_WAIT;
+    if (!parseTenths(compiler, words[1], &duration)) {
+      return false;
+    }
+    putU16(&instruction[1], duration);
+    return emit(compiler, instruction, MISSION_OP_WAIT_SIZE);
+  }
+
+  if (strcmp(command, "repeat") == 0 && count == 2) {
+    uint16_t repetitions;
+    if (!parseCount(compiler, words[1], &repetitions)) {
+      return false;
+    }
+    if (compiler->openCount == MISSION_MAX_DEPTH) {
+      return fail(compiler, "plus de %d boucles imbriquées", MISSION_MAX_DEPTH);
+    }
+    compiler->openLoops[compiler->openCount] = compiler->length;
+    compiler->openLines[compiler->openCount] = compiler->line;
+    compiler->openCount++;
+    instruction[0] = MISSION_OP_REPEAT;
+    putU16(&instruction[1], repetitions);
+    return emit(compiler, instruction, MISSION_OP_REPEAT_SIZE);
+  }
+
+  if (strcmp(command, "end") == 0 && count == 1) {
+    if (compiler->openCount == 0) {
+      return fail(compiler, "end sans repeat");
+    }
+    instruction[0] = MISSION_OP_END;
+    if (!emit(compiler, instruction, MISSION_OP_END_SIZE)) {
+      return false;
+    }
+    size_t repeat = compiler->openLoops[--compiler->openCount];
+    putU16(&compiler->code[repeat + 3], (uint16_t)compiler->length);
+    return true;
+  }
+
+  if (strcmp(command, "abort") == 0 && count >= 5 && strcmp(words[1], "if") == 0) {
+    uint8_t mode = 5;  // emergency
+    if (!parseCondition(compiler, &words[2], &instruction[1]) ||
+        !optionalWord(compiler, words, count, 5, "then", &option) ||
+        (option != nullptr && !parseMode(compiler, option, &mode))) {
+      return false;
+    }
+    if (++compiler->guards > MISSION_MAX_GUARDS) {
+      return fail(compiler, "plus de %d gardes", MISSION_MAX_GUARDS);
+    }
+    instruction[0] = MISSION_OP_ABORT_IF;
+    instruction[4] = mode;
+    return emit(compiler, instruction, MISSION_OP_ABORT_IF_SIZE);
+  }
+
+  if (strcmp(command, "set") == 0 && count == 3) {
+    int param = findName(words[1], PARAM_NAMES, MISSION_PARAM_COUNT);
+    float value;
+    if (param < 0) {
+      return fail(compiler, "paramètre inconnu : '%s'", words[1]);
+    }
+    if (!parseNumber(compiler, words[2], 0.0f, 255.0f, &value)) {
+      return false;
+    }
+    instruction[0] = MISSION_OP_SET;
+    instruction[1] = (uint8_t)param;
+    putU16(&instruction[2], (uint16_t)lroundf(value));
+    return emit(compiler, instruction, MISSION_OP_SET_SIZE);
+  }
+
+  if (strcmp(command, "mark") == 0 && count == 2) {
+    float value;
+    if (!parseNumber(compiler, words[1], 0.0f, 255.0f, &value)) {
+      return false;
+    }
+    instruction[0] = MISSION_OP_MARK;
+    instruction[1] = (uint8_t)lroundf(value);
+    return emit(compiler, instruction, MISSION_OP_MARK_SIZE);
+  }
+
+  if (strcmp(command, "halt") == 0 && count == 1) {
+    instruction[0] = MISSION_OP_HALT;
+    return emit(compiler, instruction, MISSION_OP_HALT_SIZE);
+  }
+
+  return fail(compiler, "instruction inconnue ou incomplète : '%s'", command);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+int missionCompile(const char* source, uint8_t* out, size_t capacity, MissionCompileError* error) {
+  memset(error, 0, sizeof(MissionCompileError));
+  if (capacity < MISSION_HEADER_SIZE + MISSION_OP_HALT_SIZE + MISSION_CRC_SIZE) {
+    snprintf(error->message, sizeof(error->message), "tampon de sortie trop petit");
+    return -1;
+  }
+
+  Compiler compiler = {};
+  compiler.code = out + MISSION_HEADER_SIZE;
+  compiler.capacity = capacity - MISSION_HEADER_SIZE - MISSION_CRC_SIZE;
+  if (compiler.capacity > MISSION_MAX_CODE_SIZE) {
+    compiler.capacity = MISSION_MAX_CODE_SIZE;
+  }
+  compiler.error = error;
+
+  const char* cursor = source;
+  while (*cursor != '\0') {
+    compiler.line++;
+    char line[MAX_LINE_LENGTH];
+    size_t length = strcspn(cursor, "\n");
+    if (length >= sizeof(line)) {
+      fail(&compiler, "ligne trop longue");
+      return -1;
+    }
+    memcpy(line, cursor, length);
+    line[length] = '\0';
+    cursor += length + (cursor[length] == '\n' ? 1 : 0);
+
+    char* comment = strchr(line, '#');
+    if (comment != nullptr) {
+      *comment = '\0';
+    }
+    char* words[MAX_WORDS];
+    int count = 0;
+    for (char* word = strtok(line, " \t\r"); word != nullptr; word = strtok(nullptr, " \t\r")) {
+      if (count == MAX_WORDS) {
+        fail(&compiler, "trop de mots");
+        return -1;
+      }
+      words[count++] = word;
+    }
+    if (count > 0 && !compileLine(&compiler, words, count)) {
+      return -1;
+    }
+  }
+
+  if (compiler.openCount > 0) {
+    compiler.line = compiler.openLines[compiler.openCount - 1];
+    fail(&compiler, "repeat sans end");
+    return -1;
+  }
+  uint8_t halt = MISSION_OP_HALT;
+  compiler.line++;
+  if (!emit(&compiler, &halt, MISSION_OP_HALT_SIZE)) {
+    return -1;
+  }
+
+  uint32_t magic = MISSION_MAGIC;
+  putU16(&out[0], magic & 0xFFFF);
+  putU16(&out[2], magic >> 16);
+  out[4] = MISSION_FORMAT_VERSION;
+  out[5] = 0;
+  putU16(&out[6], (uint16_t)compiler.length);
+  size_t crcOffset = MISSION_HEADER_SIZE + compiler.length;
+  putU16(&out[crcOffset], telemetryCrc16(out, crcOffset));
+  return (int)(crcOffset + MISSION_CRC_SIZE);
+}
+
+int missionDisassemble(const uint8_t* code, size_t size, FILE* out) {
+  if (size < MISSION_HEADER_SIZE + MISSION_CRC_SIZE ||
+      size != (size_t)(MISSION_HEADER_SIZE + getU16(&code[6]) + MISSION_CRC_SIZE)) {
+    return -1;
+  }
+  const uint8_t* program = code + MISSION_HEADER_SIZE;
+  size_t length = getU16(&code[6]);
+  int count = 0;
+  int depth = 0;
+
+  for (size_t pc = 0; pc < length; count++) {
+    uint8_t opcode = program[pc];
+    if (opcode >= MISSION_OP_COUNT) {
+      return -1;
+    }
+    static const uint8_t sizes[MISSION_OP_COUNT] = {
+      MISSION_OP_HALT_SIZE, MISSION_OP_MODE_SIZE, MISSION_OP_WAIT_SIZE, MISSION_OP_WAIT_UNTIL_SIZE,
+      MISSION_OP_WAIT_CYCLES_SIZE, MISSION_OP_REPEAT_SIZE, MISSION_OP_END_SIZE,
+      MISSION_OP_ABORT_IF_SIZE, MISSION_OP_SET_SIZE, MISSION_OP_MARK_SIZE
+    };
+    if (pc + sizes[opcode] > length) {
+      return -1;
+    }
+    const uint8_t* operands = &program[pc + 1];
+    if (opcode == MISSION_OP_END && depth > 0) {
+      depth--;
+    }
+    fprintf(out, "%4u  %*s%s", (unsigned)pc, depth * 2, "", OPCODE_NAMES[opcode]);
+
+    uint8_t sensor = operands[0] >> 2;
+    uint8_t comparison = operands[0] & 0x3;
+    bool conditionValid = sensor < MISSION_SENSOR_COUNT && comparison < MISSION_CMP_COUNT;
+    switch (opcode) {
+      case MISSION_OP_MODE:
+        fprintf(out, " %s", operands[0] < MISSION_MODE_COUNT ? MODE_NAMES[operands[0]] : "?");
+        break;
+      case MISSION_OP_WAIT:
+        fprintf(out, " %.1f", getU16(operands) / 10.0f);
+        break;
+      case MISSION_OP_WAIT_UNTIL:
+      case MISSION_OP_ABORT_IF:
+        if (conditionValid) {
+          fprintf(out, " %s %s %.1f", SENSOR_NAMES[sensor], COMPARISON_NAMES[comparison],
+                  (int16_t)getU16(&operands[1]) / 10.0f);
+        }
+        if (opcode == MISSION_OP_WAIT_UNTIL && getU16(&operands[3]) > 0) {
+          fprintf(out, " timeout %.1f", getU16(&operands[3]) / 10.0f);
+        }
+        if (opcode == MISSION_OP_ABORT_IF && operands[3] < MISSION_MODE_COUNT) {
+          fprintf(out, " then %s", MODE_NAMES[operands[3]]);
+        }
+        break;
+      case MISSION_OP_WAIT_CYCLES:
+        fprintf(out, " %u", getU16(operands));
+        if (getU16(&operands[2]) > 0) {
+          fprintf(out, " timeout %.1f", getU16(&operands[2]) / 10.0f);
+        }
+        break;
+      case MISSION_OP_REPEAT:
+        fprintf(out, " %u  (fin : %u)", getU16(operands), getU16(&operands[2]));
+        depth++;
+        break;
+      case MISSION_OP_SET:
+        fprintf(out, " %s %d", operands[0] < MISSION_PARAM_COUNT ? PARAM_NAMES[operands[0]] : "?",
+                (int16_t)getU16(&operands[1]));
+        break;
+      case MISSION_OP_MARK:
+        fprintf(out, " %u", operands[0]);
+        break;
+      default:
+        break;
+    }
+    fprintf(out, "\n");
+    pc += sizes[opcode];
+  }
+  return count;
+}
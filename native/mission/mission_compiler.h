@@ -0,0 +1,87 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compilateur des plans de vol (Interface)
+  -----------------------
+
+  Traduction d'un plan de vol texte (.kpl) en code compact pour
+  l'interpréteur du firmware (control/mission_format.h), et listage d'un
+  plan compilé.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+    uint8_t code[MISSION_HEADER_SIZE + MISSION_MAX_CODE_SIZE + MISSION_CRC_SIZE];
+    MissionCompileError error;
+    int size = missionCompile(source, code, sizeof(code), &error);
+    if (size < 0) fprintf(stderr, "ligne %d : %s\n", error.line, error.message);
+
+  Langage (une instruction par ligne, '#' commente la fin de ligne,
+  indentation libre, durées en secondes au dixième) :
+
+    mode <off|figure8|hover|landing|takeoff|emergency|calibration>
+    wait <s>
+    wait until <capteur> <comparaison> <seuil> [timeout <s>]
+    wait cycles <n> [timeout <s>]
+    repeat <n>
+      ...
+    end
+    abort if <capteur> <comparaison> <seuil> [then <mode>]   (repli : emergency)
+    set <figure8Width|figure8Height|turnSpeed|aggressiveness|windAdaptation|maxWindSpeed> <valeur>
+    mark <0-255>
+    halt
+
+  Capteurs : elevation, azimuth (degrés), wind, gust (m/s), line (m),
+  confidence [0-100] ; comparaisons : <, <=, >, >=.
+
+  Principales fonctionnalités exposées :
+  - missionCompile() : Plan texte vers code (en-tête, instructions, HALT final, CRC)
+  - missionDisassemble() : Listage d'un plan compilé
+
+  Contraintes techniques :
+  - Une garde (abort if) ne prend effet qu'une fois franchie : la placer en
+    tête du plan pour qu'elle couvre tout le vol
+*/
+
+#ifndef MISSION_COMPILER_H
+#define MISSION_COMPILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "control/mission_format.h"
+
+// === CONSTANTES ===
+#define MISSION_MAX_PLAN_SIZE  (MISSION_HEADER_SIZE + MISSION_MAX_CODE_SIZE + MISSION_CRC_SIZE)
+
+// === DÉFINITION DES TYPES ===
+
+// Erreur de compilation
+typedef struct {
+  int line;                      // Ligne du plan (1 = première)
+  char message[96];
+} MissionCompileError;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Compile un plan de vol
+ * @param source Texte du plan (terminé par un zéro)
+ * @param out Plan compilé
+ * @param capacity Taille de out (MISSION_MAX_PLAN_SIZE suffit)
+ * @param error Erreur (ligne et message) si la compilation échoue
+ * @return Taille du plan compilé, -1 en cas d'erreur
+ */
+int missionCompile(const char* source, uint8_t* out, size_t capacity, MissionCompileError* error);
+
+/**
+ * Liste les instructions d'un plan compilé
+ * @param code Plan compilé
+ * @param size Taille du plan
+ * @param out Flux de sortie
+ * @return Nombre d'instructions, -1 si le plan est tronqué ou inconnu
+ */
+int missionDisassemble(const uint8_t* code, size_t size, FILE* out);
+
+#endif // MISSION_COMPILER_H
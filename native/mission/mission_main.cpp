@@ -0,0 +1,227 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Outil des plans de vol (Point d'entrée)
+  -----------------------
+
+  Compilation des plans de vol texte (.kpl) en code pour l'interpréteur du
+  firmware, génération de l'en-tête des plans intégrés et listage.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  pio run -e native_mission && .pio/build/native_mission/program <commande> [options]
+
+  Commandes :
+  compile <plan.kpl> [--out <plan.bin>]
+         Compile un plan (fichier binaire, à charger par missionLoad()) et
+         affiche sa taille et son listage
+  header  <plan.kpl>... [--out <mission_plans.h>]
+         Génère l'en-tête des plans rangés en flash (include/control/mission_plans.h),
+         nommés d'après leur fichier
+  disasm  <plan.bin>
+         Listage d'un plan compilé
+
+  Le vol d'un plan contre le simulateur de kite se fait avec la simulation
+  en boucle fermée : .pio/build/native_sim/program --mission <plan.kpl>
+
+  Le code de retour vaut 1 si un plan est invalide.
+*/
+
+#include "mission_compiler.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// === CONSTANTES ===
+#define MAX_SOURCE_SIZE   65536
+#define MAX_HEADER_PLANS  16
+
+// === FONCTIONS INTERNES ===
+
+static void usage() {
+  fprintf(stderr,
+          "Usage :\n"
+          "  compile <plan.kpl> [--out <plan.bin>]\n"
+          "  header  <plan.kpl>... [--out <mission_plans.h>]\n"
+          "  disasm  <plan.bin>\n");
+}
+
+/**
+ * Lit un fichier entier, terminé par un zéro
+ */
+static size_t readFile(const char* path, char* buffer, size_t capacity) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "Impossible de lire %s\n", path);
+    return 0;
+  }
+  size_t length = fread(buffer, 1, capacity - 1, file);
+  fclose(file);
+  buffer[length] = '\0';
+  return length;
+}
+
+static int compileFile(const char* path, uint8_t* code) {
+  static char source[MAX_SOURCE_SIZE];
+  if (readFile(path, source, sizeof(source)) == 0) {
+    return -1;
+  }
+  MissionCompileError error;
+  int size = missionCompile(source, code, MISSION_MAX_PLAN_SIZE, &error);
+  if (size < 0) {
+    fprintf(stderr, "%s:%d : %s\n", path, error.line, error.message);
+  }
+  return size;
+}
+
+/**
+ * Nom d'un plan : nom du fichier sans répertoire ni extension
+ */
+static void planName(const char* path, char* name, size_t size) {
+  const char* base = strrchr(path, '/');
+  base = base != nullptr ? base + 1 : path;
+  snprintf(name, size, "%s", base);
+  char* dot = strrchr(name, '.');
+  if (dot != nullptr) {
+    *dot = '\0';
+  }
+}
+
+static int commandCompile(const char* path, const char* outPath) {
+  uint8_t code[MISSION_MAX_PLAN_SIZE];
+  int size = compileFile(path, code);
+  if (size < 0) {
+    return 1;
+  }
+  int count = missionDisassemble(code, size, stdout);
+  printf("%s : %d instructions, %d octets\n", path, count, size);
+  if (outPath != nullptr) {
+    FILE* out = fopen(outPath, "wb");
+    if (out == nullptr || fwrite(code, 1, size, out) != (size_t)size) {
+      fprintf(stderr, "Impossible d'écrire %s\n", outPath);
+      if (out != nullptr) fclose(out);
+      return 1;
+    }
+    fclose(out);
+  }
+  return 0;
+}
+
+static int commandHeader(const char* const* paths, int count, const char* outPath) {
+  if (count > MAX_HEADER_PLANS) {
+    fprintf(stderr, "Au plus %d plans\n", MAX_HEADER_PLANS);
+    return 1;
+  }
+  FILE* out = outPath != nullptr ? fopen(outPath, "w") : stdout;
+  if (out == nullptr) {
+    fprintf(stderr, "Impossible d'écrire %s\n", outPath);
+    return 1;
+  }
+
+  fprintf(out,
+          "/*\n"
+          "  -----------------------\n"
+          "  Kite PiloteV3 - Plans de vol intégrés (généré)\n"
+          "  -----------------------\n"
+          "\n"
+          "  Généré par native/mission à partir des plans texte, ne pas modifier :\n"
+          "    cd native/mission/plans && ../../../.pio/build/native_mission/program header *.kpl \\\n"
+          "        --out ../../../include/control/mission_plans.h\n"
+          "\n"
+          "  Tableaux constants : rangés en flash, lus en place par l'interpréteur.\n"
+          "  Inclus par src/control/mission.cpp uniquement.\n"
+          "*/\n"
+          "\n"
+          "#ifndef MISSION_PLANS_H\n"
+          "#define MISSION_PLANS_H\n"
+          "\n"
+          "#include \"mission_format.h\"\n");
+
+  struct { char name[48]; char symbol[64]; } plans[MAX_HEADER_PLANS];
+  for (int i = 0; i < count; i++) {
+    uint8_t code[MISSION_MAX_PLAN_SIZE];
+    int size = compileFile(paths[i], code);
+    if (size < 0) {
+      if (out != stdout) fclose(out);
+      return 1;
+    }
+    planName(paths[i], plans[i].name, sizeof(plans[i].name));
+    strcpy(plans[i].symbol, "MISSION_PLAN_");
+    strncat(plans[i].symbol, plans[i].name, sizeof(plans[i].symbol) - strlen(plans[i].symbol) - 1);
+    for (char* c = plans[i].symbol; *c != '\0'; c++) {
+      *c = isalnum((unsigned char)*c) ? toupper((unsigned char)*c) : '_';
+    }
+    fprintf(out, "\n// %s (%d octets)\nstatic const uint8_t %s[] = {", plans[i].name, size, plans[i].symbol);
+    for (int b = 0; b < size; b++) {
+      fprintf(out, "%s0x%02X%s", b % 12 == 0 ? "\n  " : "", code[b], b + 1 < size ? "," : "");
+      if (b + 1 < size && b % 12 != 11) fputc(' ', out);
+    }
+    fprintf(out, "\n};\n");
+  }
+
+  fprintf(out, "\nstatic const MissionPlan MISSION_PLANS[] = {\n");
+  for (int i = 0; i < count; i++) {
+    fprintf(out, "  { \"%s\", %s, sizeof(%s) },\n", plans[i].name, plans[i].symbol, plans[i].symbol);
+  }
+  fprintf(out, "};\n\n#define MISSION_PLAN_COUNT  (sizeof(MISSION_PLANS) / sizeof(MISSION_PLANS[0]))\n"
+               "\n#endif // MISSION_PLANS_H\n");
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
+
+static int commandDisasm(const char* path) {
+  uint8_t code[MISSION_MAX_PLAN_SIZE];
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "Impossible de lire %s\n", path);
+    return 1;
+  }
+  size_t size = fread(code, 1, sizeof(code), file);
+  fclose(file);
+  if (missionDisassemble(code, size, stdout) < 0) {
+    fprintf(stderr, "%s : plan invalide\n", path);
+    return 1;
+  }
+  return 0;
+}
+
+// === POINT D'ENTRÉE ===
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    usage();
+    return 2;
+  }
+  const char* command = argv[1];
+  const char* outPath = nullptr;
+  const char* inputs[MAX_HEADER_PLANS + 1];
+  int inputCount = 0;
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else if (inputCount <= MAX_HEADER_PLANS) {
+      inputs[inputCount++] = argv[i];
+    }
+  }
+  if (inputCount == 0) {
+    usage();
+    return 2;
+  }
+
+  if (strcmp(command, "compile") == 0 && inputCount == 1) {
+    return commandCompile(inputs[0], outPath);
+  }
+  if (strcmp(command, "header") == 0) {
+    return commandHeader(inputs, inputCount, outPath);
+  }
+  if (strcmp(command, "disasm") == 0 && inputCount == 1) {
+    return commandDisasm(inputs[0]);
+  }
+  usage();
+  return 2;
+}
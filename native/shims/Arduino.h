@@ -0,0 +1,191 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim Arduino pour l'environnement natif
+  -----------------------
+  
+  Sous-ensemble minimal de l'API Arduino-ESP32 pour compiler et tester la
+  logique du firmware sur la machine hôte (env:native).
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== FONCTIONNEMENT =====
+  - millis()/micros() lisent une horloge simulée, avancée par delay(),
+    vTaskDelay() ou explicitement par les tests (nativeAdvanceMillis)
+  - analogRead()/digitalRead() renvoient des valeurs injectées par les tests
+  - Serial écrit sur la sortie standard (ou sur nativeSerialOutput)
+  - String reproduit le formatage Arduino (2 décimales pour les flottants)
+*/
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+
+#define NATIVE_PIN_COUNT 40
+
+// === ÉTAT SIMULÉ (manipulé par les tests) ===
+inline int nativeAnalogValues[NATIVE_PIN_COUNT] = {0};
+inline int nativeDigitalValues[NATIVE_PIN_COUNT] = {0};
+
+inline void nativeSetMillis(unsigned long ms) { nativeMicros = (uint64_t)ms * 1000ULL; }
+inline void nativeSetAnalog(uint8_t pin, int value) { if (pin < NATIVE_PIN_COUNT) nativeAnalogValues[pin] = value; }
+
+// === TEMPS ===
+inline unsigned long millis() { return (unsigned long)(nativeMicros / 1000ULL); }
+inline unsigned long micros() { return (unsigned long)nativeMicros; }
+inline void delay(unsigned long ms) { nativeAdvanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { nativeMicros += us; }
+inline void yield() {}
+
+// === HORLOGE CPU ===
+inline uint32_t nativeCpuFrequencyMhz = 240;
+inline bool setCpuFrequencyMhz(uint32_t mhz) { nativeCpuFrequencyMhz = mhz; return true; }
+inline uint32_t getCpuFrequencyMhz() { return nativeCpuFrequencyMhz; }
+
+// === E/S ===
+inline void pinMode(uint8_t, uint8_t) {}
+inline int analogRead(uint8_t pin) { return pin < NATIVE_PIN_COUNT ? nativeAnalogValues[pin] : 0; }
+inline int digitalRead(uint8_t pin) { return pin < NATIVE_PIN_COUNT ? nativeDigitalValues[pin] : LOW; }
+inline void digitalWrite(uint8_t pin, uint8_t value) { if (pin < NATIVE_PIN_COUNT) nativeDigitalValues[pin] = value; }
+
+// === MATHÉMATIQUES ===
+#define PI         3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define sq(x)      ((x) * (x))
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+template<typename T, typename L, typename H>
+inline T constrain(T x, L low, H high) {
+  return x < (T)low ? (T)low : (x > (T)high ? (T)high : x);
+}
+
+inline long random(long maxValue) { return maxValue > 0 ? rand() % maxValue : 0; }
+inline long random(long minValue, long maxValue) { return minValue + random(maxValue - minValue); }
+
+// === CHAÎNES ===
+class String {
+public:
+  String(const char* s = "") : str(s ? s : "") {}
+  String(const std::string& s) : str(s) {}
+  String(char c) : str(1, c) {}
+  String(int v) : str(std::to_string(v)) {}
+  String(unsigned int v) : str(std::to_string(v)) {}
+  String(long v) : str(std::to_string(v)) {}
+  String(unsigned long v) : str(std::to_string(v)) {}
+  String(long long v) : str(std::to_string(v)) {}
+  String(unsigned long long v) : str(std::to_string(v)) {}
+  String(unsigned char v) : str(std::to_string(v)) {}
+  String(float v, unsigned int decimals = 2) : str(format(v, decimals)) {}
+  String(double v, unsigned int decimals = 2) : str(format(v, decimals)) {}
+
+  const char* c_str() const { return str.c_str(); }
+  unsigned int length() const { return str.length(); }
+  bool isEmpty() const { return str.empty(); }
+  long toInt() const { return atol(str.c_str()); }
+  float toFloat() const { return (float)atof(str.c_str()); }
+  int indexOf(const char* s) const { size_t p = str.find(s); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(char c) const { size_t p = str.find(c); return p == std::string::npos ? -1 : (int)p; }
+  String substring(unsigned int from) const { return String(str.substr(from)); }
+  String substring(unsigned int from, unsigned int to) const { return String(str.substr(from, to - from)); }
+  bool startsWith(const char* s) const { return str.rfind(s, 0) == 0; }
+  bool endsWith(const char* s) const { size_t n = strlen(s); return str.size() >= n && str.compare(str.size() - n, n, s) == 0; }
+  bool reserve(unsigned int size) { str.reserve(size); return true; }
+  void remove(unsigned int index) { if (index < str.size()) str.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < str.size()) str.erase(index, count); }
+  char operator[](unsigned int i) const { return str[i]; }
+
+  String& operator+=(const String& other) { str += other.str; return *this; }
+  String& operator+=(const char* other) { str += other; return *this; }
+  String& operator+=(char c) { str += c; return *this; }
+  bool operator==(const String& other) const { return str == other.str; }
+  bool operator==(const char* other) const { return str == other; }
+  bool operator!=(const String& other) const { return str != other.str; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+  friend String operator+(const String& a, const char* b) { return String(a.str + b); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.str); }
+
+private:
+  static std::string format(double v, unsigned int decimals) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, v);
+    return std::string(buffer);
+  }
+  std::string str;
+};
+
+// === PORT SÉRIE ===
+// Flux de sortie du port série simulé (redirigeable, ex. pour les mesures de performance)
+inline FILE* nativeSerialOutput = stdout;
+
+class NativeSerial {
+public:
+  void begin(unsigned long) {}
+  explicit operator bool() const { return true; }
+  size_t print(const char* s) { return fputs(s, nativeSerialOutput) >= 0 ? strlen(s) : 0; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(int v) { return fprintf(nativeSerialOutput, "%d", v); }
+  size_t println(const char* s = "") { size_t n = print(s); fputc('\n', nativeSerialOutput); return n + 1; }
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    int n = vfprintf(nativeSerialOutput, format, args);
+    va_end(args);
+    return n > 0 ? (size_t)n : 0;
+  }
+  void flush() { fflush(nativeSerialOutput); }
+};
+inline NativeSerial Serial;
+
+// === SYSTÈME ===
+// Tas libre simulé (modifiable par les tests et l'injection de fautes)
+inline uint32_t nativeFreeHeap = 200000;
+
+class NativeEsp {
+public:
+  uint32_t getFreeHeap() { return nativeFreeHeap; }
+  uint32_t getHeapSize() { return 320000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 110000; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  void restart() { exit(0); }
+};
+inline NativeEsp ESP;
+
+#endif // NATIVE_ARDUINO_H
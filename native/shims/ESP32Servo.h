@@ -0,0 +1,33 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim ESP32Servo pour l'environnement natif
+  -----------------------
+  
+  Servomoteur simulé : mémorise l'angle commandé.
+*/
+
+#ifndef NATIVE_ESP32SERVO_H
+#define NATIVE_ESP32SERVO_H
+
+#include <Arduino.h>
+
+class ESP32PWM {
+public:
+  static void allocateTimer(int) {}
+};
+
+class Servo {
+public:
+  int attach(int pin, int /*minPulse*/ = 544, int /*maxPulse*/ = 2400) { attachedPin = pin; return 1; }
+  void detach() { attachedPin = -1; }
+  bool attached() const { return attachedPin >= 0; }
+  void write(int value) { angle = value; }
+  void writeMicroseconds(int) {}
+  int read() const { return angle; }
+  void setPeriodHertz(int) {}
+private:
+  int attachedPin = -1;
+  int angle = 90;
+};
+
+#endif // NATIVE_ESP32SERVO_H
@@ -0,0 +1,50 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim LiquidCrystal_I2C pour l'environnement natif
+  -----------------------
+  
+  Écran LCD sans matériel : les caractères écrits sont conservés dans une
+  mémoire d'affichage et chaque accès au bus est compté (nativeLcdBusWrites).
+*/
+
+#ifndef NATIVE_LIQUIDCRYSTAL_I2C_H
+#define NATIVE_LIQUIDCRYSTAL_I2C_H
+
+#include <Arduino.h>
+
+inline uint32_t nativeLcdBusWrites = 0;
+
+class LiquidCrystal_I2C {
+public:
+  LiquidCrystal_I2C(uint8_t /*addr*/, uint8_t cols, uint8_t rows) : cols(cols), rows(rows), col(0), row(0) { clear(); }
+  bool init() { return true; }
+  void begin(uint8_t, uint8_t) {}
+  void backlight() {}
+  void noBacklight() {}
+  void clear() { memset(ddram, ' ', sizeof(ddram)); col = row = 0; nativeLcdBusWrites++; }
+  void home() { col = row = 0; nativeLcdBusWrites++; }
+  void setCursor(uint8_t c, uint8_t r) { col = c; row = r; nativeLcdBusWrites++; }
+  void createChar(uint8_t, uint8_t*) { nativeLcdBusWrites++; }
+  size_t write(uint8_t value) {
+    if (row < 4 && col < 20) ddram[row][col] = (char)value;
+    col++;
+    nativeLcdBusWrites++;
+    return 1;
+  }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(const char* s) { size_t n = 0; while (*s) n += write((uint8_t)*s++); return n; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(int v) { char b[12]; snprintf(b, sizeof(b), "%d", v); return print(b); }
+  size_t print(unsigned int v) { char b[12]; snprintf(b, sizeof(b), "%u", v); return print(b); }
+  size_t print(long v) { char b[24]; snprintf(b, sizeof(b), "%ld", v); return print(b); }
+  size_t print(unsigned long v) { char b[24]; snprintf(b, sizeof(b), "%lu", v); return print(b); }
+  char charAt(uint8_t c, uint8_t r) const { return (r < 4 && c < 20) ? ddram[r][c] : '\0'; }
+private:
+  uint8_t cols;
+  uint8_t rows;
+  uint8_t col;
+  uint8_t row;
+  char ddram[4][20];
+};
+
+#endif // NATIVE_LIQUIDCRYSTAL_I2C_H
@@ -0,0 +1,36 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim LittleFS pour l'environnement natif
+  -----------------------
+
+  Sur la cible, LittleFS est monté dans le VFS et les modules y accèdent par
+  stdio/POSIX. Sur l'hôte, le montage crée NATIVE_LITTLEFS_ROOT dans le
+  répertoire courant ; les chemins des modules y sont redirigés par les
+  build_flags de env:native (ex. SESSION_STORAGE_ROOT).
+*/
+
+#ifndef NATIVE_LITTLEFS_H
+#define NATIVE_LITTLEFS_H
+
+#include <Arduino.h>
+#include <sys/stat.h>
+
+#define NATIVE_LITTLEFS_ROOT "native_littlefs"  // Point de montage sur l'hôte
+
+class NativeLittleFS {
+public:
+  bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10) {
+    (void)formatOnFail;
+    (void)basePath;
+    (void)maxOpenFiles;
+    struct stat st;
+    mounted = stat(NATIVE_LITTLEFS_ROOT, &st) == 0 || mkdir(NATIVE_LITTLEFS_ROOT, 0775) == 0;
+    return mounted;
+  }
+  void end() { mounted = false; }
+private:
+  bool mounted = false;
+};
+inline NativeLittleFS LittleFS;
+
+#endif // NATIVE_LITTLEFS_H
@@ -0,0 +1,63 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim Preferences (NVS) pour l'environnement natif
+  -----------------------
+  
+  NVS en mémoire : les espaces de noms survivent aux instances Preferences
+  pendant l'exécution du programme, comme sur la cible entre deux redémarrages.
+*/
+
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> NativeNvsNamespace;
+inline std::map<std::string, NativeNvsNamespace> nativeNvs;
+
+class Preferences {
+public:
+  bool begin(const char* name, bool /*readOnly*/ = false) { space = &nativeNvs[name]; return true; }
+  void end() { space = nullptr; }
+  bool clear() { if (!space) return false; space->clear(); return true; }
+  bool remove(const char* key) { return space && space->erase(key) > 0; }
+  bool isKey(const char* key) { return space && space->count(key) > 0; }
+
+  size_t putBytes(const char* key, const void* value, size_t length) {
+    if (!space) return 0;
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    (*space)[key].assign(bytes, bytes + length);
+    return length;
+  }
+  size_t getBytesLength(const char* key) {
+    if (!space || !space->count(key)) return 0;
+    return (*space)[key].size();
+  }
+  size_t getBytes(const char* key, void* buffer, size_t maxLength) {
+    size_t length = getBytesLength(key);
+    if (length == 0 || length > maxLength) return 0;
+    memcpy(buffer, (*space)[key].data(), length);
+    return length;
+  }
+
+  size_t putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+  uint32_t getUInt(const char* key, uint32_t defaultValue = 0) {
+    uint32_t value = defaultValue;
+    getBytes(key, &value, sizeof(value));
+    return value;
+  }
+  size_t putULong64(const char* key, uint64_t value) { return putBytes(key, &value, sizeof(value)); }
+  uint64_t getULong64(const char* key, uint64_t defaultValue = 0) {
+    uint64_t value = defaultValue;
+    getBytes(key, &value, sizeof(value));
+    return value;
+  }
+
+private:
+  NativeNvsNamespace* space = nullptr;
+};
+
+#endif // NATIVE_PREFERENCES_H
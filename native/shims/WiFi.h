@@ -0,0 +1,43 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim WiFi pour l'environnement natif
+  -----------------------
+  
+  Interface WiFi toujours déconnectée, suffisante pour compiler l'affichage.
+*/
+
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+class IPAddress {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) { bytes[0] = a; bytes[1] = b; bytes[2] = c; bytes[3] = d; }
+  uint8_t operator[](int index) const { return bytes[index & 3]; }
+  String toString() const {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return String(buffer);
+  }
+private:
+  uint8_t bytes[4];
+};
+
+class NativeWiFi {
+public:
+  wl_status_t status() { return WL_DISCONNECTED; }
+  String SSID() { return String(""); }
+  IPAddress localIP() { return IPAddress(); }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+  int32_t RSSI() { return 0; }
+};
+inline NativeWiFi WiFi;
+
+#endif // NATIVE_WIFI_H
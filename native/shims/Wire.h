@@ -0,0 +1,29 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim Wire (I2C) pour l'environnement natif
+  -----------------------
+  
+  Bus I2C sans périphérique : toutes les transmissions échouent (NAK).
+*/
+
+#ifndef NATIVE_WIRE_H
+#define NATIVE_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool begin(int /*sda*/ = -1, int /*scl*/ = -1, uint32_t /*frequency*/ = 0) { return true; }
+  bool end() { return true; }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool /*stop*/ = true) { return 2; }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  size_t write(uint8_t) { return 1; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+inline TwoWire Wire;
+
+#endif // NATIVE_WIRE_H
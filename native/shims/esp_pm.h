@@ -0,0 +1,72 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim esp_pm (gestion de l'énergie) pour l'environnement natif
+  -----------------------
+  
+  Configuration et verrous mémorisés pour que les tests vérifient la
+  politique : nativePmSupported simule un sdkconfig sans CONFIG_PM_ENABLE,
+  nativePmLockCount[] donne le nombre de verrous tenus par type.
+*/
+
+#ifndef NATIVE_ESP_PM_H
+#define NATIVE_ESP_PM_H
+
+#include <stdint.h>
+
+#ifndef ESP_OK
+typedef int esp_err_t;
+#define ESP_OK                 0
+#define ESP_FAIL               -1
+#define ESP_ERR_INVALID_ARG    0x102
+#define ESP_ERR_INVALID_STATE  0x103
+#define ESP_ERR_NOT_SUPPORTED  0x106
+#endif
+
+typedef struct {
+  int max_freq_mhz;
+  int min_freq_mhz;
+  bool light_sleep_enable;
+} esp_pm_config_esp32_t;
+
+typedef enum {
+  ESP_PM_CPU_FREQ_MAX = 0,
+  ESP_PM_APB_FREQ_MAX,
+  ESP_PM_NO_LIGHT_SLEEP
+} esp_pm_lock_type_t;
+
+struct NativePmLock {
+  esp_pm_lock_type_t type;
+  int count;
+};
+typedef NativePmLock* esp_pm_lock_handle_t;
+
+inline bool nativePmSupported = true;
+inline esp_pm_config_esp32_t nativePmConfig = {240, 240, false};
+inline int nativePmLockCount[3] = {0, 0, 0};
+
+inline esp_err_t esp_pm_configure(const void* config) {
+  if (!nativePmSupported) return ESP_ERR_NOT_SUPPORTED;
+  nativePmConfig = *(const esp_pm_config_esp32_t*)config;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_pm_lock_create(esp_pm_lock_type_t type, int, const char*, esp_pm_lock_handle_t* handle) {
+  if (!nativePmSupported) return ESP_ERR_NOT_SUPPORTED;
+  *handle = new NativePmLock{type, 0};
+  return ESP_OK;
+}
+
+inline esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle) {
+  handle->count++;
+  nativePmLockCount[handle->type]++;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle) {
+  if (handle->count == 0) return ESP_ERR_INVALID_STATE;
+  handle->count--;
+  nativePmLockCount[handle->type]--;
+  return ESP_OK;
+}
+
+#endif // NATIVE_ESP_PM_H
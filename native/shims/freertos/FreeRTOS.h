@@ -0,0 +1,39 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim FreeRTOS pour l'environnement natif
+  -----------------------
+  
+  Types et macros FreeRTOS minimaux pour compiler le firmware sur l'hôte.
+  Le temps est celui de l'horloge simulée du shim Arduino (1 tick = 1 ms).
+*/
+
+#ifndef NATIVE_FREERTOS_H
+#define NATIVE_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+#define portMAX_DELAY        ((TickType_t)0xFFFFFFFF)
+#define configTICK_RATE_HZ   1000
+#define portTICK_PERIOD_MS   1
+#define pdMS_TO_TICKS(ms)    ((TickType_t)(ms))
+#define tskNO_AFFINITY       0x7FFFFFFF
+
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux)  ((void)(mux))
+#define portMUX_INITIALIZER_UNLOCKED 0
+typedef int portMUX_TYPE;
+
+// Horloge simulée partagée avec le shim Arduino (µs)
+inline uint64_t nativeMicros = 0;
+inline void nativeAdvanceMillis(unsigned long ms) { nativeMicros += (uint64_t)ms * 1000ULL; }
+
+#endif // NATIVE_FREERTOS_H
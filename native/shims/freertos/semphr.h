@@ -0,0 +1,66 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim FreeRTOS (sémaphores) pour l'environnement natif
+  -----------------------
+  
+  Mutex et sémaphores implémentés avec la bibliothèque standard, utilisables
+  depuis plusieurs threads hôtes (simulateur, bancs d'essai).
+*/
+
+#ifndef NATIVE_FREERTOS_SEMPHR_H
+#define NATIVE_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+struct NativeSemaphore {
+  std::mutex lock;
+  std::condition_variable available;
+  UBaseType_t count;
+  UBaseType_t maxCount;
+};
+typedef NativeSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t nativeCreateSemaphore(UBaseType_t maxCount, UBaseType_t initialCount) {
+  SemaphoreHandle_t sem = new NativeSemaphore();
+  sem->count = initialCount;
+  sem->maxCount = maxCount;
+  return sem;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return nativeCreateSemaphore(1, 1); }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return nativeCreateSemaphore(1, 1); }
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return nativeCreateSemaphore(1, 0); }
+inline SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount) {
+  return nativeCreateSemaphore(maxCount, initialCount);
+}
+inline void vSemaphoreDelete(SemaphoreHandle_t sem) { delete sem; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  std::unique_lock<std::mutex> guard(sem->lock);
+  if (ticks == portMAX_DELAY) {
+    sem->available.wait(guard, [sem] { return sem->count > 0; });
+  } else if (!sem->available.wait_for(guard, std::chrono::milliseconds(ticks),
+                                      [sem] { return sem->count > 0; })) {
+    return pdFALSE;
+  }
+  sem->count--;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  std::lock_guard<std::mutex> guard(sem->lock);
+  if (sem->count >= sem->maxCount) {
+    return pdFALSE;
+  }
+  sem->count++;
+  sem->available.notify_one();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t*) { return xSemaphoreGive(sem); }
+inline UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem) { return sem->count; }
+
+#endif // NATIVE_FREERTOS_SEMPHR_H
@@ -0,0 +1,81 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Shim FreeRTOS (tâches) pour l'environnement natif
+  -----------------------
+  
+  L'ordonnanceur n'est jamais démarré sur l'hôte : les délais font avancer
+  l'horloge simulée et la création de tâche échoue proprement.
+  nativeTaskStatus[] et nativeTotalRunTime donnent aux tests la table des
+  tâches renvoyée par uxTaskGetSystemState().
+*/
+
+#ifndef NATIVE_FREERTOS_TASK_H
+#define NATIVE_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum {
+  eRunning = 0,
+  eReady,
+  eBlocked,
+  eSuspended,
+  eDeleted,
+  eInvalid
+} eTaskState;
+
+typedef struct {
+  TaskHandle_t xHandle;
+  const char* pcTaskName;
+  UBaseType_t xTaskNumber;
+  eTaskState eCurrentState;
+  UBaseType_t uxCurrentPriority;
+  UBaseType_t uxBasePriority;
+  uint32_t ulRunTimeCounter;
+  uint32_t usStackHighWaterMark;
+  BaseType_t xCoreID;              // Lu par xTaskGetAffinity() dans le shim
+} TaskStatus_t;
+
+#define NATIVE_MAX_TASKS 32
+inline TaskStatus_t nativeTaskStatus[NATIVE_MAX_TASKS];
+inline UBaseType_t nativeTaskCount = 0;
+inline uint32_t nativeTotalRunTime = 0;
+
+#define taskSCHEDULER_NOT_STARTED 1
+#define taskSCHEDULER_RUNNING     2
+
+inline BaseType_t xTaskGetSchedulerState() { return taskSCHEDULER_NOT_STARTED; }
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+inline const char* pcTaskGetName(TaskHandle_t) { return "native"; }
+inline TickType_t xTaskGetTickCount() { return (TickType_t)(nativeMicros / 1000ULL); }
+inline void vTaskDelay(TickType_t ticks) { nativeAdvanceMillis(ticks); }
+inline void vTaskDelayUntil(TickType_t* previous, TickType_t increment) {
+  *previous += increment;
+  TickType_t now = xTaskGetTickCount();
+  if (*previous > now) nativeAdvanceMillis(*previous - now);
+}
+inline void vTaskDelete(TaskHandle_t) {}
+inline void vTaskSuspend(TaskHandle_t) {}
+inline void vTaskResume(TaskHandle_t) {}
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 1024; }
+inline BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*) { return pdFAIL; }
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t,
+                                          TaskHandle_t*, BaseType_t) { return pdFAIL; }
+inline BaseType_t xPortGetCoreID() { return 0; }
+inline UBaseType_t uxTaskGetNumberOfTasks() { return nativeTaskCount; }
+inline UBaseType_t uxTaskGetSystemState(TaskStatus_t* array, UBaseType_t size, uint32_t* totalRunTime) {
+  if (size < nativeTaskCount) return 0;
+  for (UBaseType_t i = 0; i < nativeTaskCount; i++) array[i] = nativeTaskStatus[i];
+  if (totalRunTime != nullptr) *totalRunTime = nativeTotalRunTime;
+  return nativeTaskCount;
+}
+inline BaseType_t xTaskGetAffinity(TaskHandle_t handle) {
+  for (UBaseType_t i = 0; i < nativeTaskCount; i++) {
+    if (nativeTaskStatus[i].xHandle == handle) return nativeTaskStatus[i].xCoreID;
+  }
+  return tskNO_AFFINITY;
+}
+
+#endif // NATIVE_FREERTOS_TASK_H
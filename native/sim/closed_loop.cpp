@@ -0,0 +1,247 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Boucle fermée simulée (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Réinitialisation du simulateur, de l'horloge simulée et des servos
+  2. Premier cycle en mode OFF pour que l'autopilote connaisse la longueur de
+     ligne et la position, puis activation du mode du scénario ou démarrage
+     du plan de vol
+  3. Boucle : simulateur +50 ms, millis() +50 ms, battement de cœur et
+     autopilotControlStep() avec l'échantillon IMU simulé, comme diffusé par
+     la tâche des capteurs (sautés si la tâche de contrôle est bloquée par
+     une faute), puis surveillance de santé et fautes toutes les
+     HEALTH_CHECK_INTERVAL ms
+  4. Métriques accumulées après settleTime : écart entre le cap demandé par
+     l'autopilote et le cap vrai du simulateur (virages compris), tension,
+     puissance, enveloppe de vol et nombre de figures en 8
+
+  Contraintes techniques :
+  - Le temps de calcul est mesuré avec l'horloge de l'hôte (steady_clock),
+    indépendante de l'horloge simulée des shims
+*/
+
+#include "closed_loop.h"
+#include "hardware/actuators/servo.h"
+#include "core/logging.h"
+#include "utils/health_monitor.h"
+#include "utils/fault_injection.h"
+#include "control/launch_sequencer.h"
+#include <chrono>
+#include <math.h>
+#include <string.h>
+
+// === CONSTANTES ===
+#define CLOSED_LOOP_STEP_MS AUTOPILOT_UPDATE_INTERVAL
+
+// === FONCTIONS INTERNES ===
+
+/**
+ * Écart entre le cap demandé par l'autopilote et le cap vrai du kite
+ */
+static float headingErrorToTarget(const AutopilotState& autopilot, const KiteSimState& sim) {
+  return fmodf(autopilot.targetAngle - sim.heading + 540.0f, 360.0f) - 180.0f;
+}
+
+/**
+ * Pilote du treuil des commandes datées : vitesse de déroulement du simulateur
+ */
+static bool setSimWinchSpeed(float speed) {
+  kiteSimSetReelSpeed(speed);
+  return true;
+}
+
+static void writeTraceHeader(FILE* trace) {
+  fprintf(trace, "time,elevation,azimuth,heading,target_azimuth,target_elevation,"
+                 "steering_command,steering_angle,tension,line_length,power,wind,"
+                 "predicted_wind,predicted_wind_upper,gust_depower,mode\n");
+}
+
+static void writeTraceLine(FILE* trace, const KiteSimState& sim, const AutopilotState& autopilot) {
+  fprintf(trace, "%.2f,%.2f,%.2f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.2f,%.1f,%.2f,%.2f,%.2f,%.2f,%d\n",
+          sim.time, sim.elevation, sim.azimuth, sim.heading,
+          autopilot.windowTarget[0], autopilot.windowTarget[1],
+          sim.steeringCommand, sim.steeringAngle, sim.tension, sim.lineLength,
+          sim.power, sim.groundWindSpeed, autopilot.predictedWindSpeed,
+          autopilot.predictedWindUpper, autopilot.gustDepower, (int)autopilot.currentMode);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void closedLoopDefaultConfig(ClosedLoopConfig* config) {
+  kiteSimDefaultConfig(&config->sim);
+  config->mode = AUTOPILOT_FIGURE_8;
+  config->duration = 120.0f;
+  config->settleTime = 10.0f;
+  config->reelSpeed = 0.0f;
+  config->trace = nullptr;
+  config->faultScenario = false;
+  config->mission = nullptr;
+  config->missionSize = 0;
+  config->commands = nullptr;
+  config->commandCount = 0;
+}
+
+/**
+ * Cycle de contrôle avec l'échantillon IMU simulé, tel que la tâche des
+ * capteurs le diffuse à l'autopilote
+ */
+static void controlStep() {
+  IMUData imu;
+  autopilotControlStep(imuReadProcessedData(&imu) ? &imu : nullptr);
+}
+
+bool closedLoopRun(const ClosedLoopConfig& config, ClosedLoopResult* result) {
+  memset(result, 0, sizeof(ClosedLoopResult));
+  result->minElevation = 90.0f;
+  result->maxElevation = -90.0f;
+  result->minAzimuth = 180.0f;
+  result->maxAzimuth = -180.0f;
+
+  autopilotInit();
+  setAutopilotMode(AUTOPILOT_OFF);
+  nativeSetMillis(0);
+  kiteSimInit(&config.sim);
+  kiteSimSetReelSpeed(config.reelSpeed);
+  servoInitAll();
+  healthMonitorInit();
+  if (config.faultScenario) {
+    faultInjectionStart();
+  }
+
+  const float step = CLOSED_LOOP_STEP_MS / 1000.0f;
+  kiteSimStep(step);
+  nativeAdvanceMillis(CLOSED_LOOP_STEP_MS);
+  controlStep();
+  commandSchedulerInit(CLOSED_LOOP_STEP_MS);
+  commandSchedulerSetWinchHandler(setSimWinchSpeed);
+  launchSequenceSetWinchHandler(setSimWinchSpeed);
+  for (int i = 0; i < config.commandCount; i++) {
+    if (commandSchedulerSubmit(&config.commands[i], COMMAND_SOURCE_LOCAL, millis(), nullptr) != COMMAND_QUEUED) {
+      return false;
+    }
+  }
+  missionInit();
+  if (config.mission != nullptr) {
+    if (!missionLoad(config.mission, config.missionSize) || !missionStart(millis())) {
+      return false;
+    }
+  } else {
+    setAutopilotMode(config.mode);
+  }
+
+  if (config.trace != nullptr) {
+    writeTraceHeader(config.trace);
+  }
+
+  double squaredErrorSum = 0;
+  double tensionSum = 0;
+  double powerSum = 0;
+  int samples = 0;
+  int8_t lastSide = getAutopilotState().figure8Side;
+  int turns = 0;
+
+  unsigned long lastHealthCheck = millis();
+
+  auto wallStart = std::chrono::steady_clock::now();
+  KiteSimState sim = kiteSimGetState();
+
+  while (sim.time < config.duration) {
+    kiteSimStep(step);
+    nativeAdvanceMillis(CLOSED_LOOP_STEP_MS);
+
+    // Tâche de contrôle
+    if (!FAULT_TASK_STALLED(FAULT_TASK_CONTROL)) {
+      healthMonitorHeartbeat(HEALTH_TASK_CONTROL);
+      commandSchedulerService(millis());
+      missionStep(millis());
+      controlStep();
+    }
+
+    // Tâche de surveillance
+    if (millis() - lastHealthCheck >= HEALTH_CHECK_INTERVAL) {
+      lastHealthCheck = millis();
+      faultInjectionUpdate();
+      healthMonitorUpdate();
+    }
+
+    sim = kiteSimGetState();
+    AutopilotState autopilot = getAutopilotState();
+
+    if (config.trace != nullptr) {
+      writeTraceLine(config.trace, sim, autopilot);
+    }
+
+    // Sécurité de la station : le treuil est freiné en mode urgence
+    if (autopilot.currentMode == AUTOPILOT_EMERGENCY) {
+      kiteSimSetReelSpeed(0);
+    }
+
+    if (sim.crashed) {
+      result->crashed = true;
+      result->crashTime = sim.time;
+      break;
+    }
+    if (sim.time < config.settleTime) {
+      lastSide = autopilot.figure8Side;
+      continue;
+    }
+
+    if (autopilot.figure8Side != lastSide) {
+      turns++;
+      lastSide = autopilot.figure8Side;
+    }
+
+    float error = headingErrorToTarget(autopilot, sim);
+    squaredErrorSum += (double)error * error;
+    if (fabsf(error) > result->maxHeadingError) result->maxHeadingError = fabsf(error);
+
+    tensionSum += sim.tension;
+    powerSum += sim.power;
+    if (sim.tension > result->peakTension) result->peakTension = sim.tension;
+    if (sim.power > result->peakPower) result->peakPower = sim.power;
+    if (sim.elevation < result->minElevation) result->minElevation = sim.elevation;
+    if (sim.elevation > result->maxElevation) result->maxElevation = sim.elevation;
+    if (sim.azimuth < result->minAzimuth) result->minAzimuth = sim.azimuth;
+    if (sim.azimuth > result->maxAzimuth) result->maxAzimuth = sim.azimuth;
+    samples++;
+  }
+
+  std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wallStart;
+
+  result->simulatedTime = sim.time;
+  result->wallTime = (float)wall.count();
+  result->realTimeFactor = result->wallTime > 0 ? sim.time / result->wallTime : 0;
+  if (samples > 0) {
+    result->rmsHeadingError = (float)sqrt(squaredErrorSum / samples);
+    result->meanTension = (float)(tensionSum / samples);
+    result->meanPower = (float)(powerSum / samples);
+  }
+  result->figure8Cycles = turns / 2;
+  result->finalMode = getAutopilotMode();
+  MissionStatus mission;
+  missionGetStatus(&mission);
+  result->missionState = mission.state;
+
+  setAutopilotMode(AUTOPILOT_OFF);
+  return !result->crashed;
+}
+
+void closedLoopPrintReport(const ClosedLoopResult& result) {
+  Serial.printf("Temps simulé        : %.1f s (%.0fx temps réel)\n", result.simulatedTime, result.realTimeFactor);
+  Serial.printf("Erreur de cap       : RMS %.1f°, max %.1f°\n", result.rmsHeadingError, result.maxHeadingError);
+  Serial.printf("Tension             : moyenne %.0f N, crête %.0f N\n", result.meanTension, result.peakTension);
+  Serial.printf("Puissance au treuil : moyenne %.0f W, crête %.0f W\n", result.meanPower, result.peakPower);
+  Serial.printf("Élévation           : %.1f° à %.1f°\n", result.minElevation, result.maxElevation);
+  Serial.printf("Azimut              : %.1f° à %.1f°\n", result.minAzimuth, result.maxAzimuth);
+  Serial.printf("Figures en 8        : %d\n", result.figure8Cycles);
+  Serial.printf("Mode final          : %d\n", (int)result.finalMode);
+  if (result.crashed) {
+    Serial.printf("CRASH à t = %.1f s\n", result.crashTime);
+  }
+}
@@ -0,0 +1,104 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Boucle fermée simulée (Interface)
+  -----------------------
+
+  Exécution de l'autopilote contre le simulateur de kite, plus vite que le
+  temps réel, et calcul des métriques de vol.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Principales fonctionnalités exposées :
+  - closedLoopDefaultConfig() : Scénario par défaut (figure en 8, 120 s)
+  - closedLoopRun() : Exécution d'un scénario et métriques
+  - closedLoopPrintReport() : Affichage des métriques
+
+  Principe :
+  Le simulateur avance par tranches de AUTOPILOT_UPDATE_INTERVAL ; l'horloge
+  simulée (millis()) avance d'autant puis autopilotControlStep() reçoit
+  l'échantillon IMU simulé, lit les autres capteurs simulés et commande le
+  servo, comme la tâche de contrôle du firmware.
+  La surveillance de santé et le scénario de fautes chargé au préalable
+  (faultInjectionParseScript / faultInjectionLoadScript) sont mis à jour
+  toutes les HEALTH_CHECK_INTERVAL ms, comme la tâche de surveillance.
+  Avec un plan de vol, missionStep() précède autopilotControlStep() à chaque
+  cycle, comme dans la tâche de contrôle, et le plan choisit les modes.
+  Les commandes datées sont exécutées juste avant, au pas de la boucle ;
+  celles du treuil règlent la vitesse de déroulement du simulateur, comme
+  le séquenceur de décollage et d'atterrissage.
+*/
+
+#ifndef CLOSED_LOOP_H
+#define CLOSED_LOOP_H
+
+#include <stdio.h>
+#include "kite_sim.h"
+#include "control/autopilot.h"
+#include "control/mission.h"
+#include "control/command_scheduler.h"
+
+// === DÉFINITION DES TYPES ===
+
+// Scénario de simulation
+typedef struct {
+  KiteSimConfig sim;          // Kite, ligne, vent
+  AutopilotMode mode;         // Mode de l'autopilote pendant le scénario
+  float duration;             // Durée simulée (s)
+  float settleTime;           // Durée ignorée par les métriques (décollage) (s)
+  float reelSpeed;            // Vitesse de déroulement imposée (m/s)
+  FILE* trace;                // Trace CSV (nullptr = aucune)
+  bool faultScenario;         // Démarre le scénario de fautes chargé
+  const uint8_t* mission;     // Plan de vol compilé qui remplace le mode fixe (nullptr = aucun)
+  size_t missionSize;         // Taille du plan compilé
+  const CommandFrame* commands; // Commandes datées soumises au démarrage (instants en ms simulées)
+  int commandCount;
+} ClosedLoopConfig;
+
+// Métriques d'un scénario
+typedef struct {
+  float simulatedTime;        // Temps simulé (s)
+  float wallTime;             // Temps de calcul (s)
+  float realTimeFactor;       // Temps simulé / temps de calcul
+  float rmsHeadingError;      // Erreur de cap RMS vers le point visé (degrés)
+  float maxHeadingError;      // Erreur de cap maximale (degrés)
+  float meanTension;          // Tension moyenne (N)
+  float peakTension;          // Tension maximale (N)
+  float meanPower;            // Puissance mécanique moyenne au treuil (W)
+  float peakPower;            // Puissance mécanique maximale (W)
+  float minElevation;         // Élévation minimale (degrés)
+  float maxElevation;         // Élévation maximale (degrés)
+  float minAzimuth;           // Azimut minimal (degrés)
+  float maxAzimuth;           // Azimut maximal (degrés)
+  int figure8Cycles;          // Figures en 8 complètes (deux virages)
+  bool crashed;               // Contact avec le sol
+  float crashTime;            // Instant du contact (s)
+  AutopilotMode finalMode;    // Mode de l'autopilote en fin de scénario
+  MissionState missionState;  // État du plan de vol en fin de scénario
+} ClosedLoopResult;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Remplit un scénario par défaut : figure en 8 pendant 120 s, vent de 8 m/s
+ * @param config Scénario à remplir
+ */
+void closedLoopDefaultConfig(ClosedLoopConfig* config);
+
+/**
+ * Exécute un scénario (réinitialise le simulateur et l'horloge simulée)
+ * @param config Scénario
+ * @param result Métriques calculées
+ * @return true si le kite n'a pas touché le sol (false aussi si le plan de vol est refusé)
+ */
+bool closedLoopRun(const ClosedLoopConfig& config, ClosedLoopResult* result);
+
+/**
+ * Affiche les métriques d'un scénario sur la console
+ * @param result Métriques
+ */
+void closedLoopPrintReport(const ClosedLoopResult& result);
+
+#endif // CLOSED_LOOP_H
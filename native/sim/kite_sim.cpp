@@ -0,0 +1,366 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Simulateur de kite captif (Implémentation)
+  -----------------------
+
+  Intégration du modèle point matériel du kite, de la ligne et du vent.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  À chaque pas (1 ms, Euler semi-implicite) :
+  1. Vent local = profil vertical + turbulence + rafale en cours
+  2. Vent apparent = vent local - vitesse du kite
+  3. Portance perpendiculaire au vent apparent, dans le plan (vent apparent,
+     ligne), inclinée de l'angle de roulis produit par le servo de direction
+  4. Traînée du kite et de la ligne (surface équivalente d * L / 4)
+  5. Tension = raideur x allongement + amortissement, nulle si la ligne est molle
+  6. Intégration vitesse puis position, déroulement de la ligne
+
+  Le cap est celui du nez du kite : opposé du vent apparent projeté dans le
+  plan tangent à la sphère de vol (0 = vers le zénith, 90 = vers la droite).
+
+  Contraintes techniques :
+  - Générateur pseudo-aléatoire xorshift32 : une graine donne toujours la même
+    simulation, quel que soit l'hôte
+  - Aucune allocation dynamique
+*/
+
+#include "kite_sim.h"
+#include <math.h>
+#include <string.h>
+
+// === CONSTANTES ===
+#define SIM_DEG_TO_RAD      0.017453292f
+#define SIM_RAD_TO_DEG      57.29578f
+#define SIM_CRASH_ALTITUDE  0.5f     // Altitude considérée comme un contact au sol (m)
+#define SIM_ANEMOMETER_HEIGHT 3.0f   // Hauteur de l'anémomètre de la station (m)
+#define SIM_MIN_APPARENT_WIND 0.1f   // En dessous, forces aérodynamiques ignorées (m/s)
+
+// === VARIABLES GLOBALES ===
+
+static KiteSimConfig simConfig;
+static KiteSimState simState;
+static uint32_t rngState = 1;
+static float turbulence = 0;          // Composante turbulente du vent (m/s)
+static float gustStart = 0;           // Début de la prochaine rafale (s)
+static float previousHeading = 0;     // Pour la vitesse de cap
+
+// === FONCTIONS INTERNES ===
+
+static uint32_t nextRandom() {
+  // xorshift32
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static float uniformRandom() {
+  return (nextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+// Loi normale centrée réduite (Box-Muller)
+static float gaussianRandom() {
+  float u1 = uniformRandom();
+  float u2 = uniformRandom();
+  if (u1 < 1e-7f) u1 = 1e-7f;
+  return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * (float)M_PI * u2);
+}
+
+static float dot(const float a[3], const float b[3]) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static float norm(const float a[3]) {
+  return sqrtf(dot(a, a));
+}
+
+static void cross(const float a[3], const float b[3], float out[3]) {
+  out[0] = a[1] * b[2] - a[2] * b[1];
+  out[1] = a[2] * b[0] - a[0] * b[2];
+  out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static void scheduleNextGust() {
+  if (simConfig.gustInterval <= 0) {
+    gustStart = INFINITY;
+    return;
+  }
+  // Intervalles exponentiels (rafales indépendantes)
+  float u = uniformRandom();
+  if (u < 1e-6f) u = 1e-6f;
+  gustStart = simState.time + simConfig.gustDuration - simConfig.gustInterval * logf(u);
+}
+
+/**
+ * Vitesse du vent moyen + turbulence + rafale à une altitude donnée
+ */
+static float windAtHeight(float z) {
+  if (z < SIM_CRASH_ALTITUDE) z = SIM_CRASH_ALTITUDE;
+  float mean = simConfig.windSpeed * powf(z / simConfig.windReferenceHeight, simConfig.windShearExponent);
+
+  float gust = 0;
+  float t = simState.time - gustStart;
+  if (t >= 0 && t <= simConfig.gustDuration) {
+    gust = 0.5f * simConfig.gustAmplitude * (1.0f - cosf(2.0f * (float)M_PI * t / simConfig.gustDuration));
+  }
+
+  float speed = mean + turbulence + gust;
+  return speed > 0 ? speed : 0;
+}
+
+/**
+ * Angles de la ligne et base locale de la sphère de vol
+ * eElevation : vers le zénith, eAzimuth : vers la droite du pilote
+ */
+static void sphericalFrame(const float position[3], float* elevation, float* azimuth,
+                           float eElevation[3], float eAzimuth[3]) {
+  float horizontal = sqrtf(position[0] * position[0] + position[1] * position[1]);
+  float el = atan2f(position[2], horizontal);
+  float az = atan2f(-position[1], position[0]);
+  *elevation = el;
+  *azimuth = az;
+
+  eElevation[0] = -sinf(el) * cosf(az);
+  eElevation[1] = sinf(el) * sinf(az);
+  eElevation[2] = cosf(el);
+  eAzimuth[0] = -sinf(az);
+  eAzimuth[1] = -cosf(az);
+  eAzimuth[2] = 0;
+}
+
+static void updateServo(float dt) {
+  float error = simState.steeringCommand - simState.steeringAngle;
+  float rate = error / simConfig.servoTimeConstant;
+  if (rate > simConfig.servoRateLimit) rate = simConfig.servoRateLimit;
+  if (rate < -simConfig.servoRateLimit) rate = -simConfig.servoRateLimit;
+  simState.steeringAngle += rate * dt;
+}
+
+static void updateTurbulence(float dt) {
+  // Processus d'Ornstein-Uhlenbeck : écart-type stationnaire sigma
+  float sigma = simConfig.turbulenceIntensity * simConfig.windSpeed;
+  float tau = simConfig.turbulenceTimeConstant;
+  turbulence += -turbulence / tau * dt + sigma * sqrtf(2.0f * dt / tau) * gaussianRandom();
+
+  if (simState.time > gustStart + simConfig.gustDuration) {
+    scheduleNextGust();
+  }
+}
+
+/**
+ * Un pas d'intégration
+ */
+static void integrate(float dt) {
+  float* p = simState.position;
+  float* v = simState.velocity;
+
+  updateServo(dt);
+  updateTurbulence(dt);
+
+  // Vent local et vent apparent
+  float windSpeed = windAtHeight(p[2]);
+  simState.wind[0] = windSpeed;
+  simState.wind[1] = 0;
+  simState.wind[2] = 0;
+  float apparent[3] = {simState.wind[0] - v[0], simState.wind[1] - v[1], simState.wind[2] - v[2]};
+  float apparentSpeed = norm(apparent);
+  simState.apparentWindSpeed = apparentSpeed;
+
+  float distance = norm(p);
+  float radial[3] = {p[0] / distance, p[1] / distance, p[2] / distance};
+
+  float force[3] = {0, 0, 0};
+
+  if (apparentSpeed > SIM_MIN_APPARENT_WIND) {
+    float eWind[3] = {apparent[0] / apparentSpeed, apparent[1] / apparentSpeed, apparent[2] / apparentSpeed};
+
+    // Portance sans roulis : direction de la ligne orthogonalisée au vent apparent
+    float along = dot(radial, eWind);
+    float lift0[3] = {radial[0] - along * eWind[0], radial[1] - along * eWind[1], radial[2] - along * eWind[2]};
+    float liftNorm = norm(lift0);
+    if (liftNorm > 1e-6f) {
+      for (int i = 0; i < 3; i++) lift0[i] /= liftNorm;
+    }
+    float side[3];
+    cross(eWind, lift0, side);
+
+    float roll = simState.steeringAngle * simConfig.rollPerSteering * SIM_DEG_TO_RAD;
+    float dynamicPressure = 0.5f * KITE_SIM_AIR_DENSITY * apparentSpeed * apparentSpeed;
+    float lift = dynamicPressure * simConfig.area * simConfig.liftCoefficient;
+    float lineDragArea = simConfig.lineDiameter * simState.lineLength / 4.0f;
+    float drag = dynamicPressure * (simConfig.area * simConfig.dragCoefficient +
+                                    lineDragArea * simConfig.lineDragCoefficient);
+
+    for (int i = 0; i < 3; i++) {
+      force[i] += lift * (cosf(roll) * lift0[i] + sinf(roll) * side[i]) + drag * eWind[i];
+    }
+  }
+
+  // Ligne : ressort amorti, ne travaille qu'en traction
+  float radialSpeed = dot(v, radial);
+  float stretch = distance - simState.lineLength;
+  float tension = 0;
+  if (stretch > 0) {
+    float stiffness = simConfig.lineStiffness / simState.lineLength;
+    tension = stiffness * stretch + simConfig.lineDamping * (radialSpeed - simState.reelSpeed);
+    if (tension < 0) tension = 0;
+  }
+  simState.tension = tension;
+  simState.power = tension * simState.reelSpeed;
+
+  for (int i = 0; i < 3; i++) {
+    force[i] -= tension * radial[i];
+    simState.acceleration[i] = force[i] / simConfig.mass;
+  }
+
+  // Euler semi-implicite : vitesse puis position
+  v[0] += simState.acceleration[0] * dt;
+  v[1] += simState.acceleration[1] * dt;
+  v[2] += (simState.acceleration[2] - KITE_SIM_GRAVITY) * dt;
+  for (int i = 0; i < 3; i++) {
+    p[i] += v[i] * dt;
+  }
+
+  simState.lineLength += simState.reelSpeed * dt;
+  if (simState.lineLength < 1.0f) simState.lineLength = 1.0f;
+  simState.time += dt;
+
+  if (p[2] < SIM_CRASH_ALTITUDE) {
+    p[2] = SIM_CRASH_ALTITUDE;
+    memset(v, 0, sizeof(simState.velocity));
+    simState.crashed = true;
+  }
+}
+
+/**
+ * Angles et cap dérivés de l'état (après intégration)
+ */
+static void updateObservables(float elapsed) {
+  float eElevation[3];
+  float eAzimuth[3];
+  float elevation;
+  float azimuth;
+  sphericalFrame(simState.position, &elevation, &azimuth, eElevation, eAzimuth);
+  simState.elevation = elevation * SIM_RAD_TO_DEG;
+  simState.azimuth = azimuth * SIM_RAD_TO_DEG;
+
+  // Nez du kite face au vent apparent
+  float nose[3] = {simState.velocity[0] - simState.wind[0],
+                   simState.velocity[1] - simState.wind[1],
+                   simState.velocity[2] - simState.wind[2]};
+  simState.heading = atan2f(dot(nose, eAzimuth), dot(nose, eElevation)) * SIM_RAD_TO_DEG;
+
+  if (elapsed > 0) {
+    float delta = fmodf(simState.heading - previousHeading + 540.0f, 360.0f) - 180.0f;
+    simState.headingRate = delta / elapsed;
+  }
+  previousHeading = simState.heading;
+
+  simState.groundWindSpeed = windAtHeight(SIM_ANEMOMETER_HEIGHT);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void kiteSimDefaultConfig(KiteSimConfig* config) {
+  config->mass = 2.5f;
+  config->area = 6.0f;
+  config->liftCoefficient = 0.9f;
+  config->dragCoefficient = 0.18f;
+  config->rollPerSteering = 0.15f;
+  config->lineLength = 100.0f;
+  config->lineStiffness = 200000.0f;
+  config->lineDamping = 50.0f;
+  config->lineDiameter = 0.003f;
+  config->lineDragCoefficient = 1.0f;
+  config->windSpeed = 8.0f;
+  config->windReferenceHeight = 10.0f;
+  config->windShearExponent = 0.14f;
+  config->turbulenceIntensity = 0.08f;
+  config->turbulenceTimeConstant = 3.0f;
+  config->gustAmplitude = 0.0f;
+  config->gustDuration = 4.0f;
+  config->gustInterval = 0.0f;
+  config->servoTimeConstant = 0.05f;
+  config->servoRateLimit = 300.0f;
+  config->imuNoise = 0.3f;
+  config->initialElevation = 45.0f;
+  config->initialAzimuth = 0.0f;
+  config->seed = 12345;
+}
+
+void kiteSimInit(const KiteSimConfig* config) {
+  if (config != nullptr) {
+    simConfig = *config;
+  } else {
+    kiteSimDefaultConfig(&simConfig);
+  }
+
+  memset(&simState, 0, sizeof(simState));
+  rngState = simConfig.seed != 0 ? simConfig.seed : 1;
+  turbulence = 0;
+
+  float el = simConfig.initialElevation * SIM_DEG_TO_RAD;
+  float az = simConfig.initialAzimuth * SIM_DEG_TO_RAD;
+  simState.lineLength = simConfig.lineLength;
+  simState.position[0] = simConfig.lineLength * cosf(el) * cosf(az);
+  simState.position[1] = -simConfig.lineLength * cosf(el) * sinf(az);
+  simState.position[2] = simConfig.lineLength * sinf(el);
+
+  scheduleNextGust();
+  simState.wind[0] = windAtHeight(simState.position[2]);
+  updateObservables(0);
+}
+
+void kiteSimStep(float dt) {
+  float elapsed = 0;
+  while (elapsed + KITE_SIM_DEFAULT_DT * 0.5f < dt) {
+    if (!simState.crashed) {
+      integrate(KITE_SIM_DEFAULT_DT);
+    } else {
+      simState.time += KITE_SIM_DEFAULT_DT;
+    }
+    elapsed += KITE_SIM_DEFAULT_DT;
+  }
+  updateObservables(elapsed);
+}
+
+KiteSimState kiteSimGetState() {
+  return simState;
+}
+
+void kiteSimReadImu(IMUData* data) {
+  memset(data, 0, sizeof(IMUData));
+  float noise = simConfig.imuNoise;
+  data->orientation[0] = simState.elevation + noise * gaussianRandom();
+  data->orientation[1] = simState.azimuth + noise * gaussianRandom();
+  data->orientation[2] = simState.heading + noise * gaussianRandom();
+
+  float eElevation[3];
+  float eAzimuth[3];
+  float elevation;
+  float azimuth;
+  sphericalFrame(simState.position, &elevation, &azimuth, eElevation, eAzimuth);
+  float distance = norm(simState.position);
+  data->gyro[0] = dot(simState.velocity, eElevation) / distance * SIM_RAD_TO_DEG;
+  data->gyro[1] = dot(simState.velocity, eAzimuth) / distance * SIM_RAD_TO_DEG;
+  data->gyro[2] = simState.headingRate;
+
+  for (int i = 0; i < 3; i++) {
+    data->accel[i] = simState.acceleration[i] / KITE_SIM_GRAVITY;
+  }
+  data->quaternion[0] = 1.0f;
+  data->timestamp = millis();
+  data->dataValid = !simState.crashed;
+}
+
+void kiteSimSetSteering(float angle) {
+  simState.steeringCommand = angle;
+}
+
+void kiteSimSetReelSpeed(float speed) {
+  simState.reelSpeed = speed;
+}
@@ -0,0 +1,150 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Simulateur de kite captif (Interface)
+  -----------------------
+
+  Modèle physique hôte d'un kite captif pour tester l'autopilote en boucle fermée.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== INTERFACE PUBLIQUE =====
+  Ce fichier définit le simulateur utilisé par l'environnement natif. Les pilotes
+  simulés (sim_drivers.cpp) remplacent imuReadProcessedData(), tensionRead(),
+  lineLengthRead(), windRead() et servoUpdateAll() par des lectures/écritures
+  dans ce modèle, sans modifier autopilot.cpp.
+
+  Principales fonctionnalités exposées :
+  - kiteSimDefaultConfig() / kiteSimInit() : Paramètres et état initial
+  - kiteSimStep() : Intégration d'un pas de temps
+  - kiteSimGetState() : État physique courant (position, vitesse, tension...)
+  - kiteSimReadImu() : Mesures IMU déduites de l'état (convention de autopilot.h)
+  - kiteSimSetSteering() / kiteSimSetReelSpeed() : Commandes
+
+  Modèle :
+  - Kite point matériel (masse, portance, traînée, inclinaison par la direction)
+  - Ligne élastique amortie (raideur EA / longueur), sans résistance en compression
+  - Vent : profil en puissance de l'altitude, turbulence (Ornstein-Uhlenbeck)
+    et rafales discrètes en 1 - cos
+  - Servo de direction : premier ordre + limitation de vitesse
+
+  Repère direct : x sous le vent, y à gauche pour le pilote regardant le kite,
+  z vers le haut. L'azimut est positif à droite (convention de autopilot.h).
+*/
+
+#ifndef KITE_SIM_H
+#define KITE_SIM_H
+
+#include <Arduino.h>
+#include "hardware/sensors/imu.h"
+
+// === CONSTANTES ===
+#define KITE_SIM_DEFAULT_DT      0.001f   // Pas d'intégration (s)
+#define KITE_SIM_AIR_DENSITY     1.225f   // Masse volumique de l'air (kg/m3)
+#define KITE_SIM_GRAVITY         9.81f    // Pesanteur (m/s2)
+
+// === DÉFINITION DES TYPES ===
+
+// Paramètres du simulateur
+typedef struct {
+  // Kite
+  float mass;                 // Masse du kite (kg)
+  float area;                 // Surface projetée (m2)
+  float liftCoefficient;      // Coefficient de portance
+  float dragCoefficient;      // Coefficient de traînée du kite
+  float rollPerSteering;      // Inclinaison obtenue par degré de direction
+  // Ligne
+  float lineLength;           // Longueur initiale déroulée (m)
+  float lineStiffness;        // Rigidité axiale EA (N)
+  float lineDamping;          // Amortissement axial (N.s/m)
+  float lineDiameter;         // Diamètre (m), pour la traînée de ligne
+  float lineDragCoefficient;  // Coefficient de traînée de la ligne
+  // Vent
+  float windSpeed;            // Vitesse moyenne à l'altitude de référence (m/s)
+  float windReferenceHeight;  // Altitude de référence (m)
+  float windShearExponent;    // Exposant du profil vertical
+  float turbulenceIntensity;  // Écart-type de la turbulence / vitesse moyenne
+  float turbulenceTimeConstant; // Constante de temps de la turbulence (s)
+  float gustAmplitude;        // Amplitude des rafales discrètes (m/s)
+  float gustDuration;         // Durée d'une rafale (s)
+  float gustInterval;         // Intervalle moyen entre rafales (s), 0 = aucune
+  // Servo
+  float servoTimeConstant;    // Constante de temps du servo (s)
+  float servoRateLimit;       // Vitesse maximale du servo (degrés/s)
+  // Capteurs
+  float imuNoise;             // Écart-type du bruit des angles IMU (degrés)
+  // Position initiale
+  float initialElevation;     // Élévation de départ (degrés)
+  float initialAzimuth;       // Azimut de départ (degrés)
+  uint32_t seed;              // Graine du générateur aléatoire
+} KiteSimConfig;
+
+// État physique du simulateur
+typedef struct {
+  float time;                 // Temps simulé (s)
+  float position[3];          // Position du kite (m)
+  float velocity[3];          // Vitesse du kite (m/s)
+  float acceleration[3];      // Accélération hors pesanteur (m/s2)
+  float wind[3];              // Vent à la position du kite (m/s)
+  float groundWindSpeed;      // Vent mesuré au sol (m/s)
+  float apparentWindSpeed;    // Vent apparent (m/s)
+  float tension;              // Tension de la ligne au sol (N)
+  float lineLength;           // Longueur déroulée (m)
+  float reelSpeed;            // Vitesse de déroulement (m/s, positive en sortie)
+  float power;                // Puissance mécanique au treuil, tension x vitesse (W)
+  float steeringCommand;      // Consigne de direction (degrés)
+  float steeringAngle;        // Position réelle du servo (degrés)
+  float elevation;            // Élévation (degrés)
+  float azimuth;              // Azimut (degrés)
+  float heading;              // Cap dans la fenêtre (degrés, 0 = zénith)
+  float headingRate;          // Vitesse de cap (degrés/s)
+  bool crashed;               // Le kite a touché le sol
+} KiteSimState;
+
+// === PROTOTYPES DES FONCTIONS ===
+
+/**
+ * Remplit une configuration par défaut (kite de 6 m2, 100 m de ligne, vent de 8 m/s)
+ * @param config Configuration à remplir
+ */
+void kiteSimDefaultConfig(KiteSimConfig* config);
+
+/**
+ * Initialise le simulateur (kite immobile à la position de départ, ligne tendue)
+ * @param config Configuration (nullptr = valeurs par défaut)
+ */
+void kiteSimInit(const KiteSimConfig* config);
+
+/**
+ * Avance la simulation
+ * @param dt Durée à simuler (s), découpée en pas de KITE_SIM_DEFAULT_DT
+ */
+void kiteSimStep(float dt);
+
+/**
+ * Obtient l'état physique courant
+ * @return Copie de l'état
+ */
+KiteSimState kiteSimGetState();
+
+/**
+ * Produit les mesures IMU correspondant à l'état courant
+ * @param data Structure recevant orientation (élévation, azimut, cap),
+ *             vitesses angulaires et accélérations
+ */
+void kiteSimReadImu(IMUData* data);
+
+/**
+ * Définit la consigne du servo de direction
+ * @param angle Consigne en degrés (positive = virage à droite)
+ */
+void kiteSimSetSteering(float angle);
+
+/**
+ * Définit la vitesse de déroulement de la ligne (treuil/générateur)
+ * @param speed Vitesse en m/s (positive = déroulement)
+ */
+void kiteSimSetReelSpeed(float speed);
+
+#endif // KITE_SIM_H
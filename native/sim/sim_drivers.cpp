@@ -0,0 +1,127 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Pilotes simulés (Implémentation)
+  -----------------------
+
+  Implémentations hôte des pilotes de capteurs et d'actionneurs, branchées sur
+  le simulateur de kite captif.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  Ces fonctions portent les mêmes signatures que les pilotes matériels
+  (imu.h, tension.h, line_length.h, wind.h, servo.h) : l'autopilote est
+  compilé sans modification et ne voit que ses interfaces habituelles.
+
+  Principes de fonctionnement :
+  1. Les lectures renvoient l'état courant du simulateur (kiteSimGetState)
+  2. servoUpdateAll() transmet la consigne de direction au servo simulé
+  3. Les unités sont celles des pilotes réels (N, cm, m/s, degrés)
+
+  Contraintes techniques :
+  - Fichier réservé aux environnements natifs ; le firmware lie les vrais pilotes
+  - kiteSimInit() doit avoir été appelé avant la première lecture
+*/
+
+#include "kite_sim.h"
+#include "hardware/sensors/imu.h"
+#include "hardware/sensors/tension.h"
+#include "hardware/sensors/line_length.h"
+#include "hardware/sensors/wind.h"
+#include "hardware/actuators/servo.h"
+
+// === VARIABLES GLOBALES ===
+
+static int lastDirection = 0;
+
+// === IMU ===
+
+bool imuInit(const IMUConfig* /*config*/) {
+  return true;
+}
+
+bool imuReadProcessedData(IMUData* data) {
+  if (data == nullptr) {
+    return false;
+  }
+  kiteSimReadImu(data);
+  return data->dataValid;
+}
+
+// === TENSION ===
+
+bool tensionInit() {
+  return true;
+}
+
+float tensionRead() {
+  return kiteSimGetState().tension;
+}
+
+bool tensionIsHealthy() {
+  return true;
+}
+
+// === LONGUEUR DE LIGNE ===
+
+bool lineLengthInit() {
+  return true;
+}
+
+int lineLengthRead() {
+  return (int)lroundf(kiteSimGetState().lineLength * 100.0f);
+}
+
+bool lineLengthIsHealthy() {
+  return true;
+}
+
+// === VENT ===
+
+bool windInit() {
+  return true;
+}
+
+WindData windRead() {
+  WindData wind = {};
+  wind.speed = kiteSimGetState().groundWindSpeed;
+  wind.direction = 0;
+  wind.gust = wind.speed;
+  wind.timestamp = millis();
+  wind.isValid = true;
+  return wind;
+}
+
+bool windIsHealthy() {
+  return true;
+}
+
+// === SERVOS ===
+
+bool servoInitAll() {
+  lastDirection = 0;
+  kiteSimSetSteering(0);
+  return true;
+}
+
+bool servoSetDirection(int angle) {
+  lastDirection = constrain(angle, DIRECTION_MIN_ANGLE, DIRECTION_MAX_ANGLE);
+  kiteSimSetSteering((float)lastDirection);
+  return true;
+}
+
+bool servoSetTrim(int /*angle*/) {
+  return true;
+}
+
+bool servoSetLineModulation(int /*position*/) {
+  return true;
+}
+
+bool servoUpdateAll(int direction, int trim, int lineModulation) {
+  servoSetTrim(trim);
+  servoSetLineModulation(lineModulation);
+  return servoSetDirection(direction);
+}
@@ -0,0 +1,165 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Simulation en boucle fermée sur l'hôte (Point d'entrée)
+  -----------------------
+
+  Fait voler l'autopilote contre le simulateur de kite captif.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  pio run -e native_sim && .pio/build/native_sim/program [options]
+
+  Options :
+  --mode figure8|hover   Mode de l'autopilote (défaut : figure8)
+  --duration <s>         Durée simulée (défaut : 120)
+  --wind <m/s>           Vent moyen à 10 m (défaut : 8)
+  --turbulence <ratio>   Intensité de turbulence (défaut : 0.08)
+  --gust <m/s>           Amplitude des rafales, une toutes les 20 s en moyenne
+  --reel <m/s>           Vitesse de déroulement (puissance au treuil)
+  --line <m>             Longueur de ligne initiale (défaut : 100)
+  --seed <n>             Graine du générateur aléatoire
+  --csv <fichier>        Trace CSV à 20 Hz
+  --faults <fichier>     Scénario de fautes (voir utils/fault_injection.h),
+                         latences de détection et de récupération en fin de vol
+  --mission <plan.kpl>   Plan de vol (voir native/mission) à la place de --mode,
+                         état et dernier repère du plan en fin de vol
+
+  Le code de retour vaut 1 si le kite a touché le sol.
+*/
+
+#include <Arduino.h>
+#include "core/logging.h"
+#include "closed_loop.h"
+#include "utils/fault_injection.h"
+#include "control/gust_predictor.h"
+#include "mission_compiler.h"
+
+// === FONCTIONS INTERNES ===
+
+/**
+ * Compile un plan de vol texte pour la simulation
+ * @return Taille du plan compilé, -1 en cas d'erreur
+ */
+static int compileMission(const char* path, uint8_t* code) {
+  static char source[16384];
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "Impossible de lire %s\n", path);
+    return -1;
+  }
+  size_t length = fread(source, 1, sizeof(source) - 1, file);
+  fclose(file);
+  source[length] = '\0';
+
+  MissionCompileError error;
+  int size = missionCompile(source, code, MISSION_MAX_PLAN_SIZE, &error);
+  if (size < 0) {
+    fprintf(stderr, "%s:%d : %s\n", path, error.line, error.message);
+  }
+  return size;
+}
+
+// === POINT D'ENTRÉE ===
+
+int main(int argc, char** argv) {
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  const char* tracePath = nullptr;
+  const char* faultsPath = nullptr;
+  const char* missionPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (value == nullptr) {
+      fprintf(stderr, "Option sans valeur : %s\n", argv[i]);
+      return 2;
+    }
+    if (strcmp(argv[i], "--mode") == 0) {
+      config.mode = strcmp(value, "hover") == 0 ? AUTOPILOT_HOVER : AUTOPILOT_FIGURE_8;
+    } else if (strcmp(argv[i], "--duration") == 0) {
+      config.duration = atof(value);
+    } else if (strcmp(argv[i], "--wind") == 0) {
+      config.sim.windSpeed = atof(value);
+    } else if (strcmp(argv[i], "--turbulence") == 0) {
+      config.sim.turbulenceIntensity = atof(value);
+    } else if (strcmp(argv[i], "--gust") == 0) {
+      config.sim.gustAmplitude = atof(value);
+      config.sim.gustInterval = 20.0f;
+    } else if (strcmp(argv[i], "--reel") == 0) {
+      config.reelSpeed = atof(value);
+    } else if (strcmp(argv[i], "--line") == 0) {
+      config.sim.lineLength = atof(value);
+    } else if (strcmp(argv[i], "--seed") == 0) {
+      config.sim.seed = (uint32_t)strtoul(value, nullptr, 10);
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      tracePath = value;
+    } else if (strcmp(argv[i], "--faults") == 0) {
+      faultsPath = value;
+    } else if (strcmp(argv[i], "--mission") == 0) {
+      missionPath = value;
+    } else {
+      fprintf(stderr, "Option inconnue : %s\n", argv[i]);
+      return 2;
+    }
+    i++;
+  }
+
+  if (tracePath != nullptr) {
+    config.trace = fopen(tracePath, "w");
+    if (config.trace == nullptr) {
+      fprintf(stderr, "Impossible d'écrire %s\n", tracePath);
+      return 2;
+    }
+  }
+
+  static uint8_t missionCode[MISSION_MAX_PLAN_SIZE];
+  if (missionPath != nullptr) {
+    int size = compileMission(missionPath, missionCode);
+    if (size < 0) {
+      return 2;
+    }
+    config.mission = missionCode;
+    config.missionSize = (size_t)size;
+  }
+
+  currentLogLevel = (LogLevel)LOG_LEVEL_WARNING;
+  faultInjectionInit();
+  if (faultsPath != nullptr) {
+    if (faultInjectionLoadScript(faultsPath) < 0) {
+      fprintf(stderr, "Scénario de fautes invalide : %s\n", faultsPath);
+      return 2;
+    }
+    config.faultScenario = true;
+  }
+
+  ClosedLoopResult result;
+  bool ok = closedLoopRun(config, &result);
+  closedLoopPrintReport(result);
+  GustPrediction gust;
+  gustPredictorGetPrediction(&gust);
+  if (gust.ready) {
+    Serial.printf("Prévision du vent   : à %d ms, RMS %.2f m/s (vent constant : %.2f m/s), bande tenue %.0f %%\n",
+                  GUST_HORIZON_MS, gust.predictionRms, gust.persistenceRms, gust.coverage * 100.0f);
+  }
+  if (config.mission != nullptr) {
+    MissionStatus mission;
+    missionGetStatus(&mission);
+    Serial.printf("Plan de vol         : %s%s%s, repère %u, %lu instructions en %.1f s\n",
+                  missionStateName(mission.state),
+                  mission.reason != nullptr ? " - " : "",
+                  mission.reason != nullptr ? mission.reason : "",
+                  mission.lastMark, (unsigned long)mission.instructions,
+                  mission.elapsedMs / 1000.0f);
+  }
+  if (config.faultScenario) {
+    faultInjectionPrintReport();
+  }
+
+  if (config.trace != nullptr) {
+    fclose(config.trace);
+  }
+  return ok ? 0 : 1;
+}
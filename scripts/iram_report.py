@@ -0,0 +1,127 @@
+# -----------------------
+# Kite PiloteV3 - Rapport d'occupation de l'IRAM (script PlatformIO)
+# -----------------------
+#
+# Après l'édition des liens du firmware, lit le fichier de correspondance
+# (.map) et affiche le code rangé en IRAM : total de la région, part du
+# framework et part de chaque fichier du projet (fonctions HOT_PATH, voir
+# include/core/hot_path.h). L'édition des liens échoue si le code du projet
+# dépasse IRAM_HOT_PATH_BUDGET (include/core/config.h) ou si un fichier
+# censé rester en flash (serveur web) y apparaît.
+#
+# Déclaré dans platformio.ini : extra_scripts = post:scripts/iram_report.py
+# Utilisable seul : python3 scripts/iram_report.py firmware.map [config.h]
+#
+# Version: 1.0.0
+# Date: 18 octobre 2026
+# Auteurs: Équipe Kite PiloteV3
+
+import os
+import re
+import sys
+
+# === CONSTANTES ===
+IRAM_OUTPUT_SECTIONS = (".iram0.vectors", ".iram0.text")
+IRAM_REGION_SIZE = 128 * 1024                      # SOC_IRAM_LOW..SOC_IRAM_HIGH (ESP32)
+COLD_FILES = ("webserver.cpp.o",)                  # Handlers COLD_PATH, attendus en flash
+PROJECT_MARKER = "/src/"                           # Objets compilés depuis src/
+
+OUTPUT_RE = re.compile(r"^(\.\S+)(?:\s+0x[0-9a-fA-F]+\s+0x[0-9a-fA-F]+)?\s*$")
+INPUT_RE = re.compile(r"^\s+(\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)")
+INPUT_NAME_RE = re.compile(r"^\s+(\.\S+)\s*$")
+INPUT_TAIL_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)")
+BUDGET_RE = re.compile(r"^#define\s+IRAM_HOT_PATH_BUDGET\s+(\d+)", re.M)
+
+# === FONCTIONS ===
+
+def parse_map(path):
+    """Octets rangés en IRAM par fichier objet."""
+    sizes = {}
+    in_memory_map = False
+    output = None
+    pending = None
+    with open(path, "r", errors="replace") as handle:
+        for line in handle:
+            line = line.rstrip("\n")
+            if not in_memory_map:
+                in_memory_map = line.startswith("Linker script and memory map")
+                continue
+            if line and not line[0].isspace():
+                match = OUTPUT_RE.match(line)
+                output = match.group(1) if match else None
+                pending = None
+                continue
+            if output not in IRAM_OUTPUT_SECTIONS:
+                continue
+            match = INPUT_RE.match(line)
+            if match:
+                size, obj = int(match.group(3), 16), match.group(4)
+            else:
+                # Nom de section long : adresse, taille et fichier à la ligne suivante
+                tail = INPUT_TAIL_RE.match(line) if pending else None
+                name = INPUT_NAME_RE.match(line)
+                pending = name.group(1) if name else None
+                if not tail:
+                    continue
+                size, obj = int(tail.group(2), 16), tail.group(3)
+            pending = None
+            if size > 0:
+                sizes[obj] = sizes.get(obj, 0) + size
+    return sizes
+
+
+def read_budget(config_path):
+    with open(config_path, "r", errors="replace") as handle:
+        match = BUDGET_RE.search(handle.read())
+    return int(match.group(1)) if match else None
+
+
+def report(map_path, config_path):
+    """Affiche le rapport ; renvoie 1 si le budget ou le placement n'est pas respecté."""
+    sizes = parse_map(map_path)
+    budget = read_budget(config_path)
+    total = sum(sizes.values())
+    project = {obj: size for obj, size in sizes.items() if PROJECT_MARKER in obj.replace("\\", "/")}
+    project_total = sum(project.values())
+
+    print("IRAM : %d / %d octets de code (%.1f %%), framework %d, projet %d"
+          % (total, IRAM_REGION_SIZE, 100.0 * total / IRAM_REGION_SIZE, total - project_total, project_total))
+    for obj, size in sorted(project.items(), key=lambda item: -item[1]):
+        print("  %6d  %s" % (size, obj.split(PROJECT_MARKER, 1)[-1]))
+
+    status = 0
+    if budget is None:
+        print("IRAM : IRAM_HOT_PATH_BUDGET absent de %s" % config_path)
+    elif project_total > budget:
+        print("IRAM : code du projet au-delà du budget (%d > %d octets)" % (project_total, budget))
+        status = 1
+    else:
+        print("IRAM : budget du projet %d / %d octets" % (project_total, budget))
+    for obj in project:
+        if obj.endswith(COLD_FILES):
+            print("IRAM : %s devrait rester en flash (COLD_PATH)" % obj)
+            status = 1
+    return status
+
+# === POINT D'ENTRÉE ===
+
+try:
+    Import("env")  # noqa: F821 (fourni par PlatformIO)
+except NameError:
+    env = None
+
+if env is not None:
+    map_path = os.path.join(env.subst("$BUILD_DIR"), env.subst("${PROGNAME}.map"))
+    config_path = os.path.join(env.subst("$PROJECT_INCLUDE_DIR"), "core", "config.h")
+    env.Append(LINKFLAGS=["-Wl,-Map=" + map_path])
+
+    def iram_report_action(source, target, env):
+        return report(map_path, config_path)
+
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", iram_report_action)
+elif __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage : iram_report.py firmware.map [include/core/config.h]")
+        sys.exit(2)
+    default_config = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "include", "core", "config.h")
+    sys.exit(report(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else default_config))
@@ -0,0 +1,94 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Réception ESP-NOW (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. esp_now_init() sur la pile WiFi déjà démarrée, puis enregistrement du
+     rappel de réception ; un échec n'est journalisé qu'une fois, la tâche
+     réseau retente à chaque vérification du WiFi
+  2. Le rappel décode la trame, écarte celles d'un autre kite et soumet la
+     commande avec l'horloge courante ; la file la vérifie et l'exécutera
+     dans la tâche de contrôle
+  3. Les compteurs sont modifiés par le seul rappel et lus sous section critique
+*/
+
+#include "communication/espnow_manager.h"
+#include "communication/protocols.h"
+#include "control/command_scheduler.h"
+#include "core/config.h"
+#include "utils/logging.h"
+#include <esp_now.h>
+
+// === VARIABLES GLOBALES ===
+
+static bool ready = false;
+static bool failureReported = false;
+static uint16_t unitId = 0;
+static EspNowStats stats;
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// === FONCTIONS INTERNES ===
+
+static void handleFrame(const uint8_t* data, int length) {
+    CommandFrame command;
+    uint32_t* counter;
+    if (length <= 0 || !commandDecode(data, (size_t)length, &command)) {
+        counter = &stats.invalid;
+    } else if (command.unitId != 0 && command.unitId != unitId) {
+        counter = &stats.otherUnit;
+    } else if (commandSchedulerSubmit(&command, COMMAND_SOURCE_ESPNOW, millis(), nullptr) == COMMAND_QUEUED) {
+        counter = &stats.queued;
+    } else {
+        counter = &stats.rejected;
+    }
+    portENTER_CRITICAL(&statsMux);
+    stats.received++;
+    (*counter)++;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+static void onReceive(const esp_now_recv_info_t* info, const uint8_t* data, int length) {
+    handleFrame(data, length);
+}
+#else
+static void onReceive(const uint8_t* mac, const uint8_t* data, int length) {
+    handleFrame(data, length);
+}
+#endif
+
+// === FONCTIONS PUBLIQUES ===
+
+bool espnowManagerInit() {
+    if (ready) {
+        return true;
+    }
+    // Même identifiant que la télémétrie émise par le kite
+    unitId = TELEMETRY_UNIT_ID != 0 ? TELEMETRY_UNIT_ID : (uint16_t)(ESP.getEfuseMac() >> 32);
+    if (esp_now_init() != ESP_OK || esp_now_register_recv_cb(onReceive) != ESP_OK) {
+        if (!failureReported) {
+            LOG_ERROR("ESPNOW", "Démarrage d'ESP-NOW impossible");
+            failureReported = true;
+        }
+        return false;
+    }
+    ready = true;
+    LOG_INFO("ESPNOW", "Réception des commandes datées (kite %u)", unitId);
+    return true;
+}
+
+bool espnowManagerIsReady() {
+    return ready;
+}
+
+EspNowStats espnowManagerGetStats() {
+    portENTER_CRITICAL(&statsMux);
+    EspNowStats copy = stats;
+    portEXIT_CRITICAL(&statsMux);
+    return copy;
+}
@@ -0,0 +1,280 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Format de télémétrie (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. L'encodage écrit les champs un à un en petit-boutiste : la trame ne
+     dépend ni de l'alignement ni du compilateur des deux côtés
+  2. Le décodage vérifie magic, version, longueur puis CRC avant de copier
+     les valeurs ; les champs inconnus sont ignorés, les manquants valent NAN
+  3. L'extracteur de flux accumule les octets à partir d'un magic ; une
+     trame invalide n'écarte que son premier octet et la recherche reprend
+     dans les octets déjà reçus (resynchronisation sans perte)
+  4. Les commandes datées ont une taille fixe : la longueur reçue doit
+     être exacte, type et politique de retard inconnus sont refusés
+  5. L'instantané des tâches a une longueur fixée par son nombre d'entrées ;
+     les noms occupent toujours 16 octets, complétés par des zéros
+
+  Compilé par le firmware et par la station sol : aucune dépendance Arduino.
+*/
+
+#include "communication/protocols.h"
+#include <math.h>
+#include <string.h>
+
+// === VARIABLES GLOBALES ===
+const char* const TELEMETRY_FIELD_NAMES[TELEMETRY_FIELD_COUNT] = {
+  "pitch", "roll", "yaw", "line_tension", "line_length",
+  "wind_speed", "wind_direction", "power", "direction", "trim"
+};
+
+// === FONCTIONS INTERNES ===
+
+static void putU16(uint8_t* p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    p[i] = (v >> (8 * i)) & 0xFF;
+  }
+}
+
+static uint16_t getU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Longueur annoncée par un en-tête complet, 0 si l'en-tête est invalide
+ */
+static size_t frameLength(const uint8_t* header) {
+  if (getU16(header) != TELEMETRY_MAGIC || header[2] != TELEMETRY_VERSION ||
+      header[3] > TELEMETRY_MAX_FIELDS) {
+    return 0;
+  }
+  return TELEMETRY_HEADER_SIZE + header[3] * sizeof(float) + TELEMETRY_CRC_SIZE;
+}
+
+/**
+ * Écarte les n premiers octets du tampon d'un extracteur
+ */
+static void discard(TelemetryParser* parser, size_t count) {
+  memmove(parser->buffer, parser->buffer + count, parser->length - count);
+  parser->length -= count;
+}
+
+/**
+ * Extrait la première trame valide du tampon, en écartant ce qui la précède
+ */
+static bool extractFrame(TelemetryParser* parser, TelemetryFrame* frame) {
+  while (parser->length > 0) {
+    // Le tampon doit commencer par le premier octet du magic
+    if (parser->buffer[0] != (TELEMETRY_MAGIC & 0xFF)) {
+      const uint8_t* next = (const uint8_t*)memchr(parser->buffer + 1, TELEMETRY_MAGIC & 0xFF, parser->length - 1);
+      size_t count = next != nullptr ? (size_t)(next - parser->buffer) : parser->length;
+      parser->skipped += count;
+      discard(parser, count);
+      continue;
+    }
+    if (parser->length >= 2 && getU16(parser->buffer) != TELEMETRY_MAGIC) {
+      parser->skipped++;
+      discard(parser, 1);
+      continue;
+    }
+    if (parser->length < TELEMETRY_HEADER_SIZE) {
+      return false;
+    }
+    size_t expected = frameLength(parser->buffer);
+    if (expected != 0 && parser->length < expected) {
+      return false;
+    }
+    if (expected != 0 && telemetryDecode(parser->buffer, expected, frame) == expected) {
+      discard(parser, expected);
+      parser->frames++;
+      return true;
+    }
+    // En-tête invalide ou CRC faux : la recherche reprend à l'octet suivant
+    if (expected != 0) {
+      parser->crcErrors++;
+    }
+    parser->skipped++;
+    discard(parser, 1);
+  }
+  return false;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+uint16_t telemetryCrc16(const uint8_t* data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+size_t telemetryEncode(const TelemetryFrame* frame, uint8_t* buffer, size_t capacity) {
+  const size_t length = TELEMETRY_HEADER_SIZE + TELEMETRY_FIELD_COUNT * sizeof(float) + TELEMETRY_CRC_SIZE;
+  if (capacity < length) {
+    return 0;
+  }
+  putU16(buffer, TELEMETRY_MAGIC);
+  buffer[2] = TELEMETRY_VERSION;
+  buffer[3] = TELEMETRY_FIELD_COUNT;
+  putU16(buffer + 4, frame->unitId);
+  putU16(buffer + 6, frame->flags);
+  putU32(buffer + 8, frame->sequence);
+  putU32(buffer + 12, frame->timestampMs);
+  for (int i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+    uint32_t bits;
+    memcpy(&bits, &frame->values[i], sizeof(bits));
+    putU32(buffer + TELEMETRY_HEADER_SIZE + i * sizeof(float), bits);
+  }
+  putU16(buffer + length - TELEMETRY_CRC_SIZE, telemetryCrc16(buffer, length - TELEMETRY_CRC_SIZE));
+  return length;
+}
+
+size_t telemetryDecode(const uint8_t* buffer, size_t length, TelemetryFrame* frame) {
+  if (length < TELEMETRY_HEADER_SIZE) {
+    return 0;
+  }
+  size_t expected = frameLength(buffer);
+  if (expected == 0 || length < expected) {
+    return 0;
+  }
+  if (telemetryCrc16(buffer, expected - TELEMETRY_CRC_SIZE) != getU16(buffer + expected - TELEMETRY_CRC_SIZE)) {
+    return 0;
+  }
+
+  frame->unitId = getU16(buffer + 4);
+  frame->flags = getU16(buffer + 6);
+  frame->sequence = getU32(buffer + 8);
+  frame->timestampMs = getU32(buffer + 12);
+  uint8_t fieldCount = buffer[3];
+  for (int i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+    if (i < fieldCount) {
+      uint32_t bits = getU32(buffer + TELEMETRY_HEADER_SIZE + i * sizeof(float));
+      memcpy(&frame->values[i], &bits, sizeof(bits));
+    } else {
+      frame->values[i] = NAN;
+    }
+  }
+  return expected;
+}
+
+void telemetryParserInit(TelemetryParser* parser) {
+  memset(parser, 0, sizeof(TelemetryParser));
+}
+
+bool telemetryParserFeed(TelemetryParser* parser, uint8_t byte, TelemetryFrame* frame) {
+  parser->buffer[parser->length++] = byte;
+  return extractFrame(parser, frame);
+}
+
+size_t commandEncode(const CommandFrame* command, uint8_t* buffer, size_t capacity) {
+  if (capacity < COMMAND_FRAME_SIZE) {
+    return 0;
+  }
+  putU16(buffer, COMMAND_MAGIC);
+  buffer[2] = COMMAND_VERSION;
+  buffer[3] = command->type;
+  putU16(buffer + 4, command->unitId);
+  buffer[6] = command->latePolicy;
+  buffer[7] = command->target;
+  putU32(buffer + 8, command->sequence);
+  putU32(buffer + 12, command->executeAtMs);
+  uint32_t bits;
+  memcpy(&bits, &command->value, sizeof(bits));
+  putU32(buffer + 16, bits);
+  putU16(buffer + 20, telemetryCrc16(buffer, COMMAND_FRAME_SIZE - TELEMETRY_CRC_SIZE));
+  return COMMAND_FRAME_SIZE;
+}
+
+bool commandDecode(const uint8_t* buffer, size_t length, CommandFrame* command) {
+  if (length != COMMAND_FRAME_SIZE || getU16(buffer) != COMMAND_MAGIC || buffer[2] != COMMAND_VERSION ||
+      buffer[3] >= COMMAND_TYPE_COUNT || buffer[6] >= COMMAND_LATE_POLICY_COUNT) {
+    return false;
+  }
+  if (telemetryCrc16(buffer, COMMAND_FRAME_SIZE - TELEMETRY_CRC_SIZE) != getU16(buffer + 20)) {
+    return false;
+  }
+  command->type = buffer[3];
+  command->unitId = getU16(buffer + 4);
+  command->latePolicy = buffer[6];
+  command->target = buffer[7];
+  command->sequence = getU32(buffer + 8);
+  command->executeAtMs = getU32(buffer + 12);
+  uint32_t bits = getU32(buffer + 16);
+  memcpy(&command->value, &bits, sizeof(bits));
+  return true;
+}
+
+size_t taskSnapshotEncode(const TaskSnapshot* snapshot, uint8_t* buffer, size_t capacity) {
+  size_t count = snapshot->taskCount;
+  size_t length = TASK_SNAPSHOT_HEADER_SIZE + count * TASK_SNAPSHOT_ENTRY_SIZE + TELEMETRY_CRC_SIZE;
+  if (count > TASK_SNAPSHOT_MAX_TASKS || capacity < length) {
+    return 0;
+  }
+  putU16(buffer, TASK_SNAPSHOT_MAGIC);
+  buffer[2] = TASK_SNAPSHOT_VERSION;
+  buffer[3] = (uint8_t)count;
+  putU32(buffer + 4, snapshot->timestampMs);
+  putU32(buffer + 8, snapshot->intervalMs);
+  putU32(buffer + 12, snapshot->runTimeTotal);
+  uint8_t* p = buffer + TASK_SNAPSHOT_HEADER_SIZE;
+  for (size_t i = 0; i < count; i++, p += TASK_SNAPSHOT_ENTRY_SIZE) {
+    const TaskSnapshotEntry& task = snapshot->tasks[i];
+    memset(p, 0, TASK_SNAPSHOT_NAME_LENGTH);
+    strncpy((char*)p, task.name, TASK_SNAPSHOT_NAME_LENGTH - 1);
+    p[16] = task.state;
+    p[17] = task.priority;
+    p[18] = (uint8_t)task.core;
+    putU32(p + 19, task.stackFreeBytes);
+    putU32(p + 23, task.runTime);
+    putU16(p + 27, task.cpuPermille);
+  }
+  putU16(p, telemetryCrc16(buffer, length - TELEMETRY_CRC_SIZE));
+  return length;
+}
+
+bool taskSnapshotDecode(const uint8_t* buffer, size_t length, TaskSnapshot* snapshot) {
+  if (length < TASK_SNAPSHOT_HEADER_SIZE + TELEMETRY_CRC_SIZE || getU16(buffer) != TASK_SNAPSHOT_MAGIC ||
+      buffer[2] != TASK_SNAPSHOT_VERSION || buffer[3] > TASK_SNAPSHOT_MAX_TASKS) {
+    return false;
+  }
+  size_t count = buffer[3];
+  if (length != TASK_SNAPSHOT_HEADER_SIZE + count * TASK_SNAPSHOT_ENTRY_SIZE + TELEMETRY_CRC_SIZE ||
+      telemetryCrc16(buffer, length - TELEMETRY_CRC_SIZE) != getU16(buffer + length - TELEMETRY_CRC_SIZE)) {
+    return false;
+  }
+  snapshot->taskCount = (uint8_t)count;
+  snapshot->timestampMs = getU32(buffer + 4);
+  snapshot->intervalMs = getU32(buffer + 8);
+  snapshot->runTimeTotal = getU32(buffer + 12);
+  const uint8_t* p = buffer + TASK_SNAPSHOT_HEADER_SIZE;
+  for (size_t i = 0; i < count; i++, p += TASK_SNAPSHOT_ENTRY_SIZE) {
+    TaskSnapshotEntry& task = snapshot->tasks[i];
+    memcpy(task.name, p, TASK_SNAPSHOT_NAME_LENGTH);
+    task.name[TASK_SNAPSHOT_NAME_LENGTH - 1] = '\0';
+    task.state = p[16];
+    task.priority = p[17];
+    task.core = (int8_t)p[18];
+    task.stackFreeBytes = getU32(p + 19);
+    task.runTime = getU32(p + 23);
+    task.cpuPermille = getU16(p + 27);
+  }
+  return true;
+}
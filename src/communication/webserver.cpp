@@ -7,22 +7,44 @@
 #include "fallback_html.h"
 #include "../include/config.h"
 #include "core/config.h"
+#include "core/hot_path.h"
 // Logging
 #include "core/logging.h"
+#include "utils/session_storage.h"
+#include "utils/timer_wheel.h"
+#include "control/autopilot.h"
+#include "control/mission.h"
+#include "control/command_scheduler.h"
+#include "ui/dashboard.h"
+#include "utils/task_snapshot.h"
+#include "utils/lifetime_stats.h"
+#include "control/energy.h"
 
-// Forward declarations des handlers en IRAM
-static void IRAM_ATTR handleRoot(AsyncWebServerRequest *request);
-static void IRAM_ATTR handleApiInfo(AsyncWebServerRequest *request);
-static void IRAM_ATTR handleApiRestart(AsyncWebServerRequest *request);
-static void IRAM_ATTR handleDashboard(AsyncWebServerRequest *request);
-static void IRAM_ATTR handleFavicon(AsyncWebServerRequest *request);
-static void IRAM_ATTR handleNotFound(AsyncWebServerRequest *request);
+// Forward declarations des handlers : code rare, gardé en flash pour laisser
+// l'IRAM au cycle de contrôle (core/hot_path.h)
+static void COLD_PATH handleRoot(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiInfo(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiRestart(AsyncWebServerRequest *request);
+static void COLD_PATH handleDashboard(AsyncWebServerRequest *request);
+static void COLD_PATH handleFavicon(AsyncWebServerRequest *request);
+static void COLD_PATH handleNotFound(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiSessions(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiSessionData(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiAutopilotParams(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiDashboard(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiMission(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiCommands(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiTasks(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiLifetime(AsyncWebServerRequest *request);
+static void COLD_PATH handleApiEnergy(AsyncWebServerRequest *request);
+
+// Nombre maximal de points renvoyés par /api/sessions/data
+#define SESSION_API_MAX_POINTS 200
 
 // Buffers statiques et flags pour mise en cache
 static char jsonBuffer[256]; // Buffer statique pour JSON
 static char htmlBuffer[1024]; // Buffer statique pour HTML
-static bool htmlCacheValid = false;
-static unsigned long lastHtmlGenTime = 0;
+static volatile bool htmlCacheValid = false;  // Invalidé par le temporisateur de la tâche réseau
 static IPAddress lastCachedIP;
 static char lastStatus[64] = "";
 
@@ -37,19 +59,28 @@ void setWebServerMode(bool useFiles) {
     LOG_INFO("WEBS", "Mode HTML optimisé activé");
 }
 
+// Expiration du cache HTML (rappel exécuté par la tâche réseau)
+static void onHtmlCacheExpired(void* context) {
+    htmlCacheValid = false;
+}
+
+// Programme l'expiration du cache HTML toutes les WEB_HTML_CACHE_TTL
+bool webServerScheduleCacheRefresh(TimerWheel* wheel) {
+    return timerWheelSchedule(wheel, WEB_HTML_CACHE_TTL, WEB_HTML_CACHE_TTL,
+                              onHtmlCacheExpired, nullptr) != TIMER_HANDLE_NONE;
+}
+
 // Fonction interne pour générer ou retourner le HTML en cache
-static IRAM_ATTR const char* getHtmlContent() {
-    unsigned long now = millis();
+static COLD_PATH const char* getHtmlContent() {
     bool ipChanged = WiFi.localIP() != lastCachedIP;
     const char* status = getSystemStatusString().c_str();
     bool statusChanged = strcmp(status, lastStatus) != 0;
-    if (!htmlCacheValid || ipChanged || statusChanged || now - lastHtmlGenTime > 5000) {
+    if (!htmlCacheValid || ipChanged || statusChanged) {
         // Régénération du HTML dans htmlBuffer
         snprintf(htmlBuffer, sizeof(htmlBuffer), fallbackHtml,
                  status, WiFi.localIP().toString().c_str());
         // Mettre à jour le cache
         htmlCacheValid = true;
-        lastHtmlGenTime = now;
         lastCachedIP = WiFi.localIP();
         strncpy(lastStatus, status, sizeof(lastStatus)-1);
         lastStatus[sizeof(lastStatus)-1] = '\0';
@@ -58,50 +89,400 @@ static IRAM_ATTR const char* getHtmlContent() {
 }
 
 // Handlers externes
-static void IRAM_ATTR handleRoot(AsyncWebServerRequest *request) {
+static void COLD_PATH handleRoot(AsyncWebServerRequest *request) {
     AsyncWebServerResponse *response = request->beginResponse(200, "text/html", getHtmlContent());
     response->addHeader("Cache-Control", "max-age=30");
     request->send(response);
 }
 
-static void IRAM_ATTR handleApiInfo(AsyncWebServerRequest *request) {
+static void COLD_PATH handleApiInfo(AsyncWebServerRequest *request) {
     IPAddress currentIP = WiFi.localIP();
     const char* status = getSystemStatusString().c_str();
+    HotPathReport hotPath = hotPathGetReport();
     snprintf(jsonBuffer, sizeof(jsonBuffer),
-             "{\"ip\":\"%s\",\"status\":\"%s\",\"uptime\":%lu}",
-             currentIP.toString().c_str(), status, millis() / 1000);
+             "{\"ip\":\"%s\",\"status\":\"%s\",\"uptime\":%lu,"
+             "\"iramUsed\":%lu,\"iramFree\":%lu,\"controlMaxPeriodUs\":%lu,\"controlOverruns\":%lu}",
+             currentIP.toString().c_str(), status, millis() / 1000,
+             (unsigned long)hotPath.iramUsed, (unsigned long)hotPath.iramHeapFree,
+             (unsigned long)hotPath.maxPeriodUs, (unsigned long)hotPath.overruns);
     AsyncWebServerResponse *response = request->beginResponse(200, "application/json", jsonBuffer);
     response->addHeader("Cache-Control", "max-age=5");
     request->send(response);
 }
 
-static void IRAM_ATTR handleApiRestart(AsyncWebServerRequest *request) {
+static void COLD_PATH handleApiRestart(AsyncWebServerRequest *request) {
     request->send(200, "text/plain", "Redémarrage en cours...");
+    lifetimeStatsCheckpoint();
     delay(500);
     ESP.restart();
 }
 
-static void IRAM_ATTR handleDashboard(AsyncWebServerRequest *request) {
+static void COLD_PATH handleDashboard(AsyncWebServerRequest *request) {
     AsyncWebServerResponse *response = request->beginResponse(200, "text/html",
         "<html><head><title>Dashboard</title><meta name='viewport' content='width=device-width, initial-scale=1'>"
         "<style>body{font-family:Arial;margin:0;padding:20px;}</style></head>"
-        "<body><h1>Tableau de bord</h1><p>Version optimisée</p></body></html>");
+        "<body><h1>Tableau de bord</h1><p>Version optimisée</p>"
+        "<h2>Tâches</h2><table id='tasks' border='1' cellpadding='4'></table>"
+        "<script>"
+        "function t(){fetch('/api/tasks').then(r=>r.json()).then(d=>{"
+        "let h='<tr><th>Tâche</th><th>État</th><th>Prio</th><th>Cœur</th><th>Pile libre</th><th>CPU %</th></tr>';"
+        "d.tasks.forEach(k=>{h+='<tr><td>'+k.name+'</td><td>'+k.state+'</td><td>'+k.priority+'</td><td>'"
+        "+(k.core<0?'-':k.core)+'</td><td>'+k.stackFree+'</td><td>'+(k.cpuPermille/10).toFixed(1)+'</td></tr>';});"
+        "document.getElementById('tasks').innerHTML=h;}).catch(()=>{});}"
+        "t();setInterval(t,2000);"
+        "</script></body></html>");
     response->addHeader("Cache-Control", "max-age=3600");
     request->send(response);
 }
 
-static void IRAM_ATTR handleFavicon(AsyncWebServerRequest *request) {
+static void COLD_PATH handleFavicon(AsyncWebServerRequest *request) {
     AsyncWebServerResponse *response = request->beginResponse(204);
     response->addHeader("Cache-Control", "max-age=86400");
     request->send(response);
 }
 
-static void IRAM_ATTR handleNotFound(AsyncWebServerRequest *request) {
+static void COLD_PATH handleNotFound(AsyncWebServerRequest *request) {
     AsyncWebServerResponse *response = request->beginResponse(404, "text/html",
         "<html><body><h1>Page non trouvée</h1><p>Ressource non disponible</p></body></html>");
     request->send(response);
 }
 
+// Liste des sessions enregistrées
+static void COLD_PATH handleApiSessions(AsyncWebServerRequest *request) {
+    SessionInfo sessions[SESSION_MAX_COUNT];
+    int count = sessionStorageList(sessions, SESSION_MAX_COUNT);
+
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    response->print("[");
+    for (int i = 0; i < count; i++) {
+        response->printf("%s{\"id\":%u,\"start\":%lu,\"end\":%lu,\"samples\":%lu,\"active\":%s}",
+                         i > 0 ? "," : "", sessions[i].id,
+                         (unsigned long)sessions[i].startTs, (unsigned long)sessions[i].endTs,
+                         (unsigned long)sessions[i].sampleCount, sessions[i].active ? "true" : "false");
+    }
+    response->print("]");
+    request->send(response);
+}
+
+// Données d'une session : niveau d'aperçu choisi selon la fenêtre et le nombre de points
+// GET /api/sessions/data?id=<id>&from=<ms>&to=<ms>&points=<n>
+static void COLD_PATH handleApiSessionData(AsyncWebServerRequest *request) {
+    SessionInfo info;
+    if (!request->hasParam("id") ||
+        !sessionStorageGetInfo(request->getParam("id")->value().toInt(), &info)) {
+        request->send(404, "application/json", "{\"error\":\"session inconnue\"}");
+        return;
+    }
+
+    uint32_t from = request->hasParam("from") ? request->getParam("from")->value().toInt() : info.startTs;
+    uint32_t to = request->hasParam("to") ? request->getParam("to")->value().toInt() : info.endTs;
+    int points = request->hasParam("points") ? request->getParam("points")->value().toInt() : SESSION_API_MAX_POINTS;
+    points = constrain(points, 1, SESSION_API_MAX_POINTS);
+    if (to < from) {
+        request->send(400, "application/json", "{\"error\":\"intervalle invalide\"}");
+        return;
+    }
+
+    uint8_t level = sessionStorageSelectLevel(to - from, points);
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+
+    if (level == SESSION_LEVEL_RAW) {
+        FlightSample* samples = (FlightSample*)malloc(points * sizeof(FlightSample));
+        int count = samples ? sessionStorageReadRange(info.id, from, to, samples, points) : -1;
+        response->print("{\"level\":\"raw\",\"samples\":[");
+        for (int i = 0; i < count; i++) {
+            response->printf("%s[%lu", i > 0 ? "," : "", (unsigned long)samples[i].timestampMs);
+            for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+                response->printf(",%.2f", samples[i].values[c]);
+            }
+            response->print("]");
+        }
+        response->print("]}");
+        free(samples);
+    } else {
+        SessionOverviewBucket* buckets = (SessionOverviewBucket*)malloc(points * sizeof(SessionOverviewBucket));
+        int count = buckets ? sessionStorageReadOverview(info.id, level, from, to, buckets, points) : -1;
+        response->printf("{\"level\":%u,\"bucketMs\":%lu,\"buckets\":[",
+                         level, (unsigned long)sessionStorageBucketDuration(level));
+        for (int i = 0; i < count; i++) {
+            const SessionOverviewBucket& b = buckets[i];
+            response->printf("%s{\"t\":%lu,\"n\":%lu,\"min\":[", i > 0 ? "," : "",
+                             (unsigned long)b.startTs, (unsigned long)b.count);
+            for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) response->printf("%s%.2f", c ? "," : "", b.minValue[c]);
+            response->print("],\"max\":[");
+            for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) response->printf("%s%.2f", c ? "," : "", b.maxValue[c]);
+            response->print("],\"mean\":[");
+            for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) response->printf("%s%.2f", c ? "," : "", b.meanValue[c]);
+            response->print("]}");
+        }
+        response->print("]}");
+        free(buckets);
+    }
+
+    request->send(response);
+}
+
+/**
+ * Lit un champ entier d'un formulaire POST
+ * @return false si le champ n'est pas un entier décimal dans [0, max]
+ */
+static bool parseFormInteger(AsyncWebServerRequest *request, const char* name, long max, long* value) {
+    const char* text = request->getParam(name, true)->value().c_str();
+    char* end = nullptr;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < 0 || parsed > max) {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+// Paramètres de l'autopilote, réglables en vol
+// GET /api/autopilot/params
+// POST /api/autopilot/params (champs modifiés seulement, ex. turnSpeed=7&figure8Width=50)
+static void COLD_PATH handleApiAutopilotParams(AsyncWebServerRequest *request) {
+    AutopilotParameters params = getAutopilotParameters();
+
+    if (request->method() == HTTP_POST) {
+        // Copie de la version courante, champs reçus remplacés, publication d'une nouvelle version ;
+        // un champ non numérique ou hors de son type est refusé avant toute conversion
+        struct { const char* name; uint8_t* field; } bytes[] = {
+            {"figure8Width", &params.figure8Width}, {"figure8Height", &params.figure8Height},
+            {"turnSpeed", &params.turnSpeed}, {"aggressiveness", &params.aggressiveness},
+            {"windAdaptation", &params.windAdaptation}, {"maxWindSpeed", &params.maxWindSpeed},
+        };
+        struct { const char* name; uint16_t* field; } words[] = {
+            {"maxAltitude", &params.maxAltitude}, {"maxLineLength", &params.maxLineLength},
+        };
+        long value;
+        for (auto& b : bytes) {
+            if (request->hasParam(b.name, true)) {
+                if (!parseFormInteger(request, b.name, UINT8_MAX, &value)) {
+                    request->send(400, "application/json", "{\"error\":\"valeur invalide\"}");
+                    return;
+                }
+                *b.field = (uint8_t)value;
+            }
+        }
+        for (auto& w : words) {
+            if (request->hasParam(w.name, true)) {
+                if (!parseFormInteger(request, w.name, UINT16_MAX, &value)) {
+                    request->send(400, "application/json", "{\"error\":\"valeur invalide\"}");
+                    return;
+                }
+                *w.field = (uint16_t)value;
+            }
+        }
+        if (request->hasParam("safetyEnabled", true)) {
+            params.safetyEnabled = request->getParam("safetyEnabled", true)->value() == "true";
+        }
+        if (!setAutopilotParameters(params)) {
+            request->send(400, "application/json", "{\"error\":\"paramètres refusés\"}");
+            return;
+        }
+    }
+
+    snprintf(jsonBuffer, sizeof(jsonBuffer),
+             "{\"version\":%lu,\"figure8Width\":%u,\"figure8Height\":%u,\"turnSpeed\":%u,"
+             "\"aggressiveness\":%u,\"windAdaptation\":%u,\"safetyEnabled\":%s,"
+             "\"maxAltitude\":%u,\"maxLineLength\":%u,\"maxWindSpeed\":%u}",
+             (unsigned long)getAutopilotParametersVersion(), params.figure8Width, params.figure8Height,
+             params.turnSpeed, params.aggressiveness, params.windAdaptation,
+             params.safetyEnabled ? "true" : "false", params.maxAltitude, params.maxLineLength,
+             params.maxWindSpeed);
+    request->send(200, "application/json", jsonBuffer);
+}
+
+// Dernière trame publiée du tableau de bord
+// GET /api/dashboard ; l'ETag est le numéro de trame, 304 si le client l'a déjà
+static void COLD_PATH handleApiDashboard(AsyncWebServerRequest *request) {
+    uint32_t sequence = dashboardGetSequence();
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)sequence);
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+        request->send(304);
+        return;
+    }
+
+    // La trame sérialisée peut être plus récente que l'ETag lu ci-dessus
+    String json = dashboardToJson(DASH_UPDATE_FULL, &sequence);
+    snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)sequence);
+    AsyncWebServerResponse *response = request->beginResponse(200, "application/json", json);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+// Plans de vol intégrés au firmware
+// GET /api/mission (état de la mission et plans disponibles)
+// POST /api/mission (action=start&plan=perf_trial ou action=abort)
+static void COLD_PATH handleApiMission(AsyncWebServerRequest *request) {
+    if (request->method() == HTTP_POST) {
+        String action = request->hasParam("action", true) ? request->getParam("action", true)->value() : "";
+        if (action == "abort") {
+            missionAbort();
+        } else if (action != "start" || !request->hasParam("plan", true) ||
+                   !missionStartPlan(request->getParam("plan", true)->value().c_str())) {
+            request->send(400, "application/json", "{\"error\":\"plan inconnu ou mission en cours\"}");
+            return;
+        }
+    }
+
+    // Raison de l'abandon et liste des plans : plus long que jsonBuffer
+    char json[384];
+    MissionStatus status;
+    missionGetStatus(&status);
+    int length = snprintf(json, sizeof(json),
+                          "{\"state\":\"%s\",\"plan\":\"%s\",\"reason\":\"%s\",\"pc\":%u,"
+                          "\"mark\":%u,\"instructions\":%lu,\"elapsedMs\":%lu,\"plans\":[",
+                          missionStateName(status.state), status.planName != nullptr ? status.planName : "",
+                          status.reason != nullptr ? status.reason : "", status.pc, status.lastMark,
+                          (unsigned long)status.instructions, (unsigned long)status.elapsedMs);
+    for (int i = 0; missionGetPlan(i) != nullptr && length > 0 && length < (int)sizeof(json); i++) {
+        length += snprintf(json + length, sizeof(json) - length, "%s\"%s\"",
+                           i > 0 ? "," : "", missionGetPlan(i)->name);
+    }
+    if (length > 0 && length < (int)sizeof(json)) {
+        snprintf(json + length, sizeof(json) - length, "]}");
+    }
+    request->send(200, "application/json", json);
+}
+
+// Commandes datées, exécutées au cycle de contrôle de leur instant
+// GET /api/commands (horloge du kite et statistiques de la file)
+// POST /api/commands (type=mode|parameter|winch, target=<numéro du mode ou nom du paramètre>, value,
+//                     at=<ms du kite> ou in=<délai ms>, late=execute|drop ; ou action=cancel&id=)
+static void COLD_PATH handleApiCommands(AsyncWebServerRequest *request) {
+    uint32_t nowMs = millis();
+    if (request->method() == HTTP_POST) {
+        if (request->hasParam("action", true) && request->getParam("action", true)->value() == "cancel") {
+            uint32_t id = request->hasParam("id", true) ? request->getParam("id", true)->value().toInt() : 0;
+            if (!commandSchedulerCancel(id)) {
+                request->send(404, "application/json", "{\"error\":\"commande inconnue ou déjà exécutée\"}");
+                return;
+            }
+        } else {
+            static const char* const paramNames[AUTOPILOT_PARAM_COUNT] = {
+                "figure8Width", "figure8Height", "turnSpeed", "aggressiveness", "windAdaptation", "maxWindSpeed"
+            };
+            CommandFrame command = {};
+            String type = request->hasParam("type", true) ? request->getParam("type", true)->value() : "";
+            String target = request->hasParam("target", true) ? request->getParam("target", true)->value() : "";
+            command.type = type == "mode" ? COMMAND_TYPE_MODE : type == "parameter" ? COMMAND_TYPE_PARAMETER
+                         : type == "winch" ? COMMAND_TYPE_WINCH : COMMAND_TYPE_COUNT;
+            command.target = target.toInt();
+            if (command.type == COMMAND_TYPE_PARAMETER) {
+                command.target = AUTOPILOT_PARAM_COUNT;
+                for (int i = 0; i < AUTOPILOT_PARAM_COUNT; i++) {
+                    if (target == paramNames[i]) command.target = i;
+                }
+            }
+            if (request->hasParam("value", true)) {
+                command.value = request->getParam("value", true)->value().toFloat();
+            }
+            command.executeAtMs = request->hasParam("at", true)
+                ? (uint32_t)strtoul(request->getParam("at", true)->value().c_str(), nullptr, 10)
+                : nowMs + (request->hasParam("in", true) ? request->getParam("in", true)->value().toInt() : 0);
+            command.latePolicy = request->hasParam("late", true) && request->getParam("late", true)->value() == "drop"
+                ? COMMAND_LATE_DROP : COMMAND_LATE_EXECUTE;
+
+            uint32_t id;
+            CommandSubmitResult result = commandSchedulerSubmit(&command, COMMAND_SOURCE_REST, nowMs, &id);
+            if (result != COMMAND_QUEUED) {
+                snprintf(jsonBuffer, sizeof(jsonBuffer), "{\"error\":\"%s\",\"nowMs\":%lu}",
+                         commandSubmitResultName(result), (unsigned long)nowMs);
+                request->send(result == COMMAND_REJECTED_FULL ? 503 : 400, "application/json", jsonBuffer);
+                return;
+            }
+            snprintf(jsonBuffer, sizeof(jsonBuffer), "{\"id\":%lu,\"executeAtMs\":%lu,\"nowMs\":%lu}",
+                     (unsigned long)id, (unsigned long)command.executeAtMs, (unsigned long)nowMs);
+            request->send(200, "application/json", jsonBuffer);
+            return;
+        }
+    }
+
+    CommandSchedulerStats stats = commandSchedulerGetStats();
+    snprintf(jsonBuffer, sizeof(jsonBuffer),
+             "{\"nowMs\":%lu,\"pending\":%u,\"nextExecuteAtMs\":%lu,\"submitted\":%lu,\"rejected\":%lu,"
+             "\"executed\":%lu,\"late\":%lu,\"dropped\":%lu,\"failed\":%lu,\"maxLatenessMs\":%lu}",
+             (unsigned long)nowMs, stats.pending, (unsigned long)stats.nextExecuteAtMs,
+             (unsigned long)stats.submitted, (unsigned long)stats.rejected, (unsigned long)stats.executed,
+             (unsigned long)stats.late, (unsigned long)stats.dropped, (unsigned long)stats.failed,
+             (unsigned long)stats.maxLatenessMs);
+    request->send(200, "application/json", jsonBuffer);
+}
+
+// Table des tâches FreeRTOS, capturée par la tâche de surveillance
+// GET /api/tasks (JSON) ou /api/tasks?format=bin (trame "KS" de protocols.h)
+static void COLD_PATH handleApiTasks(AsyncWebServerRequest *request) {
+    // Trop grands pour la pile de la tâche async_tcp ; handlers exécutés par cette seule tâche
+    static TaskSnapshot snapshot;
+    static char json[TASK_SNAPSHOT_JSON_SIZE];
+    if (!taskSnapshotGetLatest(&snapshot)) {
+        request->send(503, "application/json", "{\"error\":\"aucune capture\"}");
+        return;
+    }
+
+    AsyncResponseStream *response;
+    if (request->hasParam("format") && request->getParam("format")->value() == "bin") {
+        uint8_t frame[TASK_SNAPSHOT_MAX_FRAME_SIZE];
+        size_t length = taskSnapshotEncode(&snapshot, frame, sizeof(frame));
+        response = request->beginResponseStream("application/octet-stream");
+        response->write(frame, length);
+    } else {
+        size_t length = taskSnapshotToJson(&snapshot, json, sizeof(json));
+        response = request->beginResponseStream("application/json");
+        response->write((const uint8_t*)json, length);
+    }
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+// Compteurs cumulés sur toute la vie du kite (comparaisons entre kites)
+// GET /api/lifetime
+static void COLD_PATH handleApiLifetime(AsyncWebServerRequest *request) {
+    char json[384];
+    LifetimeCounters counters = lifetimeStatsGet();
+    snprintf(json, sizeof(json),
+             "{\"bootCount\":%lu,\"flightCount\":%lu,\"uptimeS\":%llu,\"flightS\":%llu,"
+             "\"energyWh\":%.3f,\"errorCount\":%lu,\"controlOverruns\":%lu,"
+             "\"worstControlWorkUs\":%lu,\"worstControlPeriodUs\":%lu,\"checkpointCount\":%lu}",
+             (unsigned long)counters.bootCount, (unsigned long)counters.flightCount,
+             (unsigned long long)(counters.uptimeMs / 1000), (unsigned long long)(counters.flightMs / 1000),
+             counters.energyMilliJoules / 3600000.0, (unsigned long)counters.errorCount,
+             (unsigned long)counters.controlOverruns, (unsigned long)counters.worstControlWorkUs,
+             (unsigned long)counters.worstControlPeriodUs, (unsigned long)counters.checkpointCount);
+    request->send(200, "application/json", json);
+}
+
+// Bilan énergétique : puissances, dernier cycle de pompage, statistiques glissantes
+// GET /api/energy
+static void COLD_PATH handleApiEnergy(AsyncWebServerRequest *request) {
+    char json[640];
+    EnergyStats stats;
+    energyGetStats(&stats);
+    const EnergyCycle& last = stats.last;
+    snprintf(json, sizeof(json),
+             "{\"phase\":%d,\"mechanicalPowerW\":%.1f,\"electricalPowerW\":%.1f,"
+             "\"mechanicalWh\":%.3f,\"electricalWh\":%.3f,\"cycleCount\":%lu,"
+             "\"abandonedCycles\":%lu,\"gaps\":%lu,"
+             "\"lastCycle\":{\"durationMs\":%lu,\"reelOutMs\":%lu,\"reelOutJ\":%.1f,"
+             "\"reelInJ\":%.1f,\"netJ\":%.1f,\"electricalJ\":%.1f,\"efficiency\":%.3f,"
+             "\"electricalEfficiency\":%.3f,\"averagePowerW\":%.1f},"
+             "\"window\":{\"cycles\":%u,\"meanNetJ\":%.1f,\"stdNetJ\":%.1f,\"meanPowerW\":%.1f,"
+             "\"meanDurationMs\":%.0f,\"meanEfficiency\":%.3f,\"minEfficiency\":%.3f,"
+             "\"maxEfficiency\":%.3f}}",
+             (int)stats.phase, stats.mechanicalPowerW, stats.electricalPowerW,
+             stats.mechanicalJ / 3600.0, stats.electricalJ / 3600.0, (unsigned long)stats.cycleCount,
+             (unsigned long)stats.abandonedCycles, (unsigned long)stats.gaps,
+             (unsigned long)last.durationMs, (unsigned long)last.reelOutMs, last.reelOutJ,
+             last.reelInJ, last.netJ, last.electricalJ, last.efficiency,
+             last.electricalEfficiency, last.averagePowerW,
+             stats.windowCycles, stats.meanNetJ, stats.stdNetJ, stats.meanPowerW,
+             stats.meanDurationMs, stats.meanEfficiency, stats.minEfficiency, stats.maxEfficiency);
+    request->send(200, "application/json", json);
+}
+
 // Gestion des routes - version optimisée
 void setupServerRoutes(AsyncWebServer* server) {
     server->on("/", HTTP_GET, handleRoot);
@@ -109,6 +490,15 @@ void setupServerRoutes(AsyncWebServer* server) {
     server->on("/api/restart", HTTP_POST, handleApiRestart);
     server->on("/dashboard", HTTP_GET, handleDashboard);
     server->on("/favicon.ico", HTTP_GET, handleFavicon);
+    server->on("/api/sessions/data", HTTP_GET, handleApiSessionData);
+    server->on("/api/sessions", HTTP_GET, handleApiSessions);
+    server->on("/api/autopilot/params", HTTP_GET | HTTP_POST, handleApiAutopilotParams);
+    server->on("/api/dashboard", HTTP_GET, handleApiDashboard);
+    server->on("/api/mission", HTTP_GET | HTTP_POST, handleApiMission);
+    server->on("/api/commands", HTTP_GET | HTTP_POST, handleApiCommands);
+    server->on("/api/tasks", HTTP_GET, handleApiTasks);
+    server->on("/api/lifetime", HTTP_GET, handleApiLifetime);
+    server->on("/api/energy", HTTP_GET, handleApiEnergy);
     server->onNotFound(handleNotFound);
     LOG_INFO("WEBS", "Routes HTTP configurées (mode optimisé)");
 }
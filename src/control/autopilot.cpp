@@ -23,11 +23,17 @@
   Interactions avec d'autres modules :
   - TaskManager : Exécute le code d'autopilote dans une tâche dédiée
   - Servo : Exécute les commandes calculées par l'autopilote
-  - IMU : Fournit des données d'orientation et d'accélération
+  - IMU : Fournit des données d'orientation et d'accélération, reçues de la
+    tâche des capteurs par le bus de messages (BUS_TOPIC_IMU)
   - Wind : Fournit des données sur la vitesse et la direction du vent
   - Tension : Fournit des données sur la tension des lignes
   - Safety : Fournit des limites et des contraintes de sécurité
   - Trajectory : Fournit des points de trajectoire à suivre
+  - Vibration : Signale les vibrations anormales, qui réduisent la confiance
+  - GustPredictor : Prévoit le vent à deux secondes, la figure remonte vers
+    le zénith avant la rafale et la sécurité réagit au vent prévu
+  - LaunchSequencer : Profils d'élévation et de longueur de ligne du décollage
+    et de l'atterrissage, abandon vers le mode urgence sur écart
   
   Aspects techniques notables :
   - Utilisation de filtres de Kalman pour fusionner les données des capteurs
@@ -37,19 +43,33 @@
 */
 
 #include "control/autopilot.h"
+#include "core/hot_path.h"
 #include "utils/logging.h"
 #include "control/trajectory.h"
 #include "control/safety.h"
 #include "hardware/actuators/servo.h"
 #include "hardware/sensors/wind.h"
+#include "hardware/sensors/line_length.h"
+#include "utils/health_monitor.h"
+#include "utils/fault_injection.h"
+#include "core/power_manager.h"
+#include "utils/param_server.h"
+#include "utils/vibration.h"
+#include "control/gust_predictor.h"
+#include "control/launch_sequencer.h"
 #include <cmath> // Pour sqrt et autres fonctions mathématiques
 
 // Variables statiques
-static AutopilotParameters autopilotParams;
+static ParamServer paramServer;            // Paramètres publiés par instantanés (RCU)
+static int controlReader = PARAM_READER_NONE;
 static AutopilotState autopilotState;
 static bool isInitialized = false;
 static unsigned long lastUpdateTime = 0;
 static unsigned long flightStartTime = 0;
+static bool positionValid = false;         // Position dans la fenêtre estimée au cycle courant
+static volatile bool sensorsRearmPending = false;  // Engagement depuis OFF : lectures précédentes périmées
+static IMUData lastImuSample = {};         // Dernier échantillon IMU reçu et vérifié
+static unsigned long lastImuSampleMs = 0;
 
 // Définition des valeurs par défaut
 static const AutopilotParameters DEFAULT_PARAMS = {
@@ -64,20 +84,48 @@ static const AutopilotParameters DEFAULT_PARAMS = {
   .maxWindSpeed = 40          // 40 km/h maximum
 };
 
+static_assert(sizeof(AutopilotParameters) <= PARAM_SERVER_MAX_SIZE,
+              "PARAM_SERVER_MAX_SIZE trop petit pour AutopilotParameters");
+
 // === FONCTIONS PRIVÉES ===
 
 // Calculer la trajectoire en fonction du mode actuel
-static void calculateTrajectory();
+static void calculateTrajectory(const AutopilotParameters& params);
 
 // Vérifier les conditions de sécurité
-static bool checkSafetyConditions();
+static bool checkSafetyConditions(const AutopilotParameters& params, AutopilotMode mode, bool checkWindow);
 
 // Mettre à jour le niveau de confiance
 static void updateConfidence(const IMUData& imuData);
 
+// Reporter la prévision du vent et calculer la réduction de puissance anticipée
+static void updateGustAnticipation(const AutopilotParameters& params);
+
 // Mettre à jour l'état de l'autopilote
 static void updateAutopilotState();
 
+// Estimer la position du kite à partir de l'orientation et de la longueur de ligne
+static void estimatePosition(const IMUData& imuData);
+
+// Calculer la commande de direction vers le point visé
+static void computeSteering(const IMUData& imuData);
+
+// Convertir une position de la fenêtre de vent (azimut, élévation) en [x, y, z]
+static void windowToPosition(const float window[2], float position[3]);
+
+// Écarter un point de la fenêtre de la limite de l'enveloppe de vol
+static void keepClearOfEnvelope(const AutopilotParameters& params, float window[2]);
+
+// Ramener le point visé vers l'intérieur quand le kite approche la limite
+static void avoidEnvelopeBoundary(const AutopilotParameters& params);
+
+// Lancer le profil du décollage ou de l'atterrissage à l'entrée du mode
+static bool startLaunchSequence(AutopilotMode mode);
+
+// Actions de récupération confiées à la surveillance de santé
+static bool reinitializeImu();
+static bool enterSafeMode();
+
 // === IMPLÉMENTATION DES FONCTIONS PUBLIQUES ===
 
 // Initialise les paramètres de l'autopilote
@@ -87,16 +135,33 @@ bool autopilotInit() {
     return true;
   }
   
-  // Initialiser les paramètres avec les valeurs par défaut
-  autopilotParams = DEFAULT_PARAMS;
+  // Initialiser les paramètres avec les valeurs par défaut ; la boucle de
+  // contrôle lit les instantanés sans verrou, une fois par cycle
+  if (!paramServerInit(&paramServer, &DEFAULT_PARAMS, sizeof(AutopilotParameters))) {
+    LOG_ERROR("APLT", "Serveur de paramètres indisponible");
+    return false;
+  }
+  controlReader = paramServerRegisterReader(&paramServer);
   
   // Initialiser l'état de l'autopilote
   memset(&autopilotState, 0, sizeof(AutopilotState));
+  positionValid = false;
   autopilotState.currentMode = AUTOPILOT_OFF;
   autopilotState.confidence = 100;
   autopilotState.isStable = true;
+  autopilotState.figure8Side = 1;
+  gustPredictorInit();
+  if (!safetyEnvelopeInit()) {
+    LOG_ERROR("APLT", "Enveloppe de vol non compilée");
+    return false;
+  }
   strncpy(autopilotState.statusMessage, "Autopilote initialisé", sizeof(autopilotState.statusMessage) - 1);
   
+  // Initialiser le PID de direction
+  pidInit(&autopilotState.pidParams, AUTOPILOT_PID_KP, AUTOPILOT_PID_KI, AUTOPILOT_PID_KD,
+          MIN_ANGLE, MAX_ANGLE, AUTOPILOT_PID_MAX_INTEGRAL);
+  pidSetDerivativeFilter(&autopilotState.pidParams, AUTOPILOT_PID_DERIVATIVE_FILTER);
+  
   // Initialiser les valeurs de position
   for (int i = 0; i < 3; i++) {
     autopilotState.currentPosition[i] = 0;
@@ -106,6 +171,13 @@ bool autopilotInit() {
     }
   }
   
+  // Récupérations : IMU réinitialisée, mode urgence si une tâche est
+  // bloquée ou si le tas est épuisé
+  healthMonitorSetRecoveryAction(HEALTH_SENSOR_IMU, reinitializeImu);
+  healthMonitorSetRecoveryAction(HEALTH_TASK_CONTROL, enterSafeMode);
+  healthMonitorSetRecoveryAction(HEALTH_TASK_SENSOR, enterSafeMode);
+  healthMonitorSetRecoveryAction(HEALTH_HEAP, enterSafeMode);
+  
   // Marquer comme initialisé
   isInitialized = true;
   
@@ -127,23 +199,44 @@ bool setAutopilotMode(AutopilotMode mode) {
     return false;
   }
   
-  // Vérifier les conditions pour activer certains modes
+  // Vérifier les conditions pour activer certains modes ; depuis OFF la
+  // position n'est pas suivie par un vol en cours, la fenêtre sera vérifiée
+  // au premier cycle sur une position fraîche
   if (mode != AUTOPILOT_OFF && mode != AUTOPILOT_EMERGENCY) {
-    if (!checkSafetyConditions()) {
+    bool checkWindow = autopilotState.currentMode != AUTOPILOT_OFF && positionValid;
+    if (!checkSafetyConditions(getAutopilotParameters(), mode, checkWindow)) {
       LOG_WARNING("APLT", "Conditions de sécurité non remplies pour le mode %d", mode);
       return false;
     }
   }
   
-  // Si on active l'autopilote à partir du mode OFF, enregistrer le temps de début
+  // Si on active l'autopilote à partir du mode OFF, enregistrer le temps de début ;
+  // la surveillance des capteurs repart de la prochaine lecture (les lectures
+  // du vol manuel ont pu être interrompues)
   if (autopilotState.currentMode == AUTOPILOT_OFF && mode != AUTOPILOT_OFF) {
     flightStartTime = millis() / 1000;
+    sensorsRearmPending = true;
+  }
+  
+  // Pleine vitesse dès l'activation, sans attendre la tâche de surveillance
+  if (mode != AUTOPILOT_OFF) {
+    powerManagerApplyProfile(POWER_PROFILE_FLIGHT);
   }
   
   // Enregistrer le mode précédent et définir le nouveau mode
   AutopilotMode previousMode = autopilotState.currentMode;
   autopilotState.currentMode = mode;
   
+  // Séquences profilées : lancées à l'entrée du mode, arrêtées à la sortie
+  if (mode != previousMode) {
+    if (previousMode == AUTOPILOT_TAKEOFF || previousMode == AUTOPILOT_LANDING) {
+      launchSequenceCancel();
+    }
+    if (mode == AUTOPILOT_TAKEOFF || mode == AUTOPILOT_LANDING) {
+      startLaunchSequence(mode);
+    }
+  }
+  
   // Mettre à jour le message de statut
   switch (mode) {
     case AUTOPILOT_OFF:
@@ -177,7 +270,7 @@ AutopilotMode getAutopilotMode() {
   return autopilotState.currentMode;
 }
 
-void autopilotUpdate(const IMUData& imuData) {
+HOT_PATH void autopilotUpdate(const IMUData& imuData) {
   if (!isInitialized) {
     return;
   }
@@ -187,7 +280,7 @@ void autopilotUpdate(const IMUData& imuData) {
   unsigned long deltaTime = currentTime - lastUpdateTime;
   
   // Ne pas mettre à jour trop fréquemment
-  if (deltaTime < 50) { // Maximum 20 Hz
+  if (deltaTime < AUTOPILOT_UPDATE_INTERVAL) { // Maximum 20 Hz
     return;
   }
   
@@ -196,12 +289,25 @@ void autopilotUpdate(const IMUData& imuData) {
     autopilotState.flightTimeSeconds = (currentTime / 1000) - flightStartTime;
   }
   
+  // Paramètres du cycle : un seul instantané, cohérent même pendant un réglage
+  const AutopilotParameters& params =
+      *static_cast<const AutopilotParameters*>(paramServerRead(&paramServer, controlReader, nullptr));
+  
   // Mettre à jour le niveau de confiance
   updateConfidence(imuData);
   
+  // Anticiper les rafales prévues
+  updateGustAnticipation(params);
+  
+  // Estimer la position avant la vérification : l'enveloppe juge ce cycle
+  if (imuData.dataValid) {
+    estimatePosition(imuData);
+  }
+  positionValid = imuData.dataValid;
+  
   // Vérifier les conditions de sécurité en mode actif
   if (autopilotState.currentMode != AUTOPILOT_OFF && autopilotState.currentMode != AUTOPILOT_EMERGENCY) {
-    if (!checkSafetyConditions()) {
+    if (!checkSafetyConditions(params, autopilotState.currentMode, positionValid)) {
       LOG_WARNING("APLT", "Conditions de sécurité non remplies, activation du mode urgence");
       setAutopilotMode(AUTOPILOT_EMERGENCY);
     }
@@ -209,7 +315,9 @@ void autopilotUpdate(const IMUData& imuData) {
   
   // Calculer la trajectoire si l'autopilote est actif
   if (autopilotState.currentMode != AUTOPILOT_OFF) {
-    calculateTrajectory();
+    calculateTrajectory(params);
+    avoidEnvelopeBoundary(params);
+    computeSteering(imuData);
   }
   
   // Mettre à jour l'état de l'autopilote
@@ -266,15 +374,45 @@ bool setAutopilotParameters(const AutopilotParameters& params) {
     return false;
   }
   
-  // Mettre à jour les paramètres
-  autopilotParams = params;
+  // Publier une nouvelle version, prise en compte au cycle de contrôle suivant
+  uint32_t version = paramServerPublish(&paramServer, &params);
+  if (version == 0) {
+    LOG_WARNING("APLT", "Paramètres non publiés : instantanés tous en cours de lecture");
+    return false;
+  }
   
-  LOG_INFO("APLT", "Paramètres d'autopilote mis à jour");
+  LOG_INFO("APLT", "Paramètres d'autopilote mis à jour (version %lu)", (unsigned long)version);
   return true;
 }
 
+bool setAutopilotParameter(AutopilotParamId id, int32_t value) {
+  // Les valeurs hors plage sont refusées ici ou par la validation complète
+  if (value < 0 || value > UINT8_MAX) {
+    return false;
+  }
+  AutopilotParameters params = getAutopilotParameters();
+  switch (id) {
+    case AUTOPILOT_PARAM_FIGURE8_WIDTH:   params.figure8Width = (uint8_t)value; break;
+    case AUTOPILOT_PARAM_FIGURE8_HEIGHT:  params.figure8Height = (uint8_t)value; break;
+    case AUTOPILOT_PARAM_TURN_SPEED:      params.turnSpeed = (uint8_t)value; break;
+    case AUTOPILOT_PARAM_AGGRESSIVENESS:  params.aggressiveness = (uint8_t)value; break;
+    case AUTOPILOT_PARAM_WIND_ADAPTATION: params.windAdaptation = (uint8_t)value; break;
+    case AUTOPILOT_PARAM_MAX_WIND_SPEED:  params.maxWindSpeed = (uint8_t)value; break;
+    default:                              return false;
+  }
+  return setAutopilotParameters(params);
+}
+
 AutopilotParameters getAutopilotParameters() {
-  return autopilotParams;
+  AutopilotParameters params = DEFAULT_PARAMS;
+  if (isInitialized) {
+    paramServerCopy(&paramServer, &params);
+  }
+  return params;
+}
+
+uint32_t getAutopilotParametersVersion() {
+  return isInitialized ? paramServerGetStats(&paramServer).version : 0;
 }
 
 AutopilotState getAutopilotState() {
@@ -298,7 +436,7 @@ bool calibrateAutopilot() {
   delay(2000); // Simulation de la calibration
   
   // Réinitialiser les paramètres à leurs valeurs par défaut
-  autopilotParams = DEFAULT_PARAMS;
+  paramServerPublish(&paramServer, &DEFAULT_PARAMS);
   
   // Revenir au mode OFF après la calibration
   setAutopilotMode(AUTOPILOT_OFF);
@@ -322,6 +460,92 @@ void autopilotEmergencyStop() {
   // Code pour sécuriser le kite
 }
 
+void updatePIDParams(const PIDParams* params) {
+  if (params == nullptr) {
+    return;
+  }
+  
+  // Conserver la consigne courante, repartir d'un état intégral/dérivé neutre
+  float setpoint = autopilotState.pidParams.setpoint;
+  pidInit(&autopilotState.pidParams, params->Kp, params->Ki, params->Kd,
+          params->minOutput, params->maxOutput, params->maxIntegral);
+  bool filterValid = params->derivativeFilter > 0.0f && params->derivativeFilter <= 1.0f;
+  pidSetDerivativeFilter(&autopilotState.pidParams,
+                         filterValid ? params->derivativeFilter : AUTOPILOT_PID_DERIVATIVE_FILTER);
+  autopilotState.pidParams.setpoint = setpoint;
+  
+  LOG_INFO("APLT", "PID mis à jour: Kp=%.2f Ki=%.2f Kd=%.2f", params->Kp, params->Ki, params->Kd);
+}
+
+float computeControlCommand(float currentAngle, float targetAngle) {
+  autopilotState.currentAngle = currentAngle;
+  autopilotState.targetAngle = targetAngle;
+  autopilotState.pidParams.setpoint = targetAngle;
+  
+  return pidCompute(&autopilotState.pidParams, currentAngle, AUTOPILOT_UPDATE_INTERVAL / 1000.0f);
+}
+
+void updateAutopilotState(float windSpeed, float lineLength) {
+  autopilotState.windSpeed = windSpeed;
+  autopilotState.lineLength = lineLength;
+}
+
+HOT_PATH bool autopilotControlStep(const IMUData* imuSample) {
+  if (!isInitialized) {
+    return false;
+  }
+  
+  // Réarmement fait ici : les canaux capteurs ne sont alimentés que par cette tâche
+  if (sensorsRearmPending) {
+    sensorsRearmPending = false;
+    healthMonitorRearmSensor(HEALTH_SENSOR_IMU);
+    healthMonitorRearmSensor(HEALTH_SENSOR_WIND);
+    healthMonitorRearmSensor(HEALTH_SENSOR_LINE_LENGTH);
+  }
+  
+  // Échantillon diffusé par la tâche des capteurs, vérifié une seule fois ;
+  // sans nouvel échantillon, le précédent sert tant qu'il est récent
+  if (imuSample != nullptr) {
+    lastImuSample = *imuSample;
+    lastImuSampleMs = millis();
+    for (uint8_t axis = 0; axis < 3; axis++) {
+      lastImuSample.orientation[axis] = FAULT_FILTER_SENSOR(FAULT_SENSOR_IMU, axis, lastImuSample.orientation[axis]);
+    }
+    // Une IMU figée ou incohérente ne guide plus le kite
+    if (lastImuSample.dataValid && !healthMonitorCheckSensor(HEALTH_SENSOR_IMU, lastImuSample.orientation[0])) {
+      lastImuSample.dataValid = false;
+    }
+  }
+  IMUData imuData = lastImuSample;
+  if (millis() - lastImuSampleMs > AUTOPILOT_IMU_MAX_AGE_MS) {
+    imuData.dataValid = false;
+  }
+  
+  WindData wind = windRead();
+  wind.speed = FAULT_FILTER_SENSOR(FAULT_SENSOR_WIND, 0, wind.speed);
+  if (wind.isValid && !healthMonitorCheckSensor(HEALTH_SENSOR_WIND, wind.speed)) {
+    wind.isValid = false;
+  }
+  if (wind.isValid) {
+    gustPredictorUpdate(wind.speed, millis());
+  }
+  int length = lineLengthRead();
+  if (length >= 0) {
+    float checked = FAULT_FILTER_SENSOR(FAULT_SENSOR_LINE_LENGTH, 0, (float)length);
+    length = healthMonitorCheckSensor(HEALTH_SENSOR_LINE_LENGTH, checked) ? (int)lroundf(checked) : -1;
+  }
+  updateAutopilotState(wind.isValid ? wind.speed : autopilotState.windSpeed,
+                       length >= 0 ? (float)length : autopilotState.lineLength);
+  
+  autopilotUpdate(imuData);
+  
+  // En mode manuel, les servos restent pilotés par les potentiomètres
+  if (!isAutopilotActive()) {
+    return true;
+  }
+  return servoUpdateAll((int)lroundf(autopilotState.steeringCommand), 0, 0);
+}
+
 bool isAutopilotActive() {
   return (autopilotState.currentMode != AUTOPILOT_OFF);
 }
@@ -332,40 +556,69 @@ uint8_t getAutopilotConfidence() {
 
 // === IMPLÉMENTATION DES FONCTIONS PRIVÉES ===
 
-static void calculateTrajectory() {
+static HOT_PATH void calculateTrajectory(const AutopilotParameters& params) {
   // Cette fonction calculerait la trajectoire optimale en fonction du mode actuel
   // Pour l'instant, c'est une version simplifiée
   
   switch (autopilotState.currentMode) {
-    case AUTOPILOT_FIGURE_8:
-      // Calculer une trajectoire en 8
-      // Code pour générer la trajectoire en 8 ici
+    case AUTOPILOT_FIGURE_8: {
+      // Deux points de virage en haut de la fenêtre, visés alternativement :
+      // le kite traverse le centre en descendant, ce qui dessine le 8
+      // Rafale prévue : la figure remonte vers le zénith, où la traction est moindre.
+      // Un point de virage trop près de la limite de l'enveloppe est rentré
+      float halfWidth = params.figure8Width / 2.0f;
+      float elevation = AUTOPILOT_FIGURE8_ELEVATION + params.figure8Height / 2.0f +
+                        autopilotState.gustDepower * GUST_DEPOWER_ELEVATION;
+      float azimuth = autopilotState.windowPosition[0];
+      float turn[2] = {autopilotState.figure8Side * halfWidth, elevation};
+      keepClearOfEnvelope(params, turn);
+      if ((autopilotState.figure8Side > 0 && azimuth >= turn[0]) ||
+          (autopilotState.figure8Side < 0 && azimuth <= turn[0])) {
+        autopilotState.figure8Side = -autopilotState.figure8Side;
+        turn[0] = autopilotState.figure8Side * halfWidth;
+        turn[1] = elevation;
+        keepClearOfEnvelope(params, turn);
+      }
+      autopilotState.windowTarget[0] = turn[0];
+      autopilotState.windowTarget[1] = turn[1];
+      windowToPosition(autopilotState.windowTarget, autopilotState.targetPosition);
       break;
+    }
       
     case AUTOPILOT_HOVER:
-      // Maintenir une position stable
-      // Définir la même position cible que la position actuelle
-      for (int i = 0; i < 3; i++) {
-        autopilotState.targetPosition[i] = autopilotState.currentPosition[i];
-      }
+      // Maintenir le kite au-dessus du centre de la fenêtre : viser le zénith
+      // ramène aussi l'azimut vers 0, la portance limite l'élévation atteinte
+      autopilotState.windowTarget[0] = 0;
+      autopilotState.windowTarget[1] = AUTOPILOT_HOVER_ELEVATION;
+      windowToPosition(autopilotState.windowTarget, autopilotState.targetPosition);
       break;
       
     case AUTOPILOT_LANDING:
-      // Calculer une trajectoire d'atterrissage
-      // Réduire progressivement l'altitude
-      autopilotState.targetPosition[2] = 0; // Z = 0 pour l'atterrissage
-      break;
-      
-    case AUTOPILOT_TAKEOFF:
-      // Calculer une trajectoire de décollage
-      // Augmenter progressivement l'altitude
-      autopilotState.targetPosition[2] = 30; // Z = 30m pour le décollage
+    case AUTOPILOT_TAKEOFF: {
+      // Profils précalculés : élévation visée dans l'axe du vent, treuil
+      // commandé par le séquenceur ; stationnaire après le décollage, manuel
+      // après l'atterrissage, urgence si le kite ou le treuil décroche du profil
+      LaunchSetpoint setpoint;
+      LaunchStatus status = launchSequenceUpdate(millis(), autopilotState.windowPosition[1],
+                                                 autopilotState.lineLength, &setpoint);
+      if (status == LAUNCH_RUNNING) {
+        autopilotState.windowTarget[0] = 0;
+        autopilotState.windowTarget[1] = setpoint.elevation;
+        windowToPosition(autopilotState.windowTarget, autopilotState.targetPosition);
+      } else if (status == LAUNCH_COMPLETE) {
+        setAutopilotMode(autopilotState.currentMode == AUTOPILOT_TAKEOFF ? AUTOPILOT_HOVER : AUTOPILOT_OFF);
+      } else {
+        setAutopilotMode(AUTOPILOT_EMERGENCY);
+      }
       break;
+    }
       
     case AUTOPILOT_EMERGENCY:
-      // Trajectoire d'urgence pour sécuriser le kite
-      // Typiquement une descente contrôlée
-      autopilotState.targetPosition[2] = 0; // Z = 0 pour descendre
+      // Trajectoire d'urgence pour sécuriser le kite : sortir de la zone de
+      // puissance vers le zénith, où la tension est minimale
+      autopilotState.windowTarget[0] = 0;
+      autopilotState.windowTarget[1] = AUTOPILOT_HOVER_ELEVATION;
+      windowToPosition(autopilotState.windowTarget, autopilotState.targetPosition);
       break;
       
     case AUTOPILOT_CALIBRATION:
@@ -377,27 +630,159 @@ static void calculateTrajectory() {
   }
 }
 
-static bool checkSafetyConditions() {
+static HOT_PATH void windowToPosition(const float window[2], float position[3]) {
+  const float degToRad = 0.017453292f;
+  float length = autopilotState.lineLength / 100.0f;
+  float azimuth = window[0] * degToRad;
+  float elevation = window[1] * degToRad;
+  position[0] = length * std::cos(elevation) * std::cos(azimuth);  // Sous le vent
+  position[1] = length * std::cos(elevation) * std::sin(azimuth);  // Latéral
+  position[2] = length * std::sin(elevation);                      // Altitude
+}
+
+static HOT_PATH void keepClearOfEnvelope(const AutopilotParameters& params, float window[2]) {
+  if (!params.safetyEnabled) {
+    return;
+  }
+  SafetyLimits limits = {SAFETY_MIN_LINE_LENGTH_CM, (float)params.maxLineLength, (float)params.maxAltitude};
+  SafetyCheck check;
+  safetyEnvelopeCheck(window[0], window[1], autopilotState.lineLength, limits, &check);
+  if (check.boundaryDistance < SAFETY_SOFT_MARGIN_DEG) {
+    float push = SAFETY_SOFT_MARGIN_DEG - check.boundaryDistance;
+    window[0] += check.inwardAzimuth * push;
+    window[1] += check.inwardElevation * push;
+  }
+}
+
+static HOT_PATH void avoidEnvelopeBoundary(const AutopilotParameters& params) {
+  // Figure en 8 et stationnaire seulement : les séquences suivent leur
+  // profil, l'urgence vise déjà le zénith
+  if (!params.safetyEnabled ||
+      (autopilotState.currentMode != AUTOPILOT_FIGURE_8 && autopilotState.currentMode != AUTOPILOT_HOVER)) {
+    return;
+  }
+  
+  // Kite dans la marge : le point visé est décalé vers l'intérieur de ce qui
+  // manque au kite, avant que la limite ne déclenche l'urgence
+  SafetyLimits limits = {SAFETY_MIN_LINE_LENGTH_CM, (float)params.maxLineLength, (float)params.maxAltitude};
+  SafetyCheck kite;
+  safetyEnvelopeCheck(autopilotState.windowPosition[0], autopilotState.windowPosition[1],
+                      autopilotState.lineLength, limits, &kite);
+  if (kite.boundaryDistance >= SAFETY_SOFT_MARGIN_DEG) {
+    return;
+  }
+  float push = SAFETY_SOFT_MARGIN_DEG - kite.boundaryDistance;
+  autopilotState.windowTarget[0] += kite.inwardAzimuth * push;
+  autopilotState.windowTarget[1] += kite.inwardElevation * push;
+  windowToPosition(autopilotState.windowTarget, autopilotState.targetPosition);
+}
+
+static HOT_PATH void estimatePosition(const IMUData& imuData) {
+  autopilotState.windowPosition[0] = imuData.orientation[1];
+  autopilotState.windowPosition[1] = imuData.orientation[0];
+  windowToPosition(autopilotState.windowPosition, autopilotState.currentPosition);
+}
+
+static bool startLaunchSequence(AutopilotMode mode) {
+  AutopilotParameters params = getAutopilotParameters();
+  float length = autopilotState.lineLength;
+  if (mode == AUTOPILOT_TAKEOFF) {
+    // Ligne déroulée dans la limite de longueur et sans dépasser l'altitude maximale
+    const float degToRad = 0.017453292f;
+    float altitudeLimitCm = params.maxAltitude * 100.0f / std::sin(LAUNCH_TAKEOFF_ELEVATION * degToRad);
+    float target = fminf(length + LAUNCH_TAKEOFF_REEL_OUT_CM,
+                         fminf((float)params.maxLineLength, LAUNCH_ALTITUDE_MARGIN * altitudeLimitCm));
+    return launchSequenceStart(LAUNCH_TAKEOFF, millis(), autopilotState.windowPosition[1], length,
+                               LAUNCH_TAKEOFF_ELEVATION, fmaxf(target, length));
+  }
+  return launchSequenceStart(LAUNCH_LANDING, millis(), autopilotState.windowPosition[1], length,
+                             LAUNCH_LANDING_ELEVATION, fminf(length, (float)LAUNCH_LANDING_LINE_CM));
+}
+
+static bool reinitializeImu() {
+  return imuInit();
+}
+
+static bool enterSafeMode() {
+  if (isAutopilotActive() && autopilotState.currentMode != AUTOPILOT_EMERGENCY) {
+    autopilotEmergencyStop();
+  }
+  return true;
+}
+
+static HOT_PATH void computeSteering(const IMUData& imuData) {
+  bool guided = imuData.dataValid &&
+                (autopilotState.currentMode == AUTOPILOT_FIGURE_8 ||
+                 autopilotState.currentMode == AUTOPILOT_HOVER ||
+                 autopilotState.currentMode == AUTOPILOT_TAKEOFF ||
+                 autopilotState.currentMode == AUTOPILOT_LANDING ||
+                 autopilotState.currentMode == AUTOPILOT_EMERGENCY);
+  if (!guided) {
+    // Direction au neutre
+    autopilotState.steeringCommand = 0;
+    return;
+  }
+  
+  // Cap vers le point visé, sur la sphère (l'azimut se contracte avec l'élévation)
+  const float degToRad = 0.017453292f;
+  float deltaAzimuth = autopilotState.windowTarget[0] - autopilotState.windowPosition[0];
+  float deltaElevation = autopilotState.windowTarget[1] - autopilotState.windowPosition[1];
+  float bearing = std::atan2(deltaAzimuth * std::cos(autopilotState.windowPosition[1] * degToRad),
+                             deltaElevation) / degToRad;
+  
+  // Erreur de cap ramenée dans [-180, 180] pour tourner du côté le plus court
+  float heading = imuData.orientation[2];
+  float headingError = std::fmod(bearing - heading + 540.0f, 360.0f) - 180.0f;
+  autopilotState.steeringCommand = computeControlCommand(heading, heading + headingError);
+}
+
+static bool checkSafetyConditions(const AutopilotParameters& params, AutopilotMode mode, bool checkWindow) {
   // Vérifier toutes les conditions de sécurité
   
   // Condition 1: La sécurité est activée
-  if (!autopilotParams.safetyEnabled) {
+  if (!params.safetyEnabled) {
     return true; // Si la sécurité est désactivée, toujours autoriser
   }
   
-  // Condition 2: L'altitude est dans les limites
-  float currentAltitude = autopilotState.currentPosition[2];
-  if (currentAltitude > autopilotParams.maxAltitude) {
-    LOG_WARNING("APLT", "Altitude trop élevée: %.1f m (max: %d m)", 
-                currentAltitude, autopilotParams.maxAltitude);
+  // Conditions 2 et 3: Le kite est dans l'enveloppe de vol (fenêtre,
+  // longueur des lignes, altitude) ; la fenêtre n'est vérifiée que sur
+  // demande (position fraîche), et ni au décollage ni à l'atterrissage, qui partent
+  // du bas de la fenêtre et sont surveillés par leur séquenceur
+  SafetyLimits limits = {SAFETY_MIN_LINE_LENGTH_CM, (float)params.maxLineLength, (float)params.maxAltitude};
+  SafetyCheck check;
+  safetyEnvelopeCheck(autopilotState.windowPosition[0], autopilotState.windowPosition[1],
+                      autopilotState.lineLength, limits, &check);
+  autopilotState.envelopeDistance = check.boundaryDistance;
+  bool launching = mode == AUTOPILOT_TAKEOFF || mode == AUTOPILOT_LANDING;
+  if (check.violation == SAFETY_OUTSIDE_WINDOW && checkWindow && !launching) {
+    LOG_WARNING("APLT", "Hors de l'enveloppe: azimut %.1f°, élévation %.1f° (%.1f° de la limite)",
+                autopilotState.windowPosition[0], autopilotState.windowPosition[1], check.boundaryDistance);
+    return false;
+  }
+  if (check.lineMarginCm < 0) {
+    LOG_WARNING("APLT", "Longueur des lignes hors limites: %.0f cm (%d-%d cm)",
+                autopilotState.lineLength, SAFETY_MIN_LINE_LENGTH_CM, params.maxLineLength);
+    return false;
+  }
+  if (check.altitudeMargin < 0) {
+    LOG_WARNING("APLT", "Altitude trop élevée: %.1f m (max: %d m)",
+                params.maxAltitude - check.altitudeMargin, params.maxAltitude);
     return false;
   }
-  
-  // Condition 3: La longueur des lignes est dans les limites
-  // Nécessite des capteurs supplémentaires
   
   // Condition 4: La vitesse du vent est dans les limites
-  // Nécessite des capteurs supplémentaires
+  if (autopilotState.windSpeed * 3.6f > params.maxWindSpeed) {
+    LOG_WARNING("APLT", "Vent trop fort: %.1f km/h (max: %d km/h)",
+                autopilotState.windSpeed * 3.6f, params.maxWindSpeed);
+    return false;
+  }
+  
+  // Condition 5: La rafale prévue reste dans les limites
+  if (autopilotState.predictedWindSpeed * 3.6f > params.maxWindSpeed) {
+    LOG_WARNING("APLT", "Rafale prévue: %.1f km/h dans %d ms (max: %d km/h)",
+                autopilotState.predictedWindSpeed * 3.6f, GUST_HORIZON_MS, params.maxWindSpeed);
+    return false;
+  }
   
   // Toutes les conditions sont remplies
   return true;
@@ -410,8 +795,9 @@ static void updateConfidence(const IMUData& imuData) {
   // Facteur 1: Stabilité des données IMU
   float gyroMagnitude = std::sqrt(std::pow(imuData.gyro[0], 2) + std::pow(imuData.gyro[1], 2) + std::pow(imuData.gyro[2], 2));
   
-  // Réduire la confiance si les gyroscopes montrent trop de mouvement
-  if (gyroMagnitude > 200) {
+  // Réduire la confiance si les gyroscopes montrent trop de mouvement, ou si
+  // l'analyse vibratoire détecte un flottement des lignes ou une oscillation
+  if (gyroMagnitude > 200 || vibrationIsAnomalous()) {
     autopilotState.confidence = std::max(30, autopilotState.confidence - 5);
   } else {
     // Augmenter lentement la confiance si tout est stable
@@ -421,6 +807,28 @@ static void updateConfidence(const IMUData& imuData) {
   // Autres facteurs de confiance pourraient être ajoutés ici
 }
 
+static void updateGustAnticipation(const AutopilotParameters& params) {
+  GustPrediction prediction;
+  gustPredictorGetPrediction(&prediction);
+  if (!prediction.ready) {
+    // Modèle en apprentissage : le vent prévu est le vent mesuré
+    autopilotState.predictedWindSpeed = autopilotState.windSpeed;
+    autopilotState.predictedWindUpper = autopilotState.windSpeed;
+    autopilotState.gustDepower = 0;
+    return;
+  }
+  autopilotState.predictedWindSpeed = prediction.predictedSpeed;
+  autopilotState.predictedWindUpper = prediction.upperBound;
+  
+  // Réduction progressive quand le haut de la bande passe de GUST_DEPOWER_START
+  // fois le vent maximal au vent maximal, dosée par l'adaptation au vent
+  float maxSpeed = params.maxWindSpeed / 3.6f;
+  float start = GUST_DEPOWER_START * maxSpeed;
+  float ratio = (prediction.upperBound - start) / (maxSpeed - start);
+  ratio = std::min(1.0f, std::max(0.0f, ratio));
+  autopilotState.gustDepower = ratio * params.windAdaptation / 10.0f;
+}
+
 static void updateAutopilotState() {
   // Mettre à jour l'état de l'autopilote
   
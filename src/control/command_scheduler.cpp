@@ -0,0 +1,259 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Commandes datées (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Les commandes en attente forment un tas binaire ordonné par instant
+     d'exécution, puis par numéro de réception : à instant égal, l'ordre
+     d'arrivée est conservé
+  2. La soumission vérifie la commande, la place en fin de tableau et la
+     remonte ; le retrait remplace l'entrée par la dernière et la replace
+  3. À chaque cycle, la racine est retirée tant que son instant est
+     atteint ; la commande est exécutée hors section critique, après la
+     décision de retard (écart supérieur ou égal à une période)
+  4. Les instants sont comparés par différence signée sur 32 bits, valable
+     tant que les échéances restent à moins de 24 jours de l'horloge
+*/
+
+#include "control/command_scheduler.h"
+#include "core/hot_path.h"
+#include "control/autopilot.h"
+#include "utils/logging.h"
+#include <math.h>
+#include <string.h>
+
+// === DÉFINITION DES TYPES ===
+
+typedef struct {
+  CommandFrame command;
+  uint32_t id;                   // Numéro de réception (départage les instants égaux)
+  uint8_t source;
+} CommandEntry;
+
+// === VARIABLES GLOBALES ===
+
+static CommandEntry heap[COMMAND_SCHEDULER_CAPACITY];
+static uint16_t heapSize = 0;
+static uint32_t nextId = 1;
+static uint32_t tickPeriodMs = 20;
+static CommandWinchHandler winchHandler = nullptr;
+static CommandSchedulerStats stats;
+static portMUX_TYPE schedulerMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const SOURCE_NAMES[] = {"locale", "web", "ESP-NOW"};
+
+// === FONCTIONS INTERNES ===
+
+static HOT_PATH bool before(const CommandEntry& a, const CommandEntry& b) {
+  int32_t delta = (int32_t)(a.command.executeAtMs - b.command.executeAtMs);
+  return delta < 0 || (delta == 0 && (int32_t)(a.id - b.id) < 0);
+}
+
+static HOT_PATH void swapEntries(uint16_t i, uint16_t j) {
+  CommandEntry tmp = heap[i];
+  heap[i] = heap[j];
+  heap[j] = tmp;
+}
+
+static HOT_PATH void siftUp(uint16_t index) {
+  while (index > 0) {
+    uint16_t parent = (index - 1) / 2;
+    if (!before(heap[index], heap[parent])) {
+      break;
+    }
+    swapEntries(index, parent);
+    index = parent;
+  }
+}
+
+static HOT_PATH void siftDown(uint16_t index) {
+  for (;;) {
+    uint16_t smallest = index;
+    uint16_t left = 2 * index + 1;
+    uint16_t right = left + 1;
+    if (left < heapSize && before(heap[left], heap[smallest])) smallest = left;
+    if (right < heapSize && before(heap[right], heap[smallest])) smallest = right;
+    if (smallest == index) {
+      return;
+    }
+    swapEntries(index, smallest);
+    index = smallest;
+  }
+}
+
+/**
+ * Retire l'entrée d'indice donné (section critique tenue par l'appelant)
+ */
+static HOT_PATH void removeAt(uint16_t index) {
+  heapSize--;
+  if (index == heapSize) {
+    return;
+  }
+  heap[index] = heap[heapSize];
+  siftDown(index);
+  siftUp(index);
+}
+
+static bool validCommand(const CommandFrame* command) {
+  if (command->latePolicy >= COMMAND_LATE_POLICY_COUNT) {
+    return false;
+  }
+  switch (command->type) {
+    case COMMAND_TYPE_MODE:      return command->target <= AUTOPILOT_CALIBRATION;
+    case COMMAND_TYPE_PARAMETER: return command->target < AUTOPILOT_PARAM_COUNT && isfinite(command->value);
+    case COMMAND_TYPE_WINCH:     return isfinite(command->value);
+    default:                     return false;
+  }
+}
+
+static HOT_PATH bool execute(const CommandFrame& command) {
+  switch (command.type) {
+    case COMMAND_TYPE_MODE:
+      return setAutopilotMode((AutopilotMode)command.target);
+    case COMMAND_TYPE_PARAMETER:
+      return setAutopilotParameter((AutopilotParamId)command.target, (int32_t)lroundf(command.value));
+    default:
+      return winchHandler != nullptr && winchHandler(command.value);
+  }
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void commandSchedulerInit(uint32_t tickMs) {
+  portENTER_CRITICAL(&schedulerMux);
+  heapSize = 0;
+  nextId = 1;
+  tickPeriodMs = tickMs > 0 ? tickMs : 1;
+  memset(&stats, 0, sizeof(stats));
+  portEXIT_CRITICAL(&schedulerMux);
+}
+
+void commandSchedulerSetWinchHandler(CommandWinchHandler handler) {
+  winchHandler = handler;
+}
+
+CommandSubmitResult commandSchedulerSubmit(const CommandFrame* command, CommandSource source,
+                                           uint32_t nowMs, uint32_t* id) {
+  int32_t delay = (int32_t)(command->executeAtMs - nowMs);
+  CommandSubmitResult result = COMMAND_QUEUED;
+  if (!validCommand(command)) {
+    result = COMMAND_REJECTED_INVALID;
+  } else if (command->type == COMMAND_TYPE_WINCH && winchHandler == nullptr) {
+    result = COMMAND_REJECTED_UNSUPPORTED;
+  } else if (delay > COMMAND_MAX_HORIZON_MS || delay < -COMMAND_MAX_HORIZON_MS) {
+    result = COMMAND_REJECTED_HORIZON;
+  } else if (command->latePolicy == COMMAND_LATE_DROP && delay <= -(int32_t)tickPeriodMs) {
+    result = COMMAND_REJECTED_LATE;
+  }
+
+  uint32_t assigned = 0;
+  portENTER_CRITICAL(&schedulerMux);
+  if (result == COMMAND_QUEUED && heapSize >= COMMAND_SCHEDULER_CAPACITY) {
+    result = COMMAND_REJECTED_FULL;
+  }
+  if (result == COMMAND_QUEUED) {
+    assigned = nextId++;
+    if (nextId == 0) nextId = 1;
+    heap[heapSize].command = *command;
+    heap[heapSize].id = assigned;
+    heap[heapSize].source = source;
+    heapSize++;
+    siftUp(heapSize - 1);
+    stats.submitted++;
+  } else {
+    stats.rejected++;
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+
+  if (result != COMMAND_QUEUED) {
+    LOG_WARNING("CMD", "Commande %s refusée : %s", SOURCE_NAMES[source], commandSubmitResultName(result));
+  }
+  if (id != nullptr) {
+    *id = assigned;
+  }
+  return result;
+}
+
+bool commandSchedulerCancel(uint32_t id) {
+  bool found = false;
+  portENTER_CRITICAL(&schedulerMux);
+  for (uint16_t i = 0; i < heapSize; i++) {
+    if (heap[i].id == id) {
+      removeAt(i);
+      stats.cancelled++;
+      found = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&schedulerMux);
+  return found;
+}
+
+HOT_PATH int commandSchedulerService(uint32_t nowMs) {
+  int executed = 0;
+  for (;;) {
+    CommandEntry entry;
+    portENTER_CRITICAL(&schedulerMux);
+    if (heapSize == 0 || (int32_t)(nowMs - heap[0].command.executeAtMs) < 0) {
+      portEXIT_CRITICAL(&schedulerMux);
+      break;
+    }
+    entry = heap[0];
+    removeAt(0);
+    portEXIT_CRITICAL(&schedulerMux);
+
+    uint32_t lateness = nowMs - entry.command.executeAtMs;
+    bool late = lateness >= tickPeriodMs;
+    if (late && entry.command.latePolicy == COMMAND_LATE_DROP) {
+      portENTER_CRITICAL(&schedulerMux);
+      stats.dropped++;
+      portEXIT_CRITICAL(&schedulerMux);
+      LOG_WARNING("CMD", "Commande %lu abandonnée : %lu ms de retard", (unsigned long)entry.id, (unsigned long)lateness);
+      continue;
+    }
+
+    bool ok = execute(entry.command);
+    portENTER_CRITICAL(&schedulerMux);
+    stats.executed++;
+    if (late) stats.late++;
+    if (!ok) stats.failed++;
+    if (lateness > stats.maxLatenessMs) stats.maxLatenessMs = lateness;
+    portEXIT_CRITICAL(&schedulerMux);
+    executed++;
+
+    if (!ok) {
+      LOG_WARNING("CMD", "Commande %lu (%s) refusée à l'exécution", (unsigned long)entry.id, SOURCE_NAMES[entry.source]);
+    } else if (late) {
+      LOG_WARNING("CMD", "Commande %lu exécutée avec %lu ms de retard", (unsigned long)entry.id, (unsigned long)lateness);
+    } else {
+      LOG_DEBUG("CMD", "Commande %lu exécutée à %lu ms", (unsigned long)entry.id, (unsigned long)nowMs);
+    }
+  }
+  return executed;
+}
+
+CommandSchedulerStats commandSchedulerGetStats() {
+  portENTER_CRITICAL(&schedulerMux);
+  CommandSchedulerStats copy = stats;
+  copy.pending = heapSize;
+  copy.nextExecuteAtMs = heapSize > 0 ? heap[0].command.executeAtMs : 0;
+  portEXIT_CRITICAL(&schedulerMux);
+  return copy;
+}
+
+const char* commandSubmitResultName(CommandSubmitResult result) {
+  switch (result) {
+    case COMMAND_QUEUED:               return "en file";
+    case COMMAND_REJECTED_INVALID:     return "commande invalide";
+    case COMMAND_REJECTED_UNSUPPORTED: return "aucun pilote de treuil";
+    case COMMAND_REJECTED_LATE:        return "instant déjà passé";
+    case COMMAND_REJECTED_HORIZON:     return "instant hors horizon";
+    case COMMAND_REJECTED_FULL:        return "file pleine";
+    default:                           return "inconnu";
+  }
+}
@@ -0,0 +1,279 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Bilan énergétique (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Chaque intervalle entre deux échantillons est intégré en trapèze ; si la
+     puissance change de signe, le trapèze est coupé au passage par zéro et
+     chaque triangle rejoint l'énergie produite ou consommée
+  2. La vitesse vote pour une phase candidate hors de la bande morte ; la
+     candidate devient la phase après ENERGY_MIN_PHASE_MS sans changement.
+     L'énergie intégrée pendant cette attente est tenue à part
+  3. Une traction reconnue après un retour clôt le cycle à l'instant où la
+     candidate est apparue : l'énergie tenue à part est retirée du cycle clos
+     et ouvre le suivant
+  4. Le cycle clos entre dans l'anneau des ENERGY_CYCLE_HISTORY derniers
+     cycles, dont les statistiques sont recalculées (quelques dizaines
+     d'opérations par cycle)
+  5. Le bilan est construit sur une copie de travail puis publié sous section
+     critique, avec l'énergie produite pas encore relevée
+*/
+
+#include "control/energy.h"
+#include <math.h>
+#include <string.h>
+
+// === VARIABLES GLOBALES ===
+
+static EnergyStats working;
+static EnergyStats published;
+static double unreportedJ = 0.0;
+static portMUX_TYPE energyMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Échantillon précédent
+static bool hasPrevious = false;
+static uint32_t previousMs = 0;
+static float previousMechanicalW = 0.0f;
+static float previousElectricalW = NAN;
+
+// Phase candidate et énergie intégrée depuis son apparition
+static EnergyPhase candidate = ENERGY_PHASE_UNKNOWN;
+static uint32_t candidateSinceMs = 0;
+static float pendingOutJ = 0.0f;
+static float pendingInJ = 0.0f;
+static float pendingElectricalJ = 0.0f;
+static bool pendingElectricalMeasured = false;
+
+// Derniers cycles achevés
+static EnergyCycle history[ENERGY_CYCLE_HISTORY];
+static uint8_t historyHead = 0;
+static uint8_t historyCount = 0;
+
+// === FONCTIONS INTERNES ===
+
+/**
+ * Trapèze entre deux puissances, partagé au passage par zéro
+ * @param outJ Énergie produite ajoutée
+ * @param inJ Énergie consommée ajoutée (positive)
+ */
+static void integrateTrapezoid(float p0, float p1, float dtS, float* outJ, float* inJ) {
+  if ((p0 >= 0.0f) == (p1 >= 0.0f)) {
+    float area = 0.5f * (p0 + p1) * dtS;
+    if (area >= 0.0f) *outJ += area; else *inJ -= area;
+    return;
+  }
+  float crossing = p0 / (p0 - p1);                   // Fraction de l'intervalle avant le zéro
+  float first = 0.5f * p0 * crossing * dtS;
+  float second = 0.5f * p1 * (1.0f - crossing) * dtS;
+  if (first >= 0.0f) {
+    *outJ += first;
+    *inJ -= second;
+  } else {
+    *inJ -= first;
+    *outJ += second;
+  }
+}
+
+static void clearPending() {
+  pendingOutJ = 0.0f;
+  pendingInJ = 0.0f;
+  pendingElectricalJ = 0.0f;
+  pendingElectricalMeasured = false;
+}
+
+/**
+ * Grandeurs dérivées d'un cycle (énergie nette, rendements, puissance moyenne)
+ */
+static void finalizeCycle(EnergyCycle* cycle) {
+  cycle->netJ = cycle->reelOutJ - cycle->reelInJ;
+  cycle->efficiency = cycle->reelOutJ > 0.0f ? cycle->netJ / cycle->reelOutJ : 0.0f;
+  cycle->electricalEfficiency = cycle->electricalMeasured && cycle->netJ > 0.0f
+      ? cycle->electricalJ / cycle->netJ : 0.0f;
+  cycle->averagePowerW = cycle->durationMs > 0 ? cycle->netJ * 1000.0f / cycle->durationMs : 0.0f;
+}
+
+static void startCycle(uint32_t startMs) {
+  memset(&working.current, 0, sizeof(working.current));
+  working.current.startMs = startMs;
+  working.current.reelOutJ = pendingOutJ;
+  working.current.reelInJ = pendingInJ;
+  working.current.electricalJ = pendingElectricalJ;
+  working.current.electricalMeasured = pendingElectricalMeasured;
+  working.cycleActive = true;
+}
+
+static void updateRollingStats() {
+  float netSum = 0.0f, durationSum = 0.0f, efficiencySum = 0.0f;
+  float minEfficiency = history[0].efficiency, maxEfficiency = history[0].efficiency;
+  for (uint8_t i = 0; i < historyCount; i++) {
+    netSum += history[i].netJ;
+    durationSum += history[i].durationMs;
+    efficiencySum += history[i].efficiency;
+    if (history[i].efficiency < minEfficiency) minEfficiency = history[i].efficiency;
+    if (history[i].efficiency > maxEfficiency) maxEfficiency = history[i].efficiency;
+  }
+  float meanNet = netSum / historyCount;
+  float squaredSum = 0.0f;
+  for (uint8_t i = 0; i < historyCount; i++) {
+    float deviation = history[i].netJ - meanNet;
+    squaredSum += deviation * deviation;
+  }
+  working.windowCycles = historyCount;
+  working.meanNetJ = meanNet;
+  working.stdNetJ = historyCount > 1 ? sqrtf(squaredSum / (historyCount - 1)) : 0.0f;
+  working.meanPowerW = durationSum > 0.0f ? netSum * 1000.0f / durationSum : 0.0f;
+  working.meanDurationMs = durationSum / historyCount;
+  working.meanEfficiency = efficiencySum / historyCount;
+  working.minEfficiency = minEfficiency;
+  working.maxEfficiency = maxEfficiency;
+}
+
+/**
+ * Clôt le cycle en cours à l'apparition de la nouvelle traction
+ */
+static void closeCycle(uint32_t endMs) {
+  EnergyCycle& cycle = working.current;
+  cycle.reelOutJ -= pendingOutJ;
+  cycle.reelInJ -= pendingInJ;
+  cycle.electricalJ -= pendingElectricalJ;
+  cycle.durationMs = endMs - cycle.startMs;
+  finalizeCycle(&cycle);
+
+  working.last = cycle;
+  working.cycleCount++;
+  history[historyHead] = cycle;
+  historyHead = (historyHead + 1) % ENERGY_CYCLE_HISTORY;
+  if (historyCount < ENERGY_CYCLE_HISTORY) historyCount++;
+  updateRollingStats();
+}
+
+/**
+ * Reconnaît la phase quand la candidate a tenu ENERGY_MIN_PHASE_MS
+ * @return true si un cycle s'achève
+ */
+static bool updatePhase(uint32_t nowMs, float reelSpeed) {
+  EnergyPhase vote = candidate;
+  if (reelSpeed > ENERGY_REEL_SPEED_THRESHOLD) vote = ENERGY_PHASE_REEL_OUT;
+  else if (reelSpeed < -ENERGY_REEL_SPEED_THRESHOLD) vote = ENERGY_PHASE_REEL_IN;
+  if (vote != candidate) {
+    candidate = vote;
+    candidateSinceMs = nowMs;
+    clearPending();
+  }
+  if (candidate == working.phase || nowMs - candidateSinceMs < ENERGY_MIN_PHASE_MS) {
+    return false;
+  }
+
+  bool completed = false;
+  if (candidate == ENERGY_PHASE_REEL_OUT) {
+    if (working.cycleActive && working.phase == ENERGY_PHASE_REEL_IN) {
+      closeCycle(candidateSinceMs);
+      completed = true;
+    }
+    startCycle(candidateSinceMs);
+  } else if (working.cycleActive) {
+    working.current.reelOutMs = candidateSinceMs - working.current.startMs;
+  }
+  working.phase = candidate;
+  clearPending();
+  return completed;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void energyInit() {
+  memset(&working, 0, sizeof(working));
+  memset(history, 0, sizeof(history));
+  historyHead = 0;
+  historyCount = 0;
+  hasPrevious = false;
+  previousElectricalW = NAN;
+  candidate = ENERGY_PHASE_UNKNOWN;
+  clearPending();
+
+  portENTER_CRITICAL(&energyMux);
+  published = working;
+  unreportedJ = 0.0;
+  portEXIT_CRITICAL(&energyMux);
+}
+
+bool energyAddSample(uint32_t timestampMs, float tensionN, float reelSpeed, float electricalW) {
+  float mechanicalW = tensionN * reelSpeed;
+  bool electricalValid = !isnan(electricalW);
+  double producedJ = 0.0;
+  working.samples++;
+
+  if (hasPrevious) {
+    uint32_t intervalMs = timestampMs - previousMs;   // Horloge revenue en arrière : très grand
+    if (intervalMs == 0 || intervalMs > ENERGY_MAX_SAMPLE_GAP_MS) {
+      working.gaps++;
+    } else {
+      float dtS = intervalMs / 1000.0f;
+      float outJ = 0.0f, inJ = 0.0f;
+      integrateTrapezoid(previousMechanicalW, mechanicalW, dtS, &outJ, &inJ);
+      bool electricalInterval = electricalValid && !isnan(previousElectricalW);
+      float electricalJ = electricalInterval ? 0.5f * (previousElectricalW + electricalW) * dtS : 0.0f;
+
+      working.mechanicalJ += outJ - inJ;
+      working.electricalJ += electricalJ;
+      producedJ = electricalInterval ? electricalJ : outJ - inJ;
+      if (working.cycleActive) {
+        working.current.reelOutJ += outJ;
+        working.current.reelInJ += inJ;
+        working.current.electricalJ += electricalJ;
+        working.current.electricalMeasured |= electricalInterval;
+      }
+      if (candidate != working.phase) {
+        pendingOutJ += outJ;
+        pendingInJ += inJ;
+        pendingElectricalJ += electricalJ;
+        pendingElectricalMeasured |= electricalInterval;
+      }
+    }
+  }
+  hasPrevious = true;
+  previousMs = timestampMs;
+  previousMechanicalW = mechanicalW;
+  previousElectricalW = electricalW;
+  working.mechanicalPowerW = mechanicalW;
+  working.electricalPowerW = electricalValid ? electricalW : 0.0f;
+
+  // Kite posé ou treuil arrêté : le cycle ne s'achèvera pas
+  if (working.cycleActive && timestampMs - working.current.startMs > ENERGY_MAX_CYCLE_MS) {
+    working.cycleActive = false;
+    working.abandonedCycles++;
+  }
+  bool completed = updatePhase(timestampMs, reelSpeed);
+  if (working.cycleActive) {
+    working.current.durationMs = timestampMs - working.current.startMs;
+    finalizeCycle(&working.current);
+  }
+
+  portENTER_CRITICAL(&energyMux);
+  published = working;
+  unreportedJ += producedJ;
+  portEXIT_CRITICAL(&energyMux);
+  return completed;
+}
+
+void energyGetStats(EnergyStats* stats) {
+  portENTER_CRITICAL(&energyMux);
+  *stats = published;
+  portEXIT_CRITICAL(&energyMux);
+}
+
+float energyTakeProduced() {
+  float produced = 0.0f;
+  portENTER_CRITICAL(&energyMux);
+  if (unreportedJ > 0.0) {
+    produced = (float)unreportedJ;
+    unreportedJ = 0.0;
+  }
+  portEXIT_CRITICAL(&energyMux);
+  return produced;
+}
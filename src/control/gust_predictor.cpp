@@ -0,0 +1,269 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Prévision des rafales (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Les lectures du vent sont moyennées sur GUST_SAMPLE_INTERVAL_MS : le
+     modèle travaille à période fixe quel que soit le rythme de la boucle
+  2. À chaque période, l'écart à la moyenne glissante est d'abord comparé à
+     la prévision faite GUST_HORIZON_STEPS périodes plus tôt (qualité mesurée),
+     puis sert de cible aux moindres carrés récursifs sur les écarts précédents
+  3. La prévision itère le modèle jusqu'à l'horizon ; les poids psi de sa
+     forme moyenne mobile (psi0 = 1, psiJ = somme aI.psiJ-I) donnent la
+     variance de l'erreur : résidus x somme des psi au carré
+  4. Un modèle instable (rafale extrapolée sans fin) est borné : l'écart
+     prévu et la demi-largeur de la bande ne dépassent pas GUST_DEVIATION_LIMIT
+     écarts types du vent
+*/
+
+#include "control/gust_predictor.h"
+#include <math.h>
+#include <string.h>
+
+// === CONSTANTES ===
+#define RLS_INITIAL_COVARIANCE  100.0f    // Confiance initiale faible dans les coefficients
+#define RLS_MAX_TRACE           1.0e4f    // Covariance bornée (vent constant, excitation nulle)
+
+static_assert(GUST_HORIZON_STEPS >= 1, "GUST_HORIZON_MS doit couvrir au moins une période");
+
+// === DÉFINITION DES TYPES ===
+
+// Prévision en attente de la mesure à l'horizon
+typedef struct {
+  bool valid;
+  float predicted;
+  float lower;
+  float upper;
+  float persistence;                // Vent au moment de la prévision
+} PendingForecast;
+
+// === VARIABLES GLOBALES ===
+
+// Moyenne des lectures de la période en cours
+static bool started = false;
+static uint32_t periodStartMs = 0;
+static uint32_t lastReadingMs = 0;
+static float periodSum = 0.0f;
+static uint16_t periodCount = 0;
+
+// Statistiques et modèle
+static float mean = 0.0f;
+static float variance = 0.0f;
+static float residualVariance = 0.0f;
+static float deviations[GUST_AR_ORDER];                   // Écarts récents, le plus récent en tête
+static float theta[GUST_AR_ORDER];                        // Coefficients du modèle
+static float covariance[GUST_AR_ORDER][GUST_AR_ORDER];
+
+// Qualité mesurée à l'horizon
+static PendingForecast pending[GUST_HORIZON_STEPS];
+static double squaredErrorSum = 0.0;
+static double persistenceErrorSum = 0.0;
+static uint32_t evaluated = 0;
+static uint32_t covered = 0;
+
+static GustPrediction prediction;
+
+// === FONCTIONS INTERNES ===
+
+static void resetModel() {
+  started = false;
+  periodSum = 0.0f;
+  periodCount = 0;
+  mean = 0.0f;
+  variance = 0.0f;
+  residualVariance = 0.0f;
+  memset(deviations, 0, sizeof(deviations));
+  memset(theta, 0, sizeof(theta));
+  memset(covariance, 0, sizeof(covariance));
+  for (int i = 0; i < GUST_AR_ORDER; i++) {
+    covariance[i][i] = RLS_INITIAL_COVARIANCE;
+  }
+  memset(pending, 0, sizeof(pending));
+  squaredErrorSum = 0.0;
+  persistenceErrorSum = 0.0;
+  evaluated = 0;
+  covered = 0;
+  memset(&prediction, 0, sizeof(prediction));
+}
+
+/**
+ * Compare la prévision arrivée à échéance à la mesure
+ */
+static void evaluateForecast(float speed) {
+  PendingForecast* forecast = &pending[prediction.samples % GUST_HORIZON_STEPS];
+  if (!forecast->valid) {
+    return;
+  }
+  float error = speed - forecast->predicted;
+  float persistenceError = speed - forecast->persistence;
+  squaredErrorSum += (double)error * error;
+  persistenceErrorSum += (double)persistenceError * persistenceError;
+  evaluated++;
+  if (speed >= forecast->lower && speed <= forecast->upper) {
+    covered++;
+  }
+  forecast->valid = false;
+}
+
+/**
+ * Moindres carrés récursifs avec oubli : cible deviation, régresseurs deviations[]
+ */
+static void fitModel(float deviation) {
+  float gain[GUST_AR_ORDER];
+  float denominator = GUST_RLS_FORGETTING;
+  for (int i = 0; i < GUST_AR_ORDER; i++) {
+    gain[i] = 0.0f;
+    for (int j = 0; j < GUST_AR_ORDER; j++) {
+      gain[i] += covariance[i][j] * deviations[j];
+    }
+    denominator += deviations[i] * gain[i];
+  }
+
+  float residual = deviation;
+  for (int i = 0; i < GUST_AR_ORDER; i++) {
+    residual -= theta[i] * deviations[i];
+  }
+  residualVariance += GUST_RESIDUAL_ALPHA * (residual * residual - residualVariance);
+
+  float trace = 0.0f;
+  for (int i = 0; i < GUST_AR_ORDER; i++) {
+    gain[i] /= denominator;
+    theta[i] += gain[i] * residual;
+  }
+  // P = (P - k.phi'.P) / lambda, P symétrique : phi'.P = (P.phi)' = gain' x denominator
+  for (int i = 0; i < GUST_AR_ORDER; i++) {
+    for (int j = i; j < GUST_AR_ORDER; j++) {
+      float value = (covariance[i][j] - gain[i] * gain[j] * denominator) / GUST_RLS_FORGETTING;
+      covariance[i][j] = value;
+      covariance[j][i] = value;
+    }
+    trace += covariance[i][i];
+  }
+  // Sans excitation, l'oubli fait croître la covariance sans limite
+  if (trace > RLS_MAX_TRACE) {
+    float scale = RLS_MAX_TRACE / trace;
+    for (int i = 0; i < GUST_AR_ORDER; i++) {
+      for (int j = 0; j < GUST_AR_ORDER; j++) {
+        covariance[i][j] *= scale;
+      }
+    }
+  }
+}
+
+/**
+ * Itère le modèle jusqu'à l'horizon et propage la variance des résidus
+ */
+static void forecast(float speed) {
+  float history[GUST_AR_ORDER];
+  float psi[GUST_HORIZON_STEPS];
+  memcpy(history, deviations, sizeof(history));
+
+  float predicted = 0.0f;
+  float psiSquaredSum = 0.0f;
+  for (int step = 0; step < GUST_HORIZON_STEPS; step++) {
+    predicted = 0.0f;
+    psi[step] = step == 0 ? 1.0f : 0.0f;
+    for (int i = 0; i < GUST_AR_ORDER; i++) {
+      predicted += theta[i] * history[i];
+      if (step > i) {
+        psi[step] += theta[i] * psi[step - 1 - i];
+      }
+    }
+    psiSquaredSum += psi[step] * psi[step];
+    memmove(&history[1], &history[0], (GUST_AR_ORDER - 1) * sizeof(float));
+    history[0] = predicted;
+  }
+
+  float stdDev = sqrtf(variance);
+  float residualStd = sqrtf(residualVariance);
+  float limit = GUST_DEVIATION_LIMIT * fmaxf(stdDev, residualStd);
+  predicted = fmaxf(-limit, fminf(limit, predicted));
+  float halfWidth = fminf(limit, GUST_CONFIDENCE_Z * residualStd * sqrtf(psiSquaredSum));
+
+  prediction.meanSpeed = mean;
+  prediction.stdDev = stdDev;
+  prediction.residualStd = residualStd;
+  prediction.predictedSpeed = fmaxf(0.0f, mean + predicted);
+  prediction.lowerBound = fmaxf(0.0f, mean + predicted - halfWidth);
+  prediction.upperBound = mean + predicted + halfWidth;
+  memcpy(prediction.coefficients, theta, sizeof(theta));
+  prediction.ready = prediction.samples >= GUST_WARMUP_SAMPLES;
+
+  if (prediction.ready) {
+    PendingForecast* slot = &pending[prediction.samples % GUST_HORIZON_STEPS];
+    slot->valid = true;
+    slot->predicted = prediction.predictedSpeed;
+    slot->lower = prediction.lowerBound;
+    slot->upper = prediction.upperBound;
+    slot->persistence = speed;
+  }
+  if (evaluated > 0) {
+    prediction.predictionRms = (float)sqrt(squaredErrorSum / evaluated);
+    prediction.persistenceRms = (float)sqrt(persistenceErrorSum / evaluated);
+    prediction.coverage = (float)covered / evaluated;
+  }
+}
+
+/**
+ * Une période du modèle : qualité, ajustement, statistiques, prévision
+ */
+static void processSample(float speed, uint32_t nowMs) {
+  prediction.samples++;
+  prediction.timestampMs = nowMs;
+  if (prediction.samples == 1) {
+    mean = speed;
+  }
+
+  evaluateForecast(speed);
+
+  float deviation = speed - mean;
+  fitModel(deviation);
+  memmove(&deviations[1], &deviations[0], (GUST_AR_ORDER - 1) * sizeof(float));
+  deviations[0] = deviation;
+
+  // Moyenne et variance à pondération exponentielle
+  mean += GUST_MEAN_ALPHA * deviation;
+  variance = (1.0f - GUST_MEAN_ALPHA) * (variance + GUST_MEAN_ALPHA * deviation * deviation);
+
+  forecast(speed);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void gustPredictorInit() {
+  resetModel();
+}
+
+bool gustPredictorUpdate(float windSpeed, uint32_t nowMs) {
+  if (started && (int32_t)(nowMs - lastReadingMs) < 0) {
+    // Horloge revenue en arrière : l'historique ne décrit plus ce vent
+    resetModel();
+  }
+  if (!started) {
+    started = true;
+    periodStartMs = nowMs;
+  }
+  lastReadingMs = nowMs;
+  periodSum += windSpeed;
+  periodCount++;
+
+  uint32_t elapsed = nowMs - periodStartMs;
+  if (elapsed < GUST_SAMPLE_INTERVAL_MS) {
+    return false;
+  }
+  // Une longue absence de lectures ne produit qu'une période
+  periodStartMs = elapsed >= 2 * GUST_SAMPLE_INTERVAL_MS ? nowMs : periodStartMs + GUST_SAMPLE_INTERVAL_MS;
+  processSample(periodSum / periodCount, nowMs);
+  periodSum = 0.0f;
+  periodCount = 0;
+  return true;
+}
+
+void gustPredictorGetPrediction(GustPrediction* out) {
+  *out = prediction;
+}
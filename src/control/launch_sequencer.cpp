@@ -0,0 +1,276 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Séquenceur de décollage et d'atterrissage (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. La forme normalisée s(t) est intégrée une fois sur [0, 1] avec un jerk
+     constant par intervalle de table : position, vitesse, accélération et
+     jerk maximaux de la forme sont relevés puis ramenés à s(1) = 1
+  2. Au lancement, chaque axe impose sa durée minimale (écart x maximum de
+     la forme / limite, à la puissance 1, 1/2 ou 1/3 selon la dérivée) ; la
+     plus longue est retenue et les tables sont remplies par mise à
+     l'échelle de la forme
+  3. Chaque cycle interpole les tables à l'instant courant, commande le
+     treuil (vitesse du profil + correction de l'écart de longueur) et
+     compare la mesure au profil
+  4. Un écart hors tolérance arme une échéance par axe, désarmée dès que
+     l'écart revient ; l'échéance atteinte abandonne la séquence
+  5. Après la fin du profil la consigne reste sur la cible jusqu'à ce que
+     la mesure s'en approche (séquence achevée) ou que LAUNCH_SETTLE_MS
+     s'écoule (abandon)
+*/
+
+#include "control/launch_sequencer.h"
+#include "core/hot_path.h"
+#include "utils/logging.h"
+#include <math.h>
+#include <string.h>
+
+// === CONSTANTES ===
+
+// Forme normalisée : fin de chaque segment en intervalles de table
+// (jerk +, accélération, jerk -, vitesse constante, jerk -, décélération, jerk +)
+#define SHAPE_INTERVALS    (LAUNCH_PROFILE_POINTS - 1)
+static const uint8_t SHAPE_SEGMENT_END[7] = {8, 16, 24, 56, 64, 72, 80};
+static const int8_t SHAPE_SEGMENT_JERK[7] = {1, 0, -1, 0, -1, 0, 1};
+
+static_assert(SHAPE_INTERVALS == 80, "Les segments de la forme sont alignés sur 80 intervalles");
+
+// === VARIABLES GLOBALES ===
+
+// Forme normalisée (s(1) = 1) et ses maximums
+static bool shapeReady = false;
+static float shapePosition[LAUNCH_PROFILE_POINTS];
+static float shapeVelocity[LAUNCH_PROFILE_POINTS];
+static float shapeVelocityMax = 0.0f;
+static float shapeAccelMax = 0.0f;
+static float shapeJerkMax = 0.0f;
+
+// Profils de la séquence courante
+static float elevationTable[LAUNCH_PROFILE_POINTS];
+static float lengthTable[LAUNCH_PROFILE_POINTS];
+static float reelSpeedTable[LAUNCH_PROFILE_POINTS];
+
+static CommandWinchHandler winchHandler = nullptr;
+static LaunchSequenceState sequence;
+static LaunchSequenceState published;
+static portMUX_TYPE launchMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t elevationDeviationSinceMs = 0;
+static uint32_t lengthDeviationSinceMs = 0;
+static bool elevationDeviating = false;
+static bool lengthDeviating = false;
+
+// === FONCTIONS INTERNES ===
+
+/**
+ * Intègre la forme à jerk constant par intervalle (mise à jour exacte d'un polynôme de degré 3)
+ */
+static void buildShape() {
+  const double h = 1.0 / SHAPE_INTERVALS;
+  double position = 0.0, velocity = 0.0, accel = 0.0, velocityMax = 0.0, accelMax = 0.0;
+  double positions[LAUNCH_PROFILE_POINTS];
+  double velocities[LAUNCH_PROFILE_POINTS];
+  positions[0] = 0.0;
+  velocities[0] = 0.0;
+  uint8_t segment = 0;
+  for (int k = 0; k < SHAPE_INTERVALS; k++) {
+    if (k >= SHAPE_SEGMENT_END[segment]) segment++;
+    double jerk = SHAPE_SEGMENT_JERK[segment];
+    position += velocity * h + accel * h * h / 2.0 + jerk * h * h * h / 6.0;
+    velocity += accel * h + jerk * h * h / 2.0;
+    accel += jerk * h;
+    positions[k + 1] = position;
+    velocities[k + 1] = velocity;
+    if (velocity > velocityMax) velocityMax = velocity;
+    if (fabs(accel) > accelMax) accelMax = fabs(accel);
+  }
+  for (int k = 0; k < LAUNCH_PROFILE_POINTS; k++) {
+    shapePosition[k] = (float)(positions[k] / position);
+    shapeVelocity[k] = (float)(velocities[k] / position);
+  }
+  shapePosition[LAUNCH_PROFILE_POINTS - 1] = 1.0f;
+  shapeVelocityMax = (float)(velocityMax / position);
+  shapeAccelMax = (float)(accelMax / position);
+  shapeJerkMax = (float)(1.0 / position);
+  shapeReady = true;
+}
+
+/**
+ * Durée minimale (s) d'un déplacement sous les trois limites
+ */
+static float axisDuration(float delta, float rateMax, float accelMax, float jerkMax) {
+  float distance = fabsf(delta);
+  float byRate = distance * shapeVelocityMax / rateMax;
+  float byAccel = sqrtf(distance * shapeAccelMax / accelMax);
+  float byJerk = cbrtf(distance * shapeJerkMax / jerkMax);
+  return fmaxf(byRate, fmaxf(byAccel, byJerk));
+}
+
+static void commandWinch(float speed) {
+  if (winchHandler != nullptr) {
+    winchHandler(speed);
+  }
+}
+
+/**
+ * Arme, désarme ou déclenche l'échéance d'un axe
+ * @return true si l'écart a duré LAUNCH_DEVIATION_MS
+ */
+static bool deviationExpired(bool outOfTolerance, bool* deviating, uint32_t* sinceMs, uint32_t nowMs) {
+  if (!outOfTolerance) {
+    *deviating = false;
+    return false;
+  }
+  if (!*deviating) {
+    *deviating = true;
+    *sinceMs = nowMs;
+  }
+  return nowMs - *sinceMs >= LAUNCH_DEVIATION_MS;
+}
+
+static void abortSequence(LaunchAbortReason reason) {
+  sequence.status = LAUNCH_ABORTED;
+  sequence.abortReason = reason;
+  sequence.setpoint.reelSpeed = 0.0f;
+  commandWinch(0.0f);
+  LOG_WARNING("LAUNCH", "%s abandonné (cause %d) : écart %.1f°, %.0f cm",
+              sequence.kind == LAUNCH_TAKEOFF ? "Décollage" : "Atterrissage", reason,
+              sequence.elevationError, sequence.lengthErrorCm);
+}
+
+static void publish() {
+  portENTER_CRITICAL(&launchMux);
+  published = sequence;
+  portEXIT_CRITICAL(&launchMux);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void launchSequenceSetWinchHandler(CommandWinchHandler handler) {
+  winchHandler = handler;
+}
+
+bool launchSequenceStart(LaunchKind kind, uint32_t nowMs, float elevation, float lineLengthCm,
+                         float targetElevation, float targetLengthCm) {
+  if (!isfinite(elevation) || !isfinite(lineLengthCm) || !isfinite(targetElevation) || !isfinite(targetLengthCm)) {
+    LOG_ERROR("LAUNCH", "Séquence refusée : valeur de départ ou cible invalide");
+    return false;
+  }
+  if (!shapeReady) {
+    buildShape();
+  }
+
+  float elevationDelta = targetElevation - elevation;
+  float lengthDelta = targetLengthCm - lineLengthCm;
+  float durationS = fmaxf(axisDuration(elevationDelta, LAUNCH_ELEVATION_RATE_MAX,
+                                       LAUNCH_ELEVATION_ACCEL_MAX, LAUNCH_ELEVATION_JERK_MAX),
+                          axisDuration(lengthDelta / 100.0f, LAUNCH_REEL_SPEED_MAX,
+                                       LAUNCH_REEL_ACCEL_MAX, LAUNCH_REEL_JERK_MAX));
+  uint32_t durationMs = (uint32_t)ceilf(durationS * 1000.0f);
+  if (durationMs == 0) {
+    durationMs = 1;                                  // Départ déjà sur la cible
+  }
+  float reelScale = lengthDelta / 100.0f / (durationMs / 1000.0f);
+  for (int k = 0; k < LAUNCH_PROFILE_POINTS; k++) {
+    elevationTable[k] = elevation + elevationDelta * shapePosition[k];
+    lengthTable[k] = lineLengthCm + lengthDelta * shapePosition[k];
+    reelSpeedTable[k] = reelScale * shapeVelocity[k];
+  }
+
+  memset(&sequence, 0, sizeof(sequence));
+  sequence.kind = kind;
+  sequence.status = LAUNCH_RUNNING;
+  sequence.startMs = nowMs;
+  sequence.durationMs = durationMs;
+  sequence.setpoint.elevation = elevation;
+  sequence.setpoint.lineLengthCm = lineLengthCm;
+  elevationDeviating = false;
+  lengthDeviating = false;
+  publish();
+
+  LOG_INFO("LAUNCH", "%s : %.1f° -> %.1f°, %.0f -> %.0f cm en %lu ms",
+           kind == LAUNCH_TAKEOFF ? "Décollage" : "Atterrissage", elevation, targetElevation,
+           lineLengthCm, targetLengthCm, (unsigned long)durationMs);
+  return true;
+}
+
+HOT_PATH LaunchStatus launchSequenceUpdate(uint32_t nowMs, float elevation, float lineLengthCm,
+                                           LaunchSetpoint* setpoint) {
+  if (sequence.status != LAUNCH_RUNNING) {
+    return sequence.status;
+  }
+
+  // Consigne : interpolation des tables, puis cible maintenue après le profil
+  uint32_t elapsedMs = nowMs - sequence.startMs;
+  const int last = LAUNCH_PROFILE_POINTS - 1;
+  LaunchSetpoint& target = sequence.setpoint;
+  float feedForward = 0.0f;
+  if (elapsedMs >= sequence.durationMs) {
+    sequence.progress = 1.0f;
+    target.elevation = elevationTable[last];
+    target.lineLengthCm = lengthTable[last];
+  } else {
+    float position = (float)elapsedMs * last / sequence.durationMs;
+    int index = (int)position;
+    float fraction = position - index;
+    sequence.progress = (float)elapsedMs / sequence.durationMs;
+    target.elevation = elevationTable[index] + fraction * (elevationTable[index + 1] - elevationTable[index]);
+    target.lineLengthCm = lengthTable[index] + fraction * (lengthTable[index + 1] - lengthTable[index]);
+    feedForward = reelSpeedTable[index] + fraction * (reelSpeedTable[index + 1] - reelSpeedTable[index]);
+  }
+
+  // Treuil : vitesse du profil et correction de l'écart de longueur
+  sequence.elevationError = elevation - target.elevation;
+  sequence.lengthErrorCm = lineLengthCm - target.lineLengthCm;
+  float reelSpeed = feedForward - LAUNCH_LENGTH_GAIN * sequence.lengthErrorCm / 100.0f;
+  target.reelSpeed = fmaxf(-LAUNCH_REEL_SPEED_MAX, fminf(LAUNCH_REEL_SPEED_MAX, reelSpeed));
+  float elevationDeviation = fabsf(sequence.elevationError);
+  float lengthDeviation = fabsf(sequence.lengthErrorCm);
+  if (elevationDeviation > sequence.maxElevationError) sequence.maxElevationError = elevationDeviation;
+  if (lengthDeviation > sequence.maxLengthErrorCm) sequence.maxLengthErrorCm = lengthDeviation;
+
+  // Surveillance de l'écart au profil
+  if (deviationExpired(elevationDeviation > LAUNCH_MAX_ELEVATION_ERROR, &elevationDeviating,
+                       &elevationDeviationSinceMs, nowMs)) {
+    abortSequence(LAUNCH_ABORT_ELEVATION);
+  } else if (deviationExpired(lengthDeviation > LAUNCH_MAX_LENGTH_ERROR_CM, &lengthDeviating,
+                              &lengthDeviationSinceMs, nowMs)) {
+    abortSequence(LAUNCH_ABORT_LINE_LENGTH);
+  } else if (elapsedMs >= sequence.durationMs) {
+    if (elevationDeviation <= LAUNCH_SETTLE_ELEVATION_ERROR && lengthDeviation <= LAUNCH_SETTLE_LENGTH_CM) {
+      sequence.status = LAUNCH_COMPLETE;
+      target.reelSpeed = 0.0f;
+      commandWinch(0.0f);
+      LOG_INFO("LAUNCH", "%s achevé en %lu ms (écart max %.1f°, %.0f cm)",
+               sequence.kind == LAUNCH_TAKEOFF ? "Décollage" : "Atterrissage", (unsigned long)elapsedMs,
+               sequence.maxElevationError, sequence.maxLengthErrorCm);
+    } else if (elapsedMs - sequence.durationMs >= LAUNCH_SETTLE_MS) {
+      abortSequence(LAUNCH_ABORT_TIMEOUT);
+    }
+  }
+  if (sequence.status == LAUNCH_RUNNING) {
+    commandWinch(target.reelSpeed);
+    *setpoint = target;
+  }
+  publish();
+  return sequence.status;
+}
+
+void launchSequenceCancel() {
+  if (sequence.status == LAUNCH_RUNNING) {
+    sequence.status = LAUNCH_IDLE;
+    commandWinch(0.0f);
+    publish();
+  }
+}
+
+void launchSequenceGetState(LaunchSequenceState* state) {
+  portENTER_CRITICAL(&launchMux);
+  *state = published;
+  portEXIT_CRITICAL(&launchMux);
+}
@@ -0,0 +1,496 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Exécution des plans de vol (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Au chargement, le plan est parcouru une fois : en-tête, CRC, codes
+     opération et opérandes connus, boucles équilibrées et sauts cohérents,
+     HALT final. L'exécution peut ensuite décoder sans aucun contrôle de bornes
+  2. Chaque cycle lit l'état de l'autopilote une fois, abandonne si
+     l'autopilote est passé en urgence de lui-même, puis évalue les gardes
+     enregistrées (décalages des instructions ABORT_IF déjà franchies)
+  3. Les instructions s'exécutent jusqu'à une attente non satisfaite ou
+     jusqu'au quota du cycle ; une attente garde son instant de début tant
+     que le compteur de programme ne bouge pas
+  4. Les figures en 8 sont comptées par les changements de point de virage
+     visé (deux par figure)
+  5. Démarrage d'un plan intégré et interruption demandés par une autre
+     tâche (serveur web) sont déposés sous section critique et appliqués
+     par la tâche de contrôle au début de son cycle
+*/
+
+#include "control/mission.h"
+#include "core/hot_path.h"
+#include "control/mission_plans.h"
+#include "control/autopilot.h"
+#include "communication/protocols.h"
+#include "utils/logging.h"
+#include <string.h>
+
+// === VARIABLES GLOBALES ===
+
+// Plan chargé (lu en place)
+static const uint8_t* program = nullptr;     // Instructions, après l'en-tête
+static uint16_t programLength = 0;
+static const char* programName = nullptr;
+
+// Exécution (tâche de contrôle uniquement)
+static MissionStatus status;
+static uint16_t loopStart[MISSION_MAX_DEPTH];
+static uint16_t loopRemaining[MISSION_MAX_DEPTH];
+static uint8_t depth = 0;
+static uint16_t guards[MISSION_MAX_GUARDS];  // Décalages des gardes actives
+static uint8_t guardCount = 0;
+static AutopilotMode commandedMode = AUTOPILOT_OFF;
+static bool waiting = false;
+static uint32_t waitStartMs = 0;
+static int8_t waitSide = 0;
+static uint16_t waitTurns = 0;
+
+// État publié et demandes des autres tâches, pris en compte au cycle suivant
+static MissionStatus published;
+static const MissionPlan* requestedPlan = nullptr;
+static bool abortRequested = false;
+static portMUX_TYPE statusMux = portMUX_INITIALIZER_UNLOCKED;
+
+// === FONCTIONS INTERNES ===
+
+static uint16_t readU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static int16_t readI16(const uint8_t* p) {
+  return (int16_t)readU16(p);
+}
+
+static uint8_t instructionSize(uint8_t opcode) {
+  switch (opcode) {
+    case MISSION_OP_HALT:        return MISSION_OP_HALT_SIZE;
+    case MISSION_OP_MODE:        return MISSION_OP_MODE_SIZE;
+    case MISSION_OP_WAIT:        return MISSION_OP_WAIT_SIZE;
+    case MISSION_OP_WAIT_UNTIL:  return MISSION_OP_WAIT_UNTIL_SIZE;
+    case MISSION_OP_WAIT_CYCLES: return MISSION_OP_WAIT_CYCLES_SIZE;
+    case MISSION_OP_REPEAT:      return MISSION_OP_REPEAT_SIZE;
+    case MISSION_OP_END:         return MISSION_OP_END_SIZE;
+    case MISSION_OP_ABORT_IF:    return MISSION_OP_ABORT_IF_SIZE;
+    case MISSION_OP_SET:         return MISSION_OP_SET_SIZE;
+    case MISSION_OP_MARK:        return MISSION_OP_MARK_SIZE;
+    default:                     return 0;
+  }
+}
+
+static bool validCondition(uint8_t condition) {
+  return (condition >> 2) < MISSION_SENSOR_COUNT && (condition & 0x3) < MISSION_CMP_COUNT;
+}
+
+/**
+ * Parcourt les instructions une fois : tout ce que l'exécution suppose est vérifié ici
+ */
+static bool verifyProgram(const uint8_t* code, uint16_t length) {
+  uint16_t openLoops[MISSION_MAX_DEPTH];
+  uint8_t openCount = 0;
+  uint8_t guardOps = 0;
+  uint16_t pc = 0;
+  uint8_t lastOpcode = MISSION_OP_COUNT;
+
+  while (pc < length) {
+    uint8_t opcode = code[pc];
+    uint8_t size = instructionSize(opcode);
+    if (size == 0 || pc + size > length) {
+      LOG_ERROR("MISSION", "Instruction invalide à %u", pc);
+      return false;
+    }
+    const uint8_t* operands = &code[pc + 1];
+    bool valid = true;
+    switch (opcode) {
+      case MISSION_OP_MODE:
+        valid = operands[0] < MISSION_MODE_COUNT;
+        break;
+      case MISSION_OP_WAIT_UNTIL:
+        valid = validCondition(operands[0]);
+        break;
+      case MISSION_OP_REPEAT:
+        valid = openCount < MISSION_MAX_DEPTH;
+        if (valid) openLoops[openCount++] = pc;
+        break;
+      case MISSION_OP_END:
+        // Le REPEAT correspondant doit sauter juste après ce END
+        valid = openCount > 0 && readU16(&code[openLoops[openCount - 1] + 3]) == pc + size;
+        if (valid) openCount--;
+        break;
+      case MISSION_OP_ABORT_IF:
+        valid = validCondition(operands[0]) && operands[3] < MISSION_MODE_COUNT &&
+                ++guardOps <= MISSION_MAX_GUARDS;
+        break;
+      case MISSION_OP_SET:
+        valid = operands[0] < MISSION_PARAM_COUNT;
+        break;
+      default:
+        break;
+    }
+    if (!valid) {
+      LOG_ERROR("MISSION", "Opérandes invalides à %u (code %u)", pc, opcode);
+      return false;
+    }
+    lastOpcode = opcode;
+    pc += size;
+  }
+
+  if (openCount != 0 || lastOpcode != MISSION_OP_HALT) {
+    LOG_ERROR("MISSION", "Plan incomplet (boucle ouverte ou HALT final manquant)");
+    return false;
+  }
+  return true;
+}
+
+static HOT_PATH float readSensor(uint8_t sensor, const AutopilotState& state) {
+  switch (sensor) {
+    case MISSION_SENSOR_ELEVATION:  return state.windowPosition[1];
+    case MISSION_SENSOR_AZIMUTH:    return state.windowPosition[0];
+    case MISSION_SENSOR_WIND:       return state.windSpeed;
+    case MISSION_SENSOR_GUST:       return state.predictedWindUpper;
+    case MISSION_SENSOR_LINE:       return state.lineLength / 100.0f;
+    case MISSION_SENSOR_CONFIDENCE: return state.confidence;
+    default:                        return 0.0f;
+  }
+}
+
+/**
+ * Condition d'une instruction : cond u8 puis seuil i16 (dixièmes)
+ */
+static HOT_PATH bool evaluateCondition(const uint8_t* operands, const AutopilotState& state) {
+  float value = readSensor(operands[0] >> 2, state);
+  float threshold = readI16(&operands[1]) / 10.0f;
+  switch (operands[0] & 0x3) {
+    case MISSION_CMP_LT: return value < threshold;
+    case MISSION_CMP_LE: return value <= threshold;
+    case MISSION_CMP_GT: return value > threshold;
+    default:             return value >= threshold;
+  }
+}
+
+static void publish(uint32_t nowMs) {
+  if (status.state == MISSION_RUNNING) {
+    status.elapsedMs = nowMs - status.startedAtMs;
+  }
+  portENTER_CRITICAL(&statusMux);
+  published = status;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+static void finish(MissionState state, const char* reason) {
+  status.state = state;
+  status.reason = reason;
+  if (state == MISSION_COMPLETED) {
+    LOG_INFO("MISSION", "Plan terminé (%lu instructions)", (unsigned long)status.instructions);
+  } else {
+    LOG_WARNING("MISSION", "Plan %s à %u : %s", missionStateName(state), status.pc, reason);
+  }
+}
+
+static bool commandMode(uint8_t mode) {
+  if (!setAutopilotMode((AutopilotMode)mode)) {
+    return false;
+  }
+  commandedMode = (AutopilotMode)mode;
+  return true;
+}
+
+// Les paramètres du plan suivent l'ordre des paramètres de l'autopilote
+static_assert(MISSION_PARAM_COUNT == (int)AUTOPILOT_PARAM_COUNT, "MissionParam et AutopilotParamId divergent");
+
+static bool setParameter(uint8_t param, int16_t value) {
+  return setAutopilotParameter((AutopilotParamId)param, value);
+}
+
+/**
+ * Délai d'une attente dépassé (0 : aucun délai)
+ */
+static bool timedOut(uint16_t timeoutTenths, uint32_t nowMs) {
+  return timeoutTenths > 0 && nowMs - waitStartMs >= timeoutTenths * 100u;
+}
+
+/**
+ * Exécute l'instruction courante
+ * @return true si le compteur de programme a avancé et que le cycle peut continuer
+ */
+static HOT_PATH bool executeInstruction(const AutopilotState& state, uint32_t nowMs) {
+  const uint8_t* instruction = &program[status.pc];
+  const uint8_t* operands = instruction + 1;
+  uint16_t next = status.pc + instructionSize(instruction[0]);
+
+  if (!waiting) {
+    waiting = true;
+    waitStartMs = nowMs;
+    waitSide = state.figure8Side;
+    waitTurns = 0;
+  }
+
+  switch (instruction[0]) {
+    case MISSION_OP_HALT:
+      status.instructions++;
+      finish(MISSION_COMPLETED, nullptr);
+      return false;
+
+    case MISSION_OP_MODE:
+      if (!commandMode(operands[0])) {
+        finish(MISSION_FAILED, "mode refusé par l'autopilote");
+        return false;
+      }
+      break;
+
+    case MISSION_OP_WAIT:
+      if (nowMs - waitStartMs < readU16(operands) * 100u) {
+        return false;
+      }
+      break;
+
+    case MISSION_OP_WAIT_UNTIL:
+      if (!evaluateCondition(operands, state)) {
+        if (timedOut(readU16(&operands[3]), nowMs)) {
+          finish(MISSION_FAILED, "condition non atteinte dans le délai");
+        }
+        return false;
+      }
+      break;
+
+    case MISSION_OP_WAIT_CYCLES:
+      if (state.figure8Side != waitSide) {
+        waitSide = state.figure8Side;
+        waitTurns++;
+      }
+      if (waitTurns < 2u * readU16(operands)) {
+        if (timedOut(readU16(&operands[2]), nowMs)) {
+          finish(MISSION_FAILED, "figures en 8 non terminées dans le délai");
+        }
+        return false;
+      }
+      break;
+
+    case MISSION_OP_REPEAT:
+      if (readU16(operands) == 0) {
+        next = readU16(&operands[2]);
+      } else {
+        loopStart[depth] = next;
+        loopRemaining[depth] = readU16(operands);
+        depth++;
+      }
+      break;
+
+    case MISSION_OP_END:
+      if (--loopRemaining[depth - 1] > 0) {
+        next = loopStart[depth - 1];
+      } else {
+        depth--;
+      }
+      break;
+
+    case MISSION_OP_ABORT_IF: {
+      bool known = false;
+      for (uint8_t i = 0; i < guardCount; i++) {
+        known |= guards[i] == status.pc;
+      }
+      if (!known) {
+        guards[guardCount++] = status.pc;
+      }
+      break;
+    }
+
+    case MISSION_OP_SET:
+      if (!setParameter(operands[0], readI16(&operands[1]))) {
+        finish(MISSION_FAILED, "paramètre refusé par l'autopilote");
+        return false;
+      }
+      break;
+
+    case MISSION_OP_MARK:
+      status.lastMark = operands[0];
+      LOG_INFO("MISSION", "Repère %u (%lu ms)", operands[0], (unsigned long)(nowMs - status.startedAtMs));
+      break;
+  }
+
+  status.instructions++;
+  status.pc = next;
+  waiting = false;
+  return true;
+}
+
+/**
+ * Gardes franchies : la première vraie abandonne le plan et applique son mode de repli
+ */
+static HOT_PATH bool checkGuards(const AutopilotState& state) {
+  for (uint8_t i = 0; i < guardCount; i++) {
+    const uint8_t* operands = &program[guards[i] + 1];
+    if (evaluateCondition(operands, state)) {
+      status.pc = guards[i];
+      finish(MISSION_ABORTED, "garde déclenchée");
+      if (!setAutopilotMode((AutopilotMode)operands[3])) {
+        autopilotEmergencyStop();
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void missionInit() {
+  requestedPlan = nullptr;
+  abortRequested = false;
+  program = nullptr;
+  programLength = 0;
+  programName = nullptr;
+  memset(&status, 0, sizeof(status));
+  status.state = MISSION_IDLE;
+  publish(0);
+}
+
+static bool checkPlan(const uint8_t* code, size_t size) {
+  if (size < MISSION_HEADER_SIZE + MISSION_CRC_SIZE) {
+    return false;
+  }
+  uint32_t magic = readU16(code) | ((uint32_t)readU16(&code[2]) << 16);
+  uint16_t length = readU16(&code[6]);
+  if (magic != MISSION_MAGIC || code[4] != MISSION_FORMAT_VERSION ||
+      length > MISSION_MAX_CODE_SIZE || size != (size_t)(MISSION_HEADER_SIZE + length + MISSION_CRC_SIZE)) {
+    LOG_ERROR("MISSION", "En-tête de plan invalide");
+    return false;
+  }
+  if (telemetryCrc16(code, MISSION_HEADER_SIZE + length) != readU16(&code[MISSION_HEADER_SIZE + length])) {
+    LOG_ERROR("MISSION", "CRC du plan invalide");
+    return false;
+  }
+  return verifyProgram(&code[MISSION_HEADER_SIZE], length);
+}
+
+bool missionLoad(const uint8_t* code, size_t size) {
+  if (status.state == MISSION_RUNNING) {
+    LOG_WARNING("MISSION", "Chargement refusé : mission en cours");
+    return false;
+  }
+  if (!checkPlan(code, size)) {
+    return false;
+  }
+  program = &code[MISSION_HEADER_SIZE];
+  programLength = readU16(&code[6]);
+  programName = nullptr;
+  return true;
+}
+
+bool missionStart(uint32_t nowMs) {
+  if (program == nullptr || status.state == MISSION_RUNNING) {
+    return false;
+  }
+  if (getAutopilotMode() == AUTOPILOT_EMERGENCY) {
+    LOG_WARNING("MISSION", "Démarrage refusé : autopilote en urgence");
+    return false;
+  }
+  memset(&status, 0, sizeof(status));
+  status.state = MISSION_RUNNING;
+  status.planName = programName;
+  status.startedAtMs = nowMs;
+  depth = 0;
+  guardCount = 0;
+  waiting = false;
+  commandedMode = getAutopilotMode();
+  LOG_INFO("MISSION", "Plan %s démarré (%u octets)", programName ? programName : "chargé", programLength);
+  publish(nowMs);
+  return true;
+}
+
+bool missionStartPlan(const char* name) {
+  const MissionPlan* plan = nullptr;
+  for (size_t i = 0; i < MISSION_PLAN_COUNT; i++) {
+    if (strcmp(MISSION_PLANS[i].name, name) == 0) {
+      plan = &MISSION_PLANS[i];
+    }
+  }
+  if (plan == nullptr) {
+    LOG_WARNING("MISSION", "Plan inconnu : %s", name);
+    return false;
+  }
+  if (!checkPlan(plan->code, plan->size)) {
+    return false;
+  }
+  portENTER_CRITICAL(&statusMux);
+  bool accepted = published.state != MISSION_RUNNING && requestedPlan == nullptr;
+  if (accepted) {
+    requestedPlan = plan;
+  }
+  portEXIT_CRITICAL(&statusMux);
+  return accepted;
+}
+
+HOT_PATH MissionState missionStep(uint32_t nowMs) {
+  portENTER_CRITICAL(&statusMux);
+  const MissionPlan* plan = requestedPlan;
+  bool abort = abortRequested;
+  requestedPlan = nullptr;
+  abortRequested = false;
+  portEXIT_CRITICAL(&statusMux);
+
+  if (abort && status.state == MISSION_RUNNING) {
+    finish(MISSION_ABORTED, "interrompu par l'opérateur");
+    publish(nowMs);
+  }
+  if (plan != nullptr && status.state != MISSION_RUNNING) {
+    // Plan déjà vérifié par missionStartPlan()
+    program = &plan->code[MISSION_HEADER_SIZE];
+    programLength = readU16(&plan->code[6]);
+    programName = plan->name;
+    missionStart(nowMs);
+  }
+  if (status.state != MISSION_RUNNING) {
+    return status.state;
+  }
+
+  AutopilotState state = getAutopilotState();
+  if (state.currentMode == AUTOPILOT_EMERGENCY && commandedMode != AUTOPILOT_EMERGENCY) {
+    finish(MISSION_ABORTED, "urgence de l'autopilote");
+  } else if (!checkGuards(state)) {
+    for (int i = 0; i < MISSION_MAX_INSTRUCTIONS_PER_TICK; i++) {
+      if (!executeInstruction(state, nowMs)) {
+        break;
+      }
+    }
+  }
+
+  publish(nowMs);
+  return status.state;
+}
+
+void missionAbort() {
+  portENTER_CRITICAL(&statusMux);
+  abortRequested = true;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+void missionGetStatus(MissionStatus* out) {
+  portENTER_CRITICAL(&statusMux);
+  *out = published;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+const MissionPlan* missionGetPlan(int index) {
+  if (index < 0 || index >= (int)MISSION_PLAN_COUNT) {
+    return nullptr;
+  }
+  return &MISSION_PLANS[index];
+}
+
+const char* missionStateName(MissionState state) {
+  switch (state) {
+    case MISSION_IDLE:      return "inactif";
+    case MISSION_RUNNING:   return "en cours";
+    case MISSION_COMPLETED: return "terminé";
+    case MISSION_ABORTED:   return "abandonné";
+    case MISSION_FAILED:    return "échoué";
+    default:                return "inconnu";
+  }
+}
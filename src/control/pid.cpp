@@ -0,0 +1,76 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module PID (Implémentation)
+  -----------------------
+  
+  Implémentation du contrôleur PID avec anti-windup.
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== FONCTIONNEMENT =====
+  Commande = Kp·e + Ki·∫e·dt + Kd·de/dt, avec e = consigne - mesure.
+  
+  Principes de fonctionnement :
+  1. Le terme dérivé utilise la variation d'erreur depuis le dernier appel
+  2. L'intégrale est bornée à ±maxIntegral
+  3. Intégration conditionnelle : si la sortie est saturée et que l'erreur
+     pousse encore dans le sens de la saturation, l'intégrale n'est pas mise à jour
+  
+  Interactions avec d'autres modules :
+  - Autopilote : Contrôle de l'angle de direction
+*/
+
+#include "control/pid.h"
+#include "core/hot_path.h"
+
+void pidInit(PIDParams* pid, float kp, float ki, float kd,
+             float minOutput, float maxOutput, float maxIntegral) {
+  pid->Kp = kp;
+  pid->Ki = ki;
+  pid->Kd = kd;
+  pid->minOutput = minOutput;
+  pid->maxOutput = maxOutput;
+  pid->maxIntegral = maxIntegral;
+  pid->setpoint = 0.0f;
+  pid->derivativeFilter = 1.0f;
+  pidReset(pid);
+}
+
+void pidReset(PIDParams* pid) {
+  pid->integral = 0.0f;
+  pid->lastError = 0.0f;
+  pid->filteredDerivative = 0.0f;
+}
+
+void pidSetDerivativeFilter(PIDParams* pid, float coefficient) {
+  pid->derivativeFilter = constrain(coefficient, 0.01f, 1.0f);
+}
+
+HOT_PATH float pidCompute(PIDParams* pid, float measurement, float dt) {
+  if (dt <= 0.0f) {
+    return constrain(pid->Kp * (pid->setpoint - measurement), pid->minOutput, pid->maxOutput);
+  }
+
+  float error = pid->setpoint - measurement;
+  float rawDerivative = (error - pid->lastError) / dt;
+  pid->lastError = error;
+  
+  // Passe-bas du premier ordre : limite l'amplification du bruit de mesure
+  float derivative = pid->derivativeFilter * rawDerivative +
+                     (1.0f - pid->derivativeFilter) * pid->filteredDerivative;
+  pid->filteredDerivative = derivative;
+
+  // Sortie sans mise à jour de l'intégrale pour décider de l'intégration
+  float output = pid->Kp * error + pid->Ki * pid->integral + pid->Kd * derivative;
+
+  bool saturatedHigh = output >= pid->maxOutput && error > 0.0f;
+  bool saturatedLow = output <= pid->minOutput && error < 0.0f;
+  if (!saturatedHigh && !saturatedLow) {
+    pid->integral = constrain(pid->integral + error * dt, -pid->maxIntegral, pid->maxIntegral);
+    output = pid->Kp * error + pid->Ki * pid->integral + pid->Kd * derivative;
+  }
+
+  return constrain(output, pid->minOutput, pid->maxOutput);
+}
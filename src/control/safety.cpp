@@ -0,0 +1,172 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Enveloppe de vol (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. La compilation vérifie d'abord les polygones, puis calcule pour chaque
+     nœud de la grille l'appartenance (parité des croisements, polygones
+     permis moins polygones interdits) et la distance à l'arête la plus
+     proche ; le résultat signé est arrondi au demi-degré sur un octet
+  2. Le sinus de l'élévation de chaque ligne de la grille est tabulé pour
+     l'altitude
+  3. La vérification ramène le point dans la grille, lit les quatre nœuds de
+     sa maille et interpole : distance, puis gradient (différences des
+     nœuds) normalisé en direction de retour
+  4. Les limites de longueur et d'altitude sont de simples comparaisons aux
+     limites reçues, qui suivent les paramètres de l'autopilote sans recompiler
+*/
+
+#include "control/safety.h"
+#include "core/hot_path.h"
+#include "utils/logging.h"
+#include <math.h>
+
+// === CONSTANTES ===
+
+// Fenêtre par défaut : ni le bas (lignes au sol) ni les bords bas (pas assez
+// de vent apparent) ; le haut dépasse la grille pour que le zénith, visé en
+// stationnaire et en urgence, reste loin de la limite
+static const SafetyVertex DEFAULT_WINDOW[] = {
+  {-75.0f, 8.0f}, {75.0f, 8.0f}, {75.0f, 45.0f}, {45.0f, 120.0f}, {-45.0f, 120.0f}, {-75.0f, 45.0f}
+};
+static const SafetyPolygon DEFAULT_ENVELOPE[] = {
+  {DEFAULT_WINDOW, sizeof(DEFAULT_WINDOW) / sizeof(DEFAULT_WINDOW[0]), false}
+};
+
+// === VARIABLES GLOBALES ===
+
+static int8_t distanceGrid[SAFETY_GRID_ROWS][SAFETY_GRID_COLUMNS];   // Distance signée par nœud
+static float rowSine[SAFETY_GRID_ROWS];                             // Sinus de l'élévation par ligne
+static bool compiled = false;
+
+// === FONCTIONS INTERNES ===
+
+static bool pointInPolygon(const SafetyPolygon& polygon, float azimuth, float elevation) {
+  bool inside = false;
+  for (uint8_t i = 0, j = polygon.count - 1; i < polygon.count; j = i++) {
+    const SafetyVertex& a = polygon.vertices[i];
+    const SafetyVertex& b = polygon.vertices[j];
+    if ((a.elevation > elevation) != (b.elevation > elevation) &&
+        azimuth < (b.azimuth - a.azimuth) * (elevation - a.elevation) / (b.elevation - a.elevation) + a.azimuth) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+static float segmentDistance(const SafetyVertex& a, const SafetyVertex& b, float azimuth, float elevation) {
+  float dx = b.azimuth - a.azimuth, dy = b.elevation - a.elevation;
+  float lengthSquared = dx * dx + dy * dy;
+  float t = lengthSquared > 0.0f ? ((azimuth - a.azimuth) * dx + (elevation - a.elevation) * dy) / lengthSquared : 0.0f;
+  t = fmaxf(0.0f, fminf(1.0f, t));
+  float ex = a.azimuth + t * dx - azimuth, ey = a.elevation + t * dy - elevation;
+  return sqrtf(ex * ex + ey * ey);
+}
+
+/**
+ * Ramène une coordonnée dans la grille : indice de maille et fraction
+ */
+static inline void gridCell(float value, float origin, int nodes, int* index, float* fraction) {
+  float position = (value - origin) / SAFETY_GRID_STEP_DEG;
+  if (position <= 0.0f) {
+    *index = 0;
+    *fraction = 0.0f;
+  } else if (position >= nodes - 1) {
+    *index = nodes - 2;
+    *fraction = 1.0f;
+  } else {
+    *index = (int)position;
+    *fraction = position - *index;
+  }
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool safetyEnvelopeInit() {
+  return safetyEnvelopeCompile(DEFAULT_ENVELOPE, sizeof(DEFAULT_ENVELOPE) / sizeof(DEFAULT_ENVELOPE[0]));
+}
+
+bool safetyEnvelopeCompile(const SafetyPolygon* polygons, uint8_t count) {
+  bool anyAllowed = false;
+  for (uint8_t p = 0; p < count; p++) {
+    if (polygons[p].vertices == nullptr || polygons[p].count < 3 || polygons[p].count > SAFETY_MAX_VERTICES) {
+      LOG_ERROR("SAFETY", "Polygone %u invalide (%u sommets)", p, polygons[p].count);
+      return false;
+    }
+    anyAllowed |= !polygons[p].keepOut;
+  }
+  if (!anyAllowed) {
+    LOG_ERROR("SAFETY", "Enveloppe sans zone permise");
+    return false;
+  }
+
+  uint16_t insideNodes = 0;
+  for (int row = 0; row < SAFETY_GRID_ROWS; row++) {
+    float elevation = SAFETY_ELEVATION_MIN + row * SAFETY_GRID_STEP_DEG;
+    rowSine[row] = sinf(elevation * 0.017453292f);
+    for (int column = 0; column < SAFETY_GRID_COLUMNS; column++) {
+      float azimuth = SAFETY_AZIMUTH_MIN + column * SAFETY_GRID_STEP_DEG;
+      bool allowed = false, forbidden = false;
+      float distance = INFINITY;
+      for (uint8_t p = 0; p < count; p++) {
+        const SafetyPolygon& polygon = polygons[p];
+        if (pointInPolygon(polygon, azimuth, elevation)) {
+          if (polygon.keepOut) forbidden = true; else allowed = true;
+        }
+        for (uint8_t i = 0, j = polygon.count - 1; i < polygon.count; j = i++) {
+          distance = fminf(distance, segmentDistance(polygon.vertices[j], polygon.vertices[i], azimuth, elevation));
+        }
+      }
+      bool inside = allowed && !forbidden;
+      float units = fminf(roundf(distance / SAFETY_DISTANCE_RESOLUTION), 127.0f);
+      distanceGrid[row][column] = (int8_t)(inside ? units : -units);
+      if (inside) insideNodes++;
+    }
+  }
+  compiled = true;
+  LOG_INFO("SAFETY", "Enveloppe compilée : %u polygones, %u/%d nœuds permis", count, insideNodes, SAFETY_GRID_NODES);
+  return true;
+}
+
+HOT_PATH void safetyEnvelopeCheck(float azimuth, float elevation, float lineLengthCm,
+                                  const SafetyLimits& limits, SafetyCheck* check) {
+  int column, row;
+  float tx, ty;
+  gridCell(azimuth, SAFETY_AZIMUTH_MIN, SAFETY_GRID_COLUMNS, &column, &tx);
+  gridCell(elevation, SAFETY_ELEVATION_MIN, SAFETY_GRID_ROWS, &row, &ty);
+
+  // Interpolation bilinéaire des quatre nœuds de la maille et de son gradient
+  float d00 = distanceGrid[row][column], d10 = distanceGrid[row][column + 1];
+  float d01 = distanceGrid[row + 1][column], d11 = distanceGrid[row + 1][column + 1];
+  float bottom = d00 + tx * (d10 - d00);
+  float top = d01 + tx * (d11 - d01);
+  check->boundaryDistance = compiled ? (bottom + ty * (top - bottom)) * SAFETY_DISTANCE_RESOLUTION : 0.0f;
+  float gradientAzimuth = (d10 - d00) + ty * ((d11 - d01) - (d10 - d00));
+  float gradientElevation = top - bottom;
+  float norm = sqrtf(gradientAzimuth * gradientAzimuth + gradientElevation * gradientElevation);
+  check->inwardAzimuth = norm > 0.0f ? gradientAzimuth / norm : 0.0f;
+  check->inwardElevation = norm > 0.0f ? gradientElevation / norm : 0.0f;
+
+  // Longueur de ligne et altitude
+  float sine = rowSine[row] + ty * (rowSine[row + 1] - rowSine[row]);
+  check->lineMarginCm = fminf(lineLengthCm - limits.minLineLengthCm, limits.maxLineLengthCm - lineLengthCm);
+  check->altitudeMargin = limits.maxAltitude - lineLengthCm / 100.0f * sine;
+
+  if (check->boundaryDistance < 0.0f) {
+    check->violation = SAFETY_OUTSIDE_WINDOW;
+  } else if (lineLengthCm < limits.minLineLengthCm) {
+    check->violation = SAFETY_LINE_TOO_SHORT;
+  } else if (lineLengthCm > limits.maxLineLengthCm) {
+    check->violation = SAFETY_LINE_TOO_LONG;
+  } else if (check->altitudeMargin < 0.0f) {
+    check->violation = SAFETY_ALTITUDE;
+  } else {
+    check->violation = SAFETY_OK;
+  }
+  check->inside = check->violation == SAFETY_OK;
+}
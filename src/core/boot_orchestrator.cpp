@@ -0,0 +1,338 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Orchestrateur de démarrage (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Les noms de dépendances sont résolus en indices ; un tri topologique
+     (Kahn) rejette les dépendances inconnues et les cycles
+  2. Deux exécutants (l'appelant et une tâche épinglée sur l'autre cœur)
+     prennent sous mutex le premier module en attente dont toutes les
+     dépendances sont terminées ; la fin d'un module réveille l'autre exécutant
+  3. Un module dont une dépendance a échoué est marqué ignoré sans être exécuté
+  4. Chemin critique : dans l'ordre topologique, fin au plus tôt d'un module =
+     sa durée + la plus grande fin au plus tôt de ses dépendances ; la chaîne
+     est reconstituée depuis le module qui finit le plus tard
+*/
+
+#include "core/boot_orchestrator.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <string.h>
+#include "utils/logging.h"
+
+// === CONSTANTES ===
+#define BOOT_ORCHESTRATOR_POLL_MS 10  // Attente d'un module de l'autre exécutant (ms)
+
+// === DÉFINITION DES TYPES ===
+
+typedef enum {
+  NODE_PENDING = 0,
+  NODE_RUNNING,
+  NODE_DONE
+} NodeStatus;
+
+// === VARIABLES GLOBALES ===
+
+static Module* const* graphModules = nullptr;
+static uint8_t graphCount = 0;
+static uint8_t dependencyIndex[BOOT_ORCHESTRATOR_MAX_MODULES][BOOT_ORCHESTRATOR_MAX_MODULES];
+static uint8_t dependencyCount[BOOT_ORCHESTRATOR_MAX_MODULES];
+static uint8_t topologicalOrder[BOOT_ORCHESTRATOR_MAX_MODULES];
+static volatile uint8_t nodeStatus[BOOT_ORCHESTRATOR_MAX_MODULES];
+static BootInitReport* activeReport = nullptr;
+
+static SemaphoreHandle_t graphLock = nullptr;       // Protège nodeStatus
+static SemaphoreHandle_t progressSignal = nullptr;  // Un module vient de se terminer
+static SemaphoreHandle_t helperDone = nullptr;      // La tâche du second cœur a terminé
+static volatile bool helperRunning = false;
+
+// === FONCTIONS INTERNES ===
+
+static int findModule(const char* name) {
+  for (int i = 0; i < graphCount; i++) {
+    if (strcmp(graphModules[i]->name(), name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Résout les dépendances et calcule l'ordre topologique
+ * @return false si une dépendance est inconnue ou si le graphe contient un cycle
+ */
+static bool buildGraph() {
+  uint8_t remainingDependencies[BOOT_ORCHESTRATOR_MAX_MODULES];
+
+  for (int i = 0; i < graphCount; i++) {
+    const Module* module = graphModules[i];
+    if (module->dependencyOverflow()) {
+      LOG_ERROR("BOOT", "Trop de dépendances pour %s (max %d)", module->name(), MODULE_MAX_DEPENDENCIES);
+      return false;
+    }
+    dependencyCount[i] = 0;
+    for (uint8_t d = 0; d < module->dependencyCount(); d++) {
+      const char* dependency = module->dependency(d);
+      int index = findModule(dependency);
+      if (index < 0) {
+        LOG_ERROR("BOOT", "Dépendance inconnue : %s -> %s", module->name(), dependency);
+        return false;
+      }
+      dependencyIndex[i][dependencyCount[i]++] = (uint8_t)index;
+    }
+    remainingDependencies[i] = dependencyCount[i];
+  }
+
+  // Kahn : retire successivement les modules sans dépendance restante
+  int sorted = 0;
+  bool placed[BOOT_ORCHESTRATOR_MAX_MODULES] = {false};
+  while (sorted < graphCount) {
+    int next = -1;
+    for (int i = 0; i < graphCount && next < 0; i++) {
+      if (!placed[i] && remainingDependencies[i] == 0) {
+        next = i;
+      }
+    }
+    if (next < 0) {
+      LOG_ERROR("BOOT", "Cycle dans les dépendances d'initialisation");
+      return false;
+    }
+    placed[next] = true;
+    topologicalOrder[sorted++] = (uint8_t)next;
+    for (int i = 0; i < graphCount; i++) {
+      for (int d = 0; d < dependencyCount[i]; d++) {
+        if (dependencyIndex[i][d] == next) {
+          remainingDependencies[i]--;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Réserve un module prêt ; les modules dont une dépendance a échoué sont
+ * marqués ignorés au passage
+ * @param remaining Reçoit true s'il reste des modules en attente
+ * @return Indice du module réservé, -1 si aucun n'est prêt
+ */
+static int claimReadyModule(bool* remaining) {
+  int claimed = -1;
+  bool skippedAny = false;
+  *remaining = false;
+
+  xSemaphoreTake(graphLock, portMAX_DELAY);
+  for (int i = 0; i < graphCount && claimed < 0; i++) {
+    if (nodeStatus[i] != NODE_PENDING) {
+      continue;
+    }
+    bool ready = true;
+    bool dependencyFailed = false;
+    for (int d = 0; d < dependencyCount[i]; d++) {
+      uint8_t dependency = dependencyIndex[i][d];
+      ready = ready && nodeStatus[dependency] == NODE_DONE;
+      dependencyFailed = dependencyFailed || (nodeStatus[dependency] == NODE_DONE &&
+                                              !activeReport->records[dependency].ok);
+    }
+    if (dependencyFailed) {
+      activeReport->records[i].skipped = true;
+      nodeStatus[i] = NODE_DONE;
+      skippedAny = true;
+    } else if (ready) {
+      nodeStatus[i] = NODE_RUNNING;
+      claimed = i;
+    } else {
+      *remaining = true;
+    }
+  }
+  xSemaphoreGive(graphLock);
+
+  if (skippedAny) {
+    // Un module ignoré peut débloquer (en échec) d'autres modules
+    *remaining = true;
+    xSemaphoreGive(progressSignal);
+  }
+  return claimed;
+}
+
+static void runModule(int index) {
+  BootInitRecord& record = activeReport->records[index];
+  record.core = (int8_t)xPortGetCoreID();
+  record.startUs = micros();
+  record.ok = graphModules[index]->runInit();
+  record.endUs = micros();
+  if (!record.ok) {
+    LOG_ERROR("BOOT", "Échec de l'initialisation de %s", graphModules[index]->name());
+  }
+
+  xSemaphoreTake(graphLock, portMAX_DELAY);
+  nodeStatus[index] = NODE_DONE;
+  xSemaphoreGive(graphLock);
+  xSemaphoreGive(progressSignal);
+}
+
+/**
+ * Boucle d'un exécutant : initialise les modules prêts jusqu'à ce qu'il n'en
+ * reste plus en attente
+ */
+static void runWorker() {
+  for (;;) {
+    bool remaining = false;
+    int index = claimReadyModule(&remaining);
+    if (index >= 0) {
+      runModule(index);
+    } else if (!remaining) {
+      return;
+    } else {
+      xSemaphoreTake(progressSignal, pdMS_TO_TICKS(BOOT_ORCHESTRATOR_POLL_MS));
+    }
+  }
+}
+
+static void helperTask(void* parameter) {
+  (void)parameter;
+  runWorker();
+  helperRunning = false;
+  xSemaphoreGive(helperDone);
+  vTaskDelete(NULL);
+}
+
+static void computeCriticalPath(BootInitReport* report) {
+  uint32_t earliestFinish[BOOT_ORCHESTRATOR_MAX_MODULES];
+  int predecessor[BOOT_ORCHESTRATOR_MAX_MODULES];
+  int last = -1;
+
+  report->serialUs = 0;
+  for (int t = 0; t < graphCount; t++) {
+    int i = topologicalOrder[t];
+    const BootInitRecord& record = report->records[i];
+    uint32_t duration = record.core >= 0 ? record.endUs - record.startUs : 0;
+    uint32_t start = 0;
+    predecessor[i] = -1;
+    for (int d = 0; d < dependencyCount[i]; d++) {
+      uint8_t dependency = dependencyIndex[i][d];
+      if (earliestFinish[dependency] > start || predecessor[i] < 0) {
+        start = earliestFinish[dependency];
+        predecessor[i] = dependency;
+      }
+    }
+    earliestFinish[i] = start + duration;
+    report->serialUs += duration;
+    if (last < 0 || earliestFinish[i] > earliestFinish[last]) {
+      last = i;
+    }
+  }
+
+  // Remonte la chaîne depuis le module qui finit le plus tard
+  int length = 0;
+  uint8_t reversed[BOOT_ORCHESTRATOR_MAX_MODULES];
+  for (int i = last; i >= 0; i = predecessor[i]) {
+    reversed[length++] = (uint8_t)i;
+  }
+  report->criticalLength = (uint8_t)length;
+  for (int i = 0; i < length; i++) {
+    report->criticalPath[i] = reversed[length - 1 - i];
+  }
+  report->criticalPathUs = last >= 0 ? earliestFinish[last] : 0;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool bootOrchestratorRun(Module* const* modules, int count, BootInitReport* report) {
+  memset(report, 0, sizeof(BootInitReport));
+  if (helperRunning) {
+    LOG_ERROR("BOOT", "Orchestration précédente toujours en cours");
+    return false;
+  }
+  if (count < 0 || count > BOOT_ORCHESTRATOR_MAX_MODULES) {
+    LOG_ERROR("BOOT", "Trop de modules à initialiser (%d, max %d)", count, BOOT_ORCHESTRATOR_MAX_MODULES);
+    return false;
+  }
+
+  graphModules = modules;
+  graphCount = (uint8_t)count;
+  if (!buildGraph()) {
+    return false;
+  }
+
+  if (graphLock == nullptr) {
+    graphLock = xSemaphoreCreateMutex();
+    progressSignal = xSemaphoreCreateBinary();
+    helperDone = xSemaphoreCreateBinary();
+  }
+  if (graphLock == nullptr || progressSignal == nullptr || helperDone == nullptr) {
+    LOG_ERROR("BOOT", "Impossible de créer les sémaphores d'orchestration");
+    return false;
+  }
+
+  activeReport = report;
+  report->count = (uint8_t)count;
+  for (int i = 0; i < count; i++) {
+    report->records[i].module = modules[i];
+    report->records[i].core = -1;
+    nodeStatus[i] = NODE_PENDING;
+  }
+  report->startUs = micros();
+
+  // Second exécutant sur l'autre cœur ; à défaut, l'appelant initialise tout
+  helperRunning = true;
+  BaseType_t otherCore = xPortGetCoreID() == 0 ? 1 : 0;
+  if (xTaskCreatePinnedToCore(helperTask, "BootInit", BOOT_INIT_TASK_STACK_SIZE, nullptr,
+                              BOOT_INIT_TASK_PRIORITY, nullptr, otherCore) == pdPASS) {
+    report->workers = 2;
+  } else {
+    helperRunning = false;
+    report->workers = 1;
+  }
+
+  runWorker();
+
+  bool completed = true;
+  if (report->workers == 2 && xSemaphoreTake(helperDone, pdMS_TO_TICKS(BOOT_INIT_TIMEOUT_MS)) != pdTRUE) {
+    LOG_ERROR("BOOT", "Initialisation des modules interrompue après %d ms", BOOT_INIT_TIMEOUT_MS);
+    completed = false;
+  }
+  report->wallUs = micros() - report->startUs;
+
+  if (!completed) {
+    // La tâche du second cœur écrit encore dans le rapport : pas de calcul
+    return false;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!report->records[i].ok) {
+      report->failures++;
+    }
+  }
+  computeCriticalPath(report);
+  return report->failures == 0;
+}
+
+void bootOrchestratorPrintReport(const BootInitReport* report) {
+  Serial.printf("Initialisation des modules : %.1f ms (séquentiel %.1f ms, chemin critique %.1f ms, %d exécutant%s)\n",
+                report->wallUs / 1000.0f, report->serialUs / 1000.0f, report->criticalPathUs / 1000.0f,
+                report->workers, report->workers > 1 ? "s" : "");
+
+  for (int i = 0; i < report->count; i++) {
+    const BootInitRecord& record = report->records[i];
+    if (record.core < 0) {
+      Serial.printf("  %-16s %s\n", record.module->name(), record.skipped ? "ignoré (dépendance en échec)" : "-");
+      continue;
+    }
+    Serial.printf("  %-16s cœur %d  début %8.1f ms  durée %8.1f ms  %s\n", record.module->name(), record.core,
+                  (record.startUs - report->startUs) / 1000.0f, (record.endUs - record.startUs) / 1000.0f,
+                  record.ok ? "OK" : "ÉCHEC");
+  }
+
+  Serial.printf("Chemin critique :");
+  for (int i = 0; i < report->criticalLength; i++) {
+    Serial.printf("%s%s", i == 0 ? " " : " -> ", report->records[report->criticalPath[i]].module->name());
+  }
+  Serial.printf("\n");
+}
@@ -0,0 +1,140 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Placement du code chaud (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. L'occupation IRAM est lue sur les symboles de l'éditeur de liens
+     (_iram_start.._iram_end), la région sur SOC_IRAM_LOW..SOC_IRAM_HIGH et
+     le reste allouable sur le tas MALLOC_CAP_EXEC
+  2. Les adresses des fonctions du cycle de contrôle sont comparées à la
+     région IRAM : une fonction chaude restée en flash est signalée
+  3. Chaque cycle de contrôle fournit son début et sa fin ; l'écart entre
+     deux débuts est la période réelle, comparée à CONTROL_TASK_PERIOD_MS
+  4. Les mesures sont écrites par la seule tâche de contrôle et lues sous
+     section critique
+*/
+
+#include "core/hot_path.h"
+#include "control/pid.h"
+#include "control/autopilot.h"
+#include "control/mission.h"
+#include "control/command_scheduler.h"
+#include "utils/logging.h"
+#include <string.h>
+
+#ifndef NATIVE_BUILD
+#include <esp_heap_caps.h>
+#include <soc/soc.h>
+
+// Symboles de l'éditeur de liens (sections.ld de l'ESP-IDF)
+extern int _iram_start;
+extern int _iram_end;
+#endif
+
+// === VARIABLES GLOBALES ===
+
+static uint32_t lastStartUs = 0;
+static bool hasLastStart = false;
+static uint32_t cycles = 0;
+static uint32_t maxPeriodUs = 0;
+static uint32_t maxWorkUs = 0;
+static uint32_t overruns = 0;
+static portMUX_TYPE hotPathMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Fonctions exécutées à chaque cycle de contrôle, attendues en IRAM
+static const void* const HOT_FUNCTIONS[] = {
+  (const void*)&hotPathRecordControlCycle,
+  (const void*)&commandSchedulerService,
+  (const void*)&missionStep,
+  (const void*)&autopilotControlStep,
+  (const void*)&pidCompute,
+};
+
+#define HOT_FUNCTION_COUNT (sizeof(HOT_FUNCTIONS) / sizeof(HOT_FUNCTIONS[0]))
+
+// === FONCTIONS INTERNES ===
+
+static bool inIram(const void* address) {
+#ifdef NATIVE_BUILD
+  (void)address;
+  return false;
+#else
+  uintptr_t value = (uintptr_t)address;
+  return value >= SOC_IRAM_LOW && value < SOC_IRAM_HIGH;
+#endif
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+HOT_PATH void hotPathRecordControlCycle(uint32_t startUs, uint32_t endUs) {
+  const uint32_t overrunUs = (uint32_t)CONTROL_TASK_PERIOD_MS * 10 * HOT_PATH_OVERRUN_PERCENT;
+  uint32_t workUs = endUs - startUs;
+  portENTER_CRITICAL(&hotPathMux);
+  if (hasLastStart) {
+    uint32_t periodUs = startUs - lastStartUs;
+    if (periodUs > maxPeriodUs) maxPeriodUs = periodUs;
+    if (periodUs > overrunUs) overruns++;
+  }
+  if (workUs > maxWorkUs) maxWorkUs = workUs;
+  lastStartUs = startUs;
+  hasLastStart = true;
+  cycles++;
+  portEXIT_CRITICAL(&hotPathMux);
+}
+
+void hotPathResetControlStats() {
+  portENTER_CRITICAL(&hotPathMux);
+  hasLastStart = false;
+  cycles = 0;
+  maxPeriodUs = 0;
+  maxWorkUs = 0;
+  overruns = 0;
+  portEXIT_CRITICAL(&hotPathMux);
+}
+
+HotPathReport hotPathGetReport() {
+  HotPathReport report;
+  memset(&report, 0, sizeof(report));
+#ifndef NATIVE_BUILD
+  report.iramTotal = SOC_IRAM_HIGH - SOC_IRAM_LOW;
+  report.iramUsed = (uint32_t)((uintptr_t)&_iram_end - (uintptr_t)&_iram_start);
+  report.iramHeapFree = heap_caps_get_free_size(MALLOC_CAP_EXEC);
+#endif
+  report.hotFunctions = HOT_FUNCTION_COUNT;
+  for (size_t i = 0; i < HOT_FUNCTION_COUNT; i++) {
+    if (inIram(HOT_FUNCTIONS[i])) {
+      report.hotInIram++;
+    }
+  }
+
+  portENTER_CRITICAL(&hotPathMux);
+  report.cycles = cycles;
+  report.maxPeriodUs = maxPeriodUs;
+  report.maxWorkUs = maxWorkUs;
+  report.overruns = overruns;
+  portEXIT_CRITICAL(&hotPathMux);
+  return report;
+}
+
+void hotPathLogReport() {
+  HotPathReport report = hotPathGetReport();
+  LOG_INFO("IRAM", "IRAM : %lu / %lu octets de code, %lu libres au tas ; fonctions chaudes en IRAM : %u/%u",
+           (unsigned long)report.iramUsed, (unsigned long)report.iramTotal,
+           (unsigned long)report.iramHeapFree, report.hotInIram, report.hotFunctions);
+#ifndef NATIVE_BUILD
+  if (report.hotInIram < report.hotFunctions) {
+    LOG_WARNING("IRAM", "Fonctions chaudes restées en flash : HOT_PATH ignoré à l'édition des liens");
+  }
+#endif
+  if (report.cycles > 0) {
+    LOG_INFO("IRAM", "Contrôle : %lu cycles, période max %lu us (nominale %lu), travail max %lu us, %lu dépassements",
+             (unsigned long)report.cycles, (unsigned long)report.maxPeriodUs,
+             (unsigned long)CONTROL_TASK_PERIOD_MS * 1000, (unsigned long)report.maxWorkUs,
+             (unsigned long)report.overruns);
+  }
+}
@@ -45,6 +45,9 @@
 #include "core/config.h"         // Constantes de configuration globale (pins, timings)
 #include "core/system.h"         // Gestion de l'état système et watchdog
 #include "core/task_manager.h"   // Orchestration des tâches FreeRTOS
+#include "core/boot_orchestrator.h" // Initialisation parallèle des modules
+#include "core/power_manager.h"     // Fréquence CPU et sommeil léger
+#include "core/hot_path.h"          // Code chaud en IRAM, régularité du contrôle
 
 // === INCLUSIONS MODULES HARDWARE ===
 // Capteurs
@@ -78,6 +81,9 @@
 #include "utils/data_storage.h"           // Gestion du stockage des données
 #include "utils/diagnostics.h"            // Diagnostics système
 #include "utils/terminal.h"               // Terminal distant
+#include "utils/benchmark.h"              // Micro-benchmarks des fonctions critiques
+#include "utils/boot_profiler.h"          // Chronologie du démarrage
+#include "utils/lifetime_stats.h"         // Compteurs cumulés sur la vie du kite
 
 // === DÉCLARATION DES OBJETS GLOBAUX ===
 DisplayManager display;                       // Gestionnaire d'affichage LCD
@@ -99,6 +105,10 @@ static unsigned long lastMemoryLogTime = 0;
 static const unsigned long SYSTEM_STATE_LOG_INTERVAL_MS = 1000; // 1s
 static const unsigned long MEMORY_LOG_INTERVAL_MS = 2000;       // 2s
 
+// Démarrage rapide : actif quand une calibration valide a été chargée depuis la NVS
+static bool fastBootActive = false;
+static CalibrationData persistedCalibration;
+
 // === DÉCLARATION DES FONCTIONS ===
 
 // Tâche d'initialisation principale (démarre après le setup)
@@ -109,6 +119,8 @@ void setupWiFi();
 void setupServer();
 void setupHardware();
 void setupTasks();
+void loadPersistedCalibration();
+void applyPersistedCalibration();
 
 // Fonctions OTA
 void onOTAStart();
@@ -165,11 +177,15 @@ void setupWiFi() {
     
     // Afficher les informations de connexion
     display.displayWiFiInfo(WIFI_SSID, WiFi.localIP());
-    delay(1000); // Afficher pendant 1 seconde
+    if (!fastBootActive) {
+      delay(1000); // Afficher pendant 1 seconde
+    }
   } else {
     LOG_ERROR("WIFI", "Échec de connexion au réseau %s", WIFI_SSID);
     display.displayMessage("Erreur", "Échec WiFi");
-    delay(1000);
+    if (!fastBootActive) {
+      delay(1000);
+    }
   }
 }
 
@@ -209,23 +225,176 @@ void setupServer() {
   
   // Affichage final
   display.displayMessage("Système", "Prêt!");
-  delay(1000);
+  if (!fastBootActive) {
+    delay(1000);
+  }
   
   char otaUrl[40];
   snprintf(otaUrl, sizeof(otaUrl), "http://%d.%d.%d.%d/update", 
            WiFi.localIP()[0], WiFi.localIP()[1], WiFi.localIP()[2], WiFi.localIP()[3]);
   display.displayMessage("OTA", otaUrl);
-  delay(1000);
+  if (!fastBootActive) {
+    delay(1000);
+  }
 #else
   LOG_INFO("SERVER", "Serveur web désactivé (MODULE_WEBSERVER_ENABLED=0)");
 #endif
 }
 
+/**
+ * Charge la calibration persistée et décide du mode de démarrage
+ * Démarrage rapide si FAST_BOOT_ENABLED et qu'un bloc valide est présent en NVS
+ */
+void loadPersistedCalibration() {
+  dataStorageDefaultCalibration(&persistedCalibration);
+  
+  if (!dataStorageInit()) {
+    LOG_WARNING("INIT", "Stockage persistant indisponible, démarrage à froid");
+    return;
+  }
+  
+  bool calibrationLoaded = dataStorageLoadCalibration(&persistedCalibration);
+  fastBootActive = FAST_BOOT_ENABLED && calibrationLoaded;
+  
+  LOG_INFO("INIT", "Mode de démarrage: %s", fastBootActive ? "rapide" : "à froid");
+}
+
+/**
+ * Recharge la calibration persistée dans les modules concernés
+ */
+void applyPersistedCalibration() {
+  const CalibrationData& calib = persistedCalibration;
+  
+  if (calib.flags & CALIB_FLAG_POTS) {
+    potManager.setCalibrationValues(calib.potMin[0], calib.potMax[0],
+                                    calib.potMin[1], calib.potMax[1],
+                                    calib.potMin[2], calib.potMax[2]);
+  }
+  
+  if (calib.flags & CALIB_FLAG_IMU) {
+    imuSetBiases(calib.gyroBias, calib.accelBias);
+  }
+}
+
+// === MODULES D'INITIALISATION ===
+// Chaque initialisation matérielle est un module du graphe de démarrage ; les
+// dépendances sérialisent l'écran (bus I2C) et l'usage de la calibration.
+// L'absence d'écran n'est pas bloquante : splash et ui vérifient lcdReady.
+
+static volatile bool lcdReady = false;
+
+static bool initStorage() {
+  loadPersistedCalibration();
+  return true;
+}
+
+static bool initLcd() {
+  display.setupI2C();
+  lcdReady = display.initLCD();
+  if (lcdReady) {
+    // Créer les caractères personnalisés
+    display.createCustomChars();
+  } else {
+    LOG_ERROR("INIT", "Échec d'initialisation de l'écran LCD");
+  }
+  return true;
+}
+
+static bool initSplash() {
+  // Écran d'accueil uniquement au démarrage à froid
+  if (lcdReady && !fastBootActive) {
+    display.displayWelcomeScreen(true); // Utiliser le mode simple
+    delay(SPLASH_SCREEN_DURATION);
+  }
+  return true;
+}
+
+static bool initUi() {
+  // Initialiser le gestionnaire d'interface (LCD et boutons)
+  if (lcdReady) {
+    uiManager.begin(!fastBootActive);
+  }
+  return true;
+}
+
+static bool initButtons() {
+  // Initialiser l'interface utilisateur à boutons
+  return buttonUI.begin();
+}
+
+static bool initPots() {
+  LOG_INFO("POT", "Initialisation des potentiomètres");
+  potManager.begin();
+  
+  // Valider l'initialisation en lisant les valeurs initiales
+  if (!potManager.isInitialized()) {
+    LOG_ERROR("POT", "Échec d'initialisation des potentiomètres");
+    return false;
+  }
+  LOG_INFO("POT", "Valeurs initiales - Dir: %d, Trim: %d, Longueur: %d", 
+           potManager.getDirection(), potManager.getTrim(), potManager.getLineLength());
+  return true;
+}
+
+static bool initServos() {
+  bool ok = servoInitAll();
+  servoInitialize();
+  return ok;
+}
+
+static bool initCalibration() {
+  // Recharger la calibration persistée (potentiomètres, biais IMU)
+  applyPersistedCalibration();
+  return true;
+}
+
+static bool initPower() {
+  powerManagerInit();
+  return true;
+}
+
+static bool initWifi() {
+  wifiManagerInit();
+  return true;
+}
+
+static InitFunctionModule storageInit("storage", initStorage, "Calibration persistée (NVS)");
+static InitFunctionModule lcdInit("lcd", initLcd, "Écran LCD (I2C)");
+static InitFunctionModule splashInit("splash", initSplash, "Écran d'accueil");
+static InitFunctionModule uiInit("ui", initUi, "Interface LCD");
+static InitFunctionModule buttonsInit("buttons", initButtons, "Boutons");
+static InitFunctionModule potsInit("pots", initPots, "Potentiomètres");
+static InitFunctionModule servosInit("servos", initServos, "Servomoteurs");
+static InitFunctionModule calibrationInit("calibration", initCalibration, "Application de la calibration");
+static InitFunctionModule dashboardModuleInit("dashboard", dashboardInit, "Tableau de bord");
+static InitFunctionModule autopilotModuleInit("autopilot", autopilotInit, "Pilote automatique");
+static InitFunctionModule wifiInit("wifi", initWifi, "WiFi");
+static InitFunctionModule powerInit("power", initPower, "Gestion de l'énergie (esp_pm)");
+
+static Module* const bootModules[] = {
+  &storageInit, &lcdInit, &splashInit, &uiInit, &buttonsInit, &potsInit,
+  &servosInit, &calibrationInit, &dashboardModuleInit, &autopilotModuleInit, &wifiInit, &powerInit
+};
+static BootInitReport bootInitReport;
+
+/**
+ * Déclare les dépendances d'initialisation des modules
+ */
+static void declareBootDependencies() {
+  splashInit.dependsOn("lcd");
+  splashInit.dependsOn("storage");       // Démarrage rapide connu après lecture de la NVS
+  uiInit.dependsOn("splash");            // Écran partagé
+  calibrationInit.dependsOn("storage");
+  calibrationInit.dependsOn("pots");     // Aucun réglage de servo rechargé : servos indépendant
+  autopilotModuleInit.dependsOn("calibration");  // Potentiomètres calibrés
+}
+
 /**
  * Initialise tous les composants matériels
  */
 void setupHardware() {
   // Configurer les GPIO
+  uint8_t step = bootProfilerStepBegin("gpio");
   pinMode(LED_PIN, OUTPUT);
   // Broches des boutons (config centralisée)
   pinMode(BUTTON_BACK_PIN, INPUT_PULLUP);
@@ -239,48 +408,20 @@ void setupHardware() {
   digitalWrite(LED_PIN, LOW);
   
   LOG_INFO("GPIO", "GPIOs configurés");
+  bootProfilerStepEnd(step);
   
-  // Initialiser l'écran LCD
-  display.setupI2C();
-  if (display.initLCD()) {
-    // Afficher "INIT" pendant 2 secondes au démarrage
-    display.displayWelcomeScreen(true); // Utiliser le mode simple
-    delay(2000); // Attendre 2 secondes
-    
-    // Créer les caractères personnalisés
-    display.createCustomChars();
-    // Initialiser le gestionnaire d'interface (LCD et boutons)
-    uiManager.begin();
-  } else {
-    LOG_ERROR("INIT", "Échec d'initialisation de l'écran LCD");
+  // Initialisation des modules selon leurs dépendances, sur les deux cœurs
+  declareBootDependencies();
+  if (!bootOrchestratorRun(bootModules, sizeof(bootModules) / sizeof(bootModules[0]), &bootInitReport)) {
+    LOG_WARNING("INIT", "Initialisation des modules incomplète (%d en échec)", bootInitReport.failures);
   }
-  
-  // Initialiser les potentiomètres
-  LOG_INFO("POT", "Initialisation des potentiomètres");
-  potManager.begin();
-  
-  // Valider l'initialisation en lisant les valeurs initiales
-  if (potManager.isInitialized()) {
-    LOG_INFO("POT", "Valeurs initiales - Dir: %d, Trim: %d, Longueur: %d", 
-             potManager.getDirection(), potManager.getTrim(), potManager.getLineLength());
-  } else {
-    LOG_ERROR("POT", "Échec d'initialisation des potentiomètres");
+  for (int i = 0; i < bootInitReport.count; i++) {
+    const BootInitRecord& record = bootInitReport.records[i];
+    if (record.core >= 0) {
+      bootProfilerAddStep(record.module->name(), record.startUs, record.endUs);
+    }
   }
-  
-  // Initialiser les servomoteurs
-  servoInitAll();
-  
-  // Initialiser l'interface utilisateur à boutons
-  buttonUI.begin();
-  
-  // Initialiser l'interface utilisateur à boutons
-  buttonUI.begin();
-  
-  // Initialiser l'interface tableau de bord
-  dashboardInit();
-  
-  // Initialiser l'autopilote (mais désactivé par défaut)
-  autopilotInit();
+  bootOrchestratorPrintReport(&bootInitReport);
 }
 
 /**
@@ -299,6 +440,8 @@ void setupTasks() {
  */
 void onOTAStart() {
   LOG_INFO("OTA", "Mise à jour OTA démarrée");
+  // Mesure de la régularité du contrôle pendant l'écriture de la flash
+  hotPathResetControlStats();
   digitalWrite(LED_PIN, HIGH);  // LED allumée pendant la mise à jour
   display.displayMessage("OTA", "Mise à jour démarrée");
 }
@@ -331,9 +474,11 @@ void onOTAEnd(bool success) {
   digitalWrite(LED_PIN, LOW);
   
   display.displayOTAStatus(success);
+  hotPathLogReport();
   
   if (success) {
     LOG_INFO("OTA", "Mise à jour terminée avec succès");
+    lifetimeStatsCheckpoint();
     
     // Double clignotement pour indiquer le succès
     for (int i = 0; i < 2; i++) {
@@ -375,14 +520,25 @@ void checkSystemState() {
  * Initialise uniquement le moniteur série et démarre FreeRTOS
  */
 void setup() {
+    // Chronologie du démarrage (la précédente reste en mémoire RTC)
+    bootProfilerBegin();
+    
     // Initialisation du moniteur série
+    uint8_t step = bootProfilerStepBegin("serial");
     Serial.begin(115200);
     delay(100); // Court délai pour que le moniteur série s'initialise
     
     // Initialisation des logs (premier composant à initialiser)
     logInit((LogLevel)LOG_LEVEL_INFO, 115200);
+    bootProfilerStepEnd(step);
     LOG_INFO("INIT", "Démarrage Kite PiloteV3, version : %s", SYSTEM_VERSION);
     
+    // Redémarrage à chaud pendant l'initialisation : étape en cause
+    const char* stalledStep = bootProfilerStalledStep(bootProfilerGetPreviousTimeline());
+    if (stalledStep != nullptr) {
+        LOG_WARNING("BOOT", "Démarrage précédent interrompu pendant l'étape '%s'", stalledStep);
+    }
+    
     // Configuration des broches de diagnostic (LED uniquement)
     pinMode(LED_PIN, OUTPUT);
     digitalWrite(LED_PIN, HIGH); // LED allumée pendant l'initialisation
@@ -408,20 +564,24 @@ void setup() {
  */
 void initTask(void* parameter) {
     // Initialisation du système
+    uint8_t step = bootProfilerStepBegin("system");
     if (systemInit() != SYS_OK) {
         LOG_ERROR("SYS", "Échec de l'initialisation du système");
         vTaskDelete(NULL);
         return;
     }
+    bootProfilerStepEnd(step);
 
     // Initialisation du matériel
+    step = bootProfilerStepBegin("hardware");
     setupHardware();
+    bootProfilerStepEnd(step);
 
     // S'assurer que l'interface utilisateur est correctement initialisée
     if (!uiManager.isInitialized()) {
         LOG_WARNING("INIT", "Interface utilisateur non initialisée, nouvelle tentative");
         // Nouvelle tentative d'initialisation plus explicite
-        uiManager.begin();
+        uiManager.begin(!fastBootActive);
         
         // Vérifier à nouveau
         if (!uiManager.isInitialized()) {
@@ -432,22 +592,42 @@ void initTask(void* parameter) {
     }
     
     // Délai pour s'assurer que tout est correctement initialisé
+    step = bootProfilerStepBegin("settle");
     vTaskDelay(pdMS_TO_TICKS(100));
+    bootProfilerStepEnd(step);
 
-    // Initialisation des modules
-    wifiManagerInit();
-    servoInitialize();
+#if BENCHMARK_ENABLED
+    // Mesures avant le démarrage des tâches applicatives (système au repos)
+    step = bootProfilerStepBegin("benchmark");
+    benchmarkRunSuite(BENCHMARK_BASELINE_PATH, BENCHMARK_UPDATE_BASELINE);
+    bootProfilerStepEnd(step);
+#endif
 
     // Démarrage des tâches FreeRTOS
+    step = bootProfilerStepBegin("task_manager");
     taskManager.begin(&uiManager, &wifiManager);
+    bootProfilerStepEnd(step);
     
     // Délai pour s'assurer que les ressources sont bien initialisées
+    step = bootProfilerStepBegin("settle_tasks");
     vTaskDelay(pdMS_TO_TICKS(100));
+    bootProfilerStepEnd(step);
     
     // Démarrage des tâches
+    step = bootProfilerStepBegin("start_tasks");
     taskManager.startTasks();
+    bootProfilerStepEnd(step);
 
+    bootProfilerFinish();
     LOG_INFO("INIT", "Système prêt");
+    hotPathLogReport();
+
+#if BOOT_PROFILER_ENABLED
+    // Cascade du démarrage et régressions par rapport à la référence
+    bootProfilerPrintWaterfall(bootProfilerGetTimeline());
+    bootProfilerCompareBaseline(bootProfilerGetTimeline(), BOOT_PROFILE_BASELINE_PATH,
+                                BOOT_PROFILE_UPDATE_BASELINE);
+#endif
 
     // Supprimer la tâche une fois l'initialisation terminée
     vTaskDelete(NULL);
@@ -0,0 +1,183 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Gestion de l'énergie (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. esp_pm est configuré une fois (max POWER_FLIGHT_CPU_MHZ, min
+     POWER_IDLE_CPU_MHZ, sommeil léger) : sans verrou, le gestionnaire
+     d'énergie abaisse la fréquence et endort le CPU pendant l'inactivité
+  2. Deux verrous (ESP_PM_CPU_FREQ_MAX, ESP_PM_NO_LIGHT_SLEEP) sont tenus en
+     vol et libérés au sol ; sans esp_pm, setCpuFrequencyMhz() les remplace
+  3. Le temps passé dans chaque profil et les mesures de courant sont
+     cumulés par profil pour chiffrer l'économie
+*/
+
+#include "core/power_manager.h"
+#include <esp_pm.h>
+#include "utils/logging.h"
+#include <math.h>
+
+// === VARIABLES GLOBALES ===
+
+static esp_pm_lock_handle_t cpuFrequencyLock = nullptr;
+static esp_pm_lock_handle_t noLightSleepLock = nullptr;
+static PowerStats stats = {};
+static bool locksHeld = false;
+static unsigned long profileSince = 0;
+static unsigned long groundedSince = 0;
+static bool groundedTiming = false;
+
+// === FONCTIONS INTERNES ===
+
+static void accumulateProfileTime() {
+  unsigned long now = millis();
+  stats.timeInProfileMs[stats.profile] += now - profileSince;
+  profileSince = now;
+}
+
+static void setFlightLocks(bool hold) {
+  if (!stats.pmSupported) {
+    setCpuFrequencyMhz(hold ? POWER_FLIGHT_CPU_MHZ : POWER_IDLE_CPU_MHZ);
+    return;
+  }
+  if (hold == locksHeld) {
+    return;
+  }
+  if (hold) {
+    esp_pm_lock_acquire(cpuFrequencyLock);
+    esp_pm_lock_acquire(noLightSleepLock);
+  } else {
+    esp_pm_lock_release(noLightSleepLock);
+    esp_pm_lock_release(cpuFrequencyLock);
+  }
+  locksHeld = hold;
+}
+
+static float meanCurrent(PowerProfile profile) {
+  return stats.currentSamples[profile] > 0 ? stats.currentSumMa[profile] / stats.currentSamples[profile] : 0.0f;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool powerManagerInit() {
+  memset(&stats, 0, sizeof(stats));
+  stats.profile = POWER_PROFILE_FLIGHT;
+  profileSince = millis();
+  groundedTiming = false;
+
+  esp_pm_config_esp32_t config = {};
+  config.max_freq_mhz = POWER_FLIGHT_CPU_MHZ;
+  config.min_freq_mhz = POWER_IDLE_CPU_MHZ;
+  config.light_sleep_enable = POWER_LIGHT_SLEEP_ENABLED != 0;
+
+  esp_err_t result = esp_pm_configure(&config);
+  if (result == ESP_OK && cpuFrequencyLock == nullptr) {
+    result = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "flight_cpu", &cpuFrequencyLock);
+    if (result == ESP_OK) {
+      result = esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "flight_awake", &noLightSleepLock);
+    }
+  }
+  stats.pmSupported = (result == ESP_OK);
+  stats.lightSleep = stats.pmSupported && config.light_sleep_enable;
+
+  if (stats.pmSupported) {
+    LOG_INFO("POWER", "esp_pm actif : %d-%d MHz, sommeil léger %s", POWER_IDLE_CPU_MHZ, POWER_FLIGHT_CPU_MHZ,
+             stats.lightSleep ? "autorisé au sol" : "désactivé");
+  } else {
+    LOG_WARNING("POWER", "esp_pm indisponible (erreur 0x%x) : fréquence fixe par profil, sans sommeil léger",
+                (unsigned)result);
+  }
+
+#if POWER_CURRENT_SENSE_PIN >= 0
+  pinMode(POWER_CURRENT_SENSE_PIN, INPUT);
+#endif
+
+  setFlightLocks(true);
+  return stats.pmSupported;
+}
+
+bool powerManagerIsGrounded(float elevation) {
+  // Élévation inconnue : le kite peut être en vol
+  return !isnan(elevation) && elevation < POWER_GROUNDED_ELEVATION;
+}
+
+PowerProfile powerManagerEvaluate(AutopilotMode mode, float elevation) {
+  if (mode != AUTOPILOT_OFF || !powerManagerIsGrounded(elevation)) {
+    groundedTiming = false;
+    return POWER_PROFILE_FLIGHT;
+  }
+  unsigned long now = millis();
+  if (!groundedTiming) {
+    groundedTiming = true;
+    groundedSince = now;
+  }
+  return now - groundedSince >= POWER_GROUNDED_HOLD_MS ? POWER_PROFILE_GROUNDED_IDLE : POWER_PROFILE_FLIGHT;
+}
+
+void powerManagerApplyProfile(PowerProfile profile) {
+  if (profile >= POWER_PROFILE_COUNT || profile == stats.profile) {
+    return;
+  }
+  accumulateProfileTime();
+  stats.profile = profile;
+  stats.transitions++;
+  if (profile == POWER_PROFILE_FLIGHT) {
+    // Un éventuel retour au sol repart d'une attente complète
+    groundedTiming = false;
+  }
+  setFlightLocks(profile == POWER_PROFILE_FLIGHT);
+
+  LOG_INFO("POWER", "Profil %s", profile == POWER_PROFILE_FLIGHT ? "vol (pleine vitesse)" : "sol (économie d'énergie)");
+  if (stats.currentSamples[POWER_PROFILE_FLIGHT] > 0 && stats.currentSamples[POWER_PROFILE_GROUNDED_IDLE] > 0) {
+    powerManagerPrintReport();
+  }
+}
+
+PowerProfile powerManagerGetProfile() {
+  return stats.profile;
+}
+
+void powerManagerSampleCurrent() {
+#if POWER_CURRENT_SENSE_PIN >= 0
+  float millivolts = analogRead(POWER_CURRENT_SENSE_PIN) * 3300.0f / ADC_RESOLUTION;
+  powerManagerRecordCurrent((millivolts - POWER_CURRENT_SENSE_OFFSET_MV) * 1000.0f / POWER_CURRENT_SENSE_MV_PER_A);
+#endif
+}
+
+void powerManagerRecordCurrent(float milliamps) {
+  stats.currentSumMa[stats.profile] += milliamps;
+  stats.currentSamples[stats.profile]++;
+}
+
+PowerStats powerManagerGetStats() {
+  accumulateProfileTime();
+  return stats;
+}
+
+void powerManagerPrintReport() {
+  PowerStats current = powerManagerGetStats();
+  static const char* const names[POWER_PROFILE_COUNT] = {"vol", "sol"};
+
+  for (int i = 0; i < POWER_PROFILE_COUNT; i++) {
+    if (current.currentSamples[i] > 0) {
+      LOG_INFO("POWER", "%s : %lu s, %.1f mA en moyenne (%lu mesures)", names[i],
+               (unsigned long)(current.timeInProfileMs[i] / 1000), meanCurrent((PowerProfile)i),
+               (unsigned long)current.currentSamples[i]);
+    } else {
+      LOG_INFO("POWER", "%s : %lu s, courant non mesuré", names[i],
+               (unsigned long)(current.timeInProfileMs[i] / 1000));
+    }
+  }
+
+  float flight = meanCurrent(POWER_PROFILE_FLIGHT);
+  float idle = meanCurrent(POWER_PROFILE_GROUNDED_IDLE);
+  if (current.currentSamples[POWER_PROFILE_FLIGHT] > 0 && current.currentSamples[POWER_PROFILE_GROUNDED_IDLE] > 0 &&
+      flight > 0.0f) {
+    LOG_INFO("POWER", "Économie au sol : %.1f mA (%.0f%%)", flight - idle, (flight - idle) * 100.0f / flight);
+  }
+}
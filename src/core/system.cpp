@@ -17,6 +17,7 @@
 
 #include "../../include/core/system.h"
 #include "../../include/core/logging.h"
+#include "../../include/core/power_manager.h"
 #include <esp_system.h>
 #include <Arduino.h>
 #include <esp_task_wdt.h>   // Ajout: inclusion pour les fonctions watchdog
@@ -28,7 +29,8 @@ static void restartTask(void* parameters);
 
 // Variables système globales
 static SystemInfo systemInfo;          // Structure contenant les informations système
-static unsigned long lastUpdateTime = 0; // Dernière mise à jour des informations système
+static TimerHandle infoTimer = TIMER_HANDLE_NONE; // Rafraîchissement périodique des informations
+static TimerWheel* infoWheel = nullptr;  // Roue de la tâche qui rafraîchit les informations
 static bool systemInitialized = false;  // Indique si le système est initialisé
 static uint8_t systemStatus = 0;        // État global du système
 static TaskHandle_t restartTaskHandle = NULL; // Tâche pour redémarrer le système
@@ -80,14 +82,32 @@ SystemErrorCode systemInit() {
  * @return Structure SystemInfo contenant les données système.
  */
 SystemInfo getSystemInfo() {
-  // Mettre à jour les informations si nécessaire
-  if (millis() - lastUpdateTime > 1000) {
+  // Sans rafraîchissement programmé (avant le démarrage des tâches), lecture directe
+  if (infoWheel == nullptr || !timerWheelIsActive(infoWheel, infoTimer)) {
     updateSystemInfo();
   }
   
   return systemInfo;
 }
 
+static void onSystemInfoTimer(void* context) {
+  updateSystemInfo();
+}
+
+/**
+ * Programme le rafraîchissement des informations système toutes les
+ * SYSTEM_INFO_UPDATE_INTERVAL sur la roue d'une tâche
+ * @param wheel Roue de temporisateurs de la tâche qui rafraîchit les informations
+ * @return false si la roue est pleine
+ */
+bool systemScheduleInfoUpdates(TimerWheel* wheel) {
+  infoTimer = timerWheelSchedule(wheel, SYSTEM_INFO_UPDATE_INTERVAL, SYSTEM_INFO_UPDATE_INTERVAL,
+                                 onSystemInfoTimer, nullptr);
+  infoWheel = infoTimer != TIMER_HANDLE_NONE ? wheel : nullptr;
+  updateSystemInfo();
+  return infoWheel != nullptr;
+}
+
 /**
  * Met à jour les informations système (mémoire, CPU, etc.).
  */
@@ -102,9 +122,6 @@ void updateSystemInfo() {
   // Dans une implémentation réelle, ces valeurs seraient obtenues des capteurs
   systemInfo.cpuUsagePercent = random(5, 30); // Simulation de 5-30% d'utilisation CPU
   systemInfo.cpuTemperature = 30.0f + (random(0, 100) / 10.0f); // Simulation de température 30-40°C
-  
-  // Mettre à jour le timestamp de dernière mise à jour
-  lastUpdateTime = millis();
 }
 
 /**
@@ -292,12 +309,16 @@ void enterPowerSaveMode() {
   if (systemInfo.systemState == SYS_STATE_POWER_SAVE) {
     return; // Déjà en mode économie d'énergie
   }
+  if (systemInfo.systemState != SYS_STATE_READY && systemInfo.systemState != SYS_STATE_RUNNING) {
+    // Erreur (même survenue au sol), mise à jour ou calibration : pleine vitesse
+    powerManagerApplyProfile(POWER_PROFILE_FLIGHT);
+    return;
+  }
   
   LOG_INFO("SYS", "Activation du mode économie d'énergie");
   
-  // Code pour réduire la consommation d'énergie
-  // - Réduire la fréquence CPU
-  // - Désactiver les périphériques non essentiels
+  // Verrous de vol libérés : fréquence réduite et sommeil léger automatique
+  powerManagerApplyProfile(POWER_PROFILE_GROUNDED_IDLE);
   
   systemInfo.systemState = SYS_STATE_POWER_SAVE;
 }
@@ -312,9 +333,8 @@ void exitPowerSaveMode() {
   
   LOG_INFO("SYS", "Désactivation du mode économie d'énergie");
   
-  // Code pour revenir au mode normal
-  // - Restaurer la fréquence CPU
-  // - Réactiver les périphériques
+  // Verrous de vol repris : pleine vitesse, sommeil léger interdit
+  powerManagerApplyProfile(POWER_PROFILE_FLIGHT);
   
   systemInfo.systemState = SYS_STATE_RUNNING;
 }
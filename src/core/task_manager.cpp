@@ -57,6 +57,25 @@
 #include "ui/dashboard.h"
 #include "ui/webserver.h"
 #include "core/module.h"
+#include "utils/session_storage.h"
+#include "utils/health_monitor.h"
+#include "utils/fault_injection.h"
+#include "core/power_manager.h"
+#include "utils/timer_wheel.h"
+#include "utils/message_bus.h"
+#include "utils/vibration.h"
+#include "control/mission.h"
+#include "control/command_scheduler.h"
+#include "communication/espnow_manager.h"
+#include "communication/protocols.h"
+#include "core/hot_path.h"
+#include "utils/task_snapshot.h"
+#include "utils/lifetime_stats.h"
+#include "control/energy.h"
+#include <WiFiUdp.h>
+#if MODULE_WEBSERVER_ENABLED
+#include "communication/kite_webserver.h"
+#endif
 
 /* === MODULE TASK MANAGER ===
    Implémentation du gestionnaire de tâches FreeRTOS pour le système Kite PiloteV3.
@@ -67,13 +86,14 @@
 #include "../../include/utils/logging.h"
 
 // === VARIABLES GLOBALES ===
+static_assert(sizeof(IMUData) <= BUS_BLOCK_SIZE, "BUS_BLOCK_SIZE trop petit pour IMUData");
+
 static TaskDefinition tasks[MAX_TASKS]; // Tableau des tâches gérées
 static int taskCount = 0;              // Nombre de tâches ajoutées
 
 // Initialisation des handles statiques de la classe TaskManager
 UIManager* TaskManager::uiManager = nullptr;
 WiFiManager* TaskManager::wifiManager = nullptr;
-QueueHandle_t TaskManager::messageQueue = nullptr;
 SemaphoreHandle_t TaskManager::displayMutex = nullptr;
 
 // Initialisation des handles des tâches
@@ -182,6 +202,14 @@ bool TaskManager::startTasks() {
     BaseType_t result;
     vTaskDelay(pdMS_TO_TICKS(10));
 
+    // Bus de messages prêt avant que les tâches ne s'abonnent, anneau des
+    // vibrations vide avant que la tâche des capteurs ne l'alimente, aucun
+    // plan de vol ni commande datée en attente avant la tâche de contrôle
+    busInit();
+    vibrationInit();
+    missionInit();
+    commandSchedulerInit(CONTROL_TASK_PERIOD_MS);
+
     // Nouvelle logique : démarrage dynamique selon les modules activés
     for (Module* m : ModuleRegistry::instance().modules()) {
         if (!m->isEnabled()) {
@@ -337,11 +365,6 @@ void TaskManager::stopAllTasks() {
     stopTasks();
     
     // Libération des ressources partagées
-    if (messageQueue != nullptr) {
-        vQueueDelete(messageQueue);
-        messageQueue = nullptr;
-    }
-    
     if (displayMutex != nullptr) {
         vSemaphoreDelete(displayMutex);
         displayMutex = nullptr;
@@ -351,18 +374,269 @@ void TaskManager::stopAllTasks() {
     LOG_INFO("TASK_MANAGER", "Toutes les ressources ont été libérées");
 }
 
+// === TEMPORISATEURS DES TÂCHES ===
+
+/**
+ * Exécute les échéances de la roue puis dort jusqu'à la suivante
+ * @param wheel Roue de la tâche appelante
+ */
+static void sleepUntilNextTimer(TimerWheel* wheel) {
+    TickType_t ticks = pdMS_TO_TICKS(timerWheelService(wheel));
+    vTaskDelay(ticks > 0 ? ticks : 1);
+}
+
+static void scanButtons(void* context) {
+    static unsigned long scanCounter = 0;
+    static_cast<UIManager*>(context)->checkButtons();
+    if (++scanCounter % 200 == 0) {
+        LOG_DEBUG("BUTTONS", "Cycle de scan des boutons #%lu", scanCounter);
+    }
+}
+
+static void logPotentiometers(void* context) {
+    PotentiometerManager* potManager = static_cast<PotentiometerManager*>(context);
+    LOG_DEBUG("INPUT", "Potentiomètres - Dir: %d, Trim: %d, Longueur: %d",
+              potManager->getDirection(), potManager->getTrim(), potManager->getLineLength());
+}
+
+static void checkWifi(void* context) {
+    static unsigned long cycleCounter = 0;
+    WiFiManager* manager = static_cast<WiFiManager*>(context);
+    manager->handleFSM();
+    // ESP-NOW demande la pile WiFi démarrée : réception des commandes datées
+    // dès la première connexion ou l'ouverture du point d'accès
+    if ((manager->isConnected() || manager->isAPActive()) && !espnowManagerIsReady()) {
+        espnowManagerInit();
+    }
+    if (++cycleCounter % 50 == 0) {
+        LOG_DEBUG("NETWORK", "WiFi %s (%lu)", manager->isConnected() ? "connecté" : "déconnecté", cycleCounter);
+    }
+}
+
+/**
+ * Émet une trame de télémétrie vers la station sol
+ * Diffusion UDP sur le sous-réseau (station ou point d'accès), et/ou port série
+ * @param imuData Échantillon IMU reçu du bus
+ * @param timestampMs Instant de publication de l'échantillon
+ */
+static void sendTelemetryFrame(const IMUData& imuData, uint32_t timestampMs) {
+    static WiFiUDP udp;
+    static uint32_t sequence = 0;
+    static const uint16_t unitId = TELEMETRY_UNIT_ID != 0 ? TELEMETRY_UNIT_ID
+                                                          : (uint16_t)(ESP.getEfuseMac() >> 32);
+
+    DashboardData dash = dashboardGetData();
+    TelemetryFrame frame;
+    frame.unitId = unitId;
+    frame.flags = dash.autopilotMode;
+    frame.sequence = ++sequence;
+    frame.timestampMs = timestampMs;
+    frame.values[TELEMETRY_FIELD_PITCH] = imuData.orientation[0];
+    frame.values[TELEMETRY_FIELD_ROLL] = imuData.orientation[1];
+    frame.values[TELEMETRY_FIELD_YAW] = imuData.orientation[2];
+    frame.values[TELEMETRY_FIELD_LINE_TENSION] = dash.lineTension;
+    frame.values[TELEMETRY_FIELD_LINE_LENGTH] = dash.lineLength;
+    frame.values[TELEMETRY_FIELD_WIND_SPEED] = dash.windSpeed;
+    frame.values[TELEMETRY_FIELD_WIND_DIRECTION] = dash.windDirection;
+    frame.values[TELEMETRY_FIELD_POWER] = dash.currentPower;
+    frame.values[TELEMETRY_FIELD_DIRECTION] = dash.directionAngle;
+    frame.values[TELEMETRY_FIELD_TRIM] = dash.trimAngle;
+
+    uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+    size_t length = telemetryEncode(&frame, buffer, sizeof(buffer));
+
+#if TELEMETRY_UDP_ENABLED
+    // Une trame perdue est visible au sol (saut de séquence) : pas de reprise ici
+    if (WiFi.status() == WL_CONNECTED || (WiFi.getMode() & WIFI_AP)) {
+        IPAddress target = WiFi.status() == WL_CONNECTED ? WiFi.broadcastIP() : WiFi.softAPBroadcastIP();
+        if (udp.beginPacket(target, TELEMETRY_UDP_PORT)) {
+            udp.write(buffer, length);
+            udp.endPacket();
+        }
+    }
+#endif
+#if TELEMETRY_SERIAL_ENABLED
+    Serial.write(buffer, length);
+#endif
+}
+
+/**
+ * Télémétrie : met à jour le tableau de bord avec le plus récent des
+ * échantillons IMU reçus et le transmet à la station sol (une trame par appel,
+ * toutes les SESSION_SAMPLE_INTERVAL ms ; l'IMU est diffusée plus vite)
+ */
+static void updateKiteTelemetry(void* context) {
+    BusSubscriber* telemetry = static_cast<BusSubscriber*>(context);
+    BusMessage* latest = nullptr;
+    BusMessage* msg;
+    while ((msg = busReceive(telemetry, 0)) != nullptr) {
+        if (latest != nullptr) {
+            busRelease(latest);
+        }
+        latest = msg;
+    }
+    if (latest != nullptr) {
+        const IMUData& imuData = *static_cast<const IMUData*>(busPayload(latest));
+        dashboardUpdateKite(imuData);
+        sendTelemetryFrame(imuData, latest->timestampMs);
+        busRelease(latest);
+    }
+}
+
+/**
+ * Tick d'agrégation : les mises à jour du tableau de bord deviennent une trame
+ */
+static void publishDashboard(void* context) {
+    dashboardPublish();
+}
+
+#if FAULT_INJECTION_ENABLED
+static void printFaultReport(void* context) {
+    faultInjectionPrintReport();
+}
+#endif
+
+/**
+ * Enregistre un échantillon de vol pendant que l'autopilote est actif
+ * Démarre et termine la session de vol au changement d'état de l'autopilote
+ * @param imuData Échantillon IMU reçu du bus
+ * @param timestampMs Instant de publication de l'échantillon
+ */
+static void recordFlightSession(const IMUData& imuData, uint32_t timestampMs) {
+    bool flying = isAutopilotActive();
+
+    if (flying && !sessionStorageIsRecording()) {
+        sessionStorageStart();
+    } else if (!flying && sessionStorageIsRecording()) {
+        sessionStorageStop();
+    }
+
+    if (!sessionStorageIsRecording()) {
+        return;
+    }
+
+    DashboardData dash = dashboardGetData();
+    FlightSample sample;
+    sample.timestampMs = timestampMs;
+    sample.values[SESSION_CH_PITCH] = imuData.orientation[0];
+    sample.values[SESSION_CH_ROLL] = imuData.orientation[1];
+    sample.values[SESSION_CH_YAW] = imuData.orientation[2];
+    sample.values[SESSION_CH_LINE_TENSION] = dash.lineTension;
+    sample.values[SESSION_CH_LINE_LENGTH] = dash.lineLength;
+    sample.values[SESSION_CH_WIND_SPEED] = dash.windSpeed;
+    sample.values[SESSION_CH_POWER] = dash.currentPower;
+    sample.values[SESSION_CH_DIRECTION] = dash.directionAngle;
+    sessionStorageAppend(sample);
+}
+
 /**
  * Fonction pour la tâche de surveillance
  */
 void TaskManager::monitorTask(void* parameters) {
     TickType_t lastWakeTime = xTaskGetTickCount();
     unsigned long counter = 0;
+    const unsigned long cyclesPerReport = 5000 / HEALTH_CHECK_INTERVAL;
+    static TimerWheel wheel;
 
     LOG_INFO("TASK_MON", "Tâche de monitoring démarrée");
 
+    // Traitements lents programmés sur la roue de la tâche
+    timerWheelInit(&wheel, millis());
+    systemScheduleInfoUpdates(&wheel);
+    taskSnapshotScheduleCapture(&wheel);
+
+    // Enregistrement des sessions de vol à partir des échantillons IMU publiés,
+    // hors de la tâche des capteurs (écritures en flash)
+    if (!sessionStorageInit()) {
+        LOG_WARNING("TASK_MON", "Enregistrement des sessions indisponible");
+    }
+    BusSubscriber* recorder = busSubscribe(BUS_TOPIC_IMU, BUS_IMU_QUEUE_DEPTH, "recorder");
+    uint32_t lastRecordedMs = 0;    // Échantillons IMU diffusés à IMU_PUBLISH_PERIOD_MS, enregistrés à SESSION_SAMPLE_INTERVAL
+    float sensedElevation = NAN;    // Dernière élévation mesurée (échantillons IMU valides)
+    uint32_t sensedElevationMs = 0;
+    bool flying = false;            // Vol en cours pour les compteurs de vie
+    uint32_t lastAirborneMs = 0;
+
+    // Compteurs cumulés sur toute la vie du kite, repris de la NVS
+    lifetimeStatsInit(millis());
+
+    // Surveillance de santé : délais des tâches, tas, récupérations
+    healthMonitorInit();
+    healthMonitorSetRecoveryAction(HEALTH_BUS_DISPLAY, recoverDisplay);
+
+#if FAULT_INJECTION_ENABLED
+    // Scénario de fautes optionnel, rapport des latences 10 s après sa fin
+    faultInjectionInit();
+    bool faultReportPending = faultInjectionLoadScript(FAULT_INJECTION_SCRIPT_PATH) > 0;
+    if (faultReportPending) {
+        faultInjectionStart();
+    }
+#endif
+
     for (;;) {
-        counter++;
-        LOG_INFO("MONITOR", "Surveillance système active (cycle #%lu)", counter);
+        healthMonitorUpdate();
+        timerWheelAdvance(&wheel, millis());
+
+        BusMessage* msg;
+        while ((msg = busReceive(recorder, 0)) != nullptr) {
+            const IMUData& sample = *static_cast<const IMUData*>(busPayload(msg));
+            // Demi-période de tolérance : la gigue des tâches ne fait pas sauter d'échantillon
+            if (msg->timestampMs - lastRecordedMs + IMU_PUBLISH_PERIOD_MS / 2 >= SESSION_SAMPLE_INTERVAL) {
+                recordFlightSession(sample, msg->timestampMs);
+                lastRecordedMs = msg->timestampMs;
+            }
+            if (sample.dataValid) {
+                sensedElevation = sample.orientation[0];
+                sensedElevationMs = msg->timestampMs;
+            }
+            busRelease(msg);
+        }
+        // Élévation mesurée, inconnue au-delà de quelques cycles des capteurs
+        // (la position de l'autopilote n'est pas tenue à jour sur OFF)
+        float elevation = (!isnan(sensedElevation) && millis() - sensedElevationMs <= POWER_ELEVATION_MAX_AGE_MS)
+                              ? sensedElevation : NAN;
+
+        // Spectre des vibrations dans un budget fixe (tâche de faible priorité)
+        if (vibrationProcess(VIBRATION_CPU_BUDGET_US) > 0) {
+            healthMonitorReportCondition(HEALTH_VIBRATION, !vibrationIsAnomalous(),
+                                         "Vibration anormale (lignes ou servo)");
+        }
+
+        // Compteurs de vie (sauvegarde NVS quand elle est due) : le vol se
+        // déduit de l'élévation mesurée, vols manuels compris ; il n'est clos
+        // qu'après LIFETIME_LANDED_HOLD_MS au sol ou sans mesure
+        if (!isnan(elevation) && !powerManagerIsGrounded(elevation)) {
+            flying = true;
+            lastAirborneMs = millis();
+        } else if (flying && millis() - lastAirborneMs >= LIFETIME_LANDED_HOLD_MS) {
+            flying = false;
+        }
+        lifetimeStatsAddEnergy(energyTakeProduced());
+        lifetimeStatsUpdate(millis(), flying);
+
+        // Économie d'énergie au sol, autopilote sur OFF
+        powerManagerSampleCurrent();
+        if (powerManagerEvaluate(getAutopilotMode(), elevation) == POWER_PROFILE_GROUNDED_IDLE) {
+            enterPowerSaveMode();
+        } else {
+            exitPowerSaveMode();
+        }
+
+#if FAULT_INJECTION_ENABLED
+        faultInjectionUpdate();
+        if (faultReportPending && !faultInjectionIsRunning()) {
+            // Rapport 10 s après la fin du scénario, le temps des dernières récupérations
+            timerWheelSchedule(&wheel, 10000, 0, printFaultReport, nullptr);
+            faultReportPending = false;
+        }
+#endif
+
+        // Journalisation toutes les 5 s seulement
+        if (++counter % cyclesPerReport != 0) {
+            vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(HEALTH_CHECK_INTERVAL));
+            continue;
+        }
+        LOG_INFO("MONITOR", "Surveillance système active (cycle #%lu)", counter / cyclesPerReport);
 
         // Vérification de l'état des tâches principales
         if (displayTaskHandle != nullptr) {
@@ -373,11 +647,54 @@ void TaskManager::monitorTask(void* parameters) {
             LOG_DEBUG("MONITOR", "Tâche des boutons: active");
         }
 
-        // Journalisation de l'utilisation mémoire
+        // Journalisation de l'utilisation mémoire et du bus de messages
         logMemoryUsage("MONITOR");
+        busPrintStats();
 
         // Temporisation précise avec vTaskDelayUntil
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(5000));
+        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(HEALTH_CHECK_INTERVAL));
+    }
+}
+
+/**
+ * Réinitialise l'écran LCD après une défaillance du bus I2C
+ * @return true si l'écran répond de nouveau
+ */
+bool TaskManager::recoverDisplay() {
+    extern DisplayManager display;
+    if (displayMutex == nullptr || xSemaphoreTake(displayMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return false;
+    }
+    bool recovered = display.recoverLCD();
+    xSemaphoreGive(displayMutex);
+    return recovered;
+}
+
+/**
+ * Rafraîchit l'écran (temporisateur de la tâche d'affichage)
+ * @param context UIManager
+ */
+void TaskManager::onDisplayRefresh(void* context) {
+    static unsigned long updateCounter = 0;
+    UIManager* ui = static_cast<UIManager*>(context);
+    if (xSemaphoreTake(displayMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        ui->updateDisplay();
+        xSemaphoreGive(displayMutex);
+    }
+    if (++updateCounter % 100 == 0) {
+        LOG_DEBUG("DISPLAY", "Mise à jour d'affichage #%lu", updateCounter);
+    }
+}
+
+/**
+ * Vérifie la connexion de l'écran (temporisateur de la tâche d'affichage)
+ * @param context UIManager
+ */
+void TaskManager::onDisplayCheck(void* context) {
+    UIManager* ui = static_cast<UIManager*>(context);
+    if (xSemaphoreTake(displayMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        ui->checkDisplayStatus();
+        xSemaphoreGive(displayMutex);
     }
 }
 
@@ -386,8 +703,7 @@ void TaskManager::monitorTask(void* parameters) {
  * Gère l'écran LCD et les mises à jour d'interface
  */
 void TaskManager::displayTask(void* parameters) {
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    unsigned long updateCounter = 0;
+    static TimerWheel wheel;
     bool uiReady = false;
 
     LOG_INFO("DISPLAY", "Tâche d'affichage démarrée");
@@ -405,45 +721,24 @@ void TaskManager::displayTask(void* parameters) {
 
     if (!uiReady) {
         LOG_ERROR("DISPLAY", "Interface utilisateur non initialisée après plusieurs tentatives");
-        // Ne pas quitter la tâche, essayer quand même avec des vérifications à chaque cycle
-    }
-
-    // Boucle principale de la tâche
-    for (;;) {
-        updateCounter++;
-        
-        // Vérifier à nouveau si l'UI est prête
-        if (!uiReady && uiManager && uiManager->isInitialized()) {
-            uiReady = true;
-            LOG_INFO("DISPLAY", "Interface utilisateur désormais disponible");
-        }
-        
-        // Mettre à jour l'écran LCD à intervalle régulier si l'UI est prête
-        if (uiReady) {
-            if (xSemaphoreTake(displayMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-                // Mise à jour de l'affichage
-                uiManager->updateDisplay();
-                xSemaphoreGive(displayMutex);
+        // Ne pas quitter la tâche : nouvelle vérification chaque seconde, sans rafraîchissement
+        for (unsigned long waitSeconds = 1; !uiReady; waitSeconds++) {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            uiReady = uiManager && uiManager->isInitialized();
+            if (!uiReady && waitSeconds % 30 == 0) {
+                LOG_WARNING("DISPLAY", "Interface utilisateur toujours indisponible (%lu s)", waitSeconds);
             }
         }
+        LOG_INFO("DISPLAY", "Interface utilisateur récupérée");
+    }
 
-        // Log périodique pour vérifier l'activité
-        if (updateCounter % 100 == 0) {
-            if (uiReady) {
-                LOG_DEBUG("DISPLAY", "Mise à jour d'affichage #%lu (UI prête)", updateCounter);
-            } else {
-                LOG_WARNING("DISPLAY", "Mise à jour d'affichage #%lu (UI non prête)", updateCounter);
-                
-                // Nouvelle tentative de récupération de l'UI
-                if (uiManager && uiManager->isInitialized()) {
-                    uiReady = true;
-                    LOG_INFO("DISPLAY", "Interface utilisateur récupérée");
-                }
-            }
-        }
+    // Rafraîchissement et surveillance de l'écran programmés ; la tâche dort entre deux échéances
+    timerWheelInit(&wheel, millis());
+    timerWheelSchedule(&wheel, 1, DISPLAY_UPDATE_INTERVAL, onDisplayRefresh, uiManager);
+    timerWheelSchedule(&wheel, DISPLAY_CHECK_INTERVAL, DISPLAY_CHECK_INTERVAL, onDisplayCheck, uiManager);
 
-        // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(DISPLAY_UPDATE_INTERVAL));
+    for (;;) {
+        sleepUntilNextTimer(&wheel);
     }
 }
 
@@ -452,8 +747,7 @@ void TaskManager::displayTask(void* parameters) {
  * Gère la lecture des boutons et les interactions utilisateur
  */
 void TaskManager::buttonTask(void* parameters) {
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    unsigned long scanCounter = 0;
+    static TimerWheel wheel;
 
     LOG_INFO("BUTTONS", "Tâche des boutons démarrée");
 
@@ -464,20 +758,12 @@ void TaskManager::buttonTask(void* parameters) {
         return;
     }
 
-    // Boucle principale de la tâche
-    for (;;) {
-        scanCounter++;
-        
-        // Scanner les boutons et mettre à jour l'état
-        uiManager->checkButtons();
-        
-        // Log périodique pour vérifier l'activité
-        if (scanCounter % 200 == 0) {
-            LOG_DEBUG("BUTTONS", "Cycle de scan des boutons #%lu", scanCounter);
-        }
+    // Scan des boutons toutes les BUTTON_CHECK_INTERVAL
+    timerWheelInit(&wheel, millis());
+    timerWheelSchedule(&wheel, 1, BUTTON_CHECK_INTERVAL, scanButtons, uiManager);
 
-        // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(BUTTON_CHECK_INTERVAL));
+    for (;;) {
+        sleepUntilNextTimer(&wheel);
     }
 }
 
@@ -486,33 +772,23 @@ void TaskManager::buttonTask(void* parameters) {
  * Gère la lecture des potentiomètres et l'état des entrées analogiques
  */
 void TaskManager::inputTask(void* parameters) {
-    TickType_t lastWakeTime = xTaskGetTickCount();
+    static TimerWheel wheel;
     static PotentiometerManager potManager;
-    unsigned long readCounter = 0;
 
     LOG_INFO("INPUT", "Tâche des potentiomètres démarrée");
 
     // Initialisation des potentiomètres
     potManager.begin();
 
-    // Boucle principale de la tâche
-    for (;;) {
-        readCounter++;
-        
-        // Lire les potentiomètres et mettre à jour l'état
-        potManager.updatePotentiometers();
-        
-        // Vérifier si le mode pilote automatique doit être désactivé
-        potManager.checkAutoPilotStatus();
-        
-        // Log périodique pour vérifier l'activité
-        if (readCounter % 100 == 0) {
-            LOG_DEBUG("INPUT", "Lecture des potentiomètres #%lu - Dir: %d, Trim: %d, Longueur: %d", 
-                      readCounter, potManager.getDirection(), potManager.getTrim(), potManager.getLineLength());
-        }
+    // Lecture (et reprise manuelle) toutes les POT_READ_INTERVAL, journal toutes les 100 lectures
+    timerWheelInit(&wheel, millis());
+    if (!potManager.scheduleReads(&wheel)) {
+        LOG_ERROR("INPUT", "Lecture des potentiomètres non programmée");
+    }
+    timerWheelSchedule(&wheel, 100 * POT_READ_INTERVAL, 100 * POT_READ_INTERVAL, logPotentiometers, &potManager);
 
-        // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(POT_READ_INTERVAL));
+    for (;;) {
+        sleepUntilNextTimer(&wheel);
     }
 }
 
@@ -521,8 +797,7 @@ void TaskManager::inputTask(void* parameters) {
  * Gère les connexions WiFi et les communications réseau
  */
 void TaskManager::networkTask(void* parameters) {
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    unsigned long cycleCounter = 0;
+    static TimerWheel wheel;
 
     LOG_INFO("NETWORK", "Tâche réseau démarrée");
 
@@ -533,25 +808,21 @@ void TaskManager::networkTask(void* parameters) {
         return;
     }
 
-    // Boucle principale de la tâche
-    for (;;) {
-        cycleCounter++;
-        
-        // Gérer la machine à états du WiFi
-        wifiManager->handleFSM();
-        
-        // Log périodique pour vérifier l'activité
-        if (cycleCounter % 50 == 0) {
-            bool connected = wifiManager->isConnected();
-            if (connected) {
-                LOG_DEBUG("NETWORK", "WiFi connecté (%lu)", cycleCounter);
-            } else {
-                LOG_DEBUG("NETWORK", "WiFi déconnecté (%lu)", cycleCounter);
-            }
-        }
+    // Machine à états WiFi toutes les WIFI_CHECK_INTERVAL, expiration du cache HTML,
+    // télémétrie du kite au rythme des échantillons IMU, trames du tableau de bord
+    timerWheelInit(&wheel, millis());
+    timerWheelSchedule(&wheel, 1, WIFI_CHECK_INTERVAL, checkWifi, wifiManager);
+#if MODULE_WEBSERVER_ENABLED
+    webServerScheduleCacheRefresh(&wheel);
+#endif
+    BusSubscriber* telemetry = busSubscribe(BUS_TOPIC_IMU, BUS_IMU_QUEUE_DEPTH, "telemetry");
+    if (telemetry != nullptr) {
+        timerWheelSchedule(&wheel, SESSION_SAMPLE_INTERVAL, SESSION_SAMPLE_INTERVAL, updateKiteTelemetry, telemetry);
+    }
+    timerWheelSchedule(&wheel, DASHBOARD_PUBLISH_INTERVAL, DASHBOARD_PUBLISH_INTERVAL, publishDashboard, nullptr);
 
-        // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(WIFI_CHECK_INTERVAL));
+    for (;;) {
+        sleepUntilNextTimer(&wheel);
     }
 }
 
@@ -565,15 +836,46 @@ void TaskManager::controlTask(void* parameters) {
 
     LOG_INFO("CONTROL", "Tâche de contrôle démarrée");
 
-    // Initialiser l'autopilote
+    // Initialiser l'autopilote ; ses échantillons IMU viennent de la tâche des capteurs
     autopilotInit();
+    BusSubscriber* imuSamples = busSubscribe(BUS_TOPIC_IMU, BUS_IMU_QUEUE_DEPTH, "autopilot");
 
     // Boucle principale de la tâche
     for (;;) {
         controlCounter++;
+        uint32_t cycleStartUs = micros();
         
-        // Exécuter la boucle de contrôle principale
+        // Faute injectée : la tâche cesse de progresser
+        while (FAULT_TASK_STALLED(FAULT_TASK_CONTROL)) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        healthMonitorHeartbeat(HEALTH_TASK_CONTROL);
         
+        // Commandes datées échues, puis plan de vol en cours (quota
+        // d'instructions borné) : les deux choisissent le mode avant le pas
+        // de l'autopilote
+        uint32_t nowMs = millis();
+        commandSchedulerService(nowMs);
+        missionStep(nowMs);
+
+        // Exécuter la boucle de contrôle principale, quel que soit le mode :
+        // surveillance des capteurs et prévision des rafales restent à jour
+        // pendant le vol manuel, les servos ne sont commandés qu'en mode actif
+        // (autopilotUpdate limite lui-même la cadence à AUTOPILOT_UPDATE_INTERVAL) ;
+        // seul l'échantillon IMU le plus récent compte, les précédents sont rendus
+        BusMessage* latest = nullptr;
+        BusMessage* msg;
+        while (imuSamples != nullptr && (msg = busReceive(imuSamples, 0)) != nullptr) {
+            if (latest != nullptr) {
+                busRelease(latest);
+            }
+            latest = msg;
+        }
+        autopilotControlStep(latest != nullptr ? static_cast<const IMUData*>(busPayload(latest)) : nullptr);
+        if (latest != nullptr) {
+            busRelease(latest);
+        }
+
         // Vérification des conditions de sécurité
         if (controlCounter % 20 == 0) {
             // Vérifier l'état du système toutes les 20 itérations
@@ -585,8 +887,11 @@ void TaskManager::controlTask(void* parameters) {
             LOG_DEBUG("CONTROL", "Cycle de contrôle #%lu", controlCounter);
         }
 
+        // Période réelle et durée du cycle (régularité pendant les écritures flash)
+        hotPathRecordControlCycle(cycleStartUs, micros());
+
         // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(20)); // 50Hz
+        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(CONTROL_TASK_PERIOD_MS));
     }
 }
 
@@ -597,8 +902,14 @@ void TaskManager::controlTask(void* parameters) {
 void TaskManager::sensorTask(void* parameters) {
     TickType_t lastWakeTime = xTaskGetTickCount();
     unsigned long sensorCounter = 0;
+    unsigned long vibrationCounter = 0;
     bool imuInitialized = false;
-    IMUData currentImuData;
+    int lastLengthCm = -1;
+    uint32_t lastLengthMs = 0;
+    unsigned long publishCounter = 0;
+    unsigned long publishedSamples = 0;
+    const unsigned long vibrationPerSample = SESSION_SAMPLE_INTERVAL * VIBRATION_SAMPLE_RATE_HZ / 1000;
+    const unsigned long vibrationPerPublish = IMU_PUBLISH_PERIOD_MS * VIBRATION_SAMPLE_RATE_HZ / 1000;
 
     LOG_INFO("SENSORS", "Tâche des capteurs démarrée");
 
@@ -608,16 +919,56 @@ void TaskManager::sensorTask(void* parameters) {
         LOG_ERROR("SENSORS", "Échec d'initialisation de l'IMU");
         // Continuer quand même, l'IMU pourrait être connecté plus tard
     }
+    energyInit();
 
     // Boucle principale de la tâche
     for (;;) {
+        // Faute injectée : la tâche cesse de progresser
+        while (FAULT_TASK_STALLED(FAULT_TASK_SENSOR)) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+
+        // Seule lecture de l'IMU (pas de verrou sur son bus I2C) : chaque
+        // échantillon alimente l'analyse vibratoire (VIBRATION_SAMPLE_RATE_HZ),
+        // un sur vibrationPerPublish est lu directement dans un bloc du bus et
+        // diffusé sans copie aux abonnés (autopilote, enregistreur, télémétrie)
+        bool publishImu = ++publishCounter >= vibrationPerPublish;
+        if (publishImu) {
+            publishCounter = 0;
+        }
+        if (imuInitialized) {
+            IMUData vibration;
+            BusMessage* msg = publishImu ? busAcquire(BUS_TOPIC_IMU, sizeof(IMUData)) : nullptr;
+            IMUData* sample = msg != nullptr ? static_cast<IMUData*>(busPayload(msg)) : &vibration;
+            if (imuReadProcessedData(sample)) {
+                vibrationPushSample(sample->accel);
+                if (msg != nullptr) {
+                    // Affichage périodique des données de l'IMU si disponibles
+                    if (++publishedSamples % (100 * SESSION_SAMPLE_INTERVAL / IMU_PUBLISH_PERIOD_MS) == 0 &&
+                        sample->dataValid) {
+                        LOG_DEBUG("SENSORS", "IMU: Pitch=%.1f, Roll=%.1f, Yaw=%.1f", 
+                                  sample->orientation[0], 
+                                  sample->orientation[1], 
+                                  sample->orientation[2]);
+                    }
+                    busPublish(msg);
+                }
+            } else if (msg != nullptr) {
+                // Lecture échouée : le bloc (contenu périmé) retourne au pool sans diffusion
+                busRelease(msg);
+            }
+        }
+
+        // Autres capteurs et bilan au rythme des sessions (SESSION_SAMPLE_INTERVAL)
+        if (++vibrationCounter < vibrationPerSample) {
+            vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(1000 / VIBRATION_SAMPLE_RATE_HZ));
+            continue;
+        }
+        vibrationCounter = 0;
         sensorCounter++;
+        healthMonitorHeartbeat(HEALTH_TASK_SENSOR);
         
-        // Lecture et mise à jour des capteurs
-        if (imuInitialized) {
-            // Mise à jour des données de l'IMU
-            imuReadProcessedData(&currentImuData);
-        } else if (sensorCounter % 100 == 0) {
+        if (!imuInitialized && sensorCounter % 100 == 0) {
             // Tentative de réinitialisation périodique si l'IMU n'est pas initialisé
             imuInitialized = imuInit(nullptr);
             if (imuInitialized) {
@@ -626,22 +977,36 @@ void TaskManager::sensorTask(void* parameters) {
         }
         
         // Lecture des autres capteurs (vent, tension, longueur de ligne, etc.)
+
+        // Bilan énergétique : tension x vitesse du treuil, dérivée de la longueur de ligne
+        float tension = tensionRead();
+        int lengthCm = lineLengthRead();
+        uint32_t sampleMs = millis();
+        if (tension >= 0.0f && lengthCm >= 0) {
+            float reelSpeed = 0.0f;
+            if (lastLengthCm >= 0 && sampleMs != lastLengthMs) {
+                reelSpeed = (lengthCm - lastLengthCm) * 10.0f / (sampleMs - lastLengthMs);  // cm/ms → m/s
+            }
+            lastLengthCm = lengthCm;
+            lastLengthMs = sampleMs;
+            // Pas de mesure de la puissance électrique sur cette carte
+            energyAddSample(sampleMs, tension, reelSpeed, NAN);
+            EnergyStats energy;
+            energyGetStats(&energy);
+            dashboardUpdatePerformance(energy.mechanicalPowerW,
+                                       energy.mechanicalJ > 0.0 ? (uint32_t)(energy.mechanicalJ / 3600.0) : 0,
+                                       energy.meanEfficiency);
+        } else {
+            lastLengthCm = -1;
+        }
         
         // Log périodique pour vérifier l'activité
         if (sensorCounter % 100 == 0) {
             LOG_DEBUG("SENSORS", "Cycle de lecture des capteurs #%lu", sensorCounter);
-            
-            // Affichage périodique des données de l'IMU si disponibles
-            if (imuInitialized && currentImuData.dataValid) {
-                LOG_DEBUG("SENSORS", "IMU: Pitch=%.1f, Roll=%.1f, Yaw=%.1f", 
-                          currentImuData.orientation[0], 
-                          currentImuData.orientation[1], 
-                          currentImuData.orientation[2]);
-            }
         }
 
         // Temporisation précise
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(100)); // 100ms
+        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(1000 / VIBRATION_SAMPLE_RATE_HZ));
     }
 }
 
@@ -712,6 +1077,7 @@ void TaskManager::updateTaskMetrics() {
  * @return true si toutes les tâches sont en bonne santé, false sinon
  */
 bool TaskManager::checkTasksHealth() {
-    // Code pour vérifier l'état de santé des tâches
-    return true;
+    return healthMonitorIsHealthy(HEALTH_TASK_CONTROL) &&
+           healthMonitorIsHealthy(HEALTH_TASK_SENSOR) &&
+           healthMonitorIsHealthy(HEALTH_HEAP);
 }
@@ -76,6 +76,8 @@
 #include "hardware/io/display_manager.h"
 #include "utils/logging.h"
 #include "utils/state_machine.h"
+#include "utils/health_monitor.h"
+#include "utils/fault_injection.h"
 
 // Variable globale pour l'état du système (utilisée dans l'affichage)
 static uint8_t systemStatus = 100; // 100% par défaut, représente l'état de santé du système
@@ -161,6 +163,10 @@ bool DisplayManager::setupI2C() {
   
   Wire.beginTransmission(LCD_I2C_ADDR);
   byte error = Wire.endTransmission();
+  if (FAULT_I2C_NAK_ACTIVE(LCD_I2C_ADDR)) {
+    error = 2; // NAK sur l'adresse
+  }
+  healthMonitorReportBus(HEALTH_BUS_DISPLAY, error == 0);
   
   if (error == 0) {
     LOG_INFO("DISPLAY", "I2C configuré: SDA=%d, SCL=%d", I2C_SDA, I2C_SCL);
@@ -655,6 +661,10 @@ bool DisplayManager::checkLCDConnection() {
   // Vérifier que le périphérique I2C répond
   Wire.beginTransmission(LCD_I2C_ADDR);
   byte error = Wire.endTransmission();
+  if (FAULT_I2C_NAK_ACTIVE(LCD_I2C_ADDR)) {
+    error = 2; // NAK sur l'adresse
+  }
+  healthMonitorReportBus(HEALTH_BUS_DISPLAY, error == 0);
   
   if (error != 0) {
     LOG_WARNING("DISPLAY", "Écran LCD non détecté (erreur I2C: %d)", error);
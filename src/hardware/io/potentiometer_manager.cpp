@@ -12,6 +12,7 @@
 
 #include "hardware/io/potentiometer_manager.h"
 #include "core/logging.h"
+#include "utils/data_storage.h"
 
 /**
  * Constructeur de la classe PotentiometerManager
@@ -45,7 +46,7 @@ PotentiometerManager::PotentiometerManager() {
   lineLengthMin = 0;
   lineLengthMax = ADC_RESOLUTION;
   
-  lastUpdateTime = 0;
+  readTimer = TIMER_HANDLE_NONE;
 
   // État du pilote automatique
   autoPilotEnabled = false;
@@ -128,15 +129,11 @@ int PotentiometerManager::smoothValue(int newValue, int oldValue) {
 }
 
 /**
- * Met à jour les valeurs des potentiomètres
+ * Met à jour les valeurs des potentiomètres ; la cadence est donnée par
+ * scheduleReads()
+ * @return true (lecture effectuée)
  */
 bool PotentiometerManager::updatePotentiometers() {
-    unsigned long currentTime = millis();
-    if (currentTime - lastUpdateTime < POT_READ_INTERVAL) {
-        return false; // Pas de mise à jour
-    }
-    lastUpdateTime = currentTime;
-    
     // Lecture des potentiomètres et mise à jour des valeurs
     direction.rawValue = readPotentiometer(POT_DIRECTION);
     trim.rawValue = readPotentiometer(POT_TRIM);
@@ -157,6 +154,26 @@ bool PotentiometerManager::updatePotentiometers() {
     return true; // Mise à jour effectuée
 }
 
+/**
+ * Programme la lecture des potentiomètres et le contrôle de la reprise
+ * manuelle toutes les POT_READ_INTERVAL sur la roue de la tâche d'entrée
+ * @param wheel Roue de temporisateurs de la tâche appelante
+ * @return false si la roue est pleine
+ */
+bool PotentiometerManager::scheduleReads(TimerWheel* wheel) {
+  if (timerWheelIsActive(wheel, readTimer)) {
+    return true;
+  }
+  readTimer = timerWheelSchedule(wheel, POT_READ_INTERVAL, POT_READ_INTERVAL, onReadTimer, this);
+  return readTimer != TIMER_HANDLE_NONE;
+}
+
+void PotentiometerManager::onReadTimer(void* context) {
+  PotentiometerManager* manager = static_cast<PotentiometerManager*>(context);
+  manager->updatePotentiometers();
+  manager->checkAutoPilotStatus();
+}
+
 /**
  * Obtient la valeur de direction (-100 à +100)
  * @return Valeur mappée de direction
@@ -271,6 +288,31 @@ void PotentiometerManager::calibrate() {
   LOG_INFO("POT", "Direction: Min=%d, Max=%d", directionMin, directionMax);
   LOG_INFO("POT", "Trim: Min=%d, Max=%d", trimMin, trimMax);
   LOG_INFO("POT", "Longueur: Min=%d, Max=%d", lineLengthMin, lineLengthMax);
+  
+  // Persister la calibration pour éviter de la refaire au prochain démarrage
+  saveCalibration();
+}
+
+/**
+ * Sauvegarde les valeurs de calibration courantes en NVS
+ * Les autres parties du bloc (IMU, servos) sont conservées
+ * @return true si la sauvegarde a réussi
+ */
+bool PotentiometerManager::saveCalibration() {
+  CalibrationData calib;
+  if (!dataStorageLoadCalibration(&calib)) {
+    dataStorageDefaultCalibration(&calib);
+  }
+  
+  calib.potMin[0] = directionMin;
+  calib.potMax[0] = directionMax;
+  calib.potMin[1] = trimMin;
+  calib.potMax[1] = trimMax;
+  calib.potMin[2] = lineLengthMin;
+  calib.potMax[2] = lineLengthMax;
+  calib.flags |= CALIB_FLAG_POTS;
+  
+  return dataStorageSaveCalibration(&calib);
 }
 
 /**
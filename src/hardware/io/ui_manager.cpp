@@ -45,10 +45,7 @@ UIManager::UIManager()
       displayNeedsUpdate(true),
       currentDisplayState(DISPLAY_MAIN),
       currentMenu(MENU_MAIN),
-      currentMenuSelection(0),
-      lastDisplayUpdate(0),
-      lastDisplayCheck(0),
-      lastButtonCheck(0) {
+      currentMenuSelection(0) {
     
     // Initialisation des états des boutons
     for (int i = 0; i < 4; i++) {
@@ -64,9 +61,10 @@ UIManager::~UIManager() {
 
 /**
  * Initialise l'UIManager
+ * @param showSplash true pour afficher l'écran d'accueil (false en démarrage rapide)
  * @return true si l'initialisation réussit, false sinon
  */
-bool UIManager::begin() {
+bool UIManager::begin(bool showSplash) {
     // Initialiser le LCD via DisplayManager
     bool lcdInitialized = display.isInitialized();
     
@@ -90,7 +88,6 @@ bool UIManager::begin() {
     currentMenu = MENU_MAIN;
     currentMenuSelection = 0;
     lastButtonCheckTime = 0;
-    lastDisplayUpdate = 0;
     displayNeedsUpdate = true;  // Forcer une mise à jour initiale
     
     // Initialiser le tableau des états des boutons
@@ -101,9 +98,11 @@ bool UIManager::begin() {
     }
     
     if (lcdInitialized) {
-        // Afficher un écran de bienvenue initial
-        display.displayWelcomeScreen(true);
-        delay(1000);  // Court délai pour afficher l'écran d'accueil
+        // Afficher un écran de bienvenue initial (sauf démarrage rapide)
+        if (showSplash) {
+            display.displayWelcomeScreen(true);
+            delay(1000);  // Court délai pour afficher l'écran d'accueil
+        }
         updateDisplay();  // Afficher l'écran principal
         LOG_INFO("UI", "Interface utilisateur initialisée avec succès");
     } else {
@@ -138,15 +137,13 @@ void UIManager::centerText(uint8_t row, const char* text) {
     lcd.print(text);
 }
 
+/**
+ * Redessine l'écran courant ; la cadence (DISPLAY_UPDATE_INTERVAL) est
+ * donnée par le temporisateur de la tâche d'affichage
+ */
 void UIManager::updateDisplay() {
     if (!lcdInitialized) return;
     
-    unsigned long currentTime = millis();
-    if (!displayNeedsUpdate && (currentTime - lastDisplayUpdate < DISPLAY_UPDATE_INTERVAL)) {
-        return;
-    }
-    
-    lastDisplayUpdate = currentTime;
     displayNeedsUpdate = false;
     
     switch (currentDisplayState) {
@@ -172,12 +169,12 @@ void UIManager::updateDisplay() {
     }
 }
 
+/**
+ * Lit les boutons avec anti-rebond ; appelée toutes les BUTTON_CHECK_INTERVAL
+ * par le temporisateur de la tâche des boutons
+ */
 void UIManager::checkButtons() {
     unsigned long currentTime = millis();
-    if (currentTime - lastButtonCheck < BUTTON_CHECK_INTERVAL) {
-        return;
-    }
-    lastButtonCheck = currentTime;
     
     // Lecture des boutons avec anti-rebond
     uint8_t pins[4] = {BUTTON_BACK_PIN, BUTTON_UP_PIN, BUTTON_SELECT_PIN, BUTTON_DOWN_PIN};
@@ -648,15 +645,11 @@ void UIManager::menuBack() {
     }
 }
 
+/**
+ * Vérifie la connexion de l'écran et tente une récupération ; appelée toutes
+ * les DISPLAY_CHECK_INTERVAL par le temporisateur de la tâche d'affichage
+ */
 void UIManager::checkDisplayStatus() {
-    unsigned long currentTime = millis();
-    
-    if (currentTime - lastDisplayCheck < DISPLAY_CHECK_INTERVAL) {
-        return;
-    }
-    
-    lastDisplayCheck = currentTime;
-    
     // Vérifier d'abord si l'écran LCD répond via DisplayManager
     if (!display.isInitialized()) {
         LOG_WARNING("UI", "Écran LCD non initialisé, tentative de récupération");
@@ -0,0 +1,106 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de calibration IMU (Implémentation)
+  -----------------------
+  
+  Calcul et persistance des biais du gyroscope et de l'accéléromètre.
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== FONCTIONNEMENT =====
+  La calibration moyenne CALIBRATION_SAMPLES lectures brutes, capteur immobile et à plat.
+  
+  Principes de fonctionnement :
+  1. Le biais gyroscope est la moyenne mesurée au repos
+  2. Le biais accéléromètre est la moyenne mesurée moins 1 g sur l'axe Z
+  3. Les biais sont sauvegardés en NVS (CALIB_FLAG_IMU) et rechargés au démarrage
+     via imuSetBiases(), ce qui évite de recalibrer à chaque mise sous tension
+  
+  Contraintes techniques :
+  - La calibration bloque environ 2 secondes (1000 échantillons à 2 ms)
+  - Le retrait des biais des lectures revient au pilote IMU (imuGetBiases())
+*/
+
+#include "hardware/sensors/imu.h"
+#include "utils/data_storage.h"
+#include "core/logging.h"
+
+// Délai entre deux échantillons de calibration (ms)
+static const uint32_t CALIBRATION_SAMPLE_DELAY = 2;
+
+static float gyroBiases[3] = {0.0f, 0.0f, 0.0f};
+static float accelBiases[3] = {0.0f, 0.0f, 0.0f};
+static IMUCalibrationState calibrationState = IMU_NOT_CALIBRATED;
+
+void imuSetBiases(const float gyroBias[3], const float accelBias[3]) {
+  for (int i = 0; i < 3; i++) {
+    gyroBiases[i] = gyroBias[i];
+    accelBiases[i] = accelBias[i];
+  }
+  calibrationState = IMU_CALIBRATED;
+  LOG_INFO("IMU", "Biais rechargés (gyro: %.2f, %.2f, %.2f)",
+           gyroBiases[0], gyroBiases[1], gyroBiases[2]);
+}
+
+void imuGetBiases(float gyroBias[3], float accelBias[3]) {
+  for (int i = 0; i < 3; i++) {
+    gyroBias[i] = gyroBiases[i];
+    accelBias[i] = accelBiases[i];
+  }
+}
+
+IMUCalibrationState imuGetCalibrationState() {
+  return calibrationState;
+}
+
+bool imuCalibrate() {
+  LOG_INFO("IMU", "Calibration IMU: gardez le capteur immobile et à plat");
+  
+  double gyroSum[3] = {0.0, 0.0, 0.0};
+  double accelSum[3] = {0.0, 0.0, 0.0};
+  int validSamples = 0;
+  
+  for (int i = 0; i < CALIBRATION_SAMPLES; i++) {
+    RawIMUData raw;
+    if (imuReadRawData(&raw)) {
+      gyroSum[0] += raw.gx / GYRO_SCALE;
+      gyroSum[1] += raw.gy / GYRO_SCALE;
+      gyroSum[2] += raw.gz / GYRO_SCALE;
+      accelSum[0] += raw.ax / ACCEL_SCALE;
+      accelSum[1] += raw.ay / ACCEL_SCALE;
+      accelSum[2] += raw.az / ACCEL_SCALE;
+      validSamples++;
+    }
+    delay(CALIBRATION_SAMPLE_DELAY);
+  }
+  
+  // Exiger au moins 90% de lectures valides
+  if (validSamples < CALIBRATION_SAMPLES * 9 / 10) {
+    calibrationState = IMU_CALIBRATION_ERROR;
+    LOG_ERROR("IMU", "Calibration échouée (%d/%d lectures valides)", validSamples, CALIBRATION_SAMPLES);
+    return false;
+  }
+  
+  for (int i = 0; i < 3; i++) {
+    gyroBiases[i] = gyroSum[i] / validSamples;
+    accelBiases[i] = accelSum[i] / validSamples;
+  }
+  accelBiases[2] -= 1.0f;  // La gravité n'est pas un biais
+  calibrationState = IMU_CALIBRATED;
+  
+  LOG_INFO("IMU", "Calibration terminée (gyro: %.2f, %.2f, %.2f deg/s)",
+           gyroBiases[0], gyroBiases[1], gyroBiases[2]);
+  
+  // Persister les biais en conservant les autres parties du bloc
+  CalibrationData calib;
+  if (!dataStorageLoadCalibration(&calib)) {
+    dataStorageDefaultCalibration(&calib);
+  }
+  imuGetBiases(calib.gyroBias, calib.accelBias);
+  calib.flags |= CALIB_FLAG_IMU;
+  dataStorageSaveCalibration(&calib);
+  
+  return true;
+}
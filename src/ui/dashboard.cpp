@@ -5,6 +5,12 @@
   
   Implémentation du tableau de bord du système Kite PiloteV3.
   
+  Double tampon : les mises à jour modifient le tampon arrière sous une
+  section critique courte ; la publication le copie dans la trame inactive,
+  puis bascule l'indice de la trame visible. Chaque trame porte un numéro
+  mis à 0 pendant sa réécriture : un lecteur qui copie une trame relit ce
+  numéro et recommence s'il a changé (verrou de séquence).
+  
   Version: 1.0.0
   Date: 2 mai 2025
   Auteurs: Équipe Kite PiloteV3
@@ -14,9 +20,18 @@
 #include "../../include/utils/logging.h"
 #include "../../include/core/config.h"
 #include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// === CONSTANTES ===
+#define FRAME_WRITING 0           // Numéro d'une trame en cours de réécriture
 
 // Variables statiques du module
-static DashboardData dashboardData;
+static DashboardData dashboardData;       // Tampon arrière, écrit par les producteurs
+static DashboardFrame frames[2];          // Trames publiées (visible et inactive)
+static uint8_t frontFrame = 0;            // Indice de la trame visible (accès atomique)
+static uint32_t frameSequence = 0;
+static bool backDirty = false;            // Tampon arrière modifié depuis la dernière trame
+static portMUX_TYPE backMux = portMUX_INITIALIZER_UNLOCKED;
 static unsigned long lastUpdateTime = 0;
 static bool isInitialized = false;
 
@@ -32,7 +47,10 @@ bool dashboardInit() {
   strncpy(dashboardData.statusMessage, "Système initialisé", sizeof(dashboardData.statusMessage) - 1);
   dashboardData.systemStatus = 100;
   
+  // Première trame publiée : les lecteurs ont toujours une trame complète
   isInitialized = true;
+  backDirty = true;
+  dashboardPublish();
   lastUpdateTime = millis();
   
   LOG_INFO("DASH", "Module initialisé avec succès");
@@ -54,12 +72,17 @@ bool dashboardUpdate(DashboardUpdateType updateType) {
       // Cette fonction appellerait d'autres fonctions pour collecter toutes les données
       break;
       
-    case DASH_UPDATE_SYSTEM:
+    case DASH_UPDATE_SYSTEM: {
       // Mise à jour des informations système uniquement
+      uint32_t freeHeap = ESP.getFreeHeap();
+      portENTER_CRITICAL(&backMux);
       dashboardData.uptime = millis() / 1000;
-      dashboardData.freeHeap = ESP.getFreeHeap();
+      dashboardData.freeHeap = freeHeap;
+      backDirty = true;
+      portEXIT_CRITICAL(&backMux);
       // Les autres données système seraient collectées ici
       break;
+    }
       
     // Autres cas selon les besoins...
       
@@ -71,7 +94,65 @@ bool dashboardUpdate(DashboardUpdateType updateType) {
 }
 
 DashboardData dashboardGetData() {
-  return dashboardData;
+  DashboardFrame frame;
+  dashboardGetFrame(&frame);
+  return frame.data;
+}
+
+bool dashboardPublish() {
+  if (!isInitialized) {
+    return false;
+  }
+  
+  uint8_t back = 1 - __atomic_load_n(&frontFrame, __ATOMIC_ACQUIRE);
+  DashboardFrame* frame = &frames[back];
+  
+  portENTER_CRITICAL(&backMux);
+  if (!backDirty) {
+    portEXIT_CRITICAL(&backMux);
+    return false;
+  }
+  // Trame marquée en cours d'écriture avant d'être modifiée
+  __atomic_store_n(&frame->sequence, (uint32_t)FRAME_WRITING, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  frame->data = dashboardData;
+  backDirty = false;
+  portEXIT_CRITICAL(&backMux);
+  
+  frame->timestampMs = millis();
+  // Numéro non nul publié après les données, puis bascule de la trame visible
+  __atomic_store_n(&frame->sequence, ++frameSequence, __ATOMIC_RELEASE);
+  __atomic_store_n(&frontFrame, back, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool dashboardGetFrame(DashboardFrame* frame) {
+  if (!isInitialized) {
+    memset(frame, 0, sizeof(DashboardFrame));
+    return false;
+  }
+  
+  for (;;) {
+    const DashboardFrame* front = &frames[__atomic_load_n(&frontFrame, __ATOMIC_ACQUIRE)];
+    uint32_t before = __atomic_load_n(&front->sequence, __ATOMIC_ACQUIRE);
+    if (before == FRAME_WRITING) {
+      continue;
+    }
+    memcpy(frame, front, sizeof(DashboardFrame));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    // Trame réécrite pendant la copie (deux publications) : recommencer
+    if (__atomic_load_n(&front->sequence, __ATOMIC_RELAXED) == before) {
+      frame->sequence = before;
+      return true;
+    }
+  }
+}
+
+uint32_t dashboardGetSequence() {
+  if (!isInitialized) {
+    return 0;
+  }
+  return __atomic_load_n(&frames[__atomic_load_n(&frontFrame, __ATOMIC_ACQUIRE)].sequence, __ATOMIC_ACQUIRE);
 }
 
 bool dashboardUpdateSystem(uint32_t uptime, uint32_t freeHeap, uint8_t cpuUsage, float cpuTemp) {
@@ -79,10 +160,13 @@ bool dashboardUpdateSystem(uint32_t uptime, uint32_t freeHeap, uint8_t cpuUsage,
     return false;
   }
   
+  portENTER_CRITICAL(&backMux);
   dashboardData.uptime = uptime;
   dashboardData.freeHeap = freeHeap;
   dashboardData.cpuUsage = cpuUsage;
   dashboardData.cpuTemperature = cpuTemp;
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
@@ -98,17 +182,23 @@ bool dashboardUpdateKite(const IMUData& imuData) {
   // Exemple: Estimer l'altitude basée sur l'angle et des modèles simples
   // orientation[0] = pitch, orientation[1] = roll, orientation[2] = yaw
   float angleRad = imuData.orientation[0] * (PI / 180.0f);
+  portENTER_CRITICAL(&backMux);
   float lineLength = dashboardData.lineLength; // Longueur actuelle des lignes
+  portEXIT_CRITICAL(&backMux);
   
-  dashboardData.kiteAltitude = sin(angleRad) * lineLength / 100.0f; // cm → m
+  float altitude = sin(angleRad) * lineLength / 100.0f; // cm → m
   
   // Calculer la vitesse du kite en fonction des données gyroscopiques
   // Conversion des taux de rotation en une estimation de vitesse
   // gyro[0] = vitesse angulaire x, gyro[1] = vitesse angulaire y, gyro[2] = vitesse angulaire z
-  dashboardData.kiteSpeed = sqrt(sq(imuData.gyro[0]) + sq(imuData.gyro[1]) + sq(imuData.gyro[2])) * 0.01f;
+  float speed = sqrt(sq(imuData.gyro[0]) + sq(imuData.gyro[1]) + sq(imuData.gyro[2])) * 0.01f;
   
-  // Puissance estimée basée sur la vitesse et la tension (formule simplifiée)
-  dashboardData.kitePower = dashboardData.kiteSpeed * dashboardData.lineTension * 10.0f;
+  // La puissance vient du bilan énergétique (dashboardUpdatePerformance)
+  portENTER_CRITICAL(&backMux);
+  dashboardData.kiteAltitude = altitude;
+  dashboardData.kiteSpeed = speed;
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
@@ -118,10 +208,13 @@ bool dashboardUpdateControl(int16_t directionAngle, int16_t trimAngle, uint16_t
     return false;
   }
   
+  portENTER_CRITICAL(&backMux);
   dashboardData.directionAngle = directionAngle;
   dashboardData.trimAngle = trimAngle;
   dashboardData.lineLength = lineLength;
   dashboardData.lineTension = lineTension;
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
@@ -131,7 +224,9 @@ bool dashboardUpdatePerformance(float currentPower, uint32_t totalEnergy, float
     return false;
   }
   
+  portENTER_CRITICAL(&backMux);
   dashboardData.currentPower = currentPower;
+  dashboardData.kitePower = currentPower;
   dashboardData.totalEnergy = totalEnergy;
   dashboardData.efficiency = efficiency;
   
@@ -139,6 +234,8 @@ bool dashboardUpdatePerformance(float currentPower, uint32_t totalEnergy, float
   if (currentPower > dashboardData.peakPower) {
     dashboardData.peakPower = currentPower;
   }
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
@@ -148,8 +245,11 @@ bool dashboardUpdateAutopilot(AutopilotMode mode, uint8_t confidence) {
     return false;
   }
   
+  portENTER_CRITICAL(&backMux);
   dashboardData.autopilotMode = mode;
   dashboardData.autopilotConfidence = confidence;
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
@@ -159,16 +259,28 @@ bool dashboardUpdateStatus(uint8_t status, const char* message, bool hasWarning,
     return false;
   }
   
+  portENTER_CRITICAL(&backMux);
   dashboardData.systemStatus = status;
   strncpy(dashboardData.statusMessage, message, sizeof(dashboardData.statusMessage) - 1);
   dashboardData.hasWarning = hasWarning;
   dashboardData.hasError = hasError;
+  backDirty = true;
+  portEXIT_CRITICAL(&backMux);
   
   return true;
 }
 
-String dashboardToJson(DashboardUpdateType updateType) {
+String dashboardToJson(DashboardUpdateType updateType, uint32_t* sequence) {
+  // Une seule trame pour tout le document
+  DashboardFrame frame;
+  dashboardGetFrame(&frame);
+  const DashboardData& dashboardData = frame.data;
+  if (sequence != nullptr) {
+    *sequence = frame.sequence;
+  }
+  
   String json = "{";
+  json += "\"sequence\":" + String(frame.sequence) + ",";
   
   // Ajouter données système
   if (updateType == DASH_UPDATE_FULL || updateType == DASH_UPDATE_SYSTEM) {
@@ -0,0 +1,304 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de micro-benchmarks (Implémentation)
+  -----------------------
+
+  Implémentation du banc de mesures : chronométrage, statistiques et référence.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  Chaque itération d'un cas est chronométrée individuellement :
+  prepare() -> t0 -> run() -> t1 -> cleanup(). Le coût du chronométrage seul
+  (mesuré sur une fonction vide) est retranché de chaque échantillon, puis
+  les échantillons sont triés pour extraire médiane et 99e centile.
+
+  Principes de fonctionnement :
+  1. Cible : compteur de cycles du cœur courant (esp_cpu_get_ccount), indépendant
+     de la fréquence CPU et des réglages de gestion d'énergie
+  2. Hôte : horloge monotone std::chrono::steady_clock en nanosecondes
+  3. Référence : fichier texte "nom médiane p99" précédé de l'unité ; une
+     référence d'une autre unité (hôte/cible) est ignorée
+
+  Contraintes techniques :
+  - Les échantillons sont stockés dans un tableau statique (pas d'allocation
+    pendant la mesure)
+  - Sur l'hôte, la sortie du port série simulé est neutralisée pendant la
+    mesure pour ne pas chronométrer la console
+*/
+
+#include "utils/benchmark.h"
+#include "core/logging.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#ifdef NATIVE_BUILD
+#include <chrono>
+#else
+#include <LittleFS.h>
+#include <esp_cpu.h>
+#endif
+
+// === VARIABLES GLOBALES ===
+
+static uint32_t samples[BENCHMARK_MAX_SAMPLES];
+static uint32_t timerOverhead = 0;
+static bool overheadMeasured = false;
+
+// === FONCTIONS INTERNES ===
+
+static void emptyBenchmark(void* /*context*/) {
+}
+
+/**
+ * Prépare l'accès au système de fichiers de la référence
+ * @return true si les fichiers sont accessibles
+ */
+static bool mountBaselineStorage() {
+#ifdef NATIVE_BUILD
+  return true;
+#else
+  return LittleFS.begin(true);
+#endif
+}
+
+/**
+ * Mesure le coût d'un chronométrage à vide (médiane)
+ */
+static void measureTimerOverhead() {
+  const int count = 64;
+  for (int i = 0; i < count; i++) {
+    uint32_t start = benchmarkNow();
+    emptyBenchmark(nullptr);
+    samples[i] = benchmarkNow() - start;
+  }
+  std::sort(samples, samples + count);
+  timerOverhead = samples[count / 2];
+  overheadMeasured = true;
+}
+
+static const BenchmarkBaselineEntry* findBaseline(const char* name, const BenchmarkBaselineEntry* baseline,
+                                                  int baselineCount) {
+  for (int i = 0; baseline != nullptr && i < baselineCount; i++) {
+    if (strcmp(baseline[i].name, name) == 0) {
+      return &baseline[i];
+    }
+  }
+  return nullptr;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+uint32_t benchmarkNow() {
+#ifdef NATIVE_BUILD
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+  return (uint32_t)esp_cpu_get_ccount();
+#endif
+}
+
+const char* benchmarkUnit() {
+#ifdef NATIVE_BUILD
+  return "ns";
+#else
+  return "cycles";
+#endif
+}
+
+bool benchmarkRun(const BenchmarkCase& benchCase, BenchmarkResult* result) {
+  if (benchCase.name == nullptr || benchCase.run == nullptr || result == nullptr) {
+    LOG_ERROR("BENCH", "Cas de mesure invalide");
+    return false;
+  }
+
+  if (!overheadMeasured) {
+    measureTimerOverhead();
+  }
+
+  uint32_t iterations = benchCase.iterations > 0 ? benchCase.iterations : BENCHMARK_DEFAULT_ITERATIONS;
+  if (iterations > BENCHMARK_MAX_SAMPLES) {
+    iterations = BENCHMARK_MAX_SAMPLES;
+  }
+
+#ifdef NATIVE_BUILD
+  FILE* consoleOutput = nativeSerialOutput;
+  FILE* nullOutput = fopen("/dev/null", "w");
+  if (nullOutput != nullptr) {
+    nativeSerialOutput = nullOutput;
+  }
+#endif
+
+  // Chauffe : remplit les caches et déclenche les allocations paresseuses
+  for (uint32_t i = 0; i < BENCHMARK_WARMUP_ITERATIONS; i++) {
+    if (benchCase.prepare) benchCase.prepare(benchCase.context);
+    benchCase.run(benchCase.context);
+    if (benchCase.cleanup) benchCase.cleanup(benchCase.context);
+  }
+
+  uint64_t total = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    if (benchCase.prepare) benchCase.prepare(benchCase.context);
+
+    uint32_t start = benchmarkNow();
+    benchCase.run(benchCase.context);
+    uint32_t elapsed = benchmarkNow() - start;
+
+    if (benchCase.cleanup) benchCase.cleanup(benchCase.context);
+
+    samples[i] = elapsed > timerOverhead ? elapsed - timerOverhead : 0;
+    total += samples[i];
+  }
+
+#ifdef NATIVE_BUILD
+  if (nullOutput != nullptr) {
+    nativeSerialOutput = consoleOutput;
+    fclose(nullOutput);
+  }
+#endif
+
+  std::sort(samples, samples + iterations);
+
+  // 99e centile par la méthode du rang le plus proche
+  uint32_t p99Index = (iterations * 99 + 99) / 100;
+  p99Index = p99Index > 0 ? p99Index - 1 : 0;
+
+  memset(result, 0, sizeof(BenchmarkResult));
+  strncpy(result->name, benchCase.name, BENCHMARK_NAME_LENGTH - 1);
+  result->iterations = iterations;
+  result->min = samples[0];
+  result->median = samples[iterations / 2];
+  result->p99 = samples[p99Index];
+  result->max = samples[iterations - 1];
+  result->mean = (uint32_t)(total / iterations);
+  return true;
+}
+
+int benchmarkLoadBaseline(const char* path, BenchmarkBaselineEntry* entries, int maxEntries,
+                          const char* expectedUnit) {
+  if (path == nullptr || entries == nullptr || !mountBaselineStorage()) {
+    return -1;
+  }
+  if (expectedUnit == nullptr) {
+    expectedUnit = benchmarkUnit();
+  }
+
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    LOG_INFO("BENCH", "Aucune référence dans %s", path);
+    return -1;
+  }
+
+  char line[96];
+  char unit[16] = "";
+  int count = 0;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    if (strncmp(line, "unit ", 5) == 0) {
+      sscanf(line + 5, "%15s", unit);
+      continue;
+    }
+    if (count >= maxEntries) {
+      break;
+    }
+    BenchmarkBaselineEntry& entry = entries[count];
+    unsigned long median = 0;
+    unsigned long p99 = 0;
+    if (sscanf(line, "%31s %lu %lu", entry.name, &median, &p99) == 3) {
+      entry.median = (uint32_t)median;
+      entry.p99 = (uint32_t)p99;
+      count++;
+    }
+  }
+  fclose(file);
+
+  if (strcmp(unit, expectedUnit) != 0) {
+    LOG_WARNING("BENCH", "Référence %s en '%s', mesures en '%s' : ignorée", path, unit, expectedUnit);
+    return -1;
+  }
+
+  return count;
+}
+
+bool benchmarkSaveBaseline(const char* path, const BenchmarkResult* results, int count,
+                           const char* unit) {
+  if (path == nullptr || results == nullptr || !mountBaselineStorage()) {
+    return false;
+  }
+
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    LOG_ERROR("BENCH", "Impossible d'écrire la référence %s", path);
+    return false;
+  }
+
+  fprintf(file, "# Kite PiloteV3 - référence des micro-benchmarks (nom médiane p99)\n");
+  fprintf(file, "unit %s\n", unit != nullptr ? unit : benchmarkUnit());
+  for (int i = 0; i < count; i++) {
+    fprintf(file, "%s %lu %lu\n", results[i].name,
+            (unsigned long)results[i].median, (unsigned long)results[i].p99);
+  }
+  fclose(file);
+
+  LOG_INFO("BENCH", "Référence enregistrée (%d cas) dans %s", count, path);
+  return true;
+}
+
+BenchmarkVerdict benchmarkCompare(const BenchmarkResult& result, const BenchmarkBaselineEntry* baseline,
+                                  int baselineCount, float* deltaPercent) {
+  const BenchmarkBaselineEntry* reference = findBaseline(result.name, baseline, baselineCount);
+  if (reference == nullptr || reference->median == 0) {
+    if (deltaPercent) *deltaPercent = 0.0f;
+    return BENCH_NEW;
+  }
+
+  float delta = 100.0f * ((float)result.median - (float)reference->median) / (float)reference->median;
+  if (deltaPercent) *deltaPercent = delta;
+
+  uint32_t absoluteDelta = result.median > reference->median ? result.median - reference->median
+                                                             : reference->median - result.median;
+  if (absoluteDelta < BENCHMARK_MIN_DELTA) {
+    return BENCH_UNCHANGED;
+  }
+  if (delta > BENCHMARK_REGRESSION_PERCENT) {
+    return BENCH_REGRESSED;
+  }
+  if (delta < -BENCHMARK_REGRESSION_PERCENT) {
+    return BENCH_IMPROVED;
+  }
+  return BENCH_UNCHANGED;
+}
+
+int benchmarkPrintReport(const BenchmarkResult* results, int count,
+                         const BenchmarkBaselineEntry* baseline, int baselineCount) {
+  static const char* verdictNames[] = {"nouveau", "stable", "AMÉLIORÉ", "RÉGRESSION"};
+  int regressions = 0;
+
+  Serial.printf("%-24s %8s %10s %10s %10s %10s  %s\n",
+                "cas", "iter", "min", "médiane", "p99", "max", "référence");
+  for (int i = 0; i < count; i++) {
+    const BenchmarkResult& r = results[i];
+    float delta = 0.0f;
+    BenchmarkVerdict verdict = benchmarkCompare(r, baseline, baselineCount, &delta);
+    if (verdict == BENCH_REGRESSED) {
+      regressions++;
+    }
+
+    Serial.printf("%-24s %8lu %10lu %10lu %10lu %10lu  ", r.name, (unsigned long)r.iterations,
+                  (unsigned long)r.min, (unsigned long)r.median, (unsigned long)r.p99, (unsigned long)r.max);
+    if (verdict == BENCH_NEW) {
+      Serial.printf("%s\n", verdictNames[verdict]);
+    } else {
+      Serial.printf("%+.1f%% %s\n", delta, verdictNames[verdict]);
+    }
+  }
+  Serial.printf("Unité : %s, seuil de régression : %d%% sur la médiane\n",
+                benchmarkUnit(), BENCHMARK_REGRESSION_PERCENT);
+
+  return regressions;
+}
@@ -0,0 +1,448 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Suite de micro-benchmarks du firmware (Implémentation)
+  -----------------------
+
+  Cas de mesure des fonctions critiques du firmware.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  Fonctions mesurées (une ligne de la référence chacune) :
+  - logPrint / logPrint_filtered : message émis et message filtré par le niveau
+  - updateLCDDiff : rafraîchissement différentiel d'une ligne (horloge)
+  - autopilotUpdate : cycle complet en mode figure en 8 (intervalle écoulé)
+  - reportError : signalement d'une erreur capteur au ErrorManager
+  - ObjectPool_acquire : réservation d'un message dans un pool de 16
+  - dashboardToJson : sérialisation complète du tableau de bord
+  - timerWheel_schedule : armement puis désarmement d'un temporisateur
+  - timerWheel_service : réveil d'une tâche (avance de 10 ms et prochaine
+    échéance) avec quatre temporisateurs périodiques armés
+  - queue_fanout_copy : message de 145 octets copié dans trois files FreeRTOS
+    puis reçu par copie (diffusion par valeur, ancienne file du TaskManager)
+  - bus_fanout : même message publié une fois sur le bus, reçu par pointeur
+    et rendu par trois abonnés
+  - paramServer_read : prise de l'instantané des paramètres de l'autopilote
+    par la boucle de contrôle (un par cycle)
+  - gorilla_encode / gorilla_decode : compression et décompression d'un
+    échantillon de session (8 canaux à 100 Hz, signaux de vol synthétiques) ;
+    le taux de compression obtenu est journalisé
+  - vibration_block : analyse d'un bloc de l'anneau vibratoire (fenêtre,
+    FFT, bandes, pics), coût à comparer à VIBRATION_CPU_BUDGET_US
+  - safetyEnvelope_check : vérification de l'enveloppe de vol par la grille
+    précompilée, points successifs d'une figure en 8
+
+  Contraintes techniques :
+  - Sur la cible, autopilotUpdate attend AUTOPILOT_UPDATE_INTERVAL entre deux
+    itérations (non chronométré) : le cas est limité à 100 itérations
+  - Les états modifiés (niveau de log, mode autopilote, historique d'erreurs,
+    bus de messages) sont restaurés en fin de suite ; la suite s'exécute
+    avant le démarrage des tâches et de leurs abonnements
+*/
+
+#include "utils/benchmark.h"
+#include "core/logging.h"
+#include "control/autopilot.h"
+#include "hardware/io/display_manager.h"
+#include "utils/error_manager.h"
+#include "utils/object_pool.h"
+#include "ui/dashboard.h"
+#include "utils/timer_wheel.h"
+#include "utils/message_bus.h"
+#include "utils/param_server.h"
+#include "utils/gorilla.h"
+#include "utils/session_format.h"
+#include "utils/vibration.h"
+#include "control/safety.h"
+#include <math.h>
+
+// === CONSTANTES ===
+#define BENCH_SUITE_MAX_CASES      16
+#define BENCH_FANOUT_SUBSCRIBERS   3
+#define BENCH_POOL_SIZE            16
+#define BENCH_AUTOPILOT_ITERATIONS 100
+#define BENCH_GORILLA_PERIOD_MS    10      // Échantillonnage à 100 Hz
+
+// === DÉFINITION DES TYPES INTERNES ===
+
+// Accès aux membres privés de DisplayManager (déclaré ami)
+struct DisplayBenchmarkAccess {
+  static void tick(DisplayManager* display, uint32_t counter) {
+    // Même motif que updateMainDisplay() : l'horloge de la ligne 4 change
+    snprintf(&display->screenBuffer[3][8], LCD_COLS - 8 + 1, "%02lu:%02lu:%02lu",
+             (unsigned long)((counter / 3600) % 100), (unsigned long)((counter / 60) % 60),
+             (unsigned long)(counter % 60));
+  }
+  static void update(DisplayManager* display) {
+    display->updateLCDDiff();
+  }
+};
+
+typedef ObjectPool<Message, BENCH_POOL_SIZE> BenchMessagePool;
+
+typedef struct {
+  DisplayManager* display;
+  uint32_t counter;
+} DisplayBenchContext;
+
+typedef struct {
+  BenchMessagePool* pool;
+  Message* lastAcquired;
+} PoolBenchContext;
+
+typedef struct {
+  TimerWheel* wheel;
+  uint32_t nowMs;               // Horloge simulée : indépendante de la durée mesurée
+  uint32_t delayMs;
+} TimerBenchContext;
+
+typedef struct {
+  Message message;
+  QueueHandle_t queues[BENCH_FANOUT_SUBSCRIBERS];
+  BusSubscriber* subscribers[BENCH_FANOUT_SUBSCRIBERS];
+  uint8_t checksum;             // Lecture du message reçu (non éliminée)
+} FanoutBenchContext;
+
+typedef struct {
+  ParamServer server;
+  int reader;
+  uint32_t checksum;
+} ParamBenchContext;
+
+typedef struct {
+  GorillaEncoder encoder;
+  GorillaDecoder decoder;
+  uint8_t block[SESSION_CHUNK_DATA_SIZE];
+  uint8_t decodeBlock[SESSION_CHUNK_DATA_SIZE];
+  size_t decodeBytes;
+  uint16_t decodeCount;
+  FlightSample sample;          // Prochain échantillon à compresser
+  uint32_t index;
+  uint32_t checksum;
+} GorillaBenchContext;
+
+typedef struct {
+  SafetyLimits limits;
+  uint32_t index;
+  float checksum;
+} SafetyBenchContext;
+
+// === CAS DE MESURE ===
+
+static void benchLogEmitted(void* context) {
+  logPrint((LogLevel)LOG_LEVEL_INFO, "BENCH", "Tension %d.%02d kg, angle %d", 12, 34, -15);
+}
+
+static void benchLogFiltered(void* context) {
+  logPrint((LogLevel)LOG_LEVEL_DEBUG, "BENCH", "Tension %d.%02d kg, angle %d", 12, 34, -15);
+}
+
+static void prepareLcdDiff(void* context) {
+  DisplayBenchContext* ctx = (DisplayBenchContext*)context;
+  DisplayBenchmarkAccess::tick(ctx->display, ++ctx->counter);
+}
+
+static void benchLcdDiff(void* context) {
+  DisplayBenchmarkAccess::update(((DisplayBenchContext*)context)->display);
+}
+
+static void prepareAutopilot(void* context) {
+#ifdef NATIVE_BUILD
+  nativeAdvanceMillis(AUTOPILOT_UPDATE_INTERVAL);
+#else
+  vTaskDelay(pdMS_TO_TICKS(AUTOPILOT_UPDATE_INTERVAL));
+#endif
+}
+
+static void benchAutopilot(void* context) {
+  autopilotUpdate(*(const IMUData*)context);
+}
+
+static void benchReportError(void* context) {
+  ErrorManager::getInstance()->reportError(ErrorCode::SENSOR_ERROR, "BENCH", "Lecture capteur simulée");
+}
+
+static void benchPoolAcquire(void* context) {
+  PoolBenchContext* ctx = (PoolBenchContext*)context;
+  ctx->lastAcquired = ctx->pool->acquire();
+}
+
+static void cleanupPoolAcquire(void* context) {
+  PoolBenchContext* ctx = (PoolBenchContext*)context;
+  ctx->pool->release(ctx->lastAcquired);
+}
+
+static void benchDashboardJson(void* context) {
+  String json = dashboardToJson(DASH_UPDATE_FULL);
+  *(size_t*)context = json.length();
+}
+
+static void benchTimerNoop(void* context) {
+}
+
+static void benchTimerSchedule(void* context) {
+  TimerBenchContext* ctx = (TimerBenchContext*)context;
+  TimerHandle handle = timerWheelSchedule(ctx->wheel, 2000, 0, benchTimerNoop, nullptr);
+  timerWheelCancel(ctx->wheel, handle);
+}
+
+static void benchTimerService(void* context) {
+  TimerBenchContext* ctx = (TimerBenchContext*)context;
+  ctx->nowMs += 10;
+  timerWheelAdvance(ctx->wheel, ctx->nowMs);
+  ctx->delayMs = timerWheelNextDelay(ctx->wheel, ctx->nowMs);
+}
+
+static void benchQueueFanout(void* context) {
+  FanoutBenchContext* ctx = (FanoutBenchContext*)context;
+  Message received;
+  for (int i = 0; i < BENCH_FANOUT_SUBSCRIBERS; i++) {
+    xQueueSend(ctx->queues[i], &ctx->message, 0);
+  }
+  for (int i = 0; i < BENCH_FANOUT_SUBSCRIBERS; i++) {
+    xQueueReceive(ctx->queues[i], &received, 0);
+    ctx->checksum += received.level;
+  }
+}
+
+static void benchBusFanout(void* context) {
+  FanoutBenchContext* ctx = (FanoutBenchContext*)context;
+  busPublishCopy(BUS_TOPIC_LOG, &ctx->message, sizeof(ctx->message));
+  for (int i = 0; i < BENCH_FANOUT_SUBSCRIBERS; i++) {
+    BusMessage* msg = busReceive(ctx->subscribers[i], 0);
+    ctx->checksum += static_cast<const Message*>(busPayload(msg))->level;
+    busRelease(msg);
+  }
+}
+
+static void benchParamRead(void* context) {
+  ParamBenchContext* ctx = (ParamBenchContext*)context;
+  const AutopilotParameters* params =
+      (const AutopilotParameters*)paramServerRead(&ctx->server, ctx->reader, nullptr);
+  ctx->checksum += params->turnSpeed;
+}
+
+/**
+ * Échantillon de vol synthétique : attitude et tension bruitées, longueur
+ * de ligne constante, direction en degrés entiers, gigue d'horloge
+ */
+static void gorillaBenchSample(uint32_t index, FlightSample* sample) {
+  float t = index * BENCH_GORILLA_PERIOD_MS / 1000.0f;
+  float noise = (float)((index * 2654435761u) >> 24) / 256.0f - 0.5f;
+  sample->timestampMs = index * BENCH_GORILLA_PERIOD_MS + (index % 16 == 0 ? 1 : 0);
+  sample->values[SESSION_CH_PITCH] = 20.0f * sinf(t) + 0.2f * noise;
+  sample->values[SESSION_CH_ROLL] = 35.0f * sinf(0.5f * t) + 0.2f * noise;
+  sample->values[SESSION_CH_YAW] = 10.0f * sinf(0.1f * t);
+  sample->values[SESSION_CH_LINE_TENSION] = 40.0f + 10.0f * sinf(t) + noise;
+  sample->values[SESSION_CH_LINE_LENGTH] = 2500.0f;
+  sample->values[SESSION_CH_WIND_SPEED] = roundf((8.0f + sinf(0.05f * t)) * 10.0f) / 10.0f;
+  sample->values[SESSION_CH_POWER] = 400.0f + 100.0f * sinf(t);
+  sample->values[SESSION_CH_DIRECTION] = roundf(30.0f * sinf(0.5f * t));
+}
+
+static void prepareGorillaEncode(void* context) {
+  GorillaBenchContext* ctx = (GorillaBenchContext*)context;
+  gorillaBenchSample(ctx->index++, &ctx->sample);
+}
+
+static void benchGorillaEncode(void* context) {
+  GorillaBenchContext* ctx = (GorillaBenchContext*)context;
+  if (!gorillaEncoderAppend(&ctx->encoder, ctx->sample.timestampMs, ctx->sample.values)) {
+    // Bloc plein : même traitement que l'enregistreur (écriture puis nouveau bloc)
+    gorillaEncoderInit(&ctx->encoder, ctx->block, sizeof(ctx->block), SESSION_CHANNEL_COUNT);
+    gorillaEncoderAppend(&ctx->encoder, ctx->sample.timestampMs, ctx->sample.values);
+  }
+}
+
+static void prepareGorillaDecode(void* context) {
+  GorillaBenchContext* ctx = (GorillaBenchContext*)context;
+  if (ctx->decoder.remaining == 0) {
+    gorillaDecoderInit(&ctx->decoder, ctx->decodeBlock, ctx->decodeBytes, SESSION_CHANNEL_COUNT,
+                       ctx->decodeCount);
+  }
+}
+
+static void benchGorillaDecode(void* context) {
+  GorillaBenchContext* ctx = (GorillaBenchContext*)context;
+  uint32_t timestampMs = 0;
+  float values[SESSION_CHANNEL_COUNT];
+  gorillaDecoderNext(&ctx->decoder, &timestampMs, values);
+  ctx->checksum += timestampMs;
+}
+
+static void prepareVibrationBlock(void* context) {
+  uint32_t* index = (uint32_t*)context;
+  for (int i = 0; i < VIBRATION_HOP; i++, (*index)++) {
+    float t = (float)*index / VIBRATION_SAMPLE_RATE_HZ;
+    float accel[3] = {0.05f * sinf(2.0f * (float)M_PI * 2.0f * t), 0.0f,
+                      1.0f + 0.2f * sinf(2.0f * (float)M_PI * 18.0f * t)};
+    vibrationPushSample(accel);
+  }
+}
+
+static void benchVibrationBlock(void* context) {
+  vibrationProcess(UINT32_MAX);
+}
+
+static void benchSafetyCheck(void* context) {
+  SafetyBenchContext* ctx = (SafetyBenchContext*)context;
+  float t = (ctx->index++ % 256) * (2.0f * (float)M_PI / 256.0f);
+  SafetyCheck check;
+  safetyEnvelopeCheck(40.0f * sinf(t), 30.0f + 12.0f * sinf(2.0f * t), 6000.0f, ctx->limits, &check);
+  ctx->checksum += check.boundaryDistance;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+int benchmarkRunSuite(const char* baselinePath, bool updateBaseline) {
+  static BenchmarkResult results[BENCH_SUITE_MAX_CASES];
+  static BenchmarkBaselineEntry baseline[BENCHMARK_MAX_BASELINE];
+  int resultCount = 0;
+
+  LOG_INFO("BENCH", "Début de la suite de micro-benchmarks (%s)", benchmarkUnit());
+
+  LogLevel savedLevel = currentLogLevel;
+  currentLogLevel = (LogLevel)LOG_LEVEL_INFO;
+
+  // Contextes des cas
+  DisplayManager* display = new DisplayManager();
+  display->setLcdInitialized(true);
+  DisplayBenchContext displayContext = {display, 0};
+
+  autopilotInit();
+  AutopilotMode savedMode = getAutopilotMode();
+  setAutopilotMode(AUTOPILOT_FIGURE_8);
+  IMUData imu = {};
+  imu.orientation[0] = 12.0f;
+  imu.orientation[1] = 5.0f;
+  imu.gyro[0] = 20.0f;
+  imu.dataValid = true;
+
+  BenchMessagePool* pool = new BenchMessagePool();
+  PoolBenchContext poolContext = {pool, nullptr};
+  // Pool à moitié occupé, comme en vol
+  for (int i = 0; i < BENCH_POOL_SIZE / 2; i++) {
+    pool->acquire();
+  }
+
+  dashboardInit();
+  dashboardUpdateSystem(3600, 150000, 35, 48.5f);
+  dashboardUpdateControl(-15, 5, 2500, 12.5f);
+  dashboardUpdatePerformance(250.0f, 1200, 0.82f);
+  dashboardUpdateStatus(90, "Vol nominal", false, false);
+  dashboardPublish();
+  size_t jsonLength = 0;
+
+  // Roue chargée comme celle d'une tâche d'interface
+  TimerWheel* wheel = new TimerWheel();
+  timerWheelInit(wheel, 0);
+  timerWheelSchedule(wheel, BUTTON_CHECK_INTERVAL, BUTTON_CHECK_INTERVAL, benchTimerNoop, nullptr);
+  timerWheelSchedule(wheel, POT_READ_INTERVAL, POT_READ_INTERVAL, benchTimerNoop, nullptr);
+  timerWheelSchedule(wheel, DISPLAY_UPDATE_INTERVAL, DISPLAY_UPDATE_INTERVAL, benchTimerNoop, nullptr);
+  timerWheelSchedule(wheel, DISPLAY_CHECK_INTERVAL, DISPLAY_CHECK_INTERVAL, benchTimerNoop, nullptr);
+  TimerBenchContext timerContext = {wheel, 0, 0};
+
+  // Diffusion d'un message de journal à trois destinataires
+  FanoutBenchContext* fanout = new FanoutBenchContext();
+  fanout->message.level = LOG_LEVEL_INFO;
+  strncpy(fanout->message.tag, "BENCH", sizeof(fanout->message.tag));
+  memset(fanout->message.message, 'x', sizeof(fanout->message.message) - 1);
+  busInit();
+  for (int i = 0; i < BENCH_FANOUT_SUBSCRIBERS; i++) {
+    fanout->queues[i] = xQueueCreate(BUS_IMU_QUEUE_DEPTH, sizeof(Message));
+    fanout->subscribers[i] = busSubscribe(BUS_TOPIC_LOG, BUS_IMU_QUEUE_DEPTH, "bench");
+  }
+
+  // Serveur de paramètres avec un réglage déjà publié
+  ParamBenchContext* paramContext = new ParamBenchContext();
+  AutopilotParameters params = getAutopilotParameters();
+  paramServerInit(&paramContext->server, &params, sizeof(params));
+  paramContext->reader = paramServerRegisterReader(&paramContext->server);
+  paramServerPublish(&paramContext->server, &params);
+
+  // Compression : un bloc plein est préparé pour la décompression
+  GorillaBenchContext* gorilla = new GorillaBenchContext();
+  memset(gorilla, 0, sizeof(GorillaBenchContext));
+  gorillaEncoderInit(&gorilla->encoder, gorilla->decodeBlock, sizeof(gorilla->decodeBlock), SESSION_CHANNEL_COUNT);
+  for (gorilla->index = 0;; gorilla->index++) {
+    gorillaBenchSample(gorilla->index, &gorilla->sample);
+    if (!gorillaEncoderAppend(&gorilla->encoder, gorilla->sample.timestampMs, gorilla->sample.values)) {
+      break;
+    }
+  }
+  gorilla->decodeBytes = gorillaEncoderSize(&gorilla->encoder);
+  gorilla->decodeCount = gorilla->encoder.count;
+  gorilla->index = 0;
+  gorillaEncoderInit(&gorilla->encoder, gorilla->block, sizeof(gorilla->block), SESSION_CHANNEL_COUNT);
+
+  // Anneau vibratoire rempli d'un bloc, un bloc de plus à chaque itération
+  vibrationInit();
+  uint32_t vibrationIndex = 0;
+  for (int i = 0; i < VIBRATION_FFT_SIZE / VIBRATION_HOP - 1; i++) {
+    prepareVibrationBlock(&vibrationIndex);
+  }
+
+  // Enveloppe par défaut (compilée par autopilotInit), limites par défaut
+  SafetyBenchContext safetyContext = {{0.0f, (float)params.maxLineLength, (float)params.maxAltitude}, 0, 0.0f};
+
+  const BenchmarkCase cases[] = {
+    {"logPrint",           benchLogEmitted,    nullptr,          nullptr,            nullptr,         0},
+    {"logPrint_filtered",  benchLogFiltered,   nullptr,          nullptr,            nullptr,         0},
+    {"updateLCDDiff",      benchLcdDiff,       prepareLcdDiff,   nullptr,            &displayContext, 0},
+    {"autopilotUpdate",    benchAutopilot,     prepareAutopilot, nullptr,            &imu,            BENCH_AUTOPILOT_ITERATIONS},
+    {"reportError",        benchReportError,   nullptr,          nullptr,            nullptr,         0},
+    {"ObjectPool_acquire", benchPoolAcquire,   nullptr,          cleanupPoolAcquire, &poolContext,    0},
+    {"dashboardToJson",    benchDashboardJson, nullptr,          nullptr,            &jsonLength,     0},
+    {"timerWheel_schedule", benchTimerSchedule, nullptr,         nullptr,            &timerContext,   0},
+    {"timerWheel_service", benchTimerService,  nullptr,          nullptr,            &timerContext,   0},
+    {"queue_fanout_copy",  benchQueueFanout,   nullptr,          nullptr,            fanout,          0},
+    {"bus_fanout",         benchBusFanout,     nullptr,          nullptr,            fanout,          0},
+    {"paramServer_read",   benchParamRead,     nullptr,          nullptr,            paramContext,    0},
+    {"gorilla_encode",     benchGorillaEncode, prepareGorillaEncode, nullptr,        gorilla,         0},
+    {"gorilla_decode",     benchGorillaDecode, prepareGorillaDecode, nullptr,        gorilla,         0},
+    {"vibration_block",    benchVibrationBlock, prepareVibrationBlock, nullptr,      &vibrationIndex, 0},
+    {"safetyEnvelope_check", benchSafetyCheck, nullptr,          nullptr,            &safetyContext,  0},
+  };
+  const int caseCount = sizeof(cases) / sizeof(cases[0]);
+
+  for (int i = 0; i < caseCount && resultCount < BENCH_SUITE_MAX_CASES; i++) {
+    if (benchmarkRun(cases[i], &results[resultCount])) {
+      resultCount++;
+    }
+  }
+
+  LOG_INFO("BENCH", "Compression des sessions : %u échantillons par bloc de %u octets, "
+           "%.2f octets/échantillon (brut : %u)", gorilla->decodeCount, (unsigned)SESSION_CHUNK_SIZE,
+           (float)SESSION_CHUNK_SIZE / gorilla->decodeCount, (unsigned)sizeof(FlightSample));
+
+  // Restauration de l'état du système
+  setAutopilotMode(savedMode);
+  ErrorManager::getInstance()->clearErrorHistory();
+  for (int i = 0; i < BENCH_FANOUT_SUBSCRIBERS; i++) {
+    vQueueDelete(fanout->queues[i]);
+  }
+  busInit();
+  delete fanout;
+  vSemaphoreDelete(paramContext->server.writeLock);
+  delete paramContext;
+  delete gorilla;
+  vibrationInit();
+  delete wheel;
+  delete pool;
+  delete display;
+  currentLogLevel = savedLevel;
+
+  int baselineCount = benchmarkLoadBaseline(baselinePath, baseline, BENCHMARK_MAX_BASELINE);
+  int regressions = benchmarkPrintReport(results, resultCount, baseline, baselineCount > 0 ? baselineCount : 0);
+
+  if (updateBaseline && !benchmarkSaveBaseline(baselinePath, results, resultCount)) {
+    return -1;
+  }
+
+  if (regressions > 0) {
+    LOG_WARNING("BENCH", "%d régression(s) par rapport à la référence", regressions);
+  }
+  return regressions;
+}
@@ -0,0 +1,246 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de profilage du démarrage (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. bootProfilerBegin() recopie la chronologie RTC précédente si son nombre
+     magique est valide, puis réinitialise la chronologie courante
+  2. Chaque étape est horodatée avec micros() à l'ouverture et à la
+     fermeture ; la profondeur d'imbrication suit les étapes ouvertes
+  3. La cascade place chaque étape sur BOOT_PROFILER_BAR_WIDTH colonnes
+     proportionnellement à la durée totale
+  4. La comparaison convertit les étapes en résultats de micro-benchmark
+     (médiane = durée) et réutilise le fichier de référence et le verdict
+     du banc de mesures ; un écart inférieur à BOOT_PROFILER_MIN_DELTA_US
+     n'est pas signalé
+*/
+
+#include "utils/boot_profiler.h"
+#include "utils/benchmark.h"
+#include "utils/logging.h"
+#include <string.h>
+
+// === CONSTANTES ===
+#define BOOT_PROFILER_MAGIC 0x424F4F54u  // "BOOT"
+
+// === VARIABLES GLOBALES ===
+
+// Conservée lors d'un redémarrage à chaud (non initialisée au démarrage)
+static RTC_NOINIT_ATTR BootTimeline rtcTimeline;
+
+static BootTimeline previousTimeline;
+static bool previousValid = false;
+
+// === FONCTIONS INTERNES ===
+
+static bool timelineValid(const BootTimeline& timeline) {
+  return timeline.magic == BOOT_PROFILER_MAGIC &&
+         timeline.stepCount <= BOOT_PROFILER_MAX_STEPS &&
+         timeline.openDepth <= BOOT_PROFILER_MAX_STEPS;
+}
+
+static uint32_t stepDuration(const BootStep& step) {
+  return step.finished ? step.endUs - step.startUs : 0;
+}
+
+static void printBar(uint32_t startUs, uint32_t durationUs, uint32_t scaleUs) {
+  int offset = (int)((uint64_t)startUs * BOOT_PROFILER_BAR_WIDTH / scaleUs);
+  int length = (int)((uint64_t)durationUs * BOOT_PROFILER_BAR_WIDTH / scaleUs);
+  if (offset >= BOOT_PROFILER_BAR_WIDTH) offset = BOOT_PROFILER_BAR_WIDTH - 1;
+  if (length < 1) length = 1;
+  if (offset + length > BOOT_PROFILER_BAR_WIDTH) length = BOOT_PROFILER_BAR_WIDTH - offset;
+
+  char bar[BOOT_PROFILER_BAR_WIDTH + 1];
+  memset(bar, ' ', BOOT_PROFILER_BAR_WIDTH);
+  memset(bar + offset, '#', length);
+  bar[BOOT_PROFILER_BAR_WIDTH] = '\0';
+  Serial.printf("|%s|\n", bar);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void bootProfilerBegin() {
+  uint32_t bootCount = 0;
+  previousValid = timelineValid(rtcTimeline);
+  if (previousValid) {
+    previousTimeline = rtcTimeline;
+    for (int i = 0; i < previousTimeline.stepCount; i++) {
+      previousTimeline.steps[i].name[BOOT_PROFILER_NAME_LENGTH - 1] = '\0';
+    }
+    bootCount = previousTimeline.bootCount;
+  }
+
+  memset(&rtcTimeline, 0, sizeof(BootTimeline));
+  rtcTimeline.magic = BOOT_PROFILER_MAGIC;
+  rtcTimeline.bootCount = bootCount + 1;
+}
+
+uint8_t bootProfilerStepBegin(const char* name) {
+  if (rtcTimeline.stepCount >= BOOT_PROFILER_MAX_STEPS) {
+    return BOOT_PROFILER_NO_STEP;
+  }
+  uint8_t index = rtcTimeline.stepCount++;
+  BootStep& step = rtcTimeline.steps[index];
+  strncpy(step.name, name != nullptr ? name : "?", BOOT_PROFILER_NAME_LENGTH - 1);
+  step.name[BOOT_PROFILER_NAME_LENGTH - 1] = '\0';
+  step.depth = rtcTimeline.openDepth++;
+  step.finished = false;
+  step.startUs = micros();
+  return index;
+}
+
+void bootProfilerStepEnd(uint8_t index) {
+  uint32_t now = micros();
+  if (index >= rtcTimeline.stepCount || rtcTimeline.steps[index].finished) {
+    return;
+  }
+  BootStep& step = rtcTimeline.steps[index];
+  step.endUs = now;
+  step.finished = true;
+  if (rtcTimeline.openDepth > 0) {
+    rtcTimeline.openDepth--;
+  }
+}
+
+void bootProfilerAddStep(const char* name, uint32_t startUs, uint32_t endUs) {
+  if (rtcTimeline.stepCount >= BOOT_PROFILER_MAX_STEPS) {
+    return;
+  }
+  BootStep& step = rtcTimeline.steps[rtcTimeline.stepCount++];
+  strncpy(step.name, name != nullptr ? name : "?", BOOT_PROFILER_NAME_LENGTH - 1);
+  step.name[BOOT_PROFILER_NAME_LENGTH - 1] = '\0';
+  step.depth = rtcTimeline.openDepth;
+  step.startUs = startUs;
+  step.endUs = endUs;
+  step.finished = true;
+}
+
+void bootProfilerFinish() {
+  rtcTimeline.totalUs = micros();
+  rtcTimeline.complete = true;
+}
+
+const BootTimeline* bootProfilerGetTimeline() {
+  return &rtcTimeline;
+}
+
+const BootTimeline* bootProfilerGetPreviousTimeline() {
+  return previousValid ? &previousTimeline : nullptr;
+}
+
+const char* bootProfilerStalledStep(const BootTimeline* timeline) {
+  if (timeline == nullptr || timeline->complete) {
+    return nullptr;
+  }
+  for (int i = timeline->stepCount - 1; i >= 0; i--) {
+    if (!timeline->steps[i].finished) {
+      return timeline->steps[i].name;
+    }
+  }
+  return timeline->stepCount > 0 ? timeline->steps[timeline->stepCount - 1].name : nullptr;
+}
+
+void bootProfilerPrintWaterfall(const BootTimeline* timeline) {
+  uint32_t scaleUs = timeline->totalUs;
+  for (int i = 0; i < timeline->stepCount; i++) {
+    const BootStep& step = timeline->steps[i];
+    uint32_t end = step.finished ? step.endUs : step.startUs;
+    if (end > scaleUs) scaleUs = end;
+  }
+  if (scaleUs == 0) {
+    scaleUs = 1;
+  }
+
+  Serial.printf("Démarrage #%lu : %.1f ms (objectif %d ms)%s\n",
+                (unsigned long)timeline->bootCount, timeline->totalUs / 1000.0f, BOOT_TARGET_MS,
+                timeline->complete ? "" : " - INTERROMPU");
+  // Largeurs +1 : « é » occupe deux octets en UTF-8
+  Serial.printf("%-*s %11s %11s  cascade\n", BOOT_PROFILER_NAME_LENGTH + 5, "étape", "début ms", "durée ms");
+
+  for (int i = 0; i < timeline->stepCount; i++) {
+    const BootStep& step = timeline->steps[i];
+    char label[BOOT_PROFILER_NAME_LENGTH + 8];
+    int indent = step.depth < 4 ? step.depth * 2 : 8;
+    snprintf(label, sizeof(label), "%*s%s", indent, "", step.name);
+
+    Serial.printf("%-*s %10.1f ", BOOT_PROFILER_NAME_LENGTH + 4, label, step.startUs / 1000.0f);
+    if (step.finished) {
+      Serial.printf("%10.1f  ", stepDuration(step) / 1000.0f);
+    } else {
+      Serial.printf("%10s  ", "inachevée");
+    }
+    printBar(step.startUs, stepDuration(step), scaleUs);
+  }
+
+  if (timeline->complete && timeline->totalUs > (uint32_t)BOOT_TARGET_MS * 1000u) {
+    Serial.printf("Démarrage au-delà de l'objectif de %d ms (+%.1f ms)\n", BOOT_TARGET_MS,
+                  (timeline->totalUs - BOOT_TARGET_MS * 1000u) / 1000.0f);
+  }
+}
+
+int bootProfilerCompareBaseline(const BootTimeline* timeline, const char* baselinePath, bool updateBaseline) {
+  if (timeline == nullptr || !timeline->complete) {
+    return -1;
+  }
+
+  static BenchmarkResult results[BOOT_PROFILER_MAX_STEPS + 1];
+  static BenchmarkBaselineEntry baseline[BOOT_PROFILER_MAX_STEPS + 1];
+  int count = 0;
+  for (int i = 0; i < timeline->stepCount; i++) {
+    const BootStep& step = timeline->steps[i];
+    if (!step.finished) {
+      continue;
+    }
+    BenchmarkResult& result = results[count++];
+    memset(&result, 0, sizeof(BenchmarkResult));
+    strncpy(result.name, step.name, BENCHMARK_NAME_LENGTH - 1);
+    result.iterations = 1;
+    result.min = result.median = result.p99 = result.max = result.mean = stepDuration(step);
+  }
+  BenchmarkResult& total = results[count++];
+  memset(&total, 0, sizeof(BenchmarkResult));
+  strncpy(total.name, "total", BENCHMARK_NAME_LENGTH - 1);
+  total.iterations = 1;
+  total.min = total.median = total.p99 = total.max = total.mean = timeline->totalUs;
+
+  int baselineCount = benchmarkLoadBaseline(baselinePath, baseline, BOOT_PROFILER_MAX_STEPS + 1, "us");
+  int regressions = 0;
+
+  for (int i = 0; i < count; i++) {
+    float delta = 0;
+    BenchmarkVerdict verdict = benchmarkCompare(results[i], baseline, baselineCount, &delta);
+    if (verdict != BENCH_REGRESSED && verdict != BENCH_IMPROVED) {
+      continue;
+    }
+    uint32_t reference = 0;
+    for (int j = 0; j < baselineCount; j++) {
+      if (strcmp(baseline[j].name, results[i].name) == 0) {
+        reference = baseline[j].median;
+        break;
+      }
+    }
+    uint32_t absoluteDelta = results[i].median > reference ? results[i].median - reference
+                                                           : reference - results[i].median;
+    if (absoluteDelta < BOOT_PROFILER_MIN_DELTA_US) {
+      continue;
+    }
+    if (verdict == BENCH_REGRESSED) {
+      regressions++;
+      LOG_WARNING("BOOT", "Régression %s : %.1f ms (référence %.1f ms, %+.0f%%)",
+                  results[i].name, results[i].median / 1000.0f, reference / 1000.0f, delta);
+    } else {
+      LOG_INFO("BOOT", "Amélioration %s : %.1f ms (référence %.1f ms, %+.0f%%)",
+               results[i].name, results[i].median / 1000.0f, reference / 1000.0f, delta);
+    }
+  }
+
+  if (updateBaseline || baselineCount < 0) {
+    benchmarkSaveBaseline(baselinePath, results, count, "us");
+  }
+  return regressions;
+}
@@ -0,0 +1,156 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de stockage des données (Implémentation)
+  -----------------------
+
+  Implémentation de la persistance des données de calibration en NVS.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  La calibration est stockée sous forme d'un bloc binaire unique dans l'espace
+  de noms NVS CALIBRATION_NVS_NAMESPACE via la bibliothèque Preferences.
+
+  Principes de fonctionnement :
+  1. Le bloc porte un magic, une version de format et un CRC32 final
+  2. Au chargement, taille, magic, version et CRC sont vérifiés avant toute utilisation
+  3. Un bloc invalide est ignoré : le système démarre à froid avec les valeurs par défaut
+  4. L'écriture est faite en une seule opération putBytes (atomique côté NVS)
+
+  Interactions avec d'autres modules :
+  - Main : Chargement au démarrage et choix du démarrage rapide
+  - PotentiometerManager / IMU / Servo : Sauvegarde après calibration
+*/
+
+#include "utils/data_storage.h"
+#include "core/logging.h"
+#include <Preferences.h>
+
+// Clé du bloc de calibration dans l'espace de noms NVS
+static const char* CALIBRATION_KEY = "calib";
+
+static Preferences preferences;
+static bool storageInitialized = false;
+
+// Table CRC32 calculée au premier usage (1 Ko en RAM plutôt qu'un calcul bit à bit)
+static uint32_t crcTable[256];
+static bool crcTableReady = false;
+
+static void buildCrcTable() {
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++) {
+      c = (c & 1) ? (0xEDB88320UL ^ (c >> 1)) : (c >> 1);
+    }
+    crcTable[i] = c;
+  }
+  crcTableReady = true;
+}
+
+uint32_t dataStorageCrc32(const void* data, size_t length, uint32_t crc) {
+  if (!crcTableReady) {
+    buildCrcTable();
+  }
+
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = crcTable[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+// CRC d'un bloc de calibration (tous les champs sauf le CRC lui-même)
+static uint32_t calibrationCrc(const CalibrationData* data) {
+  return dataStorageCrc32(data, offsetof(CalibrationData, crc));
+}
+
+bool dataStorageInit() {
+  if (storageInitialized) {
+    return true;
+  }
+
+  if (!preferences.begin(CALIBRATION_NVS_NAMESPACE, false)) {
+    LOG_ERROR("STORAGE", "Impossible d'ouvrir l'espace NVS '%s'", CALIBRATION_NVS_NAMESPACE);
+    return false;
+  }
+
+  storageInitialized = true;
+  LOG_INFO("STORAGE", "Stockage persistant initialisé");
+  return true;
+}
+
+void dataStorageDefaultCalibration(CalibrationData* data) {
+  memset(data, 0, sizeof(CalibrationData));
+  data->magic = CALIBRATION_DATA_MAGIC;
+  data->version = CALIBRATION_DATA_VERSION;
+  for (int i = 0; i < 3; i++) {
+    data->potMin[i] = 0;
+    data->potMax[i] = ADC_RESOLUTION;
+  }
+}
+
+bool dataStorageLoadCalibration(CalibrationData* data) {
+  if (!dataStorageInit()) {
+    return false;
+  }
+
+  if (preferences.getBytesLength(CALIBRATION_KEY) != sizeof(CalibrationData)) {
+    LOG_INFO("STORAGE", "Aucune calibration persistée (démarrage à froid)");
+    return false;
+  }
+
+  CalibrationData stored;
+  if (preferences.getBytes(CALIBRATION_KEY, &stored, sizeof(stored)) != sizeof(stored)) {
+    LOG_ERROR("STORAGE", "Lecture de la calibration impossible");
+    return false;
+  }
+
+  if (stored.magic != CALIBRATION_DATA_MAGIC || stored.version != CALIBRATION_DATA_VERSION) {
+    LOG_WARNING("STORAGE", "Calibration ignorée (format %u, attendu %u)",
+                stored.version, CALIBRATION_DATA_VERSION);
+    return false;
+  }
+
+  uint32_t crc = calibrationCrc(&stored);
+  if (crc != stored.crc) {
+    LOG_WARNING("STORAGE", "Calibration corrompue (CRC %08lX != %08lX)",
+                (unsigned long)crc, (unsigned long)stored.crc);
+    return false;
+  }
+
+  *data = stored;
+  LOG_INFO("STORAGE", "Calibration chargée (flags 0x%02X)", stored.flags);
+  return true;
+}
+
+bool dataStorageSaveCalibration(CalibrationData* data) {
+  if (!dataStorageInit()) {
+    return false;
+  }
+
+  data->magic = CALIBRATION_DATA_MAGIC;
+  data->version = CALIBRATION_DATA_VERSION;
+  data->crc = calibrationCrc(data);
+
+  if (preferences.putBytes(CALIBRATION_KEY, data, sizeof(CalibrationData)) != sizeof(CalibrationData)) {
+    LOG_ERROR("STORAGE", "Échec d'écriture de la calibration");
+    return false;
+  }
+
+  LOG_INFO("STORAGE", "Calibration sauvegardée (flags 0x%02X, CRC %08lX)",
+           data->flags, (unsigned long)data->crc);
+  return true;
+}
+
+bool dataStorageInvalidateCalibration() {
+  if (!dataStorageInit()) {
+    return false;
+  }
+
+  bool removed = preferences.remove(CALIBRATION_KEY);
+  LOG_INFO("STORAGE", "Calibration persistée effacée");
+  return removed;
+}
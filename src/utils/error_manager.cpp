@@ -42,15 +42,17 @@ ErrorManager::ErrorManager() {
     // Création du mutex pour la protection des accès concurrents
     errorMutex = xSemaphoreCreateMutex();
     
-    // Initialisation du callback critique
+    // Initialisation du callback critique et de l'observateur
     criticalErrorCallback = nullptr;
+    errorObserver = nullptr;
     
     // Initialisation des compteurs d'erreurs
     memset(errorCounts, 0, sizeof(errorCounts));
     
     // Initialisation des stratégies de récupération par défaut
-    for (int i = 0; i <= static_cast<int>(ErrorCode::TASK_CREATION_ERROR); i++) {
+    for (int i = 0; i < ERROR_CODE_COUNT; i++) {
         recoveryStrategies[i] = RecoveryStrategy::NONE;
+        recoveryHandlers[i] = nullptr;
     }
     
     // Configuration de quelques stratégies de récupération par défaut
@@ -128,9 +130,15 @@ bool ErrorManager::reportError(ErrorCode code, ErrorSeverity severity, const cha
     }
     errorHistory.push_back(error);
     
+    ErrorObserver observer = errorObserver;
+    
     // Libération du mutex
     xSemaphoreGive(errorMutex);
     
+    if (observer != nullptr) {
+        observer(error);
+    }
+    
     // Journalisation de l'erreur avec le niveau approprié
     const char* severityStr = "INCONNU";
     switch (severity) {
@@ -207,6 +215,7 @@ bool ErrorManager::reportError(ErrorCode code, const char* module, const char* d
 bool ErrorManager::attemptRecovery(ErrorCode code) {
     bool success = false;
     RecoveryStrategy strategy;
+    RecoveryHandler handler;
     
     // Acquisition du mutex
     if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
@@ -214,12 +223,23 @@ bool ErrorManager::attemptRecovery(ErrorCode code) {
         return false;
     }
     
-    // Récupération de la stratégie configurée
+    // Récupération de la stratégie et de l'action configurées
     strategy = recoveryStrategies[static_cast<int>(code)];
+    handler = recoveryHandlers[static_cast<int>(code)];
     
     // Libération du mutex
     xSemaphoreGive(errorMutex);
     
+    // Action du module propriétaire : l'erreur n'est résolue que si le
+    // composant est de nouveau opérationnel
+    if (handler != nullptr && strategy != RecoveryStrategy::NONE) {
+        success = handler(code, strategy);
+        if (success) {
+            resolveError(code);
+        }
+        return success;
+    }
+    
     // Implémentation des stratégies de récupération
     switch (strategy) {
         case RecoveryStrategy::NONE:
@@ -294,6 +314,72 @@ void ErrorManager::setRecoveryStrategy(ErrorCode code, RecoveryStrategy strategy
     }
 }
 
+/**
+ * Enregistre l'action de récupération d'un code d'erreur
+ * @param code Code d'erreur
+ * @param handler Action de récupération (nullptr pour la retirer)
+ */
+void ErrorManager::setRecoveryHandler(ErrorCode code, RecoveryHandler handler) {
+    if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        recoveryHandlers[static_cast<int>(code)] = handler;
+        xSemaphoreGive(errorMutex);
+    } else {
+        LOG_ERROR("ERROR_MGR", "Impossible d'acquérir le mutex pour définir l'action de récupération");
+    }
+}
+
+/**
+ * Définit l'observateur des signalements et résolutions
+ * @param observer Fonction à appeler (nullptr pour le retirer)
+ */
+void ErrorManager::setErrorObserver(ErrorObserver observer) {
+    if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        errorObserver = observer;
+        xSemaphoreGive(errorMutex);
+    } else {
+        LOG_ERROR("ERROR_MGR", "Impossible d'acquérir le mutex pour définir l'observateur");
+    }
+}
+
+/**
+ * Relance la récupération des erreurs non résolues ayant une action enregistrée
+ * @return Nombre d'erreurs résolues
+ */
+int ErrorManager::processPendingRecoveries() {
+    ErrorCode pending[MAX_ERROR_HISTORY];
+    int pendingCount = 0;
+    
+    // Codes distincts à traiter, relevés sous mutex (les actions sont
+    // appelées hors mutex car elles peuvent signaler de nouvelles erreurs)
+    if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        LOG_ERROR("ERROR_MGR", "Impossible d'acquérir le mutex pour les récupérations en attente");
+        return 0;
+    }
+    for (const auto& error : errorHistory) {
+        int index = static_cast<int>(error.code);
+        if (error.resolved || recoveryHandlers[index] == nullptr ||
+            recoveryStrategies[index] == RecoveryStrategy::NONE) {
+            continue;
+        }
+        bool known = false;
+        for (int i = 0; i < pendingCount; i++) {
+            known = known || pending[i] == error.code;
+        }
+        if (!known && pendingCount < MAX_ERROR_HISTORY) {
+            pending[pendingCount++] = error.code;
+        }
+    }
+    xSemaphoreGive(errorMutex);
+    
+    int recovered = 0;
+    for (int i = 0; i < pendingCount; i++) {
+        if (attemptRecovery(pending[i])) {
+            recovered++;
+        }
+    }
+    return recovered;
+}
+
 /**
  * Définit un callback pour les erreurs critiques
  * @param callback Fonction à appeler lors d'une erreur critique
@@ -347,6 +433,21 @@ uint32_t ErrorManager::getErrorCount(ErrorCode code) {
     return count;
 }
 
+uint32_t ErrorManager::getTotalErrorCount() {
+    uint32_t total = 0;
+    
+    if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        for (int i = 0; i < ERROR_CODE_COUNT; i++) {
+            total += errorCounts[i];
+        }
+        xSemaphoreGive(errorMutex);
+    } else {
+        LOG_ERROR("ERROR_MGR", "Impossible d'acquérir le mutex pour récupérer le total des erreurs");
+    }
+    
+    return total;
+}
+
 /**
  * Marque une erreur comme résolue
  * @param code Code d'erreur à marquer comme résolu
@@ -355,6 +456,7 @@ uint32_t ErrorManager::getErrorCount(ErrorCode code) {
  */
 bool ErrorManager::resolveError(ErrorCode code, const char* module) {
     bool resolved = false;
+    ErrorDetails resolvedError;
     
     // Acquisition du mutex
     if (xSemaphoreTake(errorMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
@@ -364,13 +466,20 @@ bool ErrorManager::resolveError(ErrorCode code, const char* module) {
                 (module == nullptr || strcmp(error.module, module) == 0)) {
                 error.resolved = true;
                 resolved = true;
+                resolvedError = error;
                 
                 LOG_INFO("ERROR_MGR", "Erreur %d du module %s marquée comme résolue", 
                         static_cast<int>(code), error.module);
             }
         }
         
+        ErrorObserver observer = errorObserver;
         xSemaphoreGive(errorMutex);
+        
+        if (resolved && observer != nullptr) {
+            resolvedError.timestamp = millis();
+            observer(resolvedError);
+        }
     } else {
         LOG_ERROR("ERROR_MGR", "Impossible d'acquérir le mutex pour résoudre l'erreur");
     }
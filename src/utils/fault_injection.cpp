@@ -0,0 +1,414 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module d'injection de fautes (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. faultInjectionUpdate() compare l'horloge à chaque événement : injection
+     au début, fin après la durée. Une faute de tas réserve des blocs jusqu'au
+     tas libre demandé et les libère à la fin
+  2. Les points d'injection parcourent les événements actifs (au plus
+     FAULT_INJECTION_MAX_EVENTS) : NAK sur l'adresse, dernière valeur figée,
+     bruit gaussien (Box-Muller sur un xorshift32), tâche bloquée
+  3. L'observateur du ErrorManager reconnaît le canal de santé d'un événement
+     (code d'erreur et nom de module) :
+     - détection = premier signalement après l'injection
+     - récupération = résolution après la fin de la faute, ou fin de la faute
+       si le canal était déjà rétabli
+  4. Latences rapportées : détection - injection, récupération - fin de faute
+*/
+
+#include "utils/fault_injection.h"
+#include "utils/error_manager.h"
+#include "utils/logging.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// === VARIABLES GLOBALES ===
+static FaultEvent events[FAULT_INJECTION_MAX_EVENTS];
+static int eventCount = 0;
+static bool scenarioRunning = false;
+static unsigned long scenarioStart = 0;
+
+// Dernière valeur de chaque composante figée, par capteur
+static float stuckValues[FAULT_SENSOR_COUNT][3];
+static bool stuckLatched[FAULT_SENSOR_COUNT][3];
+
+// Canaux de santé actuellement en défaut (selon l'observateur)
+static bool channelOpen[HEALTH_CHANNEL_COUNT];
+
+static void* heapBlocks[FAULT_HEAP_MAX_BLOCKS];
+static int heapBlockCount = 0;
+
+static uint32_t noiseState = 0x2545F491u;
+
+// === FONCTIONS INTERNES ===
+
+static const char* faultTypeName(FaultType type) {
+  switch (type) {
+    case FAULT_I2C_NAK:         return "i2c_nak";
+    case FAULT_SENSOR_STUCK:    return "stuck";
+    case FAULT_SENSOR_NOISE:    return "noise";
+    case FAULT_TASK_STALL:      return "stall";
+    case FAULT_HEAP_EXHAUSTION: return "heap";
+  }
+  return "?";
+}
+
+/**
+ * Canal de santé chargé de détecter un événement
+ */
+static HealthChannel channelForFault(FaultType type, uint8_t target) {
+  switch (type) {
+    case FAULT_I2C_NAK:
+      return target == LCD_I2C_ADDR ? HEALTH_BUS_DISPLAY : HEALTH_CHANNEL_COUNT;
+    case FAULT_SENSOR_STUCK:
+    case FAULT_SENSOR_NOISE:
+      if (target == FAULT_SENSOR_IMU) return HEALTH_SENSOR_IMU;
+      if (target == FAULT_SENSOR_LINE_LENGTH) return HEALTH_SENSOR_LINE_LENGTH;
+      if (target == FAULT_SENSOR_WIND) return HEALTH_SENSOR_WIND;
+      return HEALTH_CHANNEL_COUNT;
+    case FAULT_TASK_STALL:
+      return target == FAULT_TASK_CONTROL ? HEALTH_TASK_CONTROL : HEALTH_TASK_SENSOR;
+    case FAULT_HEAP_EXHAUSTION:
+      return HEALTH_HEAP;
+  }
+  return HEALTH_CHANNEL_COUNT;
+}
+
+static HealthChannel channelForError(const ErrorDetails& error) {
+  for (int i = 0; i < HEALTH_CHANNEL_COUNT; i++) {
+    if (strcmp(error.module, healthMonitorChannelName((HealthChannel)i)) == 0) {
+      return (HealthChannel)i;
+    }
+  }
+  return HEALTH_CHANNEL_COUNT;
+}
+
+/**
+ * Observateur du ErrorManager : datation des détections et des récupérations
+ */
+static void observeError(const ErrorDetails& error) {
+  HealthChannel channel = channelForError(error);
+  if (channel == HEALTH_CHANNEL_COUNT) {
+    return;
+  }
+  channelOpen[channel] = !error.resolved;
+
+  for (int i = 0; i < eventCount; i++) {
+    FaultEvent& event = events[i];
+    if (event.channel != channel || !(event.active || event.done)) {
+      continue;
+    }
+    if (!error.resolved && !event.detected && error.timestamp >= event.injectedAt) {
+      event.detected = true;
+      event.detectedAt = error.timestamp;
+    } else if (error.resolved && event.done && event.detected && !event.recovered) {
+      event.recovered = true;
+      event.recoveredAt = error.timestamp;
+    }
+  }
+}
+
+static float gaussianNoise() {
+  noiseState ^= noiseState << 13;
+  noiseState ^= noiseState >> 17;
+  noiseState ^= noiseState << 5;
+  float u1 = ((noiseState >> 8) + 1.0f) / 16777217.0f;
+  noiseState ^= noiseState << 13;
+  noiseState ^= noiseState >> 17;
+  noiseState ^= noiseState << 5;
+  float u2 = (noiseState >> 8) / 16777216.0f;
+  return sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+static void exhaustHeap(uint32_t remaining) {
+  while (heapBlockCount < FAULT_HEAP_MAX_BLOCKS &&
+         ESP.getFreeHeap() > remaining + FAULT_HEAP_BLOCK_SIZE) {
+    void* block = malloc(FAULT_HEAP_BLOCK_SIZE);
+    if (block == nullptr) {
+      break;
+    }
+    memset(block, 0xA5, FAULT_HEAP_BLOCK_SIZE);
+    heapBlocks[heapBlockCount++] = block;
+#ifdef NATIVE_BUILD
+    nativeFreeHeap -= FAULT_HEAP_BLOCK_SIZE;
+#endif
+  }
+}
+
+static void releaseHeap() {
+  while (heapBlockCount > 0) {
+    free(heapBlocks[--heapBlockCount]);
+#ifdef NATIVE_BUILD
+    nativeFreeHeap += FAULT_HEAP_BLOCK_SIZE;
+#endif
+  }
+}
+
+static void injectFault(FaultEvent& event, unsigned long now) {
+  event.active = true;
+  event.injectedAt = now;
+  if (event.type == FAULT_SENSOR_STUCK && event.target < FAULT_SENSOR_COUNT) {
+    memset(stuckLatched[event.target], 0, sizeof(stuckLatched[event.target]));
+  } else if (event.type == FAULT_HEAP_EXHAUSTION) {
+    exhaustHeap((uint32_t)event.amplitude);
+  }
+  LOG_WARNING("FAULT", "Injection %s (cible 0x%02X) pour %lu ms",
+              faultTypeName(event.type), event.target, (unsigned long)event.duration);
+}
+
+static void clearFault(FaultEvent& event, unsigned long now) {
+  event.active = false;
+  event.done = true;
+  event.clearedAt = now;
+  if (event.type == FAULT_HEAP_EXHAUSTION) {
+    releaseHeap();
+  }
+  // Canal déjà rétabli pendant la faute : récupéré dès la fin de la faute
+  if (event.detected && event.channel != HEALTH_CHANNEL_COUNT && !channelOpen[event.channel]) {
+    event.recovered = true;
+    event.recoveredAt = now;
+  }
+  LOG_INFO("FAULT", "Fin de la faute %s (cible 0x%02X)", faultTypeName(event.type), event.target);
+}
+
+static bool parseTarget(FaultType type, const char* text, uint8_t* target) {
+  switch (type) {
+    case FAULT_I2C_NAK: {
+      char* end = nullptr;
+      unsigned long address = strtoul(text, &end, 0);
+      *target = (uint8_t)address;
+      return end != text && *end == '\0' && address < 128;
+    }
+    case FAULT_SENSOR_STUCK:
+    case FAULT_SENSOR_NOISE:
+      if (strcmp(text, "imu") == 0) *target = FAULT_SENSOR_IMU;
+      else if (strcmp(text, "line") == 0) *target = FAULT_SENSOR_LINE_LENGTH;
+      else if (strcmp(text, "wind") == 0) *target = FAULT_SENSOR_WIND;
+      else return false;
+      return true;
+    case FAULT_TASK_STALL:
+      if (strcmp(text, "control") == 0) *target = FAULT_TASK_CONTROL;
+      else if (strcmp(text, "sensor") == 0) *target = FAULT_TASK_SENSOR;
+      else return false;
+      return true;
+    case FAULT_HEAP_EXHAUSTION:
+      *target = 0;
+      return true;
+  }
+  return false;
+}
+
+static bool parseLine(const char* line) {
+  unsigned long startTime = 0;
+  unsigned long duration = 0;
+  char typeName[16];
+  char targetName[16];
+  float amplitude = 0;
+
+  int fields = sscanf(line, "%lu %15s %15s %lu %f", &startTime, typeName, targetName, &duration, &amplitude);
+  if (fields < 4) {
+    return false;
+  }
+
+  FaultType type;
+  if (strcmp(typeName, "i2c_nak") == 0) type = FAULT_I2C_NAK;
+  else if (strcmp(typeName, "stuck") == 0) type = FAULT_SENSOR_STUCK;
+  else if (strcmp(typeName, "noise") == 0) type = FAULT_SENSOR_NOISE;
+  else if (strcmp(typeName, "stall") == 0) type = FAULT_TASK_STALL;
+  else if (strcmp(typeName, "heap") == 0) type = FAULT_HEAP_EXHAUSTION;
+  else return false;
+
+  uint8_t target;
+  if (!parseTarget(type, targetName, &target)) {
+    return false;
+  }
+  return faultInjectionAdd(type, target, startTime, duration, amplitude);
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void faultInjectionInit() {
+  releaseHeap();
+  memset(events, 0, sizeof(events));
+  memset(stuckLatched, 0, sizeof(stuckLatched));
+  memset(channelOpen, 0, sizeof(channelOpen));
+  eventCount = 0;
+  scenarioRunning = false;
+  ErrorManager::getInstance()->setErrorObserver(observeError);
+}
+
+bool faultInjectionAdd(FaultType type, uint8_t target, uint32_t startTime, uint32_t duration, float amplitude) {
+  if (eventCount >= FAULT_INJECTION_MAX_EVENTS) {
+    LOG_ERROR("FAULT", "Scénario plein (%d événements)", FAULT_INJECTION_MAX_EVENTS);
+    return false;
+  }
+  FaultEvent& event = events[eventCount++];
+  memset(&event, 0, sizeof(FaultEvent));
+  event.type = type;
+  event.target = target;
+  event.startTime = startTime;
+  event.duration = duration;
+  event.amplitude = amplitude;
+  event.channel = channelForFault(type, target);
+  return true;
+}
+
+int faultInjectionParseScript(const char* text) {
+  int added = 0;
+  int lineNumber = 0;
+  char line[96];
+
+  while (text != nullptr && *text != '\0') {
+    const char* end = strchr(text, '\n');
+    size_t length = end != nullptr ? (size_t)(end - text) : strlen(text);
+    if (length >= sizeof(line)) {
+      length = sizeof(line) - 1;
+    }
+    memcpy(line, text, length);
+    line[length] = '\0';
+    text = end != nullptr ? end + 1 : text + strlen(text);
+    lineNumber++;
+
+    char* comment = strchr(line, '#');
+    if (comment != nullptr) {
+      *comment = '\0';
+    }
+    const char* content = line;
+    while (*content == ' ' || *content == '\t' || *content == '\r') {
+      content++;
+    }
+    if (*content == '\0') {
+      continue;
+    }
+    if (!parseLine(content)) {
+      LOG_ERROR("FAULT", "Scénario invalide, ligne %d : %s", lineNumber, content);
+      return -1;
+    }
+    added++;
+  }
+  return added;
+}
+
+int faultInjectionLoadScript(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return -1;
+  }
+  static char script[1024];
+  size_t length = fread(script, 1, sizeof(script) - 1, file);
+  script[length] = '\0';
+  fclose(file);
+
+  int added = faultInjectionParseScript(script);
+  if (added >= 0) {
+    LOG_INFO("FAULT", "Scénario %s : %d fautes", path, added);
+  }
+  return added;
+}
+
+void faultInjectionStart() {
+  scenarioStart = millis();
+  scenarioRunning = eventCount > 0;
+}
+
+void faultInjectionUpdate() {
+  if (!scenarioRunning) {
+    return;
+  }
+  unsigned long now = millis();
+  unsigned long elapsed = now - scenarioStart;
+  bool pending = false;
+
+  for (int i = 0; i < eventCount; i++) {
+    FaultEvent& event = events[i];
+    if (!event.active && !event.done && elapsed >= event.startTime) {
+      injectFault(event, now);
+    }
+    if (event.active && elapsed >= event.startTime + event.duration) {
+      clearFault(event, now);
+    }
+    pending = pending || !event.done;
+  }
+  scenarioRunning = pending;
+}
+
+bool faultInjectionIsRunning() {
+  return scenarioRunning;
+}
+
+bool faultI2cNak(uint8_t address) {
+  for (int i = 0; i < eventCount; i++) {
+    if (events[i].active && events[i].type == FAULT_I2C_NAK && events[i].target == address) {
+      return true;
+    }
+  }
+  return false;
+}
+
+float faultFilterSensor(FaultSensor sensor, uint8_t axis, float value) {
+  if (sensor >= FAULT_SENSOR_COUNT || axis >= 3) {
+    return value;
+  }
+  for (int i = 0; i < eventCount; i++) {
+    const FaultEvent& event = events[i];
+    if (!event.active || event.target != sensor) {
+      continue;
+    }
+    if (event.type == FAULT_SENSOR_STUCK) {
+      if (!stuckLatched[sensor][axis]) {
+        stuckLatched[sensor][axis] = true;
+        stuckValues[sensor][axis] = value;
+      }
+      value = stuckValues[sensor][axis];
+    } else if (event.type == FAULT_SENSOR_NOISE) {
+      value += event.amplitude * gaussianNoise();
+    }
+  }
+  return value;
+}
+
+bool faultTaskStalled(FaultTask task) {
+  for (int i = 0; i < eventCount; i++) {
+    if (events[i].active && events[i].type == FAULT_TASK_STALL && events[i].target == task) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int faultInjectionGetEvents(const FaultEvent** result) {
+  *result = events;
+  return eventCount;
+}
+
+void faultInjectionPrintReport() {
+  Serial.printf("Faute    Cible  Canal         Détection  Récupération  Indisponibilité\n");
+  for (int i = 0; i < eventCount; i++) {
+    const FaultEvent& event = events[i];
+    const char* channel = event.channel != HEALTH_CHANNEL_COUNT ? healthMonitorChannelName(event.channel) : "-";
+    Serial.printf("%-8s 0x%02X   %-12s  ", faultTypeName(event.type), event.target, channel);
+    if (!event.active && !event.done) {
+      Serial.printf("non injectée\n");
+      continue;
+    }
+    if (event.detected) {
+      Serial.printf("%6lu ms  ", event.detectedAt - event.injectedAt);
+    } else {
+      Serial.printf("  non détectée  ");
+    }
+    if (event.recovered) {
+      Serial.printf("%9lu ms  %11lu ms\n", event.recoveredAt - event.clearedAt,
+                    event.recoveredAt - event.injectedAt);
+    } else {
+      Serial.printf("%12s\n", event.done ? "en défaut" : "en cours");
+    }
+  }
+}
@@ -0,0 +1,244 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compression Gorilla des échantillons (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Les bits sont écrits par paquets de 8 au plus dans l'octet courant,
+     poids fort en premier ; le tampon est remis à zéro à l'ouverture du bloc
+  2. Un échantillon régulier (période constante) coûte 1 bit d'horodatage,
+     un canal inchangé 1 bit, un canal bruité ses seuls bits significatifs
+  3. La fenêtre d'un canal (zéros de tête et de queue) n'est renouvelée que
+     si le XOR en sort : les variations de même ordre de grandeur se
+     suivent sans en répéter la description
+  4. Le décodeur refuse toute lecture au-delà des octets utiles du bloc
+*/
+
+#include "utils/gorilla.h"
+#include <string.h>
+
+// === CONSTANTES ===
+#define WINDOW_NONE        0xFF   // Canal sans fenêtre (premier XOR non nul à venir)
+#define FIRST_SAMPLE_BITS  32
+#define WORST_TS_BITS      (4 + 32)
+#define WORST_VALUE_BITS   (2 + 5 + 5 + 32)
+
+// === FONCTIONS INTERNES ===
+
+static void writeBits(GorillaEncoder* encoder, uint32_t value, uint8_t bits) {
+  while (bits > 0) {
+    uint8_t room = 8 - (encoder->bitCount & 7);
+    uint8_t take = bits < room ? bits : room;
+    uint8_t chunk = (value >> (bits - take)) & ((1u << take) - 1);
+    encoder->buffer[encoder->bitCount >> 3] |= chunk << (room - take);
+    encoder->bitCount += take;
+    bits -= take;
+  }
+}
+
+static uint32_t readBits(GorillaDecoder* decoder, uint8_t bits) {
+  if (decoder->bitCount + bits > decoder->lengthBits) {
+    decoder->error = true;
+    return 0;
+  }
+  uint32_t value = 0;
+  while (bits > 0) {
+    uint8_t room = 8 - (decoder->bitCount & 7);
+    uint8_t take = bits < room ? bits : room;
+    uint8_t byte = decoder->buffer[decoder->bitCount >> 3];
+    value = (value << take) | ((byte >> (room - take)) & ((1u << take) - 1));
+    decoder->bitCount += take;
+    bits -= take;
+  }
+  return value;
+}
+
+static uint32_t floatBits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float bitsFloat(uint32_t bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * Étend le signe d'une valeur de n bits
+ */
+static int32_t signExtend(uint32_t value, uint8_t bits) {
+  uint32_t sign = 1u << (bits - 1);
+  return (int32_t)((value ^ sign) - sign);
+}
+
+static void encodeTimestamp(GorillaEncoder* encoder, uint32_t timestampMs) {
+  uint32_t delta = timestampMs - encoder->previousTs;
+  int32_t dod = (int32_t)(delta - encoder->previousDelta);
+  if (dod == 0) {
+    writeBits(encoder, 0x0, 1);
+  } else if (dod >= -64 && dod <= 63) {
+    writeBits(encoder, 0x2, 2);
+    writeBits(encoder, (uint32_t)dod & 0x7F, 7);
+  } else if (dod >= -256 && dod <= 255) {
+    writeBits(encoder, 0x6, 3);
+    writeBits(encoder, (uint32_t)dod & 0x1FF, 9);
+  } else if (dod >= -2048 && dod <= 2047) {
+    writeBits(encoder, 0xE, 4);
+    writeBits(encoder, (uint32_t)dod & 0xFFF, 12);
+  } else {
+    writeBits(encoder, 0xF, 4);
+    writeBits(encoder, (uint32_t)dod, 32);
+  }
+  encoder->previousDelta = delta;
+  encoder->previousTs = timestampMs;
+}
+
+static void encodeValue(GorillaEncoder* encoder, uint8_t channel, uint32_t bits) {
+  uint32_t xorValue = bits ^ encoder->previousBits[channel];
+  encoder->previousBits[channel] = bits;
+  if (xorValue == 0) {
+    writeBits(encoder, 0x0, 1);
+    return;
+  }
+
+  uint8_t leading = __builtin_clz(xorValue);
+  uint8_t trailing = __builtin_ctz(xorValue);
+  if (encoder->leading[channel] != WINDOW_NONE &&
+      leading >= encoder->leading[channel] && trailing >= encoder->trailing[channel]) {
+    // Le XOR tient dans la fenêtre du canal
+    uint8_t length = 32 - encoder->leading[channel] - encoder->trailing[channel];
+    writeBits(encoder, 0x2, 2);
+    writeBits(encoder, xorValue >> encoder->trailing[channel], length);
+    return;
+  }
+
+  uint8_t length = 32 - leading - trailing;
+  writeBits(encoder, 0x3, 2);
+  writeBits(encoder, leading, 5);
+  writeBits(encoder, length - 1, 5);
+  writeBits(encoder, xorValue >> trailing, length);
+  encoder->leading[channel] = leading;
+  encoder->trailing[channel] = trailing;
+}
+
+static void decodeTimestamp(GorillaDecoder* decoder) {
+  int32_t dod = 0;
+  if (readBits(decoder, 1) != 0) {
+    if (readBits(decoder, 1) == 0) {
+      dod = signExtend(readBits(decoder, 7), 7);
+    } else if (readBits(decoder, 1) == 0) {
+      dod = signExtend(readBits(decoder, 9), 9);
+    } else if (readBits(decoder, 1) == 0) {
+      dod = signExtend(readBits(decoder, 12), 12);
+    } else {
+      dod = (int32_t)readBits(decoder, 32);
+    }
+  }
+  decoder->previousDelta += (uint32_t)dod;
+  decoder->previousTs += decoder->previousDelta;
+}
+
+static uint32_t decodeValue(GorillaDecoder* decoder, uint8_t channel) {
+  if (readBits(decoder, 1) != 0) {
+    if (readBits(decoder, 1) != 0) {
+      decoder->leading[channel] = readBits(decoder, 5);
+      uint8_t length = readBits(decoder, 5) + 1;
+      if (decoder->leading[channel] + length > 32) {
+        decoder->error = true;
+        return 0;
+      }
+      decoder->trailing[channel] = 32 - decoder->leading[channel] - length;
+    } else if (decoder->leading[channel] == WINDOW_NONE) {
+      decoder->error = true;
+      return 0;
+    }
+    uint8_t length = 32 - decoder->leading[channel] - decoder->trailing[channel];
+    decoder->previousBits[channel] ^= readBits(decoder, length) << decoder->trailing[channel];
+  }
+  return decoder->previousBits[channel];
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void gorillaEncoderInit(GorillaEncoder* encoder, uint8_t* buffer, size_t capacity, uint8_t channels) {
+  memset(encoder, 0, sizeof(GorillaEncoder));
+  memset(buffer, 0, capacity);
+  encoder->buffer = buffer;
+  encoder->capacityBits = capacity * 8;
+  encoder->channels = channels < GORILLA_MAX_CHANNELS ? channels : GORILLA_MAX_CHANNELS;
+  memset(encoder->leading, WINDOW_NONE, sizeof(encoder->leading));
+}
+
+bool gorillaEncoderAppend(GorillaEncoder* encoder, uint32_t timestampMs, const float* values) {
+  size_t worstCase = encoder->count == 0
+      ? FIRST_SAMPLE_BITS * (1 + encoder->channels)
+      : WORST_TS_BITS + WORST_VALUE_BITS * encoder->channels;
+  if (encoder->bitCount + worstCase > encoder->capacityBits || encoder->count == UINT16_MAX) {
+    return false;
+  }
+
+  if (encoder->count == 0) {
+    writeBits(encoder, timestampMs, 32);
+    encoder->previousTs = timestampMs;
+    for (uint8_t c = 0; c < encoder->channels; c++) {
+      encoder->previousBits[c] = floatBits(values[c]);
+      writeBits(encoder, encoder->previousBits[c], 32);
+    }
+  } else {
+    encodeTimestamp(encoder, timestampMs);
+    for (uint8_t c = 0; c < encoder->channels; c++) {
+      encodeValue(encoder, c, floatBits(values[c]));
+    }
+  }
+  encoder->count++;
+  return true;
+}
+
+size_t gorillaEncoderSize(const GorillaEncoder* encoder) {
+  return (encoder->bitCount + 7) / 8;
+}
+
+void gorillaDecoderInit(GorillaDecoder* decoder, const uint8_t* buffer, size_t length,
+                        uint8_t channels, uint16_t count) {
+  memset(decoder, 0, sizeof(GorillaDecoder));
+  decoder->buffer = buffer;
+  decoder->lengthBits = length * 8;
+  decoder->remaining = count;
+  decoder->channels = channels < GORILLA_MAX_CHANNELS ? channels : GORILLA_MAX_CHANNELS;
+  memset(decoder->leading, WINDOW_NONE, sizeof(decoder->leading));
+}
+
+bool gorillaDecoderNext(GorillaDecoder* decoder, uint32_t* timestampMs, float* values) {
+  if (decoder->remaining == 0 || decoder->error) {
+    return false;
+  }
+
+  if (decoder->decoded == 0) {
+    decoder->previousTs = readBits(decoder, 32);
+    for (uint8_t c = 0; c < decoder->channels; c++) {
+      decoder->previousBits[c] = readBits(decoder, 32);
+    }
+  } else {
+    decodeTimestamp(decoder);
+    for (uint8_t c = 0; c < decoder->channels; c++) {
+      decodeValue(decoder, c);
+    }
+  }
+  if (decoder->error) {
+    return false;
+  }
+
+  *timestampMs = decoder->previousTs;
+  for (uint8_t c = 0; c < decoder->channels; c++) {
+    values[c] = bitsFloat(decoder->previousBits[c]);
+  }
+  decoder->decoded++;
+  decoder->remaining--;
+  return true;
+}
@@ -0,0 +1,259 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module de surveillance de santé (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Chaque canal a une définition constante : type de surveillance, code
+     d'erreur, sévérité, stratégie de récupération et seuils
+  2. Transition sain -> défaillant : ErrorManager::reportError() avec le nom
+     du canal comme module ; transition inverse : ErrorManager::resolveError()
+  3. Le ErrorManager appelle recoverChannels() pour chaque code surveillé :
+     l'action de chaque canal défaillant est exécutée, l'erreur n'est résolue
+     que lorsque les observations redeviennent saines
+  4. Tâches et tas sont évalués dans healthMonitorUpdate() ; capteurs et bus
+     à chaque lecture, dans la tâche qui les lit
+*/
+
+#include "utils/health_monitor.h"
+#include "utils/error_manager.h"
+#include "utils/logging.h"
+#include <math.h>
+#include <string.h>
+
+// === DÉFINITION DES TYPES ===
+
+typedef enum {
+  HEALTH_KIND_HEARTBEAT = 0,    // Délai depuis le dernier battement de cœur
+  HEALTH_KIND_SENSOR,           // Vraisemblance des lectures
+  HEALTH_KIND_BUS,              // Échecs consécutifs de transaction
+  HEALTH_KIND_HEAP,             // Tas libre minimal
+  HEALTH_KIND_CONDITION         // Diagnostic du module lui-même
+} HealthKind;
+
+typedef struct {
+  const char* name;             // Module rapporté au ErrorManager
+  HealthKind kind;
+  ErrorCode code;
+  ErrorSeverity severity;
+  RecoveryStrategy strategy;
+  float maxDelta;               // Variation maximale entre deux lectures (capteurs)
+  uint16_t stuckSamples;        // Lectures identiques = capteur figé (0 = non vérifié)
+} HealthChannelDefinition;
+
+typedef struct {
+  bool faulty;
+  bool armed;                   // Tâche : premier battement reçu ; capteur : première lecture reçue
+  volatile unsigned long lastHeartbeat;
+  float lastValue;
+  uint16_t identicalCount;
+  uint16_t plausibleCount;
+  uint16_t busFailures;
+} HealthChannelState;
+
+// === VARIABLES GLOBALES ===
+
+// Élévation : 20° en 50 ms dépasse la dynamique du kite ; la longueur de ligne
+// (cm) et le vent restent constants au repos, ils ne sont pas testés « figés »
+static const HealthChannelDefinition channelDefinitions[HEALTH_CHANNEL_COUNT] = {
+  { "CONTROL_TASK", HEALTH_KIND_HEARTBEAT, ErrorCode::TIMEOUT,       ErrorSeverity::CRITICAL,      RecoveryStrategy::SAFE_MODE,    0.0f,   0 },
+  { "SENSOR_TASK",  HEALTH_KIND_HEARTBEAT, ErrorCode::TIMEOUT,       ErrorSeverity::CRITICAL,      RecoveryStrategy::SAFE_MODE,    0.0f,   0 },
+  { "IMU",          HEALTH_KIND_SENSOR,    ErrorCode::IMU_ERROR,     ErrorSeverity::HIGH_SEVERITY, RecoveryStrategy::REINITIALIZE, 20.0f,  HEALTH_SENSOR_STUCK_SAMPLES },
+  { "LINE_LENGTH",  HEALTH_KIND_SENSOR,    ErrorCode::SENSOR_ERROR,  ErrorSeverity::HIGH_SEVERITY, RecoveryStrategy::RETRY,        100.0f, 0 },
+  { "WIND",         HEALTH_KIND_SENSOR,    ErrorCode::SENSOR_ERROR,  ErrorSeverity::MEDIUM,        RecoveryStrategy::RETRY,        10.0f,  0 },
+  { "LCD_I2C",      HEALTH_KIND_BUS,       ErrorCode::DISPLAY_ERROR, ErrorSeverity::LOW_SEVERITY,  RecoveryStrategy::REINITIALIZE, 0.0f,   0 },
+  { "HEAP",         HEALTH_KIND_HEAP,      ErrorCode::OUT_OF_MEMORY, ErrorSeverity::CRITICAL,      RecoveryStrategy::SAFE_MODE,    0.0f,   0 },
+  { "VIBRATION",    HEALTH_KIND_CONDITION, ErrorCode::HARDWARE_FAILURE, ErrorSeverity::MEDIUM,      RecoveryStrategy::NONE,         0.0f,   0 },
+};
+
+static HealthChannelState channelStates[HEALTH_CHANNEL_COUNT];
+static HealthRecoveryAction recoveryActions[HEALTH_CHANNEL_COUNT] = {nullptr};
+static unsigned long lastRecoveryAttempt = 0;
+
+// === FONCTIONS INTERNES ===
+
+static void markFaulty(HealthChannel channel, const char* description) {
+  const HealthChannelDefinition& definition = channelDefinitions[channel];
+  channelStates[channel].faulty = true;
+  ErrorManager::getInstance()->reportError(definition.code, definition.severity,
+                                           definition.name, description, definition.strategy);
+}
+
+static void markHealthy(HealthChannel channel) {
+  const HealthChannelDefinition& definition = channelDefinitions[channel];
+  channelStates[channel].faulty = false;
+  ErrorManager::getInstance()->resolveError(definition.code, definition.name);
+  LOG_INFO("HEALTH", "%s rétabli", definition.name);
+}
+
+/**
+ * Action de récupération enregistrée auprès du ErrorManager pour chaque code
+ * surveillé : exécute l'action des canaux défaillants de ce code
+ * @return true si plus aucun canal de ce code n'est défaillant
+ */
+static bool recoverChannels(ErrorCode code, RecoveryStrategy strategy) {
+  (void)strategy;
+  bool healthy = true;
+  for (int i = 0; i < HEALTH_CHANNEL_COUNT; i++) {
+    if (channelDefinitions[i].code != code || !channelStates[i].faulty) {
+      continue;
+    }
+    if (recoveryActions[i] != nullptr && !recoveryActions[i]()) {
+      LOG_WARNING("HEALTH", "Récupération de %s sans effet", channelDefinitions[i].name);
+    }
+    healthy = healthy && !channelStates[i].faulty;
+  }
+  return healthy;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void healthMonitorInit() {
+  memset(channelStates, 0, sizeof(channelStates));
+  lastRecoveryAttempt = millis();
+
+  ErrorManager* errors = ErrorManager::getInstance();
+  for (int i = 0; i < HEALTH_CHANNEL_COUNT; i++) {
+    errors->setRecoveryStrategy(channelDefinitions[i].code, channelDefinitions[i].strategy);
+    errors->setRecoveryHandler(channelDefinitions[i].code, recoverChannels);
+  }
+  LOG_INFO("HEALTH", "Surveillance de santé initialisée (%d canaux)", HEALTH_CHANNEL_COUNT);
+}
+
+void healthMonitorSetRecoveryAction(HealthChannel channel, HealthRecoveryAction action) {
+  if (channel < HEALTH_CHANNEL_COUNT) {
+    recoveryActions[channel] = action;
+  }
+}
+
+void healthMonitorHeartbeat(HealthChannel channel) {
+  if (channel >= HEALTH_CHANNEL_COUNT) {
+    return;
+  }
+  channelStates[channel].lastHeartbeat = millis();
+  channelStates[channel].armed = true;
+}
+
+bool healthMonitorCheckSensor(HealthChannel channel, float value) {
+  if (channel >= HEALTH_CHANNEL_COUNT) {
+    return false;
+  }
+  const HealthChannelDefinition& definition = channelDefinitions[channel];
+  HealthChannelState& state = channelStates[channel];
+
+  if (isnan(value) || isinf(value)) {
+    state.plausibleCount = 0;
+    if (!state.faulty) {
+      markFaulty(channel, "Lecture non numérique");
+    }
+    return false;
+  }
+  if (!state.armed) {
+    state.armed = true;
+    state.lastValue = value;
+    return !state.faulty;
+  }
+
+  state.identicalCount = (value == state.lastValue) ? state.identicalCount + 1 : 0;
+  bool stuck = definition.stuckSamples > 0 && state.identicalCount + 1 >= definition.stuckSamples;
+  bool jump = fabsf(value - state.lastValue) > definition.maxDelta;
+  state.lastValue = value;
+
+  if (stuck || jump) {
+    state.plausibleCount = 0;
+    if (!state.faulty) {
+      markFaulty(channel, stuck ? "Capteur figé" : "Saut de mesure invraisemblable");
+    }
+  } else if (state.faulty && ++state.plausibleCount >= HEALTH_PLAUSIBLE_SAMPLES) {
+    markHealthy(channel);
+  }
+  return !state.faulty;
+}
+
+void healthMonitorRearmSensor(HealthChannel channel) {
+  if (channel >= HEALTH_CHANNEL_COUNT) {
+    return;
+  }
+  channelStates[channel].armed = false;
+  channelStates[channel].identicalCount = 0;
+}
+
+void healthMonitorReportBus(HealthChannel channel, bool success) {
+  if (channel >= HEALTH_CHANNEL_COUNT) {
+    return;
+  }
+  HealthChannelState& state = channelStates[channel];
+  if (success) {
+    state.busFailures = 0;
+    if (state.faulty) {
+      markHealthy(channel);
+    }
+  } else if (++state.busFailures >= HEALTH_BUS_FAILURES && !state.faulty) {
+    markFaulty(channel, "Périphérique sans réponse (NAK)");
+  }
+}
+
+void healthMonitorReportCondition(HealthChannel channel, bool nominal, const char* description) {
+  if (channel >= HEALTH_CHANNEL_COUNT) {
+    return;
+  }
+  if (!nominal && !channelStates[channel].faulty) {
+    markFaulty(channel, description);
+  } else if (nominal && channelStates[channel].faulty) {
+    markHealthy(channel);
+  }
+}
+
+void healthMonitorUpdate() {
+  unsigned long now = millis();
+  bool anyFaulty = false;
+
+  for (int i = 0; i < HEALTH_CHANNEL_COUNT; i++) {
+    HealthChannel channel = (HealthChannel)i;
+    HealthChannelState& state = channelStates[i];
+
+    switch (channelDefinitions[i].kind) {
+      case HEALTH_KIND_HEARTBEAT: {
+        if (!state.armed) {
+          break;
+        }
+        bool late = now - state.lastHeartbeat > HEALTH_TASK_TIMEOUT;
+        if (late && !state.faulty) {
+          markFaulty(channel, "Tâche bloquée (battement de cœur absent)");
+        } else if (!late && state.faulty) {
+          markHealthy(channel);
+        }
+        break;
+      }
+      case HEALTH_KIND_HEAP: {
+        uint32_t freeHeap = ESP.getFreeHeap();
+        if (!state.faulty && freeHeap < HEALTH_MIN_FREE_HEAP) {
+          markFaulty(channel, "Tas libre sous le seuil minimal");
+        } else if (state.faulty && freeHeap >= HEALTH_MIN_FREE_HEAP + HEALTH_HEAP_HYSTERESIS) {
+          markHealthy(channel);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    anyFaulty = anyFaulty || state.faulty;
+  }
+
+  if (anyFaulty && now - lastRecoveryAttempt >= HEALTH_RECOVERY_INTERVAL) {
+    lastRecoveryAttempt = now;
+    ErrorManager::getInstance()->processPendingRecoveries();
+  }
+}
+
+bool healthMonitorIsHealthy(HealthChannel channel) {
+  return channel < HEALTH_CHANNEL_COUNT && !channelStates[channel].faulty;
+}
+
+const char* healthMonitorChannelName(HealthChannel channel) {
+  return channel < HEALTH_CHANNEL_COUNT ? channelDefinitions[channel].name : "INCONNU";
+}
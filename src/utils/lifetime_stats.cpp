@@ -0,0 +1,194 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Compteurs de vie (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Au démarrage, le bloc NVS est relu et vérifié (taille, magic, version,
+     CRC32 de data_storage) ; le démarrage est compté puis sauvegardé
+  2. Chaque mise à jour ajoute le temps écoulé depuis la précédente
+     (différence sur 32 bits, juste au passage à zéro de millis()), compte
+     un vol au passage à vrai de l'indicateur "en vol" de l'appelant (déduit
+     de l'élévation mesurée par l'IMU) et reporte les écarts
+     des compteurs du démarrage courant (erreurs, retards du contrôle) ; un
+     compteur source remis à zéro (rapport OTA) repart de sa nouvelle valeur
+  3. Les pires temps du contrôle sont des maximums sur toute la vie
+  4. L'énergie est cumulée en millijoules entiers ; la fraction reste en RAM
+  5. La sauvegarde copie les compteurs sous section critique puis écrit le
+     bloc complet en une opération putBytes
+*/
+
+#include "utils/lifetime_stats.h"
+#include "utils/data_storage.h"
+#include "utils/error_manager.h"
+#include "core/hot_path.h"
+#include "utils/logging.h"
+#include <Preferences.h>
+#include <stddef.h>
+#include <string.h>
+
+// === DÉFINITION DES TYPES ===
+
+// Bloc sauvegardé en NVS
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;                   // sizeof(LifetimeCounters)
+  LifetimeCounters counters;
+  uint32_t crc;                    // CRC32 de tout ce qui précède
+} LifetimeRecord;
+
+// === VARIABLES GLOBALES ===
+
+static const char* LIFETIME_KEY = "counters";
+
+static Preferences preferences;
+static bool nvsReady = false;
+static LifetimeCounters counters;
+static portMUX_TYPE countersMux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t lastUpdateMs = 0;
+static uint32_t lastCheckpointMs = 0;
+static bool wasFlying = false;
+static uint32_t lastErrorTotal = 0;
+static uint32_t lastOverruns = 0;
+static float energyRemainderMj = 0.0f;
+
+// === FONCTIONS INTERNES ===
+
+static uint32_t recordCrc(const LifetimeRecord* record) {
+  return dataStorageCrc32(record, offsetof(LifetimeRecord, crc));
+}
+
+/**
+ * Écart d'un compteur du démarrage courant depuis la lecture précédente
+ */
+static uint32_t counterDelta(uint32_t current, uint32_t* last) {
+  uint32_t delta = current >= *last ? current - *last : current;
+  *last = current;
+  return delta;
+}
+
+static bool loadRecord(LifetimeCounters* loaded) {
+  if (preferences.getBytesLength(LIFETIME_KEY) != sizeof(LifetimeRecord)) {
+    LOG_INFO("LIFETIME", "Aucun compteur de vie en NVS : départ à zéro");
+    return false;
+  }
+  LifetimeRecord record;
+  if (preferences.getBytes(LIFETIME_KEY, &record, sizeof(record)) != sizeof(record) ||
+      record.magic != LIFETIME_STATS_MAGIC || record.version != LIFETIME_STATS_VERSION ||
+      record.size != sizeof(LifetimeCounters) || record.crc != recordCrc(&record)) {
+    LOG_WARNING("LIFETIME", "Compteurs de vie invalides en NVS : départ à zéro");
+    return false;
+  }
+  *loaded = record.counters;
+  return true;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool lifetimeStatsInit(uint32_t nowMs) {
+  LifetimeCounters loaded;
+  memset(&loaded, 0, sizeof(loaded));
+  if (!nvsReady) {
+    nvsReady = preferences.begin(LIFETIME_NVS_NAMESPACE, false);
+    if (!nvsReady) {
+      LOG_ERROR("LIFETIME", "Impossible d'ouvrir l'espace NVS '%s'", LIFETIME_NVS_NAMESPACE);
+    }
+  }
+  if (nvsReady) {
+    loadRecord(&loaded);
+  }
+  loaded.bootCount++;
+
+  portENTER_CRITICAL(&countersMux);
+  counters = loaded;
+  portEXIT_CRITICAL(&countersMux);
+  lastUpdateMs = nowMs;
+  lastCheckpointMs = nowMs;
+  wasFlying = false;
+  lastErrorTotal = ErrorManager::getInstance()->getTotalErrorCount();
+  lastOverruns = hotPathGetReport().overruns;
+  energyRemainderMj = 0.0f;
+
+  LOG_INFO("LIFETIME", "Démarrage n°%lu, %lu h de vol, %lu Wh produits",
+           (unsigned long)loaded.bootCount, (unsigned long)(loaded.flightMs / 3600000ULL),
+           (unsigned long)(loaded.energyMilliJoules / 3600000ULL));
+  return nvsReady && lifetimeStatsCheckpoint();
+}
+
+bool lifetimeStatsUpdate(uint32_t nowMs, bool flying) {
+  uint32_t elapsedMs = nowMs - lastUpdateMs;
+  lastUpdateMs = nowMs;
+  uint32_t errors = counterDelta(ErrorManager::getInstance()->getTotalErrorCount(), &lastErrorTotal);
+  HotPathReport control = hotPathGetReport();
+  uint32_t overruns = counterDelta(control.overruns, &lastOverruns);
+  bool flightEnded = wasFlying && !flying;
+
+  portENTER_CRITICAL(&countersMux);
+  counters.uptimeMs += elapsedMs;
+  if (flying) {
+    counters.flightMs += elapsedMs;
+    if (!wasFlying) counters.flightCount++;
+  }
+  counters.errorCount += errors;
+  counters.controlOverruns += overruns;
+  if (control.maxWorkUs > counters.worstControlWorkUs) counters.worstControlWorkUs = control.maxWorkUs;
+  if (control.maxPeriodUs > counters.worstControlPeriodUs) counters.worstControlPeriodUs = control.maxPeriodUs;
+  portEXIT_CRITICAL(&countersMux);
+  wasFlying = flying;
+
+  uint32_t sinceCheckpointMs = nowMs - lastCheckpointMs;
+  if (sinceCheckpointMs >= LIFETIME_CHECKPOINT_INTERVAL_MS ||
+      (flightEnded && sinceCheckpointMs >= LIFETIME_MIN_CHECKPOINT_SPACING_MS)) {
+    lastCheckpointMs = nowMs;
+    return lifetimeStatsCheckpoint();
+  }
+  return false;
+}
+
+void lifetimeStatsAddEnergy(float joules) {
+  if (!(joules > 0.0f)) {
+    return;
+  }
+  float milliJoules = joules * 1000.0f + energyRemainderMj;
+  uint64_t whole = (uint64_t)milliJoules;
+  energyRemainderMj = milliJoules - (float)whole;
+  portENTER_CRITICAL(&countersMux);
+  counters.energyMilliJoules += whole;
+  portEXIT_CRITICAL(&countersMux);
+}
+
+bool lifetimeStatsCheckpoint() {
+  if (!nvsReady) {
+    return false;
+  }
+  LifetimeRecord record;
+  memset(&record, 0, sizeof(record));
+  record.magic = LIFETIME_STATS_MAGIC;
+  record.version = LIFETIME_STATS_VERSION;
+  record.size = sizeof(LifetimeCounters);
+  portENTER_CRITICAL(&countersMux);
+  counters.checkpointCount++;
+  record.counters = counters;
+  portEXIT_CRITICAL(&countersMux);
+  record.crc = recordCrc(&record);
+
+  if (preferences.putBytes(LIFETIME_KEY, &record, sizeof(record)) != sizeof(record)) {
+    LOG_ERROR("LIFETIME", "Échec de sauvegarde des compteurs de vie");
+    return false;
+  }
+  LOG_DEBUG("LIFETIME", "Compteurs de vie sauvegardés (%lu écritures)", (unsigned long)record.counters.checkpointCount);
+  return true;
+}
+
+LifetimeCounters lifetimeStatsGet() {
+  portENTER_CRITICAL(&countersMux);
+  LifetimeCounters copy = counters;
+  portEXIT_CRITICAL(&countersMux);
+  return copy;
+}
@@ -0,0 +1,270 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Bus de messages par sujets (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Le pool est une liste libre de blocs statiques ; busAcquire() retire un
+     bloc (référence du producteur), busRelease() le remet à la dernière
+     référence rendue
+  2. busPublish() fixe d'abord le compteur à 1 + nombre d'abonnés du sujet,
+     puis dépose le pointeur dans la file de chaque abonné ; une file pleine
+     rend aussitôt la référence prévue pour elle, puis le producteur rend la
+     sienne : le bloc vit exactement jusqu'au dernier abonné servi
+  3. Le pool, les compteurs de références et les statistiques sont protégés
+     par une section critique courte (aucun appel FreeRTOS à l'intérieur) ;
+     les envois dans les files se font hors section critique
+  4. Le débit d'un sujet est le nombre de publications de la dernière
+     fenêtre de BUS_RATE_WINDOW_MS, recalculé à la publication et à la lecture
+*/
+
+#include "utils/message_bus.h"
+#include "utils/logging.h"
+
+// === CONSTANTES ===
+#define BLOCK_NONE -1
+
+// === DÉFINITION DES TYPES ===
+
+// État d'un sujet
+typedef struct {
+  BusTopicStats stats;
+  uint32_t sequence;
+  uint32_t windowStart;         // Début de la fenêtre de débit (ms)
+  uint32_t windowCount;         // Publications dans la fenêtre
+  uint8_t subscriberIndex[BUS_MAX_SUBSCRIBERS];
+} TopicState;
+
+// === VARIABLES GLOBALES ===
+static BusMessage pool[BUS_POOL_BLOCKS];
+static int16_t freeList = BLOCK_NONE;
+static int freeCount = 0;
+static TopicState topics[BUS_TOPIC_COUNT];
+static BusSubscriber subscribers[BUS_MAX_SUBSCRIBERS];
+static uint8_t subscriberCount = 0;
+static portMUX_TYPE busMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const TOPIC_NAMES[BUS_TOPIC_COUNT] = { "log", "imu" };
+
+// === FONCTIONS INTERNES ===
+
+/**
+ * Clôt la fenêtre de débit si elle est écoulée (section critique requise)
+ */
+static void rollRateWindow(TopicState* state, uint32_t now) {
+  uint32_t elapsed = now - state->windowStart;
+  if (elapsed < BUS_RATE_WINDOW_MS) {
+    return;
+  }
+  // Une fenêtre sans publication ramène le débit à zéro
+  state->stats.rateHz = elapsed < 2 * BUS_RATE_WINDOW_MS ? state->windowCount * 1000.0f / elapsed : 0.0f;
+  state->windowStart = now;
+  state->windowCount = 0;
+}
+
+/**
+ * Rend une référence (section critique requise)
+ */
+static void releaseLocked(BusMessage* msg) {
+  if (msg->refCount == 0 || --msg->refCount > 0) {
+    return;
+  }
+  msg->nextFree = freeList;
+  freeList = msg - pool;
+  freeCount++;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void busInit() {
+  for (uint8_t i = 0; i < subscriberCount; i++) {
+    if (subscribers[i].queue != nullptr) {
+      vQueueDelete(subscribers[i].queue);
+    }
+  }
+
+  portENTER_CRITICAL(&busMux);
+  memset(pool, 0, sizeof(pool));
+  for (int16_t i = 0; i < BUS_POOL_BLOCKS; i++) {
+    pool[i].nextFree = i + 1 < BUS_POOL_BLOCKS ? i + 1 : BLOCK_NONE;
+  }
+  freeList = 0;
+  freeCount = BUS_POOL_BLOCKS;
+  memset(topics, 0, sizeof(topics));
+  memset(subscribers, 0, sizeof(subscribers));
+  subscriberCount = 0;
+  uint32_t now = millis();
+  for (int t = 0; t < BUS_TOPIC_COUNT; t++) {
+    topics[t].windowStart = now;
+  }
+  portEXIT_CRITICAL(&busMux);
+}
+
+BusSubscriber* busSubscribe(BusTopic topic, uint8_t depth, const char* name) {
+  if (topic >= BUS_TOPIC_COUNT || depth == 0 || subscriberCount >= BUS_MAX_SUBSCRIBERS) {
+    LOG_ERROR("BUS", "Abonnement refusé : %s", name);
+    return nullptr;
+  }
+  QueueHandle_t queue = xQueueCreate(depth, sizeof(BusMessage*));
+  if (queue == nullptr) {
+    LOG_ERROR("BUS", "File non créée pour %s", name);
+    return nullptr;
+  }
+
+  portENTER_CRITICAL(&busMux);
+  uint8_t index = subscriberCount++;
+  BusSubscriber* subscriber = &subscribers[index];
+  subscriber->queue = queue;
+  subscriber->name = name;
+  subscriber->topic = topic;
+  subscriber->received = 0;
+  subscriber->dropped = 0;
+  TopicState* state = &topics[topic];
+  state->subscriberIndex[state->stats.subscribers++] = index;
+  portEXIT_CRITICAL(&busMux);
+
+  LOG_DEBUG("BUS", "%s abonné au sujet %s (file de %u)", name, TOPIC_NAMES[topic], depth);
+  return subscriber;
+}
+
+BusMessage* busAcquire(BusTopic topic, size_t size) {
+  if (topic >= BUS_TOPIC_COUNT) {
+    return nullptr;
+  }
+
+  BusMessage* msg = nullptr;
+  portENTER_CRITICAL(&busMux);
+  if (size <= BUS_BLOCK_SIZE && freeList != BLOCK_NONE) {
+    msg = &pool[freeList];
+    freeList = msg->nextFree;
+    freeCount--;
+    msg->refCount = 1;
+    msg->topic = topic;
+    msg->size = size;
+  } else {
+    topics[topic].stats.exhausted++;
+  }
+  portEXIT_CRITICAL(&busMux);
+  return msg;
+}
+
+int busPublish(BusMessage* msg) {
+  if (msg == nullptr) {
+    return 0;
+  }
+  TopicState* state = &topics[msg->topic];
+  uint32_t now = millis();
+
+  // Références de tous les abonnés posées avant la première livraison :
+  // un abonné rapide ne peut pas libérer le bloc pendant la diffusion
+  portENTER_CRITICAL(&busMux);
+  uint8_t count = state->stats.subscribers;
+  msg->refCount += count;
+  msg->sequence = ++state->sequence;
+  msg->timestampMs = now;
+  state->stats.published++;
+  state->stats.bytes += msg->size;
+  rollRateWindow(state, now);
+  state->windowCount++;
+  portEXIT_CRITICAL(&busMux);
+
+  uint32_t sentMask = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    BusSubscriber* subscriber = &subscribers[state->subscriberIndex[i]];
+    if (xQueueSend(subscriber->queue, &msg, 0) == pdTRUE) {
+      sentMask |= 1UL << i;
+    }
+  }
+
+  // Comptes des livraisons, références des files pleines et du producteur
+  int delivered = 0;
+  portENTER_CRITICAL(&busMux);
+  for (uint8_t i = 0; i < count; i++) {
+    BusSubscriber* subscriber = &subscribers[state->subscriberIndex[i]];
+    if (sentMask & (1UL << i)) {
+      subscriber->received++;
+      delivered++;
+    } else {
+      subscriber->dropped++;
+      releaseLocked(msg);
+    }
+  }
+  state->stats.delivered += delivered;
+  state->stats.dropped += count - delivered;
+  releaseLocked(msg);
+  portEXIT_CRITICAL(&busMux);
+  return delivered;
+}
+
+int busPublishCopy(BusTopic topic, const void* data, size_t size) {
+  BusMessage* msg = busAcquire(topic, size);
+  if (msg == nullptr) {
+    return -1;
+  }
+  memcpy(msg->payload, data, size);
+  return busPublish(msg);
+}
+
+BusMessage* busReceive(BusSubscriber* subscriber, TickType_t ticksToWait) {
+  BusMessage* msg = nullptr;
+  if (subscriber == nullptr || xQueueReceive(subscriber->queue, &msg, ticksToWait) != pdTRUE) {
+    return nullptr;
+  }
+  return msg;
+}
+
+void busRetain(BusMessage* msg) {
+  portENTER_CRITICAL(&busMux);
+  msg->refCount++;
+  portEXIT_CRITICAL(&busMux);
+}
+
+void busRelease(BusMessage* msg) {
+  if (msg == nullptr) {
+    return;
+  }
+  portENTER_CRITICAL(&busMux);
+  releaseLocked(msg);
+  portEXIT_CRITICAL(&busMux);
+}
+
+BusTopicStats busGetTopicStats(BusTopic topic) {
+  BusTopicStats stats = {};
+  if (topic >= BUS_TOPIC_COUNT) {
+    return stats;
+  }
+  portENTER_CRITICAL(&busMux);
+  rollRateWindow(&topics[topic], millis());
+  stats = topics[topic].stats;
+  portEXIT_CRITICAL(&busMux);
+  return stats;
+}
+
+int busFreeBlocks() {
+  portENTER_CRITICAL(&busMux);
+  int count = freeCount;
+  portEXIT_CRITICAL(&busMux);
+  return count;
+}
+
+void busPrintStats() {
+  LOG_INFO("BUS", "Pool : %d/%d blocs libres", busFreeBlocks(), BUS_POOL_BLOCKS);
+  for (int t = 0; t < BUS_TOPIC_COUNT; t++) {
+    BusTopicStats stats = busGetTopicStats((BusTopic)t);
+    LOG_INFO("BUS", "Sujet %s : %.1f Hz, %lu publiés, %lu livrés, %lu perdus, %lu refusés, %u abonnés",
+             TOPIC_NAMES[t], stats.rateHz, (unsigned long)stats.published,
+             (unsigned long)stats.delivered, (unsigned long)stats.dropped,
+             (unsigned long)stats.exhausted, stats.subscribers);
+  }
+  for (uint8_t i = 0; i < subscriberCount; i++) {
+    const BusSubscriber* subscriber = &subscribers[i];
+    LOG_INFO("BUS", "  %s (%s) : %lu reçus, %lu perdus, %u en attente",
+             subscriber->name, TOPIC_NAMES[subscriber->topic],
+             (unsigned long)subscriber->received, (unsigned long)subscriber->dropped,
+             (unsigned)uxQueueMessagesWaiting(subscriber->queue));
+  }
+}
@@ -0,0 +1,135 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Serveur de paramètres RCU (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Chaque lecteur annonce l'instantané qu'il utilise puis vérifie qu'il
+     est toujours courant ; sinon une publication est intervenue entre les
+     deux et il recommence (au plus une fois par publication concurrente)
+  2. Le rédacteur écrit la nouvelle version dans un emplacement qui n'est ni
+     courant ni annoncé, puis échange le pointeur courant : les lecteurs
+     voient l'ancienne ou la nouvelle version, jamais un mélange
+  3. Un instantané qui n'est plus courant reste intact tant qu'un lecteur
+     l'annonce ; il est réutilisé dès que chaque lecteur a relu ou abandonné
+     (fin de la période de grâce), sans attente du côté des lecteurs
+  4. Les accès partagés (pointeur courant, annonces) sont atomiques et
+     séquentiellement cohérents, valables entre les deux cœurs de l'ESP32
+*/
+
+#include "utils/param_server.h"
+#include "utils/logging.h"
+
+// === FONCTIONS INTERNES ===
+
+static bool isAnnounced(const ParamServer* server, const ParamSnapshot* snapshot) {
+  for (uint8_t r = 0; r < server->readerCount; r++) {
+    if (__atomic_load_n(&server->announced[r], __ATOMIC_SEQ_CST) == snapshot) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool paramServerInit(ParamServer* server, const void* initial, size_t size) {
+  if (size == 0 || size > PARAM_SERVER_MAX_SIZE) {
+    LOG_ERROR("PARAMS", "Jeu de paramètres trop grand : %u octets", (unsigned)size);
+    return false;
+  }
+  // Le mutex d'une initialisation précédente est conservé
+  SemaphoreHandle_t lock = server->writeLock != nullptr ? server->writeLock : xSemaphoreCreateMutex();
+  if (lock == nullptr) {
+    return false;
+  }
+
+  memset(server, 0, sizeof(ParamServer));
+  server->writeLock = lock;
+  server->size = size;
+  memcpy(server->slots[0].data, initial, size);
+  server->slots[0].version = 1;
+  server->stats.version = 1;
+  __atomic_store_n(&server->current, &server->slots[0], __ATOMIC_SEQ_CST);
+  return true;
+}
+
+int paramServerRegisterReader(ParamServer* server) {
+  xSemaphoreTake(server->writeLock, portMAX_DELAY);
+  int reader = server->readerCount < PARAM_SERVER_MAX_READERS ? server->readerCount++ : PARAM_READER_NONE;
+  xSemaphoreGive(server->writeLock);
+  if (reader == PARAM_READER_NONE) {
+    LOG_ERROR("PARAMS", "Table des lecteurs pleine");
+  }
+  return reader;
+}
+
+const void* paramServerRead(ParamServer* server, int reader, uint32_t* version) {
+  ParamSnapshot* snapshot = __atomic_load_n(&server->current, __ATOMIC_SEQ_CST);
+  for (;;) {
+    __atomic_store_n(&server->announced[reader], snapshot, __ATOMIC_SEQ_CST);
+    ParamSnapshot* check = __atomic_load_n(&server->current, __ATOMIC_SEQ_CST);
+    if (check == snapshot) {
+      break;
+    }
+    __atomic_fetch_add(&server->stats.readRetries, 1, __ATOMIC_RELAXED);
+    snapshot = check;
+  }
+  if (version != nullptr) {
+    *version = snapshot->version;
+  }
+  return snapshot->data;
+}
+
+void paramServerRelease(ParamServer* server, int reader) {
+  __atomic_store_n(&server->announced[reader], (ParamSnapshot*)nullptr, __ATOMIC_SEQ_CST);
+}
+
+uint32_t paramServerPublish(ParamServer* server, const void* data) {
+  xSemaphoreTake(server->writeLock, portMAX_DELAY);
+
+  // Emplacement hors période de grâce : ni courant, ni annoncé par un lecteur
+  ParamSnapshot* current = __atomic_load_n(&server->current, __ATOMIC_SEQ_CST);
+  ParamSnapshot* target = nullptr;
+  for (int i = 0; i < PARAM_SERVER_SLOTS && target == nullptr; i++) {
+    ParamSnapshot* slot = &server->slots[i];
+    if (slot != current && !isAnnounced(server, slot)) {
+      target = slot;
+    }
+  }
+
+  uint32_t version = 0;
+  if (target == nullptr) {
+    server->stats.busy++;
+  } else {
+    if (target->version != 0) {
+      server->stats.reclaimed++;
+    }
+    memcpy(target->data, data, server->size);
+    version = target->version = server->stats.version + 1;
+    __atomic_store_n(&server->current, target, __ATOMIC_SEQ_CST);
+    server->stats.version = version;
+    server->stats.published++;
+  }
+
+  xSemaphoreGive(server->writeLock);
+  return version;
+}
+
+uint32_t paramServerCopy(ParamServer* server, void* out) {
+  // Les emplacements ne sont réécrits que sous le verrou des rédacteurs
+  xSemaphoreTake(server->writeLock, portMAX_DELAY);
+  ParamSnapshot* current = __atomic_load_n(&server->current, __ATOMIC_SEQ_CST);
+  memcpy(out, current->data, server->size);
+  uint32_t version = current->version;
+  xSemaphoreGive(server->writeLock);
+  return version;
+}
+
+ParamServerStats paramServerGetStats(const ParamServer* server) {
+  return server->stats;
+}
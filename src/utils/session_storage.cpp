@@ -0,0 +1,622 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Module d'enregistrement des sessions de vol (Implémentation)
+  -----------------------
+
+  Implémentation de l'enregistrement par blocs indexés et des aperçus multi-niveaux.
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  Les échantillons sont compressés (utils/gorilla.h) dans un bloc en RAM de
+  SESSION_CHUNK_SIZE octets. Quand le suivant n'y tient plus, le bloc est écrit
+  d'un seul tenant dans le fichier de données et une entrée d'index
+  (premier/dernier horodatage, décalage) est ajoutée.
+
+  Principes de fonctionnement :
+  1. Écritures alignées sur un secteur flash : un bloc = une écriture
+  2. Les aperçus sont mis à jour à chaque échantillon (min, max, somme) pour
+     chaque niveau ; un seau est écrit dès que le temps dépasse sa tranche
+  3. Les fichiers d'index et d'aperçus sont des tableaux d'enregistrements de
+     taille fixe triés par horodatage : une recherche dichotomique donne le
+     premier enregistrement utile en O(log n) lectures
+  4. Les tranches d'aperçu sont alignées sur le début de la session
+  5. La compression (delta de delta des horodatages, XOR des valeurs) réduit
+     un échantillon de 36 octets à quelques octets : un bloc couvre plusieurs
+     minutes de vol au lieu de 113 échantillons ; les blocs bruts des
+     sessions antérieures restent lisibles
+
+  Interactions avec d'autres modules :
+  - TaskManager : La tâche capteurs alimente la session pendant le vol
+  - Serveur web : Les routes /api/sessions lisent aperçus et plages brutes
+
+  Contraintes techniques :
+  - Un mutex protège l'état de la session et les fichiers (écrivain et lecteurs
+    s'exécutent dans des tâches différentes)
+  - Les fichiers sont accédés via le VFS (stdio) sous SESSION_STORAGE_ROOT
+*/
+
+#include "utils/session_storage.h"
+#include "core/logging.h"
+#include "utils/gorilla.h"
+#include <LittleFS.h>
+#include <stdio.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <float.h>
+
+// === DÉFINITION DES TYPES INTERNES ===
+
+// Bloc de données tel qu'écrit sur la flash
+typedef struct {
+  SessionChunkHeader header;
+  uint8_t data[SESSION_CHUNK_DATA_SIZE];  // Échantillons compressés (ou bruts)
+} SessionChunk;
+
+static_assert(sizeof(SessionChunk) == SESSION_CHUNK_SIZE, "SessionChunk doit occuper un secteur");
+static_assert(offsetof(SessionIndexEntry, lastTs) == offsetof(SessionOverviewBucket, lastTs),
+              "La clé de recherche doit être au même décalage");
+
+// === VARIABLES GLOBALES ===
+
+static const uint32_t overviewDurations[SESSION_OVERVIEW_LEVELS] = {
+  SESSION_OVERVIEW_L0_MS, SESSION_OVERVIEW_L1_MS, SESSION_OVERVIEW_L2_MS
+};
+
+static SemaphoreHandle_t storageMutex = nullptr;
+static bool isInitialized = false;
+
+// État de la session en cours
+static SessionInfo currentSession;
+static SessionChunk chunk;
+static GorillaEncoder chunkEncoder;
+static SessionChunk readChunk;           // Bloc en cours de lecture (sous mutex)
+static FILE* dataFile = nullptr;
+static FILE* indexFile = nullptr;
+static FILE* overviewFiles[SESSION_OVERVIEW_LEVELS] = {nullptr};
+static SessionOverviewBucket openBuckets[SESSION_OVERVIEW_LEVELS];
+static double bucketSums[SESSION_OVERVIEW_LEVELS][SESSION_CHANNEL_COUNT];
+
+// === FONCTIONS INTERNES ===
+
+static void buildPath(char* path, size_t size, uint16_t id, const char* extension) {
+  snprintf(path, size, "%s/%u.%s", SESSION_STORAGE_ROOT, id, extension);
+}
+
+static void buildOverviewPath(char* path, size_t size, uint16_t id, uint8_t level) {
+  snprintf(path, size, "%s/%u.o%u", SESSION_STORAGE_ROOT, id, level);
+}
+
+// Force l'écriture sur la flash pour rendre les données visibles aux lecteurs
+static void syncFile(FILE* file) {
+  fflush(file);
+  fsync(fileno(file));
+}
+
+static bool writeMeta(const SessionInfo& info) {
+  char path[48];
+  buildPath(path, sizeof(path), info.id, "meta");
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool ok = fwrite(&info, sizeof(info), 1, file) == 1;
+  fclose(file);
+  return ok;
+}
+
+static bool readMeta(uint16_t id, SessionInfo* info) {
+  char path[48];
+  buildPath(path, sizeof(path), id, "meta");
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool ok = fread(info, sizeof(SessionInfo), 1, file) == 1 && info->magic == SESSION_META_MAGIC;
+  fclose(file);
+  return ok;
+}
+
+// Nombre d'enregistrements complets d'un fichier à enregistrements de taille fixe
+static long countRecords(FILE* file, size_t recordSize) {
+  if (fseek(file, 0, SEEK_END) != 0) {
+    return 0;
+  }
+  long size = ftell(file);
+  return size > 0 ? size / (long)recordSize : 0;
+}
+
+/**
+ * Recherche dichotomique du premier enregistrement dont lastTs >= ts
+ * @return Position de l'enregistrement (count si aucun)
+ */
+static long findFirstRecord(FILE* file, size_t recordSize, long count, uint32_t ts) {
+  long low = 0;
+  long high = count;
+  while (low < high) {
+    long mid = low + (high - low) / 2;
+    uint32_t key = 0;
+    if (fseek(file, mid * (long)recordSize + (long)offsetof(SessionIndexEntry, lastTs), SEEK_SET) != 0 ||
+        fread(&key, sizeof(key), 1, file) != 1) {
+      return count;
+    }
+    if (key < ts) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+static void resetChunk() {
+  memset(&chunk.header, 0, sizeof(chunk.header));
+  chunk.header.magic = SESSION_CHUNK_MAGIC_GORILLA;
+  gorillaEncoderInit(&chunkEncoder, chunk.data, sizeof(chunk.data), SESSION_CHANNEL_COUNT);
+}
+
+static bool flushChunk() {
+  if (chunk.header.count == 0) {
+    return true;
+  }
+
+  SessionIndexEntry entry;
+  entry.firstTs = chunk.header.firstTs;
+  entry.lastTs = chunk.header.lastTs;
+  entry.offset = currentSession.chunkCount * SESSION_CHUNK_SIZE;
+  entry.count = chunk.header.count;
+  chunk.header.encodedBytes = (uint16_t)gorillaEncoderSize(&chunkEncoder);
+
+  if (fwrite(&chunk, sizeof(chunk), 1, dataFile) != 1) {
+    LOG_ERROR("SESSION", "Échec d'écriture du bloc %lu", (unsigned long)currentSession.chunkCount);
+    return false;
+  }
+  syncFile(dataFile);
+
+  // L'entrée d'index n'est écrite qu'une fois le bloc sur la flash
+  if (fwrite(&entry, sizeof(entry), 1, indexFile) != 1) {
+    LOG_ERROR("SESSION", "Échec d'écriture de l'index");
+    return false;
+  }
+  syncFile(indexFile);
+
+  currentSession.chunkCount++;
+  resetChunk();
+
+  writeMeta(currentSession);
+  return true;
+}
+
+static void openBucket(uint8_t level, uint32_t ts) {
+  SessionOverviewBucket& bucket = openBuckets[level];
+  uint32_t duration = overviewDurations[level];
+
+  bucket.startTs = ts - ((ts - currentSession.startTs) % duration);
+  bucket.lastTs = ts;
+  bucket.count = 0;
+  for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+    bucket.minValue[c] = FLT_MAX;
+    bucket.maxValue[c] = -FLT_MAX;
+    bucket.meanValue[c] = 0.0f;
+    bucketSums[level][c] = 0.0;
+  }
+}
+
+static bool closeBucket(uint8_t level) {
+  SessionOverviewBucket& bucket = openBuckets[level];
+  if (bucket.count == 0) {
+    return true;
+  }
+
+  for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+    bucket.meanValue[c] = bucketSums[level][c] / bucket.count;
+  }
+
+  if (fwrite(&bucket, sizeof(bucket), 1, overviewFiles[level]) != 1) {
+    LOG_ERROR("SESSION", "Échec d'écriture de l'aperçu niveau %u", level);
+    return false;
+  }
+  syncFile(overviewFiles[level]);
+
+  currentSession.bucketCount[level]++;
+  bucket.count = 0;
+  return true;
+}
+
+static void accumulateOverviews(const FlightSample& sample) {
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    SessionOverviewBucket& bucket = openBuckets[level];
+
+    if (bucket.count > 0 && sample.timestampMs >= bucket.startTs + overviewDurations[level]) {
+      closeBucket(level);
+    }
+    if (bucket.count == 0) {
+      openBucket(level, sample.timestampMs);
+    }
+
+    for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+      float value = sample.values[c];
+      if (value < bucket.minValue[c]) bucket.minValue[c] = value;
+      if (value > bucket.maxValue[c]) bucket.maxValue[c] = value;
+      bucketSums[level][c] += value;
+    }
+    bucket.lastTs = sample.timestampMs;
+    bucket.count++;
+  }
+}
+
+static void closeSessionFiles() {
+  if (dataFile != nullptr) { fclose(dataFile); dataFile = nullptr; }
+  if (indexFile != nullptr) { fclose(indexFile); indexFile = nullptr; }
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    if (overviewFiles[level] != nullptr) {
+      fclose(overviewFiles[level]);
+      overviewFiles[level] = nullptr;
+    }
+  }
+}
+
+static bool removeSessionFiles(uint16_t id) {
+  char path[48];
+  bool ok = true;
+  const char* extensions[] = {"dat", "idx", "meta"};
+  for (const char* extension : extensions) {
+    buildPath(path, sizeof(path), id, extension);
+    ok &= (remove(path) == 0);
+  }
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    buildOverviewPath(path, sizeof(path), id, level);
+    ok &= (remove(path) == 0);
+  }
+  return ok;
+}
+
+// Parcourt le répertoire des sessions (appelé sous mutex)
+static int listSessionsLocked(SessionInfo* sessions, int maxSessions) {
+  DIR* dir = opendir(SESSION_STORAGE_ROOT);
+  if (dir == nullptr) {
+    return 0;
+  }
+
+  int count = 0;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr && count < maxSessions) {
+    const char* dot = strrchr(entry->d_name, '.');
+    if (dot == nullptr || strcmp(dot, ".meta") != 0) {
+      continue;
+    }
+    uint16_t id = (uint16_t)atoi(entry->d_name);
+    if (id != 0 && readMeta(id, &sessions[count])) {
+      count++;
+    }
+  }
+  closedir(dir);
+  return count;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool sessionStorageInit() {
+  if (isInitialized) {
+    return true;
+  }
+
+  if (!LittleFS.begin(true)) {
+    LOG_ERROR("SESSION", "Montage LittleFS impossible");
+    return false;
+  }
+
+  struct stat st;
+  if (stat(SESSION_STORAGE_ROOT, &st) != 0 && mkdir(SESSION_STORAGE_ROOT, 0775) != 0) {
+    LOG_ERROR("SESSION", "Création du répertoire %s impossible", SESSION_STORAGE_ROOT);
+    return false;
+  }
+
+  storageMutex = xSemaphoreCreateMutex();
+  if (storageMutex == nullptr) {
+    LOG_ERROR("SESSION", "Création du mutex impossible");
+    return false;
+  }
+
+  memset(&currentSession, 0, sizeof(currentSession));
+  isInitialized = true;
+  LOG_INFO("SESSION", "Stockage des sessions prêt (blocs compressés de %u octets)",
+           (unsigned)SESSION_CHUNK_SIZE);
+  return true;
+}
+
+uint16_t sessionStorageStart() {
+  if (!isInitialized || currentSession.active) {
+    return 0;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+
+  // Rotation : supprimer les sessions les plus anciennes
+  SessionInfo sessions[SESSION_MAX_COUNT + 1];
+  int count = listSessionsLocked(sessions, SESSION_MAX_COUNT + 1);
+  uint16_t lastId = 0;
+  for (int i = 0; i < count; i++) {
+    if (sessions[i].id > lastId) lastId = sessions[i].id;
+  }
+  while (count >= SESSION_MAX_COUNT) {
+    int oldest = 0;
+    for (int i = 1; i < count; i++) {
+      if (sessions[i].id < sessions[oldest].id) oldest = i;
+    }
+    LOG_INFO("SESSION", "Suppression de la session %u (rotation)", sessions[oldest].id);
+    removeSessionFiles(sessions[oldest].id);
+    sessions[oldest] = sessions[--count];
+  }
+
+  memset(&currentSession, 0, sizeof(currentSession));
+  currentSession.magic = SESSION_META_MAGIC;
+  currentSession.id = (lastId == 0xFFFF) ? 1 : lastId + 1;
+  currentSession.channelCount = SESSION_CHANNEL_COUNT;
+
+  char path[48];
+  buildPath(path, sizeof(path), currentSession.id, "dat");
+  dataFile = fopen(path, "wb");
+  buildPath(path, sizeof(path), currentSession.id, "idx");
+  indexFile = fopen(path, "wb");
+  bool ok = dataFile != nullptr && indexFile != nullptr;
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    buildOverviewPath(path, sizeof(path), currentSession.id, level);
+    overviewFiles[level] = fopen(path, "wb");
+    ok &= overviewFiles[level] != nullptr;
+    openBuckets[level].count = 0;
+  }
+
+  if (!ok) {
+    LOG_ERROR("SESSION", "Ouverture des fichiers de la session %u impossible", currentSession.id);
+    closeSessionFiles();
+    removeSessionFiles(currentSession.id);
+    xSemaphoreGive(storageMutex);
+    return 0;
+  }
+
+  resetChunk();
+  currentSession.active = true;
+  writeMeta(currentSession);
+
+  uint16_t id = currentSession.id;
+  xSemaphoreGive(storageMutex);
+
+  LOG_INFO("SESSION", "Session %u démarrée", id);
+  return id;
+}
+
+bool sessionStorageAppend(const FlightSample& sample) {
+  if (!isInitialized || !currentSession.active) {
+    return false;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+
+  // Les recherches dichotomiques exigent des horodatages croissants
+  if (currentSession.sampleCount > 0 && sample.timestampMs < currentSession.endTs) {
+    xSemaphoreGive(storageMutex);
+    return false;
+  }
+
+  if (currentSession.sampleCount == 0) {
+    currentSession.startTs = sample.timestampMs;
+  }
+  currentSession.endTs = sample.timestampMs;
+  currentSession.sampleCount++;
+
+  // Bloc plein : l'écrire, l'échantillon ouvre le suivant
+  bool ok = true;
+  if (!gorillaEncoderAppend(&chunkEncoder, sample.timestampMs, sample.values)) {
+    ok = flushChunk();
+    if (!ok) {
+      resetChunk();  // Bloc perdu, l'enregistrement continue
+    }
+    gorillaEncoderAppend(&chunkEncoder, sample.timestampMs, sample.values);
+  }
+  if (chunk.header.count == 0) {
+    chunk.header.firstTs = sample.timestampMs;
+  }
+  chunk.header.lastTs = sample.timestampMs;
+  chunk.header.count++;
+
+  accumulateOverviews(sample);
+
+  xSemaphoreGive(storageMutex);
+  return ok;
+}
+
+bool sessionStorageStop() {
+  if (!isInitialized || !currentSession.active) {
+    return false;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+
+  bool ok = flushChunk();
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    ok &= closeBucket(level);
+  }
+  closeSessionFiles();
+
+  currentSession.active = false;
+  ok &= writeMeta(currentSession);
+
+  LOG_INFO("SESSION", "Session %u terminée: %lu échantillons, %lu blocs",
+           currentSession.id, (unsigned long)currentSession.sampleCount,
+           (unsigned long)currentSession.chunkCount);
+
+  xSemaphoreGive(storageMutex);
+  return ok;
+}
+
+bool sessionStorageIsRecording() {
+  return currentSession.active;
+}
+
+int sessionStorageList(SessionInfo* sessions, int maxSessions) {
+  if (!isInitialized) {
+    return 0;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+  int count = listSessionsLocked(sessions, maxSessions);
+  xSemaphoreGive(storageMutex);
+  return count;
+}
+
+bool sessionStorageGetInfo(uint16_t id, SessionInfo* info) {
+  if (!isInitialized) {
+    return false;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+  bool ok = readMeta(id, info);
+  xSemaphoreGive(storageMutex);
+  return ok;
+}
+
+int sessionStorageReadRange(uint16_t id, uint32_t fromMs, uint32_t toMs,
+                            FlightSample* samples, int maxSamples) {
+  if (!isInitialized || fromMs > toMs) {
+    return -1;
+  }
+
+  char indexPath[48];
+  char dataPath[48];
+  buildPath(indexPath, sizeof(indexPath), id, "idx");
+  buildPath(dataPath, sizeof(dataPath), id, "dat");
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+
+  FILE* index = fopen(indexPath, "rb");
+  FILE* data = fopen(dataPath, "rb");
+  if (index == nullptr || data == nullptr) {
+    if (index != nullptr) fclose(index);
+    if (data != nullptr) fclose(data);
+    xSemaphoreGive(storageMutex);
+    return -1;
+  }
+
+  long entryCount = countRecords(index, sizeof(SessionIndexEntry));
+  long position = findFirstRecord(index, sizeof(SessionIndexEntry), entryCount, fromMs);
+
+  int found = 0;
+  for (; position < entryCount && found < maxSamples; position++) {
+    SessionIndexEntry entry;
+    if (fseek(index, position * (long)sizeof(entry), SEEK_SET) != 0 ||
+        fread(&entry, sizeof(entry), 1, index) != 1 || entry.firstTs > toMs) {
+      break;
+    }
+
+    if (fseek(data, entry.offset, SEEK_SET) != 0 ||
+        fread(&readChunk, sizeof(readChunk), 1, data) != 1) {
+      break;
+    }
+
+    const SessionChunkHeader& header = readChunk.header;
+    bool compressed = header.magic == SESSION_CHUNK_MAGIC_GORILLA;
+    if ((!compressed && header.magic != SESSION_CHUNK_MAGIC) ||
+        (!compressed && header.count > SESSION_SAMPLES_PER_CHUNK) ||
+        (compressed && header.encodedBytes > sizeof(readChunk.data))) {
+      LOG_WARNING("SESSION", "Bloc %ld corrompu (session %u)", position, id);
+      break;
+    }
+
+    GorillaDecoder decoder;
+    gorillaDecoderInit(&decoder, readChunk.data, header.encodedBytes, SESSION_CHANNEL_COUNT, header.count);
+    for (uint32_t i = 0; i < header.count && found < maxSamples; i++) {
+      FlightSample sample;
+      if (compressed) {
+        if (!gorillaDecoderNext(&decoder, &sample.timestampMs, sample.values)) {
+          break;
+        }
+      } else {
+        memcpy(&sample, readChunk.data + i * sizeof(FlightSample), sizeof(sample));
+      }
+      if (sample.timestampMs > toMs) {
+        break;
+      }
+      if (sample.timestampMs >= fromMs) {
+        samples[found++] = sample;
+      }
+    }
+  }
+
+  fclose(index);
+  fclose(data);
+  xSemaphoreGive(storageMutex);
+  return found;
+}
+
+int sessionStorageReadOverview(uint16_t id, uint8_t level, uint32_t fromMs, uint32_t toMs,
+                               SessionOverviewBucket* buckets, int maxBuckets) {
+  if (!isInitialized || level >= SESSION_OVERVIEW_LEVELS || fromMs > toMs) {
+    return -1;
+  }
+
+  char path[48];
+  buildOverviewPath(path, sizeof(path), id, level);
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    xSemaphoreGive(storageMutex);
+    return -1;
+  }
+
+  long bucketCount = countRecords(file, sizeof(SessionOverviewBucket));
+  long position = findFirstRecord(file, sizeof(SessionOverviewBucket), bucketCount, fromMs);
+
+  int found = 0;
+  if (position < bucketCount && fseek(file, position * (long)sizeof(SessionOverviewBucket), SEEK_SET) == 0) {
+    while (position < bucketCount && found < maxBuckets) {
+      if (fread(&buckets[found], sizeof(SessionOverviewBucket), 1, file) != 1 ||
+          buckets[found].startTs > toMs) {
+        break;
+      }
+      found++;
+      position++;
+    }
+  }
+
+  fclose(file);
+  xSemaphoreGive(storageMutex);
+  return found;
+}
+
+uint8_t sessionStorageSelectLevel(uint32_t spanMs, int maxPoints) {
+  if (maxPoints <= 0) {
+    return SESSION_OVERVIEW_LEVELS - 1;
+  }
+  if (spanMs / SESSION_SAMPLE_INTERVAL <= (uint32_t)maxPoints) {
+    return SESSION_LEVEL_RAW;
+  }
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    if (spanMs / overviewDurations[level] <= (uint32_t)maxPoints) {
+      return level;
+    }
+  }
+  return SESSION_OVERVIEW_LEVELS - 1;
+}
+
+uint32_t sessionStorageBucketDuration(uint8_t level) {
+  return level < SESSION_OVERVIEW_LEVELS ? overviewDurations[level] : 0;
+}
+
+bool sessionStorageDelete(uint16_t id) {
+  if (!isInitialized || (currentSession.active && currentSession.id == id)) {
+    return false;
+  }
+
+  xSemaphoreTake(storageMutex, portMAX_DELAY);
+  bool ok = removeSessionFiles(id);
+  xSemaphoreGive(storageMutex);
+
+  LOG_INFO("SESSION", "Session %u supprimée", id);
+  return ok;
+}
@@ -0,0 +1,179 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Instantané des tâches FreeRTOS (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. uxTaskGetSystemState() remplit le tableau statique ; les tâches sont
+     rangées par numéro de création pour un affichage stable
+  2. Le temps d'exécution de chaque tâche est retrouvé dans la capture
+     précédente par son numéro de tâche (xTaskNumber, jamais réutilisé) ;
+     une tâche nouvelle compte tout son temps depuis sa création
+  3. Les écarts sont des différences sur 32 bits, justes au passage à zéro
+     des compteurs tant que l'intervalle reste plus court qu'un tour
+  4. La capture est construite hors section critique puis copiée sous
+     section critique dans la dernière capture lue par les autres tâches
+*/
+
+#include "utils/task_snapshot.h"
+#include "utils/logging.h"
+#include <string.h>
+
+#ifndef NATIVE_BUILD
+#include <esp_idf_version.h>
+#endif
+
+// === VARIABLES GLOBALES ===
+
+static TaskStatus_t statusBuffer[TASK_SNAPSHOT_MAX_TASKS];
+static UBaseType_t previousNumbers[TASK_SNAPSHOT_MAX_TASKS];
+static uint32_t previousRunTime[TASK_SNAPSHOT_MAX_TASKS];
+static uint8_t previousCount = 0;
+static uint32_t previousTotal = 0;
+static uint32_t previousMs = 0;
+static bool overflowReported = false;
+
+static TaskSnapshot building;
+static TaskSnapshot latest;
+static bool latestValid = false;
+static portMUX_TYPE snapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+// === FONCTIONS INTERNES ===
+
+static int8_t taskCore(TaskHandle_t handle) {
+#if defined(ESP_IDF_VERSION_MAJOR) && ESP_IDF_VERSION_MAJOR >= 5
+  BaseType_t core = xTaskGetCoreID(handle);
+#else
+  BaseType_t core = xTaskGetAffinity(handle);
+#endif
+  return core == tskNO_AFFINITY ? -1 : (int8_t)core;
+}
+
+static void sortByTaskNumber(UBaseType_t count) {
+  for (UBaseType_t i = 1; i < count; i++) {
+    TaskStatus_t status = statusBuffer[i];
+    UBaseType_t j = i;
+    while (j > 0 && statusBuffer[j - 1].xTaskNumber > status.xTaskNumber) {
+      statusBuffer[j] = statusBuffer[j - 1];
+      j--;
+    }
+    statusBuffer[j] = status;
+  }
+}
+
+/**
+ * Temps d'exécution de la tâche lors de la capture précédente
+ * @return 0 pour une tâche créée depuis
+ */
+static uint32_t previousRunTimeOf(UBaseType_t taskNumber) {
+  for (uint8_t i = 0; i < previousCount; i++) {
+    if (previousNumbers[i] == taskNumber) {
+      return previousRunTime[i];
+    }
+  }
+  return 0;
+}
+
+static void onCaptureTimer(void* /*context*/) {
+  taskSnapshotCapture(millis());
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+bool taskSnapshotCapture(uint32_t nowMs) {
+  uint32_t total = 0;
+  UBaseType_t count = uxTaskGetSystemState(statusBuffer, TASK_SNAPSHOT_MAX_TASKS, &total);
+  if (count == 0 && uxTaskGetNumberOfTasks() > TASK_SNAPSHOT_MAX_TASKS) {
+    if (!overflowReported) {
+      LOG_WARNING("TASKS", "%u tâches, instantané limité à %d", (unsigned)uxTaskGetNumberOfTasks(),
+                  TASK_SNAPSHOT_MAX_TASKS);
+      overflowReported = true;
+    }
+    return false;
+  }
+  sortByTaskNumber(count);
+
+  building.timestampMs = nowMs;
+  building.intervalMs = nowMs - previousMs;
+  building.runTimeTotal = total - previousTotal;
+  building.taskCount = (uint8_t)count;
+  for (UBaseType_t i = 0; i < count; i++) {
+    const TaskStatus_t& status = statusBuffer[i];
+    TaskSnapshotEntry& task = building.tasks[i];
+    strncpy(task.name, status.pcTaskName, TASK_SNAPSHOT_NAME_LENGTH - 1);
+    task.name[TASK_SNAPSHOT_NAME_LENGTH - 1] = '\0';
+    task.state = (uint8_t)status.eCurrentState;
+    task.priority = (uint8_t)status.uxCurrentPriority;
+    task.core = taskCore(status.xHandle);
+    task.stackFreeBytes = (uint32_t)status.usStackHighWaterMark;
+    task.runTime = status.ulRunTimeCounter - previousRunTimeOf(status.xTaskNumber);
+    uint32_t permille = building.runTimeTotal > 0
+        ? (uint32_t)((uint64_t)task.runTime * 1000 / building.runTimeTotal) : 0;
+    task.cpuPermille = (uint16_t)(permille > 1000 ? 1000 : permille);
+  }
+
+  for (UBaseType_t i = 0; i < count; i++) {
+    previousNumbers[i] = statusBuffer[i].xTaskNumber;
+    previousRunTime[i] = statusBuffer[i].ulRunTimeCounter;
+  }
+  previousCount = (uint8_t)count;
+  previousTotal = total;
+  previousMs = nowMs;
+
+  portENTER_CRITICAL(&snapshotMux);
+  latest = building;
+  latestValid = true;
+  portEXIT_CRITICAL(&snapshotMux);
+  return true;
+}
+
+bool taskSnapshotGetLatest(TaskSnapshot* snapshot) {
+  portENTER_CRITICAL(&snapshotMux);
+  bool valid = latestValid;
+  if (valid) {
+    *snapshot = latest;
+  }
+  portEXIT_CRITICAL(&snapshotMux);
+  return valid;
+}
+
+size_t taskSnapshotToJson(const TaskSnapshot* snapshot, char* buffer, size_t size) {
+  int length = snprintf(buffer, size,
+                        "{\"timestampMs\":%lu,\"intervalMs\":%lu,\"runTimeTotal\":%lu,\"tasks\":[",
+                        (unsigned long)snapshot->timestampMs, (unsigned long)snapshot->intervalMs,
+                        (unsigned long)snapshot->runTimeTotal);
+  for (uint8_t i = 0; i < snapshot->taskCount && length > 0 && (size_t)length < size; i++) {
+    const TaskSnapshotEntry& task = snapshot->tasks[i];
+    length += snprintf(buffer + length, size - length,
+                       "%s{\"name\":\"%s\",\"state\":\"%s\",\"priority\":%u,\"core\":%d,"
+                       "\"stackFree\":%lu,\"runTime\":%lu,\"cpuPermille\":%u}",
+                       i > 0 ? "," : "", task.name, taskSnapshotStateName(task.state), task.priority,
+                       task.core, (unsigned long)task.stackFreeBytes, (unsigned long)task.runTime,
+                       task.cpuPermille);
+  }
+  if (length > 0 && (size_t)length < size) {
+    length += snprintf(buffer + length, size - length, "]}");
+  }
+  return length > 0 && (size_t)length < size ? (size_t)length : 0;
+}
+
+bool taskSnapshotScheduleCapture(TimerWheel* wheel) {
+  taskSnapshotCapture(millis());
+  return timerWheelSchedule(wheel, TASK_SNAPSHOT_INTERVAL_MS, TASK_SNAPSHOT_INTERVAL_MS,
+                            onCaptureTimer, nullptr) != TIMER_HANDLE_NONE;
+}
+
+const char* taskSnapshotStateName(uint8_t state) {
+  switch (state) {
+    case eRunning:   return "running";
+    case eReady:     return "ready";
+    case eBlocked:   return "blocked";
+    case eSuspended: return "suspended";
+    case eDeleted:   return "deleted";
+    default:         return "invalid";
+  }
+}
@@ -0,0 +1,357 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Roue de temporisateurs hiérarchique (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. Un temporisateur est rangé au niveau le plus bas qui partage le bloc de
+     son échéance avec l'instant courant : niveau 0 s'il tombe dans les mêmes
+     64 ms, niveau 1 dans les mêmes 4096 ms, niveau 2 dans les mêmes 262 s,
+     débordement sinon. La case est donnée par les bits de l'échéance
+  2. À chaque début de bloc, la case correspondante du niveau supérieur est
+     redistribuée vers les niveaux inférieurs (cascade) ; la case du niveau 0
+     de l'instant traité contient exactement les échéances de cet instant
+  3. Les cases occupées sont suivies par bitmap : l'avance saute directement
+     à la prochaine échéance ou cascade (un long sommeil ne coûte que
+     quelques itérations) ; la prochaine échéance exacte ne demande que le
+     parcours de la première case occupée de chaque niveau
+*/
+
+#include "utils/timer_wheel.h"
+
+// === CONSTANTES ===
+#define SLOT_MASK       (TIMER_WHEEL_SLOTS - 1)
+#define LEVEL_OVERFLOW  TIMER_WHEEL_LEVELS
+#define LEVEL_FIRING    0xFE
+#define LEVEL_FREE      0xFF
+#define ENTRY_NONE      -1
+
+// === FONCTIONS INTERNES ===
+
+static inline uint8_t levelShift(int level) {
+  return level * TIMER_WHEEL_SLOT_BITS;
+}
+
+static inline int16_t* listHead(TimerWheel* wheel, uint8_t level, uint8_t slot) {
+  return level == LEVEL_OVERFLOW ? &wheel->overflow : &wheel->slots[level][slot];
+}
+
+static TimerEntry* entryFromHandle(const TimerWheel* wheel, TimerHandle handle) {
+  uint16_t index = handle & 0xFFFF;
+  if (handle == TIMER_HANDLE_NONE || index >= TIMER_WHEEL_MAX_TIMERS) {
+    return nullptr;
+  }
+  TimerEntry* entry = const_cast<TimerEntry*>(&wheel->timers[index]);
+  if (entry->generation != (handle >> 16) || entry->level == LEVEL_FREE) {
+    return nullptr;
+  }
+  return entry;
+}
+
+static void linkEntry(TimerWheel* wheel, int16_t index) {
+  TimerEntry* entry = &wheel->timers[index];
+  // Référence : prochain instant à traiter
+  uint32_t base = wheel->tick + 1;
+  uint8_t level = LEVEL_OVERFLOW;
+  for (int l = 0; l < TIMER_WHEEL_LEVELS; l++) {
+    uint8_t shift = levelShift(l + 1);
+    if ((entry->expiry >> shift) == (base >> shift)) {
+      level = l;
+      break;
+    }
+  }
+  entry->level = level;
+  entry->slot = level == LEVEL_OVERFLOW ? 0 : (entry->expiry >> levelShift(level)) & SLOT_MASK;
+
+  int16_t* head = listHead(wheel, level, entry->slot);
+  entry->prev = ENTRY_NONE;
+  entry->next = *head;
+  if (*head != ENTRY_NONE) {
+    wheel->timers[*head].prev = index;
+  }
+  *head = index;
+  if (level != LEVEL_OVERFLOW) {
+    wheel->occupied[level] |= 1ULL << entry->slot;
+  }
+}
+
+static void unlinkEntry(TimerWheel* wheel, int16_t index) {
+  TimerEntry* entry = &wheel->timers[index];
+  int16_t* head = listHead(wheel, entry->level, entry->slot);
+  if (entry->prev != ENTRY_NONE) {
+    wheel->timers[entry->prev].next = entry->next;
+  } else {
+    *head = entry->next;
+  }
+  if (entry->next != ENTRY_NONE) {
+    wheel->timers[entry->next].prev = entry->prev;
+  }
+  if (entry->level != LEVEL_OVERFLOW && *head == ENTRY_NONE) {
+    wheel->occupied[entry->level] &= ~(1ULL << entry->slot);
+  }
+}
+
+static void releaseEntry(TimerWheel* wheel, int16_t index) {
+  TimerEntry* entry = &wheel->timers[index];
+  // Nouvelle génération : les identifiants existants deviennent périmés,
+  // qu'il s'agisse d'un désarmement ou d'un temporisateur unique échu
+  entry->generation = entry->generation == 0xFFFF ? 1 : entry->generation + 1;
+  entry->level = LEVEL_FREE;
+  entry->callback = nullptr;
+  entry->next = wheel->freeList;
+  wheel->freeList = index;
+  wheel->stats.active--;
+}
+
+// Redistribue une liste vers les niveaux inférieurs
+static void cascadeList(TimerWheel* wheel, uint8_t level, uint8_t slot) {
+  int16_t* head = listHead(wheel, level, slot);
+  int16_t index = *head;
+  *head = ENTRY_NONE;
+  if (level != LEVEL_OVERFLOW) {
+    wheel->occupied[level] &= ~(1ULL << slot);
+  }
+  while (index != ENTRY_NONE) {
+    int16_t next = wheel->timers[index].next;
+    linkEntry(wheel, index);
+    wheel->stats.cascaded++;
+    index = next;
+  }
+}
+
+// Cascades dues au début du bloc contenant t (tick == t - 1)
+static void cascadeAt(TimerWheel* wheel, uint32_t t) {
+  if ((t & SLOT_MASK) != 0) {
+    return;
+  }
+  for (int level = TIMER_WHEEL_LEVELS; level >= 1; level--) {
+    // Niveau `level` redistribué seulement au début de l'un de ses blocs
+    if ((t & ((1UL << levelShift(level)) - 1)) != 0) {
+      continue;
+    }
+    if (level == LEVEL_OVERFLOW) {
+      if (wheel->overflow != ENTRY_NONE) {
+        cascadeList(wheel, LEVEL_OVERFLOW, 0);
+      }
+    } else {
+      uint8_t slot = (t >> levelShift(level)) & SLOT_MASK;
+      if (wheel->occupied[level] & (1ULL << slot)) {
+        cascadeList(wheel, level, slot);
+      }
+    }
+  }
+}
+
+// Exécute les échéances de l'instant t (case du niveau 0)
+static int expireAt(TimerWheel* wheel, uint32_t t) {
+  uint8_t slot = t & SLOT_MASK;
+  int fired = 0;
+  wheel->tick = t;
+
+  int16_t index = wheel->slots[0][slot];
+  while (index != ENTRY_NONE) {
+    TimerEntry* entry = &wheel->timers[index];
+    if (entry->expiry != t) {
+      // Armé par un rappel pour le bloc suivant : reste dans la case
+      index = entry->next;
+      continue;
+    }
+    unlinkEntry(wheel, index);
+    entry->level = LEVEL_FIRING;
+    uint16_t generation = entry->generation;
+
+    uint32_t lateness = wheel->target - t;
+    if (lateness > wheel->stats.maxLatenessMs) {
+      wheel->stats.maxLatenessMs = lateness;
+    }
+    entry->callback(entry->context);
+    wheel->stats.fired++;
+    fired++;
+
+    // Le rappel a pu désarmer son temporisateur (emplacement libéré ou réutilisé)
+    if (entry->level == LEVEL_FIRING && entry->generation == generation) {
+      if (entry->period == 0) {
+        releaseEntry(wheel, index);
+      } else {
+        entry->expiry = t + entry->period;
+        if ((int32_t)(entry->expiry - wheel->target) <= 0) {
+          uint32_t skipped = (wheel->target - entry->expiry) / entry->period + 1;
+          entry->expiry += skipped * entry->period;
+          wheel->stats.missed += skipped;
+        }
+        linkEntry(wheel, index);
+      }
+    }
+    // La liste a pu changer pendant le rappel
+    index = wheel->slots[0][slot];
+  }
+  return fired;
+}
+
+// Échéance la plus proche d'une liste
+static uint32_t earliestInList(const TimerWheel* wheel, int16_t index, uint32_t base) {
+  uint32_t earliest = UINT32_MAX;
+  for (; index != ENTRY_NONE; index = wheel->timers[index].next) {
+    uint32_t offset = wheel->timers[index].expiry - base;
+    if (offset < earliest) {
+      earliest = offset;
+    }
+  }
+  return earliest;
+}
+
+// Prochain instant à traiter, en écart au prochain instant non traité :
+// échéance du niveau 0 ou début d'une case à redistribuer. Avec exact, la
+// case trouvée aux niveaux supérieurs est parcourue pour donner l'échéance
+static bool nextEvent(const TimerWheel* wheel, bool exact, uint32_t* when) {
+  uint32_t base = wheel->tick + 1;
+  uint32_t earliest = UINT32_MAX;   // Écart à base
+  for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    // Cases restant à atteindre dans le bloc courant de ce niveau
+    uint8_t current = (base >> levelShift(level)) & SLOT_MASK;
+    uint64_t pending = wheel->occupied[level] & (~0ULL << current);
+    if (pending == 0) {
+      continue;
+    }
+    uint8_t slot = __builtin_ctzll(pending);
+    uint32_t offset;
+    if (exact && level > 0) {
+      offset = earliestInList(wheel, wheel->slots[level][slot], base);
+    } else {
+      uint8_t blockShift = levelShift(level + 1);
+      uint32_t slotStart = ((base >> blockShift) << blockShift) | ((uint32_t)slot << levelShift(level));
+      // Case courante d'un niveau supérieur pas encore redistribuée : tout de suite
+      offset = (int32_t)(slotStart - base) < 0 ? 0 : slotStart - base;
+    }
+    if (offset < earliest) {
+      earliest = offset;
+    }
+  }
+  if (wheel->overflow != ENTRY_NONE) {
+    uint32_t offset;
+    if (exact) {
+      offset = earliestInList(wheel, wheel->overflow, base);
+    } else {
+      // Premier début de bloc du dernier niveau à partir de base
+      uint8_t shift = levelShift(TIMER_WHEEL_LEVELS);
+      offset = ((((base - 1) >> shift) + 1) << shift) - base;
+    }
+    if (offset < earliest) {
+      earliest = offset;
+    }
+  }
+  if (earliest == UINT32_MAX) {
+    return false;
+  }
+  *when = base + earliest;
+  return true;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void timerWheelInit(TimerWheel* wheel, uint32_t nowMs) {
+  memset(wheel, 0, sizeof(TimerWheel));
+  for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+      wheel->slots[level][slot] = ENTRY_NONE;
+    }
+  }
+  wheel->overflow = ENTRY_NONE;
+  for (int i = 0; i < TIMER_WHEEL_MAX_TIMERS; i++) {
+    wheel->timers[i].level = LEVEL_FREE;
+    wheel->timers[i].generation = 1;
+    wheel->timers[i].next = (i + 1 < TIMER_WHEEL_MAX_TIMERS) ? i + 1 : ENTRY_NONE;
+  }
+  wheel->freeList = 0;
+  wheel->tick = nowMs;
+  wheel->target = nowMs;
+}
+
+TimerHandle timerWheelSchedule(TimerWheel* wheel, uint32_t delayMs, uint32_t periodMs,
+                               TimerCallback callback, void* context) {
+  if (callback == nullptr) {
+    return TIMER_HANDLE_NONE;
+  }
+  int16_t index = wheel->freeList;
+  if (index == ENTRY_NONE) {
+    wheel->stats.exhausted++;
+    return TIMER_HANDLE_NONE;
+  }
+  TimerEntry* entry = &wheel->timers[index];
+  wheel->freeList = entry->next;
+
+  entry->callback = callback;
+  entry->context = context;
+  entry->period = periodMs;
+  // L'instant courant est déjà traité : échéance au plus tôt au suivant
+  entry->expiry = wheel->tick + (delayMs > 0 ? delayMs : 1);
+  linkEntry(wheel, index);
+
+  wheel->stats.active++;
+  if (wheel->stats.active > wheel->stats.peakActive) {
+    wheel->stats.peakActive = wheel->stats.active;
+  }
+  return ((TimerHandle)entry->generation << 16) | (uint16_t)index;
+}
+
+bool timerWheelCancel(TimerWheel* wheel, TimerHandle handle) {
+  TimerEntry* entry = entryFromHandle(wheel, handle);
+  if (entry == nullptr) {
+    return false;
+  }
+  int16_t index = entry - wheel->timers;
+  if (entry->level != LEVEL_FIRING) {
+    unlinkEntry(wheel, index);
+  }
+  releaseEntry(wheel, index);
+  return true;
+}
+
+bool timerWheelIsActive(const TimerWheel* wheel, TimerHandle handle) {
+  return entryFromHandle(wheel, handle) != nullptr;
+}
+
+int timerWheelAdvance(TimerWheel* wheel, uint32_t nowMs) {
+  int fired = 0;
+  uint32_t t;
+  wheel->target = nowMs;
+
+  // Seuls les instants d'une échéance ou d'une cascade sont visités
+  while (nextEvent(wheel, false, &t) && (int32_t)(nowMs - t) >= 0) {
+    wheel->tick = t - 1;
+    cascadeAt(wheel, t);
+    if (wheel->occupied[0] & (1ULL << (t & SLOT_MASK))) {
+      fired += expireAt(wheel, t);
+    }
+    wheel->tick = t;
+  }
+  if ((int32_t)(nowMs - wheel->tick) > 0) {
+    wheel->tick = nowMs;
+  }
+  return fired;
+}
+
+uint32_t timerWheelNextDelay(const TimerWheel* wheel, uint32_t nowMs) {
+  uint32_t due;
+  if (!nextEvent(wheel, true, &due)) {
+    return TIMER_WHEEL_MAX_IDLE_MS;
+  }
+  int32_t delay = (int32_t)(due - nowMs);
+  if (delay <= 0) {
+    return 0;
+  }
+  return delay < TIMER_WHEEL_MAX_IDLE_MS ? delay : TIMER_WHEEL_MAX_IDLE_MS;
+}
+
+uint32_t timerWheelService(TimerWheel* wheel) {
+  timerWheelAdvance(wheel, millis());
+  return timerWheelNextDelay(wheel, millis());
+}
+
+TimerWheelStats timerWheelGetStats(const TimerWheel* wheel) {
+  return wheel->stats;
+}
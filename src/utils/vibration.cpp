@@ -0,0 +1,364 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Analyse vibratoire de l'IMU (Implémentation)
+  -----------------------
+
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+
+  ===== FONCTIONNEMENT =====
+  1. L'anneau reçoit la norme de l'accélération (indépendante de l'attitude) ;
+     l'index d'écriture ne fait que croître, publié après l'échantillon
+  2. Un bloc est lu en place dans l'anneau : une passe pour la moyenne
+     (gravité retirée), une passe qui applique la fenêtre en remplissant le
+     tampon complexe de la FFT, seule copie des données
+  3. Après la FFT, la puissance de chaque raie remplace le tampon ; elle
+     donne l'énergie des bandes (Parseval, fenêtre compensée) et les pics
+     (maxima locaux, interpolation parabolique de la fréquence)
+  4. La référence de chaque bande est une moyenne exponentielle apprise au
+     démarrage puis suivie lentement ; pendant une anomalie elle n'évolue
+     presque plus, pour ne pas l'absorber
+  5. Le coût d'un bloc est suivi en moyenne glissante : l'analyse s'arrête
+     quand le bloc suivant dépasserait le budget du cycle
+*/
+
+#include "utils/vibration.h"
+#include "utils/logging.h"
+#include <math.h>
+#include <string.h>
+#ifndef NATIVE_BUILD
+#include "esp_dsp.h"
+#endif
+
+// === CONSTANTES ===
+#define RING_MASK               (VIBRATION_RING_SIZE - 1)
+#define SPECTRUM_BINS           (VIBRATION_FFT_SIZE / 2)
+#define BASELINE_ALPHA          0.05f     // Suivi de la référence hors anomalie
+#define BASELINE_ALPHA_ANOMALY  0.002f    // Suivi pendant une anomalie
+#define BLOCK_COST_ALPHA        0.2f
+
+static_assert((VIBRATION_RING_SIZE & RING_MASK) == 0, "VIBRATION_RING_SIZE doit être une puissance de 2");
+static_assert((VIBRATION_FFT_SIZE & (VIBRATION_FFT_SIZE - 1)) == 0, "VIBRATION_FFT_SIZE doit être une puissance de 2");
+static_assert(VIBRATION_RING_SIZE >= 2 * VIBRATION_FFT_SIZE, "L'anneau doit contenir au moins deux blocs");
+
+// === DÉFINITION DES TYPES ===
+
+typedef struct {
+  const char* name;
+  float lowHz;
+  float highHz;
+} VibrationBandDefinition;
+
+// === VARIABLES GLOBALES ===
+
+static const VibrationBandDefinition bandDefinitions[VIBRATION_BAND_COUNT] = {
+  { "PILOTAGE",  0.5f,  3.0f   },
+  { "SERVO",     3.0f,  12.0f  },
+  { "LIGNES",    12.0f, 40.0f  },
+  { "STRUCTURE", 40.0f, 100.0f },
+};
+
+// Anneau : écrit par la tâche des capteurs, lu par la tâche d'analyse
+static float ring[VIBRATION_RING_SIZE];
+static uint32_t writeIndex = 0;
+
+// État de l'analyse (tâche d'analyse uniquement)
+static float window[VIBRATION_FFT_SIZE];
+static float windowPower = 1.0f;                       // Somme des carrés de la fenêtre
+static float fftBuffer[2 * VIBRATION_FFT_SIZE];        // Complexes entrelacés, puis puissance
+static uint32_t readIndex = 0;
+static float baselineEnergy[VIBRATION_BAND_COUNT];
+static uint16_t anomalyStreak = 0;
+static float blockCostUs = 0.0f;
+static VibrationStatus working;
+
+// Résumé publié
+static VibrationStatus published;
+static portMUX_TYPE statusMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool anomalous = false;
+
+// === FONCTIONS INTERNES ===
+
+#ifdef NATIVE_BUILD
+// Équivalents hôte des fonctions esp-dsp utilisées (mêmes conventions)
+
+static void fftInit() {
+}
+
+static void fftWindowHann(float* w, int n) {
+  for (int i = 0; i < n; i++) {
+    w[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (n - 1));
+  }
+}
+
+static void fftRun(float* data, int n) {
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      float re = data[2 * i], im = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = re;
+      data[2 * j + 1] = im;
+    }
+  }
+  for (int length = 2; length <= n; length <<= 1) {
+    float angle = -2.0f * (float)M_PI / length;
+    for (int start = 0; start < n; start += length) {
+      for (int k = 0; k < length / 2; k++) {
+        float wr = cosf(angle * k), wi = sinf(angle * k);
+        float* a = &data[2 * (start + k)];
+        float* b = &data[2 * (start + k + length / 2)];
+        float tr = b[0] * wr - b[1] * wi;
+        float ti = b[0] * wi + b[1] * wr;
+        b[0] = a[0] - tr;
+        b[1] = a[1] - ti;
+        a[0] += tr;
+        a[1] += ti;
+      }
+    }
+  }
+}
+#else
+static float fftTable[VIBRATION_FFT_SIZE];             // Facteurs de rotation (taille fixe, pas d'allocation)
+
+static void fftInit() {
+  if (dsps_fft2r_init_fc32(fftTable, VIBRATION_FFT_SIZE) != ESP_OK) {
+    LOG_ERROR("VIBRATION", "Initialisation de la FFT impossible");
+  }
+}
+
+static void fftWindowHann(float* w, int n) {
+  dsps_wind_hann_f32(w, n);
+}
+
+static void fftRun(float* data, int n) {
+  dsps_fft2r_fc32(data, n);       // Version optimisée de l'ESP32 (ae32)
+  dsps_bit_rev_fc32(data, n);
+}
+#endif
+
+/**
+ * Charge un bloc de l'anneau dans le tampon de la FFT (moyenne retirée, fenêtre appliquée)
+ */
+static void loadBlock(uint32_t start) {
+  float mean = 0.0f;
+  for (int i = 0; i < VIBRATION_FFT_SIZE; i++) {
+    mean += ring[(start + i) & RING_MASK];
+  }
+  mean /= VIBRATION_FFT_SIZE;
+  for (int i = 0; i < VIBRATION_FFT_SIZE; i++) {
+    fftBuffer[2 * i] = (ring[(start + i) & RING_MASK] - mean) * window[i];
+    fftBuffer[2 * i + 1] = 0.0f;
+  }
+}
+
+/**
+ * Puissance des raies 0..N/2-1, écrite en place au début du tampon
+ */
+static void computePower() {
+  for (int k = 0; k < SPECTRUM_BINS; k++) {
+    float re = fftBuffer[2 * k];
+    float im = fftBuffer[2 * k + 1];
+    fftBuffer[k] = re * re + im * im;
+  }
+}
+
+static void insertPeak(float hz, float amplitude) {
+  for (int p = 0; p < VIBRATION_PEAK_COUNT; p++) {
+    if (amplitude > working.peakAmplitude[p]) {
+      for (int q = VIBRATION_PEAK_COUNT - 1; q > p; q--) {
+        working.peakHz[q] = working.peakHz[q - 1];
+        working.peakAmplitude[q] = working.peakAmplitude[q - 1];
+      }
+      working.peakHz[p] = hz;
+      working.peakAmplitude[p] = amplitude;
+      return;
+    }
+  }
+}
+
+static void summarizeSpectrum() {
+  const float* power = fftBuffer;
+  const float binHz = (float)VIBRATION_SAMPLE_RATE_HZ / VIBRATION_FFT_SIZE;
+  // Énergie à une face ramenée au signal : 2 / (N * somme des carrés de la fenêtre)
+  const float energyScale = 2.0f / (VIBRATION_FFT_SIZE * windowPower);
+  // Amplitude crête d'une sinusoïde : 2 |X| / somme de la fenêtre (N/2 pour Hann)
+  const float amplitudeScale = 4.0f / VIBRATION_FFT_SIZE;
+
+  for (int b = 0; b < VIBRATION_BAND_COUNT; b++) {
+    int low = (int)ceilf(bandDefinitions[b].lowHz / binHz);
+    int high = (int)ceilf(bandDefinitions[b].highHz / binHz);
+    float energy = 0.0f;
+    for (int k = low > 1 ? low : 1; k < high && k < SPECTRUM_BINS; k++) {
+      energy += power[k];
+    }
+    working.bandRms[b] = sqrtf(energy * energyScale);
+  }
+
+  for (int p = 0; p < VIBRATION_PEAK_COUNT; p++) {
+    working.peakHz[p] = 0.0f;
+    working.peakAmplitude[p] = 0.0f;
+  }
+  for (int k = 2; k < SPECTRUM_BINS - 1; k++) {
+    if (power[k] <= power[k - 1] || power[k] < power[k + 1]) {
+      continue;
+    }
+    // Interpolation parabolique sur les amplitudes voisines
+    float left = sqrtf(power[k - 1]), center = sqrtf(power[k]), right = sqrtf(power[k + 1]);
+    float denominator = left - 2.0f * center + right;
+    float offset = denominator != 0.0f ? 0.5f * (left - right) / denominator : 0.0f;
+    float amplitude = (center - 0.25f * (left - right) * offset) * amplitudeScale;
+    insertPeak((k + offset) * binHz, amplitude);
+  }
+}
+
+static void updateAnomaly() {
+  bool learning = working.blocks < VIBRATION_LEARN_BLOCKS;
+  float worstRatio = 0.0f;
+  uint8_t worstBand = 0;
+
+  for (int b = 0; b < VIBRATION_BAND_COUNT; b++) {
+    float energy = working.bandRms[b] * working.bandRms[b];
+    if (!learning && working.bandRms[b] > VIBRATION_MIN_RMS) {
+      // Référence plancher : une bande calme ne déclenche pas sur du bruit
+      float floor = fmaxf(baselineEnergy[b], VIBRATION_MIN_RMS * VIBRATION_MIN_RMS);
+      float ratio = energy / floor;
+      if (ratio > worstRatio) {
+        worstRatio = ratio;
+        worstBand = b;
+      }
+    }
+  }
+
+  bool blockAnomalous = worstRatio > VIBRATION_ANOMALY_RATIO;
+  anomalyStreak = blockAnomalous ? anomalyStreak + 1 : 0;
+  bool wasAnomalous = working.anomalous;
+  if (blockAnomalous && anomalyStreak >= VIBRATION_ANOMALY_BLOCKS) {
+    working.anomalous = true;
+  } else if (!blockAnomalous) {
+    working.anomalous = false;
+  }
+
+  // Apprentissage : moyenne simple, puis suivi exponentiel
+  float alpha = learning ? 1.0f / (working.blocks + 1)
+              : (blockAnomalous ? BASELINE_ALPHA_ANOMALY : BASELINE_ALPHA);
+  for (int b = 0; b < VIBRATION_BAND_COUNT; b++) {
+    float energy = working.bandRms[b] * working.bandRms[b];
+    baselineEnergy[b] += alpha * (energy - baselineEnergy[b]);
+    working.baselineRms[b] = sqrtf(baselineEnergy[b]);
+  }
+
+  working.anomalyRatio = worstRatio;
+  working.anomalyBand = worstBand;
+  working.learning = learning;
+
+  if (working.anomalous && !wasAnomalous) {
+    LOG_WARNING("VIBRATION", "Vibration anormale bande %s : %.3f g eff. (référence %.3f g), pic %.1f Hz",
+                bandDefinitions[worstBand].name, working.bandRms[worstBand],
+                working.baselineRms[worstBand], working.peakHz[0]);
+  } else if (!working.anomalous && wasAnomalous) {
+    LOG_INFO("VIBRATION", "Vibrations revenues à la normale");
+  }
+}
+
+static void publishStatus() {
+  portENTER_CRITICAL(&statusMux);
+  published = working;
+  portEXIT_CRITICAL(&statusMux);
+  anomalous = working.anomalous;
+}
+
+// === FONCTIONS PUBLIQUES ===
+
+void vibrationInit() {
+  fftInit();
+  fftWindowHann(window, VIBRATION_FFT_SIZE);
+  windowPower = 0.0f;
+  for (int i = 0; i < VIBRATION_FFT_SIZE; i++) {
+    windowPower += window[i] * window[i];
+  }
+
+  __atomic_store_n(&writeIndex, 0, __ATOMIC_RELEASE);
+  readIndex = 0;
+  memset(baselineEnergy, 0, sizeof(baselineEnergy));
+  memset(&working, 0, sizeof(working));
+  anomalyStreak = 0;
+  blockCostUs = 0.0f;
+  publishStatus();
+  LOG_INFO("VIBRATION", "Analyse vibratoire prête (%d points à %d Hz, résolution %.2f Hz)",
+           VIBRATION_FFT_SIZE, VIBRATION_SAMPLE_RATE_HZ,
+           (float)VIBRATION_SAMPLE_RATE_HZ / VIBRATION_FFT_SIZE);
+}
+
+void vibrationPushSample(const float accel[3]) {
+  uint32_t index = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+  ring[index & RING_MASK] = sqrtf(accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2]);
+  __atomic_store_n(&writeIndex, index + 1, __ATOMIC_RELEASE);
+}
+
+int vibrationProcess(uint32_t budgetUs) {
+  uint32_t start = micros();
+  int processed = 0;
+
+  for (;;) {
+    uint32_t written = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+    if (written - readIndex > VIBRATION_RING_SIZE - VIBRATION_HOP) {
+      // Analyse en retard : reprise au bloc complet le plus récent
+      uint32_t latest = written - VIBRATION_FFT_SIZE;
+      working.skipped += (latest - readIndex) / VIBRATION_HOP;
+      readIndex = latest;
+    }
+    if (written - readIndex < VIBRATION_FFT_SIZE) {
+      break;
+    }
+    uint32_t elapsed = micros() - start;
+    if (processed > 0 && elapsed + (uint32_t)blockCostUs >= budgetUs) {
+      break;
+    }
+
+    uint32_t blockStart = micros();
+    loadBlock(readIndex);
+    // Bloc écrasé par le producteur pendant la lecture : écarté
+    if (__atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE) - readIndex > VIBRATION_RING_SIZE) {
+      working.overruns++;
+      readIndex += VIBRATION_HOP;
+      continue;
+    }
+    fftRun(fftBuffer, VIBRATION_FFT_SIZE);
+    computePower();
+    summarizeSpectrum();
+    updateAnomaly();
+    working.blocks++;
+    readIndex += VIBRATION_HOP;
+    processed++;
+
+    blockCostUs += BLOCK_COST_ALPHA * ((float)(micros() - blockStart) - blockCostUs);
+    working.blockUs = (uint32_t)blockCostUs;
+    working.timestampMs = millis();
+  }
+
+  if (processed > 0) {
+    publishStatus();
+  }
+  return processed;
+}
+
+void vibrationGetStatus(VibrationStatus* status) {
+  portENTER_CRITICAL(&statusMux);
+  *status = published;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+bool vibrationIsAnomalous() {
+  return anomalous;
+}
+
+const char* vibrationBandName(uint8_t band) {
+  return band < VIBRATION_BAND_COUNT ? bandDefinitions[band].name : "INCONNUE";
+}
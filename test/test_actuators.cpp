@@ -0,0 +1,70 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires des actionneurs
+  -----------------------
+  
+  Commande de direction produite par l'autopilote : bornes servo, sens de
+  correction et changement de gains en vol.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include "control/autopilot.h"
+
+// autopilotInit() est idempotent : on repart d'un PID neuf avant chaque mesure
+static void resetController() {
+  autopilotInit();
+  PIDParams gains;
+  pidInit(&gains, AUTOPILOT_PID_KP, AUTOPILOT_PID_KI, AUTOPILOT_PID_KD,
+          -45.0f, 45.0f, AUTOPILOT_PID_MAX_INTEGRAL);
+  updatePIDParams(&gains);
+}
+
+static void test_command_is_bounded_to_servo_range() {
+  resetController();
+  float command = computeControlCommand(-90.0f, 90.0f);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 45.0f, command);
+  resetController();
+  command = computeControlCommand(90.0f, -90.0f);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, -45.0f, command);
+}
+
+static void test_command_corrects_toward_target() {
+  resetController();
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, computeControlCommand(0.0f, 5.0f));
+  resetController();
+  TEST_ASSERT_LESS_THAN_FLOAT(0.0f, computeControlCommand(0.0f, -5.0f));
+}
+
+static void test_command_zero_on_target() {
+  resetController();
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, computeControlCommand(10.0f, 10.0f));
+}
+
+static void test_command_updates_state_angles() {
+  resetController();
+  computeControlCommand(3.0f, 7.0f);
+  AutopilotState state = getAutopilotState();
+  TEST_ASSERT_EQUAL_FLOAT(3.0f, state.currentAngle);
+  TEST_ASSERT_EQUAL_FLOAT(7.0f, state.targetAngle);
+}
+
+static void test_pid_params_update_keeps_setpoint() {
+  resetController();
+  computeControlCommand(0.0f, 12.0f);
+
+  PIDParams gains;
+  pidInit(&gains, 2.0f, 0.0f, 0.0f, -45.0f, 45.0f, 10.0f);
+  updatePIDParams(&gains);
+
+  // Gain proportionnel seul : 2 x (12 - 2) = 20
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 20.0f, computeControlCommand(2.0f, 12.0f));
+}
+
+void runActuatorTests() {
+  RUN_TEST(test_command_is_bounded_to_servo_range);
+  RUN_TEST(test_command_corrects_toward_target);
+  RUN_TEST(test_command_zero_on_target);
+  RUN_TEST(test_command_updates_state_angles);
+  RUN_TEST(test_pid_params_update_keeps_setpoint);
+}
@@ -0,0 +1,423 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires de la communication
+  -----------------------
+  
+  Pool d'objets des messages, sérialisation JSON du tableau de bord,
+  format de télémétrie et archive en colonnes de la station sol.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <string.h>
+#include "utils/object_pool.h"
+#include "ui/dashboard.h"
+#include "communication/protocols.h"
+#ifdef NATIVE_BUILD
+#include <atomic>
+#include <thread>
+#include <stdlib.h>
+#include <unistd.h>
+#include "column_store.h"
+#endif
+
+typedef struct {
+  uint8_t type;
+  char payload[32];
+} TestMessage;
+
+// === POOL D'OBJETS ===
+
+static void test_pool_acquire_until_exhausted() {
+  ObjectPool<TestMessage, 4> pool;
+  TestMessage* items[4];
+  for (int i = 0; i < 4; i++) {
+    items[i] = pool.acquire();
+    TEST_ASSERT_NOT_NULL(items[i]);
+  }
+  TEST_ASSERT_EQUAL(0, pool.available());
+  TEST_ASSERT_NULL(pool.acquire());
+  TEST_ASSERT_TRUE(pool.release(items[2]));
+  TEST_ASSERT_EQUAL_PTR(items[2], pool.acquire());
+}
+
+static void test_pool_rejects_double_and_foreign_release() {
+  ObjectPool<TestMessage, 2> pool;
+  TestMessage outside;
+  TestMessage* item = pool.acquire();
+  TEST_ASSERT_TRUE(pool.isUsed(item));
+  TEST_ASSERT_TRUE(pool.release(item));
+  TEST_ASSERT_FALSE(pool.release(item));
+  TEST_ASSERT_FALSE(pool.release(&outside));
+  TEST_ASSERT_EQUAL(2, pool.available());
+}
+
+static void test_pool_reset() {
+  ObjectPool<TestMessage, 3> pool;
+  pool.acquire();
+  pool.acquire();
+  TEST_ASSERT_TRUE(pool.reset());
+  TEST_ASSERT_EQUAL(pool.capacity(), pool.available());
+}
+
+// === TABLEAU DE BORD ===
+
+static void test_dashboard_json_full() {
+  dashboardInit();
+  dashboardUpdateSystem(120, 150000, 42, 51.5f);
+  dashboardUpdateControl(-15, 5, 2500, 12.5f);
+  dashboardUpdateStatus(90, "OK", false, false);
+  TEST_ASSERT_TRUE(dashboardPublish());
+
+  String json = dashboardToJson(DASH_UPDATE_FULL);
+  const char* text = json.c_str();
+  TEST_ASSERT_EQUAL_CHAR('{', text[0]);
+  TEST_ASSERT_EQUAL_CHAR('}', text[json.length() - 1]);
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"uptime\":120"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"direction\":-15"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"message\":\"OK\""));
+  TEST_ASSERT_NULL(strstr(text, ",}"));
+}
+
+static void test_dashboard_frames_publish_complete_updates() {
+  dashboardInit();
+  dashboardUpdateControl(10, 0, 3000, 8.0f);
+  dashboardPublish();
+  uint32_t sequence = dashboardGetSequence();
+
+  // Mises à jour invisibles jusqu'au tick d'agrégation
+  dashboardUpdateControl(-20, 3, 4000, 9.5f);
+  dashboardUpdateStatus(70, "Rafale", true, false);
+  DashboardFrame frame;
+  TEST_ASSERT_TRUE(dashboardGetFrame(&frame));
+  TEST_ASSERT_EQUAL_UINT32(sequence, frame.sequence);
+  TEST_ASSERT_EQUAL(10, frame.data.directionAngle);
+  TEST_ASSERT_EQUAL_UINT16(3000, frame.data.lineLength);
+
+  // Une trame rassemble toutes les mises à jour du tick
+  TEST_ASSERT_TRUE(dashboardPublish());
+  TEST_ASSERT_EQUAL_UINT32(sequence + 1, dashboardGetSequence());
+  dashboardGetFrame(&frame);
+  TEST_ASSERT_EQUAL(-20, frame.data.directionAngle);
+  TEST_ASSERT_EQUAL_UINT16(4000, frame.data.lineLength);
+  TEST_ASSERT_EQUAL_STRING("Rafale", frame.data.statusMessage);
+  TEST_ASSERT_TRUE(frame.data.hasWarning);
+
+  // Rien de nouveau : pas de trame, numéro inchangé (détection de changement)
+  TEST_ASSERT_FALSE(dashboardPublish());
+  uint32_t jsonSequence = 0;
+  String json = dashboardToJson(DASH_UPDATE_CONTROL, &jsonSequence);
+  TEST_ASSERT_EQUAL_UINT32(sequence + 1, jsonSequence);
+  char expected[32];
+  snprintf(expected, sizeof(expected), "\"sequence\":%lu,", (unsigned long)jsonSequence);
+  TEST_ASSERT_NOT_NULL(strstr(json.c_str(), expected));
+}
+
+#ifdef NATIVE_BUILD
+static void test_dashboard_concurrent_readers_see_whole_frames() {
+  dashboardInit();
+  // Trame initiale cohérente : le lecteur peut démarrer avant la première publication
+  dashboardUpdateControl(0, 0, 0, 0.0f);
+  dashboardUpdateSystem(0, 0, 0, 0.0f);
+  dashboardPublish();
+  std::atomic<bool> done(false);
+  std::atomic<uint32_t> reads(0);
+  uint32_t torn = 0;
+  uint32_t backwards = 0;
+
+  // Lecteur (serveur web) pendant que la tâche réseau agrège et publie
+  std::thread reader([&]() {
+    uint32_t lastSequence = 0;
+    DashboardFrame frame;
+    while (!done.load()) {
+      dashboardGetFrame(&frame);
+      const DashboardData& d = frame.data;
+      torn += (d.trimAngle != d.directionAngle || d.lineLength != (uint16_t)(d.directionAngle * 3) ||
+               d.uptime != (uint32_t)d.directionAngle) ? 1 : 0;
+      backwards += frame.sequence < lastSequence ? 1 : 0;
+      lastSequence = frame.sequence;
+      reads++;
+    }
+  });
+  for (int i = 0; i < 5000 || reads.load() < 1000; i++) {
+    int16_t k = i % 5000 + 1;
+    dashboardUpdateControl(k, k, k * 3, 0.0f);
+    dashboardUpdateSystem(k, 0, 0, 0.0f);
+    dashboardPublish();
+  }
+  done.store(true);
+  reader.join();
+
+  TEST_ASSERT_EQUAL_UINT32(0, torn);
+  TEST_ASSERT_EQUAL_UINT32(0, backwards);
+}
+#endif
+
+static void test_dashboard_json_partial_has_no_trailing_comma() {
+  dashboardInit();
+  String json = dashboardToJson(DASH_UPDATE_CONTROL);
+  const char* text = json.c_str();
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"control\""));
+  TEST_ASSERT_NULL(strstr(text, "\"system\""));
+  TEST_ASSERT_NULL(strstr(text, ",}"));
+  TEST_ASSERT_EQUAL_CHAR('}', text[json.length() - 1]);
+}
+
+// === TÉLÉMÉTRIE ===
+
+static TelemetryFrame makeTelemetryFrame(uint16_t unitId, uint32_t sequence) {
+  TelemetryFrame frame = {};
+  frame.unitId = unitId;
+  frame.flags = 2;
+  frame.sequence = sequence;
+  frame.timestampMs = sequence * 10;
+  for (int i = 0; i < TELEMETRY_FIELD_COUNT; i++) {
+    frame.values[i] = sequence + i * 0.5f;
+  }
+  return frame;
+}
+
+static void test_telemetry_round_trip_and_crc() {
+  TelemetryFrame sent = makeTelemetryFrame(42, 7);
+  uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+  size_t length = telemetryEncode(&sent, buffer, sizeof(buffer));
+  TEST_ASSERT_EQUAL(TELEMETRY_HEADER_SIZE + TELEMETRY_FIELD_COUNT * 4 + TELEMETRY_CRC_SIZE, length);
+  TEST_ASSERT_EQUAL('K', buffer[0]);
+  TEST_ASSERT_EQUAL('T', buffer[1]);
+
+  TelemetryFrame received;
+  TEST_ASSERT_EQUAL(length, telemetryDecode(buffer, length, &received));
+  TEST_ASSERT_EQUAL(42, received.unitId);
+  TEST_ASSERT_EQUAL(2, received.flags);
+  TEST_ASSERT_EQUAL_UINT32(7, received.sequence);
+  TEST_ASSERT_EQUAL_UINT32(70, received.timestampMs);
+  TEST_ASSERT_EQUAL_MEMORY(sent.values, received.values, sizeof(sent.values));
+
+  // Octet altéré, trame tronquée, destination trop petite
+  buffer[20] ^= 0x01;
+  TEST_ASSERT_EQUAL(0, telemetryDecode(buffer, length, &received));
+  buffer[20] ^= 0x01;
+  TEST_ASSERT_EQUAL(0, telemetryDecode(buffer, length - 1, &received));
+  TEST_ASSERT_EQUAL(0, telemetryEncode(&sent, buffer, length - 1));
+}
+
+static void test_telemetry_older_frame_leaves_new_fields_nan() {
+  // Trame d'un émetteur qui ne connaît que les 3 premiers champs
+  TelemetryFrame sent = makeTelemetryFrame(1, 1);
+  uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+  telemetryEncode(&sent, buffer, sizeof(buffer));
+  buffer[3] = 3;
+  size_t length = TELEMETRY_HEADER_SIZE + 3 * 4;
+  uint16_t crc = telemetryCrc16(buffer, length);
+  buffer[length] = crc & 0xFF;
+  buffer[length + 1] = crc >> 8;
+
+  TelemetryFrame received;
+  TEST_ASSERT_EQUAL(length + TELEMETRY_CRC_SIZE, telemetryDecode(buffer, length + TELEMETRY_CRC_SIZE, &received));
+  TEST_ASSERT_EQUAL_FLOAT(sent.values[TELEMETRY_FIELD_YAW], received.values[TELEMETRY_FIELD_YAW]);
+  TEST_ASSERT_TRUE(isnan(received.values[TELEMETRY_FIELD_LINE_TENSION]));
+  TEST_ASSERT_TRUE(isnan(received.values[TELEMETRY_FIELD_TRIM]));
+}
+
+static void test_telemetry_parser_resyncs_through_log_text() {
+  // Journal texte, trame, trame corrompue, magic isolé, trame
+  uint8_t stream[512];
+  size_t length = 0;
+  const char* log = "[1.000] INFO KT boot\r\nK";
+  memcpy(stream, log, strlen(log));
+  length += strlen(log);
+  TelemetryFrame first = makeTelemetryFrame(3, 1);
+  length += telemetryEncode(&first, stream + length, sizeof(stream) - length);
+  size_t corrupted = length;
+  TelemetryFrame second = makeTelemetryFrame(3, 2);
+  length += telemetryEncode(&second, stream + length, sizeof(stream) - length);
+  stream[corrupted + 30] ^= 0xFF;
+  stream[length++] = 'K';
+  stream[length++] = 'T';
+  TelemetryFrame third = makeTelemetryFrame(3, 3);
+  length += telemetryEncode(&third, stream + length, sizeof(stream) - length);
+
+  TelemetryParser parser;
+  telemetryParserInit(&parser);
+  TelemetryFrame frame;
+  uint32_t sequences[4];
+  int found = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (telemetryParserFeed(&parser, stream[i], &frame) && found < 4) {
+      sequences[found++] = frame.sequence;
+    }
+  }
+  TEST_ASSERT_EQUAL(2, found);
+  TEST_ASSERT_EQUAL_UINT32(1, sequences[0]);
+  TEST_ASSERT_EQUAL_UINT32(3, sequences[1]);
+  TEST_ASSERT_EQUAL_UINT32(2, parser.frames);
+  TEST_ASSERT_EQUAL_UINT32(1, parser.crcErrors);
+}
+
+static void test_command_frame_round_trip_and_validation() {
+  CommandFrame sent = {};
+  sent.unitId = 42;
+  sent.type = COMMAND_TYPE_WINCH;
+  sent.latePolicy = COMMAND_LATE_DROP;
+  sent.sequence = 9;
+  sent.executeAtMs = 0xFFFFFF00u;
+  sent.value = -1.25f;
+  uint8_t buffer[COMMAND_FRAME_SIZE];
+  TEST_ASSERT_EQUAL(COMMAND_FRAME_SIZE, commandEncode(&sent, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL('K', buffer[0]);
+  TEST_ASSERT_EQUAL('C', buffer[1]);
+
+  CommandFrame received;
+  TEST_ASSERT_TRUE(commandDecode(buffer, sizeof(buffer), &received));
+  TEST_ASSERT_EQUAL(42, received.unitId);
+  TEST_ASSERT_EQUAL(COMMAND_TYPE_WINCH, received.type);
+  TEST_ASSERT_EQUAL(COMMAND_LATE_DROP, received.latePolicy);
+  TEST_ASSERT_EQUAL_UINT32(9, received.sequence);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFF00u, received.executeAtMs);
+  TEST_ASSERT_EQUAL_FLOAT(-1.25f, received.value);
+
+  // Longueur inexacte, CRC faux, type inconnu (CRC recalculé)
+  TEST_ASSERT_FALSE(commandDecode(buffer, sizeof(buffer) - 1, &received));
+  buffer[12] ^= 0x01;
+  TEST_ASSERT_FALSE(commandDecode(buffer, sizeof(buffer), &received));
+  buffer[12] ^= 0x01;
+  buffer[3] = COMMAND_TYPE_COUNT;
+  uint16_t crc = telemetryCrc16(buffer, COMMAND_FRAME_SIZE - TELEMETRY_CRC_SIZE);
+  buffer[20] = crc & 0xFF;
+  buffer[21] = crc >> 8;
+  TEST_ASSERT_FALSE(commandDecode(buffer, sizeof(buffer), &received));
+  TEST_ASSERT_EQUAL(0, commandEncode(&sent, buffer, COMMAND_FRAME_SIZE - 1));
+}
+
+static void test_task_snapshot_frame_round_trip_and_validation() {
+  TaskSnapshot sent;
+  memset(&sent, 0, sizeof(sent));
+  sent.timestampMs = 123456;
+  sent.intervalMs = 2000;
+  sent.runTimeTotal = 2000000;
+  sent.taskCount = 2;
+  strcpy(sent.tasks[0].name, "Control");
+  sent.tasks[0].state = 2;
+  sent.tasks[0].priority = 1;
+  sent.tasks[0].core = -1;
+  sent.tasks[0].stackFreeBytes = 70000;
+  sent.tasks[0].runTime = 150000;
+  sent.tasks[0].cpuPermille = 75;
+  strcpy(sent.tasks[1].name, "IDLE1");
+  sent.tasks[1].core = 1;
+  sent.tasks[1].cpuPermille = 1000;
+
+  uint8_t buffer[TASK_SNAPSHOT_MAX_FRAME_SIZE];
+  size_t length = taskSnapshotEncode(&sent, buffer, sizeof(buffer));
+  TEST_ASSERT_EQUAL(TASK_SNAPSHOT_HEADER_SIZE + 2 * TASK_SNAPSHOT_ENTRY_SIZE + TELEMETRY_CRC_SIZE, length);
+  TEST_ASSERT_EQUAL('K', buffer[0]);
+  TEST_ASSERT_EQUAL('S', buffer[1]);
+
+  TaskSnapshot received;
+  TEST_ASSERT_TRUE(taskSnapshotDecode(buffer, length, &received));
+  TEST_ASSERT_EQUAL_UINT32(123456, received.timestampMs);
+  TEST_ASSERT_EQUAL_UINT32(2000, received.intervalMs);
+  TEST_ASSERT_EQUAL_UINT32(2000000, received.runTimeTotal);
+  TEST_ASSERT_EQUAL(2, received.taskCount);
+  TEST_ASSERT_EQUAL_STRING("Control", received.tasks[0].name);
+  TEST_ASSERT_EQUAL(-1, received.tasks[0].core);
+  TEST_ASSERT_EQUAL_UINT32(70000, received.tasks[0].stackFreeBytes);
+  TEST_ASSERT_EQUAL_UINT32(150000, received.tasks[0].runTime);
+  TEST_ASSERT_EQUAL(75, received.tasks[0].cpuPermille);
+  TEST_ASSERT_EQUAL_STRING("IDLE1", received.tasks[1].name);
+  TEST_ASSERT_EQUAL(1, received.tasks[1].core);
+  TEST_ASSERT_EQUAL(1000, received.tasks[1].cpuPermille);
+
+  // Longueur différente du nombre d'entrées, CRC faux, destination trop petite
+  TEST_ASSERT_FALSE(taskSnapshotDecode(buffer, length - 1, &received));
+  buffer[20] ^= 0x01;
+  TEST_ASSERT_FALSE(taskSnapshotDecode(buffer, length, &received));
+  TEST_ASSERT_EQUAL(0, taskSnapshotEncode(&sent, buffer, length - 1));
+  sent.taskCount = TASK_SNAPSHOT_MAX_TASKS + 1;
+  TEST_ASSERT_EQUAL(0, taskSnapshotEncode(&sent, buffer, sizeof(buffer)));
+}
+
+// === ARCHIVE EN COLONNES (STATION SOL) ===
+
+#ifdef NATIVE_BUILD
+static void test_column_store_range_query_and_resume() {
+  char root[] = "/tmp/kite_columns_XXXXXX";
+  TEST_ASSERT_NOT_NULL(mkdtemp(root));
+
+  // 1000 lignes à 10 ms d'intervalle (dont un saut de séquence), deux kites
+  static ColumnStore store;
+  TEST_ASSERT_TRUE(columnStoreOpen(&store, root));
+  for (uint32_t i = 0; i < 1000; i++) {
+    TelemetryFrame frame = makeTelemetryFrame(5, i < 500 ? i : i + 3);
+    TEST_ASSERT_TRUE(columnStoreAppend(&store, &frame, 100000 + i * 10));
+    frame.unitId = 6;
+    columnStoreAppend(&store, &frame, 100000 + i * 10);
+  }
+  ColumnUnitStats stats = columnStoreUnitStats(&store, 0);
+  TEST_ASSERT_EQUAL_UINT32(1000, (uint32_t)stats.rows);
+  TEST_ASSERT_EQUAL_UINT32(3, (uint32_t)stats.lost);
+  columnStoreClose(&store);
+
+  uint16_t units[4];
+  TEST_ASSERT_EQUAL(2, columnListUnits(root, units, 4));
+  TEST_ASSERT_EQUAL(5, units[0]);
+
+  ColumnReader reader;
+  TEST_ASSERT_TRUE(columnReaderOpen(&reader, root, 5));
+  TEST_ASSERT_EQUAL_UINT32(1000, (uint32_t)reader.rows);
+  uint64_t first, end;
+  TEST_ASSERT_TRUE(columnReaderFindRange(&reader, 103005, 105000, &first, &end));
+  TEST_ASSERT_EQUAL_UINT32(301, (uint32_t)first);
+  TEST_ASSERT_EQUAL_UINT32(500, (uint32_t)end);
+  float pitch[200];
+  TEST_ASSERT_EQUAL(199, columnReaderRead(&reader, columnFind("pitch"), first, end - first, pitch));
+  TEST_ASSERT_EQUAL_FLOAT(301.0f, pitch[0]);
+  TEST_ASSERT_TRUE(columnReaderFindRange(&reader, 0, 50, &first, &end));
+  TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)(end - first));
+  columnReaderClose(&reader);
+
+  // Écriture interrompue (colonne plus courte) puis reprise : colonnes réalignées,
+  // heures toujours non décroissantes malgré une horloge qui recule
+  char path[COLUMN_PATH_MAX];
+  snprintf(path, sizeof(path), "%s/unit_5/roll.col", root);
+  TEST_ASSERT_EQUAL(0, truncate(path, 990 * sizeof(float)));
+  TEST_ASSERT_TRUE(columnStoreOpen(&store, root));
+  TelemetryFrame frame = makeTelemetryFrame(5, 2000);
+  TEST_ASSERT_TRUE(columnStoreAppend(&store, &frame, 50000));
+  columnStoreClose(&store);
+
+  TEST_ASSERT_TRUE(columnReaderOpen(&reader, root, 5));
+  TEST_ASSERT_EQUAL_UINT32(991, (uint32_t)reader.rows);
+  int64_t lastTime;
+  TEST_ASSERT_EQUAL(1, columnReaderRead(&reader, COLUMN_TIME, 990, 1, &lastTime));
+  TEST_ASSERT_TRUE(lastTime == 100000 + 989 * 10);
+  TEST_ASSERT_TRUE(columnReaderFindRange(&reader, 109890, INT64_MAX, &first, &end));
+  TEST_ASSERT_EQUAL_UINT32(989, (uint32_t)first);
+  TEST_ASSERT_EQUAL_UINT32(991, (uint32_t)end);
+  columnReaderClose(&reader);
+
+  char command[COLUMN_PATH_MAX + 16];
+  snprintf(command, sizeof(command), "rm -rf %s", root);
+  system(command);
+}
+#endif
+
+void runCommunicationTests() {
+  RUN_TEST(test_pool_acquire_until_exhausted);
+  RUN_TEST(test_pool_rejects_double_and_foreign_release);
+  RUN_TEST(test_pool_reset);
+  RUN_TEST(test_dashboard_json_full);
+  RUN_TEST(test_dashboard_frames_publish_complete_updates);
+#ifdef NATIVE_BUILD
+  RUN_TEST(test_dashboard_concurrent_readers_see_whole_frames);
+#endif
+  RUN_TEST(test_dashboard_json_partial_has_no_trailing_comma);
+  RUN_TEST(test_telemetry_round_trip_and_crc);
+  RUN_TEST(test_telemetry_older_frame_leaves_new_fields_nan);
+  RUN_TEST(test_telemetry_parser_resyncs_through_log_text);
+  RUN_TEST(test_command_frame_round_trip_and_validation);
+  RUN_TEST(test_task_snapshot_frame_round_trip_and_validation);
+#ifdef NATIVE_BUILD
+  RUN_TEST(test_column_store_range_query_and_resume);
+#endif
+}
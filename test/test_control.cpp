@@ -0,0 +1,1033 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires du contrôle
+  -----------------------
+  
+  Contrôleur PID, transitions de mode de l'autopilote, prévision des rafales,
+  bilan énergétique des cycles de pompage, décollage et atterrissage profilés,
+  enveloppe de vol précompilée, vol en boucle fermée contre le simulateur de kite et machine à états.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include "control/pid.h"
+#include "control/autopilot.h"
+#include "control/gust_predictor.h"
+#include "control/energy.h"
+#include "control/launch_sequencer.h"
+#include "control/safety.h"
+#include "control/mission.h"
+#include "control/command_scheduler.h"
+#include "communication/protocols.h"
+#include "mission_compiler.h"
+#include "utils/state_machine.h"
+#include "closed_loop.h"
+#include "utils/fault_injection.h"
+#include "utils/health_monitor.h"
+#include "hardware/actuators/servo.h"
+
+// === PID ===
+
+static void test_pid_proportional_only() {
+  PIDParams pid;
+  pidInit(&pid, 2.0f, 0.0f, 0.0f, -100.0f, 100.0f, 10.0f);
+  pid.setpoint = 10.0f;
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 16.0f, pidCompute(&pid, 2.0f, 0.05f));
+}
+
+static void test_pid_output_is_clamped() {
+  PIDParams pid;
+  pidInit(&pid, 10.0f, 0.0f, 0.0f, -45.0f, 45.0f, 10.0f);
+  pid.setpoint = 100.0f;
+  TEST_ASSERT_EQUAL_FLOAT(45.0f, pidCompute(&pid, 0.0f, 0.05f));
+  pid.setpoint = -100.0f;
+  TEST_ASSERT_EQUAL_FLOAT(-45.0f, pidCompute(&pid, 0.0f, 0.05f));
+}
+
+static void test_pid_integral_removes_steady_error() {
+  PIDParams pid;
+  pidInit(&pid, 0.0f, 1.0f, 0.0f, -100.0f, 100.0f, 100.0f);
+  pid.setpoint = 1.0f;
+  float output = 0.0f;
+  for (int i = 0; i < 10; i++) {
+    output = pidCompute(&pid, 0.0f, 0.1f);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, output);
+}
+
+static void test_pid_integral_is_bounded() {
+  PIDParams pid;
+  pidInit(&pid, 0.0f, 1.0f, 0.0f, -100.0f, 100.0f, 2.0f);
+  pid.setpoint = 5.0f;
+  for (int i = 0; i < 100; i++) {
+    pidCompute(&pid, 0.0f, 0.1f);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 2.0f, pid.integral);
+}
+
+static void test_pid_anti_windup_when_saturated() {
+  PIDParams pid;
+  pidInit(&pid, 10.0f, 1.0f, 0.0f, -45.0f, 45.0f, 1000.0f);
+  pid.setpoint = 100.0f;
+  for (int i = 0; i < 50; i++) {
+    pidCompute(&pid, 0.0f, 0.1f);
+  }
+  // La sortie est saturée dès le premier pas : l'intégrale ne doit pas grossir
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, pid.integral);
+}
+
+static void test_pid_derivative_reacts_to_error_change() {
+  PIDParams pid;
+  pidInit(&pid, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, 10.0f);
+  pid.setpoint = 0.0f;
+  pidCompute(&pid, 0.0f, 0.1f);
+  // L'erreur passe de 0 à -1 en 0,1 s : dérivée -10
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, -10.0f, pidCompute(&pid, 1.0f, 0.1f));
+}
+
+static void test_pid_reset_clears_state() {
+  PIDParams pid;
+  pidInit(&pid, 1.0f, 1.0f, 1.0f, -100.0f, 100.0f, 10.0f);
+  pid.setpoint = 3.0f;
+  pidCompute(&pid, 0.0f, 0.1f);
+  pidReset(&pid);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, pid.integral);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, pid.lastError);
+}
+
+static void test_pid_derivative_filter_smooths_steps() {
+  PIDParams pid;
+  pidInit(&pid, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, 10.0f);
+  pidSetDerivativeFilter(&pid, 0.25f);
+  pidCompute(&pid, 0.0f, 0.1f);
+  // Dérivée brute -10, seul un quart passe au premier pas
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, -2.5f, pidCompute(&pid, 1.0f, 0.1f));
+  // Mesure stable : la dérivée filtrée décroît sans changer de signe
+  float next = pidCompute(&pid, 1.0f, 0.1f);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, -1.875f, next);
+}
+
+// === AUTOPILOTE ===
+
+static void test_autopilot_starts_off() {
+  TEST_ASSERT_TRUE(autopilotInit());
+  setAutopilotMode(AUTOPILOT_OFF);
+  TEST_ASSERT_EQUAL(AUTOPILOT_OFF, getAutopilotMode());
+  TEST_ASSERT_FALSE(isAutopilotActive());
+}
+
+static void test_autopilot_enters_and_leaves_figure8() {
+  autopilotInit();
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_FIGURE_8));
+  TEST_ASSERT_EQUAL(AUTOPILOT_FIGURE_8, getAutopilotMode());
+  TEST_ASSERT_TRUE(isAutopilotActive());
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_OFF));
+  TEST_ASSERT_FALSE(isAutopilotActive());
+}
+
+static void test_autopilot_rejects_invalid_mode() {
+  autopilotInit();
+  setAutopilotMode(AUTOPILOT_HOVER);
+  TEST_ASSERT_FALSE(setAutopilotMode((AutopilotMode)42));
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, getAutopilotMode());
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+static void test_autopilot_emergency_stop() {
+  autopilotInit();
+  setAutopilotMode(AUTOPILOT_FIGURE_8);
+  autopilotEmergencyStop();
+  TEST_ASSERT_EQUAL(AUTOPILOT_EMERGENCY, getAutopilotMode());
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+static void test_autopilot_parameters_validation() {
+  autopilotInit();
+  AutopilotParameters params = getAutopilotParameters();
+  AutopilotParameters invalid = params;
+  invalid.figure8Width = 5;
+  TEST_ASSERT_FALSE(setAutopilotParameters(invalid));
+  uint32_t version = getAutopilotParametersVersion();
+  params.turnSpeed = 8;
+  TEST_ASSERT_TRUE(setAutopilotParameters(params));
+  TEST_ASSERT_EQUAL_UINT8(8, getAutopilotParameters().turnSpeed);
+  TEST_ASSERT_EQUAL_UINT32(version + 1, getAutopilotParametersVersion());
+}
+
+static void test_autopilot_update_is_throttled() {
+  autopilotInit();
+  IMUData imu = {};
+  nativeSetMillis(10000);
+  autopilotUpdate(imu);
+  uint32_t flightTime = getAutopilotState().flightTimeSeconds;
+  setAutopilotMode(AUTOPILOT_HOVER);
+  nativeAdvanceMillis(AUTOPILOT_UPDATE_INTERVAL - 1);
+  autopilotUpdate(imu);
+  TEST_ASSERT_EQUAL_UINT32(flightTime, getAutopilotState().flightTimeSeconds);
+  nativeAdvanceMillis(2000);
+  autopilotUpdate(imu);
+  TEST_ASSERT_EQUAL_UINT32(2, getAutopilotState().flightTimeSeconds);
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+static void test_autopilot_confidence_drops_with_rotation() {
+  autopilotInit();
+  IMUData imu = {};
+  imu.gyro[0] = 300.0f;
+  uint8_t before = getAutopilotConfidence();
+  nativeSetMillis(20000);
+  autopilotUpdate(imu);
+  TEST_ASSERT_LESS_THAN_UINT8(before, getAutopilotConfidence());
+}
+
+static void test_autopilot_checks_window_on_fresh_position() {
+  autopilotInit();
+  IMUData imu = {};
+  imu.dataValid = true;
+  imu.orientation[0] = -20.0f;  // Kite posé, sous la fenêtre
+  nativeSetMillis(30000);
+  autopilotUpdate(imu);
+  // Depuis OFF, la position posée ne bloque pas l'activation
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_HOVER));
+  imu.orientation[0] = 60.0f;
+  nativeAdvanceMillis(AUTOPILOT_UPDATE_INTERVAL);
+  autopilotUpdate(imu);
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, getAutopilotMode());
+  // Sortie de la fenêtre : urgence dès le cycle qui la mesure
+  imu.orientation[0] = -20.0f;
+  nativeAdvanceMillis(AUTOPILOT_UPDATE_INTERVAL);
+  autopilotUpdate(imu);
+  TEST_ASSERT_EQUAL(AUTOPILOT_EMERGENCY, getAutopilotMode());
+  // Laisse une position dans la fenêtre aux tests suivants
+  imu.orientation[0] = 60.0f;
+  nativeAdvanceMillis(AUTOPILOT_UPDATE_INTERVAL);
+  autopilotUpdate(imu);
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+// === PRÉVISION DES RAFALES ===
+
+static uint32_t gustNoiseState = 1;
+
+// Bruit uniforme reproductible dans [-0.5, 0.5]
+static float gustNoise() {
+  gustNoiseState = gustNoiseState * 1664525u + 1013904223u;
+  return (gustNoiseState >> 8) / 16777216.0f - 0.5f;
+}
+
+/**
+ * Fournit une valeur par période du modèle, lue à chaque cycle de 50 ms
+ */
+static void feedGustPeriod(float speed, uint32_t* nowMs) {
+  for (int i = 0; i < GUST_SAMPLE_INTERVAL_MS / AUTOPILOT_UPDATE_INTERVAL; i++) {
+    *nowMs += AUTOPILOT_UPDATE_INTERVAL;
+    gustPredictorUpdate(speed, *nowMs);
+  }
+}
+
+static void test_gust_predictor_forecasts_periodic_gusts() {
+  // Rafales de 2 m/s toutes les 8 s sur un vent de 8 m/s
+  gustPredictorInit();
+  gustNoiseState = 1;
+  uint32_t nowMs = 0;
+  for (int k = 0; k < 400; k++) {
+    float t = k * GUST_SAMPLE_INTERVAL_MS / 1000.0f;
+    feedGustPeriod(8.0f + 2.0f * sinf(2.0f * (float)M_PI * t / 8.0f) + 0.1f * gustNoise(), &nowMs);
+  }
+  GustPrediction prediction;
+  gustPredictorGetPrediction(&prediction);
+  TEST_ASSERT_TRUE(prediction.ready);
+  TEST_ASSERT_FLOAT_WITHIN(0.3f, 8.0f, prediction.meanSpeed);
+  // Deux secondes d'avance : l'erreur est bien inférieure à celle du vent constant
+  TEST_ASSERT_LESS_THAN_FLOAT(0.3f * prediction.persistenceRms, prediction.predictionRms);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.8f, prediction.coverage);
+}
+
+static void test_gust_predictor_band_covers_turbulence() {
+  // Turbulence autorégressive (corrélation 0,9 par période) : peu prévisible,
+  // la bande doit contenir la mesure à l'horizon dans la proportion attendue
+  gustPredictorInit();
+  gustNoiseState = 7;
+  uint32_t nowMs = 0;
+  float turbulence = 0.0f;
+  for (int k = 0; k < 2000; k++) {
+    turbulence = 0.9f * turbulence + gustNoise();
+    feedGustPeriod(8.0f + turbulence, &nowMs);
+  }
+  GustPrediction prediction;
+  gustPredictorGetPrediction(&prediction);
+  TEST_ASSERT_FLOAT_WITHIN(0.15f, 0.9f, prediction.coefficients[0]);
+  TEST_ASSERT_LESS_THAN_FLOAT(prediction.persistenceRms, prediction.predictionRms);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.88f, prediction.coverage);
+  TEST_ASSERT_LESS_THAN_FLOAT(prediction.upperBound, prediction.predictedSpeed);
+  TEST_ASSERT_GREATER_THAN_FLOAT(prediction.lowerBound, prediction.predictedSpeed);
+}
+
+static void test_gust_predictor_warmup_and_clock_reset() {
+  gustPredictorInit();
+  // La première lecture ouvre la première période
+  uint32_t nowMs = 100000;
+  gustPredictorUpdate(6.0f, nowMs);
+  GustPrediction prediction;
+  for (int k = 0; k < GUST_WARMUP_SAMPLES - 1; k++) {
+    feedGustPeriod(6.0f, &nowMs);
+  }
+  gustPredictorGetPrediction(&prediction);
+  TEST_ASSERT_FALSE(prediction.ready);
+  feedGustPeriod(6.0f, &nowMs);
+  gustPredictorGetPrediction(&prediction);
+  TEST_ASSERT_TRUE(prediction.ready);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 6.0f, prediction.predictedSpeed);
+
+  // Horloge revenue en arrière : l'historique est oublié
+  nowMs = 0;
+  gustPredictorUpdate(9.0f, nowMs);
+  feedGustPeriod(9.0f, &nowMs);
+  gustPredictorGetPrediction(&prediction);
+  TEST_ASSERT_FALSE(prediction.ready);
+  TEST_ASSERT_EQUAL_UINT32(1, prediction.samples);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 9.0f, prediction.meanSpeed);
+}
+
+// === BILAN ÉNERGÉTIQUE ===
+
+/**
+ * Vitesse du treuil d'un cycle de pompage de 15 s, linéaire par morceaux
+ * (puissance continue : le trapèze est exact aux échantillons)
+ */
+static float pumpingReelSpeed(float t) {
+  if (t < 1.0f) return 2.0f * t;
+  if (t < 9.0f) return 2.0f;
+  if (t < 10.0f) return 2.0f * (10.0f - t);
+  if (t < 11.0f) return -(t - 10.0f);
+  if (t < 14.0f) return -1.0f;
+  return -(15.0f - t);
+}
+
+static void test_energy_pumping_cycles_and_efficiency() {
+  // Traction à 1000 N (18 kJ), retour à 250 N (1 kJ), générateur à 80 %
+  energyInit();
+  int completed = 0;
+  for (uint32_t ms = 0; ms <= 62000; ms += 100) {
+    float speed = pumpingReelSpeed(fmodf(ms / 1000.0f, 15.0f));
+    float tension = speed >= 0.0f ? 1000.0f : 250.0f;
+    float power = tension * speed;
+    if (energyAddSample(ms, tension, speed, power > 0.0f ? 0.8f * power : power)) completed++;
+  }
+  EnergyStats stats;
+  energyGetStats(&stats);
+  TEST_ASSERT_EQUAL(4, completed);
+  TEST_ASSERT_EQUAL_UINT32(4, stats.cycleCount);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.gaps);
+  TEST_ASSERT_EQUAL(ENERGY_PHASE_REEL_OUT, stats.phase);
+  TEST_ASSERT_TRUE(stats.cycleActive);
+
+  // Le cycle commence au premier échantillon au-delà du seuil (0,2 s) et
+  // la traction s'arrête au premier échantillon de retour (10,3 s)
+  const EnergyCycle& last = stats.last;
+  TEST_ASSERT_EQUAL_UINT32(45200, last.startMs);
+  TEST_ASSERT_EQUAL_UINT32(15000, last.durationMs);
+  TEST_ASSERT_EQUAL_UINT32(10100, last.reelOutMs);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 18000.0f, last.reelOutJ);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 1000.0f, last.reelInJ);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 17000.0f, last.netJ);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 17.0f / 18.0f, last.efficiency);
+  TEST_ASSERT_TRUE(last.electricalMeasured);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 13400.0f, last.electricalJ);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 13400.0f / 17000.0f, last.electricalEfficiency);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 17000.0f / 15.0f, last.averagePowerW);
+
+  // Cycles identiques : fenêtre sans dispersion
+  TEST_ASSERT_EQUAL_UINT8(4, stats.windowCycles);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 17000.0f, stats.meanNetJ);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 0.0f, stats.stdNetJ);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 15000.0f, stats.meanDurationMs);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, last.efficiency, stats.minEfficiency);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, last.efficiency, stats.maxEfficiency);
+
+  // Totaux : 4 cycles puis 2 s de la traction suivante
+  TEST_ASSERT_FLOAT_WITHIN(5.0f, 4 * 17000.0f + 3000.0f, (float)stats.mechanicalJ);
+  TEST_ASSERT_FLOAT_WITHIN(5.0f, 4 * 13400.0f + 2400.0f, (float)stats.electricalJ);
+  TEST_ASSERT_FLOAT_WITHIN(5.0f, 4 * 13400.0f + 2400.0f, energyTakeProduced());
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, energyTakeProduced());
+}
+
+static void test_energy_carry_gaps_and_abandoned_cycle() {
+  energyInit();
+  uint32_t ms = 0;
+  // Retour de 2 s à -1000 W : rien de produit, le solde négatif est conservé
+  for (; ms < 2000; ms += 100) energyAddSample(ms, 500.0f, -2.0f, NAN);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, energyTakeProduced());
+  // Traction de 3 s à +1000 W ; l'intervalle qui change de signe s'annule
+  for (; ms < 5000; ms += 100) energyAddSample(ms, 500.0f, 2.0f, NAN);
+  EnergyStats stats;
+  energyGetStats(&stats);
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 1000.0f, (float)stats.mechanicalJ);
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 1000.0f, energyTakeProduced());
+  TEST_ASSERT_FALSE(stats.current.electricalMeasured);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, stats.electricalPowerW);
+  TEST_ASSERT_TRUE(stats.cycleActive);
+  TEST_ASSERT_EQUAL_UINT32(2000, stats.current.startMs);
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 2900.0f, stats.current.reelOutJ);
+
+  // Trou de 2 s puis horloge revenue en arrière : non intégrés
+  energyAddSample(ms + 2000, 500.0f, 2.0f, NAN);
+  energyAddSample(1000, 500.0f, 2.0f, NAN);
+  energyGetStats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.gaps);
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 1000.0f, (float)stats.mechanicalJ);
+
+  // Traction sans fin (treuil bloqué en sortie) : le cycle est abandonné
+  for (ms = 1100; ms <= 2000 + ENERGY_MAX_CYCLE_MS + 100; ms += 100) {
+    energyAddSample(ms, 500.0f, 2.0f, NAN);
+  }
+  energyGetStats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.abandonedCycles);
+  TEST_ASSERT_FALSE(stats.cycleActive);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.cycleCount);
+}
+
+// === DÉCOLLAGE ET ATTERRISSAGE ===
+
+static float launchWinchSpeed = 0.0f;
+static uint32_t launchWinchCalls = 0;
+
+static bool recordLaunchWinch(float speed) {
+  launchWinchSpeed = speed;
+  launchWinchCalls++;
+  return true;
+}
+
+static void test_launch_profile_respects_limits() {
+  // 50° et 20 m : le treuil impose la durée (20 m à 1,5 m/s au plus)
+  launchSequenceSetWinchHandler(recordLaunchWinch);
+  TEST_ASSERT_TRUE(launchSequenceStart(LAUNCH_TAKEOFF, 1000, 10.0f, 5000.0f, 60.0f, 7000.0f));
+  LaunchSequenceState state;
+  launchSequenceGetState(&state);
+  TEST_ASSERT_EQUAL(LAUNCH_RUNNING, state.status);
+  TEST_ASSERT_UINT32_WITHIN(200, 19050, state.durationMs);
+
+  LaunchSetpoint setpoint = {10.0f, 5000.0f, 0.0f};
+  float elevation = 10.0f, length = 5000.0f, maxElevationRate = 0.0f, maxReelSpeed = 0.0f;
+  bool monotonic = true;
+  LaunchStatus status = LAUNCH_RUNNING;
+  uint32_t ms = 1000;
+  while (status == LAUNCH_RUNNING && ms < 1000 + state.durationMs + 1000) {
+    ms += 10;
+    // Suivi parfait : la mesure est la consigne du cycle précédent
+    float previousElevation = setpoint.elevation, previousLength = setpoint.lineLengthCm;
+    status = launchSequenceUpdate(ms, elevation, length, &setpoint);
+    float rate = (setpoint.elevation - previousElevation) / 0.01f;
+    if (rate > maxElevationRate) maxElevationRate = rate;
+    if (setpoint.reelSpeed > maxReelSpeed) maxReelSpeed = setpoint.reelSpeed;
+    if (setpoint.elevation < previousElevation || setpoint.lineLengthCm < previousLength) monotonic = false;
+    elevation = setpoint.elevation;
+    length = setpoint.lineLengthCm;
+  }
+  TEST_ASSERT_EQUAL(LAUNCH_COMPLETE, status);
+  TEST_ASSERT_TRUE(monotonic);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 60.0f, elevation);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 7000.0f, length);
+  TEST_ASSERT_LESS_THAN_FLOAT(LAUNCH_ELEVATION_RATE_MAX + 0.01f, maxElevationRate);
+  TEST_ASSERT_FLOAT_WITHIN(0.03f, LAUNCH_REEL_SPEED_MAX, maxReelSpeed);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, launchWinchSpeed);
+  launchSequenceSetWinchHandler(nullptr);
+}
+
+static void test_launch_deviation_aborts_sequence() {
+  launchSequenceSetWinchHandler(recordLaunchWinch);
+  LaunchSetpoint setpoint;
+
+  // Le kite reste au sol : abandon LAUNCH_DEVIATION_MS après le franchissement de la tolérance
+  launchSequenceStart(LAUNCH_TAKEOFF, 0, 10.0f, 5000.0f, 60.0f, 5000.0f);
+  uint32_t exceededMs = 0;
+  LaunchStatus status = LAUNCH_RUNNING;
+  LaunchSequenceState state;
+  for (uint32_t ms = 50; status == LAUNCH_RUNNING && ms < 20000; ms += 50) {
+    status = launchSequenceUpdate(ms, 10.0f, 5000.0f, &setpoint);
+    launchSequenceGetState(&state);
+    if (exceededMs == 0 && fabsf(state.elevationError) > LAUNCH_MAX_ELEVATION_ERROR) exceededMs = ms;
+    if (status != LAUNCH_RUNNING) {
+      TEST_ASSERT_EQUAL_UINT32(exceededMs + LAUNCH_DEVIATION_MS, ms);
+    }
+  }
+  TEST_ASSERT_EQUAL(LAUNCH_ABORTED, status);
+  TEST_ASSERT_EQUAL(LAUNCH_ABORT_ELEVATION, state.abortReason);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, launchWinchSpeed);
+  // Plus de consigne ni de commande du treuil après l'abandon
+  uint32_t calls = launchWinchCalls;
+  TEST_ASSERT_EQUAL(LAUNCH_ABORTED, launchSequenceUpdate(30000, 10.0f, 5000.0f, &setpoint));
+  TEST_ASSERT_EQUAL_UINT32(calls, launchWinchCalls);
+
+  // Treuil bloqué pendant l'atterrissage ; un écart bref est toléré
+  launchSequenceStart(LAUNCH_LANDING, 0, 60.0f, 8000.0f, 60.0f, 6000.0f);
+  status = LAUNCH_RUNNING;
+  uint32_t ms = 0;
+  while (status == LAUNCH_RUNNING && ms < 30000) {
+    ms += 50;
+    status = launchSequenceUpdate(ms, 60.0f, ms < 3000 ? setpoint.lineLengthCm : 8000.0f, &setpoint);
+  }
+  launchSequenceGetState(&state);
+  TEST_ASSERT_EQUAL(LAUNCH_ABORTED, status);
+  TEST_ASSERT_EQUAL(LAUNCH_ABORT_LINE_LENGTH, state.abortReason);
+  TEST_ASSERT_GREATER_THAN_FLOAT(LAUNCH_MAX_LENGTH_ERROR_CM, state.lengthErrorCm);
+
+  // Changement de mode : séquence arrêtée, treuil arrêté
+  launchSequenceStart(LAUNCH_TAKEOFF, 0, 10.0f, 5000.0f, 20.0f, 6000.0f);
+  launchSequenceUpdate(500, 10.0f, 5000.0f, &setpoint);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, launchWinchSpeed);
+  launchSequenceCancel();
+  launchSequenceGetState(&state);
+  TEST_ASSERT_EQUAL(LAUNCH_IDLE, state.status);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, launchWinchSpeed);
+  launchSequenceSetWinchHandler(nullptr);
+}
+
+// === ENVELOPPE DE VOL ===
+
+// Fenêtre rectangulaire avec une zone interdite carrée à droite du centre
+static const SafetyVertex TEST_WINDOW[] = {{-60.0f, 10.0f}, {60.0f, 10.0f}, {60.0f, 70.0f}, {-60.0f, 70.0f}};
+static const SafetyVertex TEST_KEEP_OUT[] = {{10.0f, 30.0f}, {30.0f, 30.0f}, {30.0f, 50.0f}, {10.0f, 50.0f}};
+static const SafetyPolygon TEST_ENVELOPE[] = {{TEST_WINDOW, 4, false}, {TEST_KEEP_OUT, 4, true}};
+
+static void test_safety_envelope_distance_and_direction() {
+  TEST_ASSERT_TRUE(safetyEnvelopeCompile(TEST_ENVELOPE, 2));
+  SafetyLimits limits = {1000.0f, 8000.0f, 50.0f};
+  SafetyCheck check;
+
+  // Entre le bord gauche et la zone interdite : 10° de chaque côté
+  safetyEnvelopeCheck(0.0f, 40.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_TRUE(check.inside);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 10.0f, check.boundaryDistance);
+
+  // Près du bord gauche : distance exacte à l'interpolation près, retour vers la droite
+  safetyEnvelopeCheck(-55.3f, 41.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_OK, check.violation);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 4.7f, check.boundaryDistance);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.95f, check.inwardAzimuth);
+
+  // Sous la fenêtre : distance négative, retour vers le haut
+  safetyEnvelopeCheck(-20.0f, 6.5f, 5000.0f, limits, &check);
+  TEST_ASSERT_FALSE(check.inside);
+  TEST_ASSERT_EQUAL(SAFETY_OUTSIDE_WINDOW, check.violation);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, -3.5f, check.boundaryDistance);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.95f, check.inwardElevation);
+
+  // Dans la zone interdite : le retour s'éloigne du centre du carré
+  safetyEnvelopeCheck(27.0f, 41.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_OUTSIDE_WINDOW, check.violation);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, -3.0f, check.boundaryDistance);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.95f, check.inwardAzimuth);
+
+  // Hors de la grille : valeur du bord le plus proche
+  safetyEnvelopeCheck(120.0f, 40.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_OUTSIDE_WINDOW, check.violation);
+
+  // Longueur et altitude
+  safetyEnvelopeCheck(-20.0f, 40.0f, 500.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_LINE_TOO_SHORT, check.violation);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -500.0f, check.lineMarginCm);
+  safetyEnvelopeCheck(-20.0f, 40.0f, 9000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_LINE_TOO_LONG, check.violation);
+  safetyEnvelopeCheck(-20.0f, 40.0f, 7000.0f, limits, &check);
+  TEST_ASSERT_TRUE(check.inside);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 50.0f - 70.0f * sinf(40.0f * 0.017453292f), check.altitudeMargin);
+  safetyEnvelopeCheck(-20.0f, 61.0f, 7000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_ALTITUDE, check.violation);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 50.0f - 70.0f * sinf(61.0f * 0.017453292f), check.altitudeMargin);
+
+  TEST_ASSERT_TRUE(safetyEnvelopeInit());
+}
+
+static void test_safety_envelope_rejects_invalid_polygons() {
+  TEST_ASSERT_TRUE(safetyEnvelopeCompile(TEST_ENVELOPE, 2));
+  SafetyPolygon segment[] = {{TEST_WINDOW, 2, false}};
+  SafetyPolygon keepOutOnly[] = {{TEST_KEEP_OUT, 4, true}};
+  SafetyPolygon missing[] = {{nullptr, 4, false}};
+  TEST_ASSERT_FALSE(safetyEnvelopeCompile(segment, 1));
+  TEST_ASSERT_FALSE(safetyEnvelopeCompile(keepOutOnly, 1));
+  TEST_ASSERT_FALSE(safetyEnvelopeCompile(missing, 1));
+
+  // Grille précédente conservée : la zone interdite est toujours là
+  SafetyLimits limits = {0.0f, 15000.0f, 100.0f};
+  SafetyCheck check;
+  safetyEnvelopeCheck(20.0f, 40.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_EQUAL(SAFETY_OUTSIDE_WINDOW, check.violation);
+
+  // Fenêtre par défaut : zénith permis, sol et bords bas interdits
+  TEST_ASSERT_TRUE(safetyEnvelopeInit());
+  safetyEnvelopeCheck(0.0f, 90.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_GREATER_THAN_FLOAT(SAFETY_SOFT_MARGIN_DEG, check.boundaryDistance);
+  safetyEnvelopeCheck(0.0f, 3.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_FALSE(check.inside);
+  safetyEnvelopeCheck(85.0f, 20.0f, 5000.0f, limits, &check);
+  TEST_ASSERT_FALSE(check.inside);
+}
+
+// === PLANS DE VOL ===
+
+static int compilePlan(const char* source, uint8_t* code) {
+  MissionCompileError error;
+  return missionCompile(source, code, MISSION_MAX_PLAN_SIZE, &error);
+}
+
+static void test_mission_rejects_invalid_plans() {
+  uint8_t code[MISSION_MAX_PLAN_SIZE];
+  MissionCompileError error;
+  TEST_ASSERT_EQUAL(-1, missionCompile("mode hover\nwait until elevation >\n", code, sizeof(code), &error));
+  TEST_ASSERT_EQUAL(2, error.line);
+  TEST_ASSERT_EQUAL(-1, missionCompile("repeat 2\n  mark 1\n", code, sizeof(code), &error));
+
+  missionInit();
+  int size = compilePlan("mode hover\nmark 3\n", code);
+  TEST_ASSERT_GREATER_THAN(0, size);
+  TEST_ASSERT_TRUE(missionLoad(code, size));
+  code[MISSION_HEADER_SIZE + 1] ^= 0x01;
+  TEST_ASSERT_FALSE(missionLoad(code, size));
+
+  // CRC correct mais boucle non ouverte : refusé par la vérification du code
+  uint8_t forged[] = {0x4B, 0x4D, 0x53, 0x4E, MISSION_FORMAT_VERSION, 0, 2, 0,
+                      MISSION_OP_END, MISSION_OP_HALT, 0, 0};
+  uint16_t crc = telemetryCrc16(forged, MISSION_HEADER_SIZE + 2);
+  forged[10] = crc & 0xFF;
+  forged[11] = crc >> 8;
+  TEST_ASSERT_FALSE(missionLoad(forged, sizeof(forged)));
+  forged[MISSION_HEADER_SIZE] = MISSION_OP_MARK;
+  forged[MISSION_HEADER_SIZE + 1] = 0;
+  crc = telemetryCrc16(forged, MISSION_HEADER_SIZE + 2);
+  forged[10] = crc & 0xFF;
+  forged[11] = crc >> 8;
+  // MARK sans HALT final : l'exécution sortirait du plan
+  TEST_ASSERT_FALSE(missionLoad(forged, sizeof(forged)));
+}
+
+static void test_mission_instruction_budget_per_tick() {
+  autopilotInit();
+  missionInit();
+  uint8_t code[MISSION_MAX_PLAN_SIZE];
+  int size = compilePlan("repeat 1000\n  mark 1\nend\n", code);
+  TEST_ASSERT_TRUE(missionLoad(code, size));
+  TEST_ASSERT_TRUE(missionStart(0));
+
+  MissionStatus status;
+  int steps = 0;
+  uint32_t previous = 0;
+  while (missionStep(steps * 10) == MISSION_RUNNING && steps < 1000) {
+    missionGetStatus(&status);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(MISSION_MAX_INSTRUCTIONS_PER_TICK, status.instructions - previous);
+    previous = status.instructions;
+    steps++;
+  }
+  missionGetStatus(&status);
+  TEST_ASSERT_EQUAL(MISSION_COMPLETED, status.state);
+  // REPEAT, 1000 x (MARK, END), HALT
+  TEST_ASSERT_EQUAL_UINT32(2002, status.instructions);
+  TEST_ASSERT_GREATER_OR_EQUAL(2002 / MISSION_MAX_INSTRUCTIONS_PER_TICK, steps);
+
+  // Interruption demandée par une autre tâche : appliquée au cycle suivant
+  size = compilePlan("wait 10\n", code);
+  TEST_ASSERT_TRUE(missionLoad(code, size));
+  TEST_ASSERT_TRUE(missionStart(0));
+  TEST_ASSERT_EQUAL(MISSION_RUNNING, missionStep(100));
+  missionAbort();
+  TEST_ASSERT_EQUAL(MISSION_ABORTED, missionStep(200));
+}
+
+static void test_closed_loop_mission_completes_and_guard_aborts() {
+  uint8_t code[MISSION_MAX_PLAN_SIZE];
+  int size = compilePlan("mode hover\n"
+                         "wait until elevation > 60 timeout 30\n"
+                         "mark 7\n"
+                         "wait 2\n", code);
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.duration = 20.0f;
+  config.mission = code;
+  config.missionSize = size;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  MissionStatus status;
+  missionGetStatus(&status);
+  TEST_ASSERT_EQUAL(MISSION_COMPLETED, result.missionState);
+  TEST_ASSERT_EQUAL_UINT8(7, status.lastMark);
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, result.finalMode);
+
+  // Garde franchie en tête : le vent dépasse aussitôt le seuil, repli en stationnaire
+  size = compilePlan("abort if wind > 1 then hover\n"
+                     "mode figure8\n"
+                     "wait 15\n", code);
+  config.missionSize = size;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_EQUAL(MISSION_ABORTED, result.missionState);
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, result.finalMode);
+  TEST_ASSERT_EQUAL(0, result.figure8Cycles);
+}
+
+// === COMMANDES DATÉES ===
+
+static CommandFrame makeCommand(uint8_t type, uint8_t target, float value, uint32_t atMs, uint8_t latePolicy) {
+  CommandFrame command = {};
+  command.type = type;
+  command.target = target;
+  command.value = value;
+  command.executeAtMs = atMs;
+  command.latePolicy = latePolicy;
+  return command;
+}
+
+static void test_command_scheduler_orders_by_time_across_wrap() {
+  autopilotInit();
+  commandSchedulerInit(20);
+  // Horloge juste avant son passage à zéro
+  const uint32_t t0 = 0xFFFFFFF0u;
+  CommandFrame later = makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_HOVER, 0, t0 + 100, COMMAND_LATE_EXECUTE);
+  CommandFrame first = makeCommand(COMMAND_TYPE_PARAMETER, AUTOPILOT_PARAM_TURN_SPEED, 4, t0 + 40, COMMAND_LATE_EXECUTE);
+  CommandFrame second = makeCommand(COMMAND_TYPE_PARAMETER, AUTOPILOT_PARAM_TURN_SPEED, 7, t0 + 40, COMMAND_LATE_EXECUTE);
+  CommandFrame mode = makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_FIGURE_8, 0, t0 + 40, COMMAND_LATE_EXECUTE);
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&later, COMMAND_SOURCE_LOCAL, t0, nullptr));
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&first, COMMAND_SOURCE_LOCAL, t0, nullptr));
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&second, COMMAND_SOURCE_LOCAL, t0, nullptr));
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&mode, COMMAND_SOURCE_LOCAL, t0, nullptr));
+
+  TEST_ASSERT_EQUAL(0, commandSchedulerService(t0 + 39));
+  // Même instant : même cycle, ordre de réception (la vitesse 7 l'emporte)
+  TEST_ASSERT_EQUAL(3, commandSchedulerService(t0 + 40));
+  TEST_ASSERT_EQUAL(7, getAutopilotParameters().turnSpeed);
+  TEST_ASSERT_EQUAL(AUTOPILOT_FIGURE_8, getAutopilotMode());
+  TEST_ASSERT_EQUAL(0, commandSchedulerService(t0 + 99));
+  TEST_ASSERT_EQUAL(1, commandSchedulerService(t0 + 100));
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, getAutopilotMode());
+
+  CommandSchedulerStats stats = commandSchedulerGetStats();
+  TEST_ASSERT_EQUAL_UINT32(4, stats.executed);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.late);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.maxLatenessMs);
+  TEST_ASSERT_EQUAL(0, stats.pending);
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+static void test_command_scheduler_late_policies_and_rejections() {
+  autopilotInit();
+  commandSchedulerInit(20);
+  commandSchedulerSetWinchHandler(nullptr);
+  CommandFrame drop = makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_HOVER, 0, 1000, COMMAND_LATE_DROP);
+  CommandFrame run = makeCommand(COMMAND_TYPE_PARAMETER, AUTOPILOT_PARAM_TURN_SPEED, 6, 1000, COMMAND_LATE_EXECUTE);
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&drop, COMMAND_SOURCE_REST, 900, nullptr));
+  TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&run, COMMAND_SOURCE_REST, 900, nullptr));
+  // Cycle manqué : écart d'une période entière
+  TEST_ASSERT_EQUAL(1, commandSchedulerService(1020));
+  TEST_ASSERT_EQUAL(AUTOPILOT_OFF, getAutopilotMode());
+  TEST_ASSERT_EQUAL(6, getAutopilotParameters().turnSpeed);
+  CommandSchedulerStats stats = commandSchedulerGetStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.late);
+  TEST_ASSERT_EQUAL_UINT32(20, stats.maxLatenessMs);
+
+  // Refus à la soumission
+  TEST_ASSERT_EQUAL(COMMAND_REJECTED_LATE, commandSchedulerSubmit(&drop, COMMAND_SOURCE_REST, 1020, nullptr));
+  drop.executeAtMs = 1000 + COMMAND_MAX_HORIZON_MS + 1;
+  TEST_ASSERT_EQUAL(COMMAND_REJECTED_HORIZON, commandSchedulerSubmit(&drop, COMMAND_SOURCE_REST, 1000, nullptr));
+  CommandFrame invalid = makeCommand(COMMAND_TYPE_PARAMETER, AUTOPILOT_PARAM_COUNT, 1, 1100, COMMAND_LATE_DROP);
+  TEST_ASSERT_EQUAL(COMMAND_REJECTED_INVALID, commandSchedulerSubmit(&invalid, COMMAND_SOURCE_REST, 1000, nullptr));
+  CommandFrame winch = makeCommand(COMMAND_TYPE_WINCH, 0, 1.0f, 1100, COMMAND_LATE_DROP);
+  TEST_ASSERT_EQUAL(COMMAND_REJECTED_UNSUPPORTED, commandSchedulerSubmit(&winch, COMMAND_SOURCE_ESPNOW, 1000, nullptr));
+
+  // File pleine, puis retrait
+  uint32_t id = 0;
+  for (int i = 0; i < COMMAND_SCHEDULER_CAPACITY; i++) {
+    CommandFrame command = makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_HOVER, 0, 5000 + i, COMMAND_LATE_DROP);
+    TEST_ASSERT_EQUAL(COMMAND_QUEUED, commandSchedulerSubmit(&command, COMMAND_SOURCE_LOCAL, 1000, i == 0 ? &id : nullptr));
+  }
+  TEST_ASSERT_EQUAL(COMMAND_REJECTED_FULL, commandSchedulerSubmit(&run, COMMAND_SOURCE_LOCAL, 1000, nullptr));
+  TEST_ASSERT_TRUE(commandSchedulerCancel(id));
+  TEST_ASSERT_FALSE(commandSchedulerCancel(id));
+  stats = commandSchedulerGetStats();
+  TEST_ASSERT_EQUAL(COMMAND_SCHEDULER_CAPACITY - 1, stats.pending);
+  TEST_ASSERT_EQUAL_UINT32(5001, stats.nextExecuteAtMs);
+  TEST_ASSERT_EQUAL_UINT32(5, stats.rejected);
+  commandSchedulerInit(20);
+}
+
+// === BOUCLE FERMÉE (SIMULATEUR) ===
+
+static void test_closed_loop_figure8_flies() {
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_EQUAL(AUTOPILOT_FIGURE_8, result.finalMode);
+  TEST_ASSERT_GREATER_OR_EQUAL(10, result.figure8Cycles);
+  // La figure reste centrée et dans la bande d'élévation visée
+  TEST_ASSERT_FLOAT_WITHIN(10.0f, 0.0f, result.minAzimuth + result.maxAzimuth);
+  TEST_ASSERT_GREATER_THAN_FLOAT(25.0f, result.minElevation);
+  TEST_ASSERT_LESS_THAN_FLOAT(60.0f, result.maxElevation);
+  TEST_ASSERT_LESS_THAN_FLOAT(60.0f, result.rmsHeadingError);
+}
+
+static void test_closed_loop_survives_gusts() {
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.sim.turbulenceIntensity = 0.15f;
+  config.sim.gustAmplitude = 3.0f;
+  config.sim.gustInterval = 15.0f;
+  config.sim.seed = 99;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_GREATER_OR_EQUAL(5, result.figure8Cycles);
+}
+
+static void test_closed_loop_hover_holds_center() {
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.mode = AUTOPILOT_HOVER;
+  config.duration = 60.0f;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_FLOAT_WITHIN(3.0f, 0.0f, result.minAzimuth);
+  TEST_ASSERT_FLOAT_WITHIN(3.0f, 0.0f, result.maxAzimuth);
+  TEST_ASSERT_GREATER_THAN_FLOAT(60.0f, result.minElevation);
+}
+
+static void test_closed_loop_line_limit_triggers_safe_emergency() {
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.duration = 60.0f;
+  config.reelSpeed = 2.0f;
+  ClosedLoopResult result;
+  // 100 m + 2 m/s dépasse les 150 m autorisés : urgence, puis le kite
+  // doit rejoindre le zénith sans toucher le sol
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_EQUAL(AUTOPILOT_EMERGENCY, result.finalMode);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, result.meanPower);
+}
+
+static void test_closed_loop_faults_are_detected_and_recovered() {
+  faultInjectionInit();
+  TEST_ASSERT_EQUAL(2, faultInjectionParseScript("15000 stuck imu 2000\n"
+                                                 "30000 stall control 800\n"));
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.duration = 40.0f;
+  config.faultScenario = true;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+
+  const FaultEvent* events = nullptr;
+  TEST_ASSERT_EQUAL(2, faultInjectionGetEvents(&events));
+  for (int i = 0; i < 2; i++) {
+    TEST_ASSERT_TRUE(events[i].detected);
+    TEST_ASSERT_TRUE(events[i].recovered);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_TASK_TIMEOUT + HEALTH_CHECK_INTERVAL,
+                                     events[i].detectedAt - events[i].injectedAt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_RECOVERY_INTERVAL,
+                                     events[i].recoveredAt - events[i].clearedAt);
+  }
+  // Tâche de contrôle bloquée : stratégie SAFE_MODE, l'autopilote passe en urgence
+  TEST_ASSERT_EQUAL(AUTOPILOT_EMERGENCY, result.finalMode);
+  faultInjectionInit();
+}
+
+static void test_closed_loop_takeoff_and_landing_follow_profiles() {
+  // Décollage depuis 15° sur 60 m de ligne, atterrissage commandé à 35 s
+  CommandFrame commands[] = {
+    makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_LANDING, 0, 35000, COMMAND_LATE_DROP),
+  };
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.sim.initialElevation = 15.0f;
+  config.sim.lineLength = 60.0f;
+  config.mode = AUTOPILOT_TAKEOFF;
+  config.duration = 56.0f;
+  config.settleTime = 0.0f;
+  config.commands = commands;
+  config.commandCount = 1;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  TEST_ASSERT_GREATER_THAN_FLOAT(LAUNCH_TAKEOFF_ELEVATION - LAUNCH_SETTLE_ELEVATION_ERROR, result.maxElevation);
+  // Atterrissage achevé : ligne rentrée, treuil arrêté, pilotage rendu
+  LaunchSequenceState launch;
+  launchSequenceGetState(&launch);
+  TEST_ASSERT_EQUAL(LAUNCH_LANDING, launch.kind);
+  TEST_ASSERT_EQUAL(LAUNCH_COMPLETE, launch.status);
+  TEST_ASSERT_LESS_THAN_FLOAT(LAUNCH_MAX_ELEVATION_ERROR, launch.maxElevationError);
+  TEST_ASSERT_FLOAT_WITHIN(LAUNCH_SETTLE_LENGTH_CM, LAUNCH_LANDING_LINE_CM, kiteSimGetState().lineLength * 100.0f);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, kiteSimGetState().reelSpeed);
+  TEST_ASSERT_EQUAL(AUTOPILOT_OFF, result.finalMode);
+}
+
+static void test_closed_loop_commands_sync_autopilot_and_winch() {
+  // Passage en figure en 8 et déroulement du treuil au même instant
+  CommandFrame commands[] = {
+    makeCommand(COMMAND_TYPE_MODE, AUTOPILOT_FIGURE_8, 0, 10000, COMMAND_LATE_DROP),
+    makeCommand(COMMAND_TYPE_WINCH, 0, 1.0f, 10000, COMMAND_LATE_DROP),
+    makeCommand(COMMAND_TYPE_WINCH, 0, 0.0f, 25000, COMMAND_LATE_DROP),
+  };
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  config.mode = AUTOPILOT_HOVER;
+  config.duration = 30.0f;
+  config.commands = commands;
+  config.commandCount = 3;
+  ClosedLoopResult result;
+  TEST_ASSERT_TRUE(closedLoopRun(config, &result));
+  CommandSchedulerStats stats = commandSchedulerGetStats();
+  TEST_ASSERT_EQUAL_UINT32(3, stats.executed);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.late);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+  TEST_ASSERT_EQUAL(AUTOPILOT_FIGURE_8, result.finalMode);
+  // Puissance au treuil seulement pendant les 15 s de déroulement
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, result.meanPower);
+  TEST_ASSERT_GREATER_OR_EQUAL(1, result.figure8Cycles);
+}
+
+static void test_closed_loop_envelope_keeps_figure8_inside() {
+  // Fenêtre réduite à ±40° d'azimut, figure en 8 demandée sur ±45° : les
+  // virages sont rentrés dans la marge douce, sans déclencher l'urgence
+  static const SafetyVertex narrow[] = {{-40.0f, 5.0f}, {40.0f, 5.0f}, {40.0f, 85.0f}, {-40.0f, 85.0f}};
+  SafetyPolygon envelope[] = {{narrow, 4, false}};
+  TEST_ASSERT_TRUE(safetyEnvelopeCompile(envelope, 1));
+  AutopilotParameters saved = getAutopilotParameters();
+  AutopilotParameters params = saved;
+  params.figure8Width = 90;
+  TEST_ASSERT_TRUE(setAutopilotParameters(params));
+
+  ClosedLoopConfig config;
+  closedLoopDefaultConfig(&config);
+  ClosedLoopResult result;
+  bool ran = closedLoopRun(config, &result);
+  setAutopilotParameters(saved);
+  safetyEnvelopeInit();
+
+  TEST_ASSERT_TRUE(ran);
+  TEST_ASSERT_EQUAL(AUTOPILOT_FIGURE_8, result.finalMode);
+  TEST_ASSERT_GREATER_OR_EQUAL(5, result.figure8Cycles);
+  TEST_ASSERT_LESS_THAN_FLOAT(40.0f, result.maxAzimuth);
+  TEST_ASSERT_GREATER_THAN_FLOAT(-40.0f, result.minAzimuth);
+}
+
+static void test_closed_loop_reengagement_rearms_sensor_checks() {
+  // Capteurs non lus pendant le vol manuel (cycle de contrôle interrompu)
+  KiteSimConfig sim;
+  kiteSimDefaultConfig(&sim);
+  autopilotInit();
+  setAutopilotMode(AUTOPILOT_OFF);
+  nativeSetMillis(0);
+  kiteSimInit(&sim);
+  servoInitAll();
+  healthMonitorInit();
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_HOVER));
+  for (int i = 0; i < 10; i++) {
+    kiteSimStep(0.02f);
+    nativeAdvanceMillis(20);
+    IMUData imu;
+    imuReadProcessedData(&imu);
+    autopilotControlStep(&imu);
+  }
+
+  // Vol manuel : le kite remonte de 30° sans être lu, puis réengagement
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_OFF));
+  sim.initialElevation += 30.0f;
+  kiteSimInit(&sim);
+  nativeAdvanceMillis(5000);
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_HOVER));
+  kiteSimStep(0.02f);
+  IMUData imu;
+  imuReadProcessedData(&imu);
+  autopilotControlStep(&imu);
+  TEST_ASSERT_TRUE(healthMonitorIsHealthy(HEALTH_SENSOR_IMU));
+  TEST_ASSERT_EQUAL(AUTOPILOT_HOVER, getAutopilotMode());
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+// === MACHINE À ÉTATS ===
+
+enum { FSM_IDLE = 0, FSM_RUNNING = 1, FSM_DONE = 2, FSM_ERROR = 3 };
+
+class CounterMachine : public StateMachine {
+public:
+  CounterMachine() : StateMachine("TEST", FSM_IDLE, 0, FSM_ERROR), ticks(0), enterCount(0) {}
+  int ticks;
+  int enterCount;
+protected:
+  int processState(int state) override {
+    switch (state) {
+      case FSM_IDLE:
+        return FSM_RUNNING;
+      case FSM_RUNNING:
+        return ++ticks >= 3 ? FSM_DONE : FSM_RUNNING;
+      default:
+        return state;
+    }
+  }
+  void onEnterState(int /*state*/, int /*fromState*/) override {
+    enterCount++;
+  }
+};
+
+static void test_state_machine_transitions() {
+  CounterMachine fsm;
+  TEST_ASSERT_EQUAL(FSM_RUNNING, fsm.update());
+  TEST_ASSERT_TRUE(fsm.didTransitionOccur());
+  TEST_ASSERT_EQUAL(FSM_IDLE, fsm.getPreviousState());
+  fsm.update();
+  fsm.update();
+  TEST_ASSERT_EQUAL(FSM_DONE, fsm.update());
+  TEST_ASSERT_EQUAL(3, fsm.ticks);
+  TEST_ASSERT_EQUAL(2, fsm.enterCount);
+}
+
+static void test_state_machine_timeout() {
+  CounterMachine fsm;
+  fsm.update();
+  fsm.setTimeoutState(FSM_ERROR);
+  fsm.transitionTo(FSM_RUNNING + 10, 100, "attente");
+  nativeAdvanceMillis(50);
+  TEST_ASSERT_EQUAL(FSM_RUNNING + 10, fsm.update());
+  nativeAdvanceMillis(60);
+  TEST_ASSERT_TRUE(fsm.hasTimedOut());
+  TEST_ASSERT_EQUAL(FSM_ERROR, fsm.update());
+}
+
+void runControlTests() {
+  RUN_TEST(test_pid_proportional_only);
+  RUN_TEST(test_pid_output_is_clamped);
+  RUN_TEST(test_pid_integral_removes_steady_error);
+  RUN_TEST(test_pid_integral_is_bounded);
+  RUN_TEST(test_pid_anti_windup_when_saturated);
+  RUN_TEST(test_pid_derivative_reacts_to_error_change);
+  RUN_TEST(test_pid_reset_clears_state);
+  RUN_TEST(test_pid_derivative_filter_smooths_steps);
+  RUN_TEST(test_autopilot_starts_off);
+  RUN_TEST(test_autopilot_enters_and_leaves_figure8);
+  RUN_TEST(test_autopilot_rejects_invalid_mode);
+  RUN_TEST(test_autopilot_emergency_stop);
+  RUN_TEST(test_autopilot_parameters_validation);
+  RUN_TEST(test_autopilot_update_is_throttled);
+  RUN_TEST(test_autopilot_confidence_drops_with_rotation);
+  RUN_TEST(test_autopilot_checks_window_on_fresh_position);
+  RUN_TEST(test_gust_predictor_forecasts_periodic_gusts);
+  RUN_TEST(test_gust_predictor_band_covers_turbulence);
+  RUN_TEST(test_gust_predictor_warmup_and_clock_reset);
+  RUN_TEST(test_energy_pumping_cycles_and_efficiency);
+  RUN_TEST(test_energy_carry_gaps_and_abandoned_cycle);
+  RUN_TEST(test_launch_profile_respects_limits);
+  RUN_TEST(test_launch_deviation_aborts_sequence);
+  RUN_TEST(test_safety_envelope_distance_and_direction);
+  RUN_TEST(test_safety_envelope_rejects_invalid_polygons);
+  RUN_TEST(test_mission_rejects_invalid_plans);
+  RUN_TEST(test_mission_instruction_budget_per_tick);
+  RUN_TEST(test_command_scheduler_orders_by_time_across_wrap);
+  RUN_TEST(test_command_scheduler_late_policies_and_rejections);
+  RUN_TEST(test_closed_loop_figure8_flies);
+  RUN_TEST(test_closed_loop_survives_gusts);
+  RUN_TEST(test_closed_loop_hover_holds_center);
+  RUN_TEST(test_closed_loop_line_limit_triggers_safe_emergency);
+  RUN_TEST(test_closed_loop_faults_are_detected_and_recovered);
+  RUN_TEST(test_closed_loop_mission_completes_and_guard_aborts);
+  RUN_TEST(test_closed_loop_commands_sync_autopilot_and_winch);
+  RUN_TEST(test_closed_loop_takeoff_and_landing_follow_profiles);
+  RUN_TEST(test_closed_loop_envelope_keeps_figure8_inside);
+  RUN_TEST(test_closed_loop_reengagement_rearms_sensor_checks);
+  RUN_TEST(test_state_machine_transitions);
+  RUN_TEST(test_state_machine_timeout);
+}
@@ -0,0 +1,226 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires du noyau
+  -----------------------
+
+  Orchestrateur de démarrage : ordre des dépendances, chemin critique,
+  graphe invalide et propagation des échecs. En natif l'autre cœur n'existe
+  pas : l'appelant initialise seul les modules.
+  Gestion de l'énergie : politique sol/vol, verrous esp_pm et repli.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <esp_pm.h>
+#include "core/boot_orchestrator.h"
+#include "core/power_manager.h"
+#include "core/hot_path.h"
+
+// Module dont l'initialisation dure durationMs sur l'horloge simulée
+class TimedModule : public Module {
+public:
+    TimedModule(const char* name, unsigned long durationMs, bool succeeds = true)
+        : Module(name), durationMs(durationMs), succeeds(succeeds) {}
+    bool init() override {
+        initCount++;
+        nativeAdvanceMillis(durationMs);
+        return succeeds;
+    }
+    int initCount = 0;
+private:
+    unsigned long durationMs;
+    bool succeeds;
+};
+
+static void test_orchestrator_respects_dependencies() {
+  // lcd -> ui ; wifi ; autopilot dépend de lcd et wifi
+  TimedModule lcd("lcd", 100), ui("ui", 50), wifi("wifi", 300), autopilot("autopilot", 10);
+  ui.dependsOn("lcd");
+  autopilot.dependsOn("lcd");
+  autopilot.dependsOn("wifi");
+  Module* modules[] = { &autopilot, &ui, &wifi, &lcd };
+  BootInitReport report;
+
+  TEST_ASSERT_TRUE(bootOrchestratorRun(modules, 4, &report));
+  const BootInitRecord* records = report.records;
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(records[3].endUs, records[1].startUs);  // ui après lcd
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(records[3].endUs, records[0].startUs);  // autopilot après lcd
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(records[2].endUs, records[0].startUs);  // autopilot après wifi
+  TEST_ASSERT_EQUAL(1, lcd.initCount);
+  TEST_ASSERT_EQUAL(0, report.failures);
+  TEST_ASSERT_TRUE(autopilot.state() == Module::State::MODULE_ENABLED);
+}
+
+static void test_orchestrator_reports_critical_path() {
+  TimedModule lcd("lcd", 100), ui("ui", 50), wifi("wifi", 300), autopilot("autopilot", 10);
+  ui.dependsOn("lcd");
+  autopilot.dependsOn("lcd");
+  autopilot.dependsOn("wifi");
+  Module* modules[] = { &lcd, &ui, &wifi, &autopilot };
+  BootInitReport report;
+
+  TEST_ASSERT_TRUE(bootOrchestratorRun(modules, 4, &report));
+  bootOrchestratorPrintReport(&report);
+
+  // Chemin critique wifi -> autopilot (310 ms) ; séquentiel : 460 ms
+  TEST_ASSERT_EQUAL(2, report.criticalLength);
+  TEST_ASSERT_EQUAL(2, report.criticalPath[0]);
+  TEST_ASSERT_EQUAL(3, report.criticalPath[1]);
+  TEST_ASSERT_EQUAL_UINT32(310000, report.criticalPathUs);
+  TEST_ASSERT_EQUAL_UINT32(460000, report.serialUs);
+  TEST_ASSERT_EQUAL(1, report.workers);
+  TEST_ASSERT_EQUAL_UINT32(report.serialUs, report.wallUs);
+}
+
+static void test_orchestrator_rejects_invalid_graph() {
+  TimedModule a("a", 10), b("b", 10), c("c", 10), d("d", 10);
+  a.dependsOn("b");
+  b.dependsOn("a");
+  c.dependsOn("missing");
+  for (int i = 0; i < MODULE_MAX_DEPENDENCIES; i++) {
+    TEST_ASSERT_TRUE(d.dependsOn("e"));
+  }
+  TEST_ASSERT_FALSE(d.dependsOn("e"));
+  TimedModule e("e", 10);
+  Module* cycle[] = { &a, &b };
+  Module* unknown[] = { &c };
+  Module* overflow[] = { &d, &e };
+  BootInitReport report;
+
+  TEST_ASSERT_FALSE(bootOrchestratorRun(cycle, 2, &report));
+  TEST_ASSERT_FALSE(bootOrchestratorRun(unknown, 1, &report));
+  TEST_ASSERT_FALSE(bootOrchestratorRun(overflow, 2, &report));
+  TEST_ASSERT_EQUAL(0, a.initCount + b.initCount + c.initCount + d.initCount + e.initCount);
+}
+
+static void test_orchestrator_skips_dependents_of_failed_module() {
+  TimedModule storage("storage", 20, false), calibration("calibration", 10),
+              autopilot("autopilot", 10), pots("pots", 10);
+  calibration.dependsOn("storage");
+  autopilot.dependsOn("calibration");
+  Module* modules[] = { &storage, &calibration, &autopilot, &pots };
+  BootInitReport report;
+
+  TEST_ASSERT_FALSE(bootOrchestratorRun(modules, 4, &report));
+  TEST_ASSERT_EQUAL(3, report.failures);
+  TEST_ASSERT_TRUE(report.records[1].skipped);
+  TEST_ASSERT_TRUE(report.records[2].skipped);
+  TEST_ASSERT_EQUAL(0, calibration.initCount + autopilot.initCount);
+  TEST_ASSERT_EQUAL(1, pots.initCount);
+  TEST_ASSERT_TRUE(storage.state() == Module::State::MODULE_ERROR);
+}
+
+// === GESTION DE L'ÉNERGIE ===
+
+static void test_power_idle_only_after_grounded_hold() {
+  powerManagerInit();
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_OFF, 2.0f));
+  nativeAdvanceMillis(POWER_GROUNDED_HOLD_MS - 1);
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_OFF, 2.0f));
+  nativeAdvanceMillis(1);
+  TEST_ASSERT_EQUAL(POWER_PROFILE_GROUNDED_IDLE, powerManagerEvaluate(AUTOPILOT_OFF, 2.0f));
+
+  // Vol manuel (élévation) ou autopilote actif : pleine vitesse immédiate, attente relancée
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_OFF, 35.0f));
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_OFF, 2.0f));
+  nativeAdvanceMillis(POWER_GROUNDED_HOLD_MS);
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_HOVER, 2.0f));
+
+  // Élévation inconnue (IMU muette ou échantillon périmé) : jamais d'économie
+  powerManagerEvaluate(AUTOPILOT_OFF, NAN);
+  nativeAdvanceMillis(POWER_GROUNDED_HOLD_MS);
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerEvaluate(AUTOPILOT_OFF, NAN));
+}
+
+static void test_power_flight_holds_pm_locks() {
+  nativePmSupported = true;
+  TEST_ASSERT_TRUE(powerManagerInit());
+  TEST_ASSERT_EQUAL(POWER_FLIGHT_CPU_MHZ, nativePmConfig.max_freq_mhz);
+  TEST_ASSERT_EQUAL(POWER_IDLE_CPU_MHZ, nativePmConfig.min_freq_mhz);
+  TEST_ASSERT_EQUAL(1, nativePmLockCount[ESP_PM_CPU_FREQ_MAX]);
+  TEST_ASSERT_EQUAL(1, nativePmLockCount[ESP_PM_NO_LIGHT_SLEEP]);
+
+  powerManagerApplyProfile(POWER_PROFILE_GROUNDED_IDLE);
+  powerManagerApplyProfile(POWER_PROFILE_GROUNDED_IDLE);
+  TEST_ASSERT_EQUAL(0, nativePmLockCount[ESP_PM_CPU_FREQ_MAX]);
+  TEST_ASSERT_EQUAL(0, nativePmLockCount[ESP_PM_NO_LIGHT_SLEEP]);
+
+  // Activation de l'autopilote : verrous repris sans attendre la surveillance
+  autopilotInit();
+  TEST_ASSERT_TRUE(setAutopilotMode(AUTOPILOT_EMERGENCY));
+  TEST_ASSERT_EQUAL(POWER_PROFILE_FLIGHT, powerManagerGetProfile());
+  TEST_ASSERT_EQUAL(1, nativePmLockCount[ESP_PM_CPU_FREQ_MAX]);
+  TEST_ASSERT_EQUAL(1, nativePmLockCount[ESP_PM_NO_LIGHT_SLEEP]);
+  setAutopilotMode(AUTOPILOT_OFF);
+}
+
+static void test_power_falls_back_to_cpu_frequency() {
+  nativePmSupported = false;
+  TEST_ASSERT_FALSE(powerManagerInit());
+  TEST_ASSERT_EQUAL_UINT32(POWER_FLIGHT_CPU_MHZ, getCpuFrequencyMhz());
+  powerManagerApplyProfile(POWER_PROFILE_GROUNDED_IDLE);
+  TEST_ASSERT_EQUAL_UINT32(POWER_IDLE_CPU_MHZ, getCpuFrequencyMhz());
+  powerManagerApplyProfile(POWER_PROFILE_FLIGHT);
+  TEST_ASSERT_EQUAL_UINT32(POWER_FLIGHT_CPU_MHZ, getCpuFrequencyMhz());
+  nativePmSupported = true;
+}
+
+static void test_power_current_and_time_per_profile() {
+  powerManagerInit();
+  powerManagerRecordCurrent(110.0f);
+  powerManagerRecordCurrent(130.0f);
+  nativeAdvanceMillis(2000);
+  powerManagerApplyProfile(POWER_PROFILE_GROUNDED_IDLE);
+  powerManagerRecordCurrent(40.0f);
+  nativeAdvanceMillis(6000);
+
+  PowerStats stats = powerManagerGetStats();
+  TEST_ASSERT_EQUAL_UINT32(2000, stats.timeInProfileMs[POWER_PROFILE_FLIGHT]);
+  TEST_ASSERT_EQUAL_UINT32(6000, stats.timeInProfileMs[POWER_PROFILE_GROUNDED_IDLE]);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 120.0f, stats.currentSumMa[POWER_PROFILE_FLIGHT] / stats.currentSamples[POWER_PROFILE_FLIGHT]);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.currentSamples[POWER_PROFILE_GROUNDED_IDLE]);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.transitions);
+  powerManagerPrintReport();
+  powerManagerApplyProfile(POWER_PROFILE_FLIGHT);
+}
+
+static void test_hot_path_control_cycle_stats() {
+  hotPathResetControlStats();
+  const uint32_t periodUs = CONTROL_TASK_PERIOD_MS * 1000;
+  // Départ proche du passage à zéro de micros()
+  uint32_t startUs = 0xFFFFFFFFu - periodUs;
+  for (int i = 0; i < 5; i++) {
+    hotPathRecordControlCycle(startUs, startUs + 800);
+    startUs += periodUs;
+  }
+  // Cycle bloqué (écriture flash) : 2 périodes, puis retour à la cadence
+  startUs += periodUs;
+  hotPathRecordControlCycle(startUs, startUs + 3000);
+
+  HotPathReport report = hotPathGetReport();
+  TEST_ASSERT_EQUAL_UINT32(6, report.cycles);
+  TEST_ASSERT_EQUAL_UINT32(2 * periodUs, report.maxPeriodUs);
+  TEST_ASSERT_EQUAL_UINT32(3000, report.maxWorkUs);
+  TEST_ASSERT_EQUAL_UINT32(1, report.overruns);
+  TEST_ASSERT_EQUAL_UINT8(5, report.hotFunctions);
+
+  // Un écart sous HOT_PATH_OVERRUN_PERCENT n'est pas un dépassement
+  hotPathResetControlStats();
+  hotPathRecordControlCycle(0, 100);
+  hotPathRecordControlCycle(periodUs * HOT_PATH_OVERRUN_PERCENT / 100, periodUs * HOT_PATH_OVERRUN_PERCENT / 100 + 100);
+  report = hotPathGetReport();
+  TEST_ASSERT_EQUAL_UINT32(0, report.overruns);
+  hotPathLogReport();
+}
+
+void runCoreTests() {
+  RUN_TEST(test_orchestrator_respects_dependencies);
+  RUN_TEST(test_orchestrator_reports_critical_path);
+  RUN_TEST(test_orchestrator_rejects_invalid_graph);
+  RUN_TEST(test_orchestrator_skips_dependents_of_failed_module);
+  RUN_TEST(test_power_idle_only_after_grounded_hold);
+  RUN_TEST(test_power_flight_holds_pm_locks);
+  RUN_TEST(test_power_falls_back_to_cpu_frequency);
+  RUN_TEST(test_power_current_and_time_per_profile);
+  RUN_TEST(test_hot_path_control_cycle_stats);
+}
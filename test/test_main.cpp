@@ -0,0 +1,44 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires (Point d'entrée)
+  -----------------------
+  
+  Exécution de la suite de tests sur l'hôte : pio test -e native
+  
+  Version: 1.0.0
+  Date: 18 octobre 2026
+  Auteurs: Équipe Kite PiloteV3
+  
+  ===== FONCTIONNEMENT =====
+  Chaque fichier test_*.cpp regroupe les tests d'un domaine et expose une
+  fonction run*Tests() appelée ici. L'horloge simulée est remise à zéro
+  avant chaque test.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+
+void runControlTests();
+void runSensorTests();
+void runActuatorTests();
+void runCommunicationTests();
+void runUtilsTests();
+void runCoreTests();
+
+void setUp() {
+  nativeSetMillis(0);
+}
+
+void tearDown() {
+}
+
+int main() {
+  UNITY_BEGIN();
+  runControlTests();
+  runSensorTests();
+  runActuatorTests();
+  runCommunicationTests();
+  runUtilsTests();
+  runCoreTests();
+  return UNITY_END();
+}
@@ -0,0 +1,171 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires des capteurs
+  -----------------------
+  
+  Lecture des potentiomètres (moyenne, mappage, cadence programmée, détection de
+  changement, reprise manuelle) et persistance de la calibration.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include "hardware/io/potentiometer_manager.h"
+#include <Preferences.h>
+#include "utils/data_storage.h"
+
+static void setPots(int direction, int trim, int length) {
+  nativeSetAnalog(POT_DIRECTION, direction);
+  nativeSetAnalog(POT_TRIM, trim);
+  nativeSetAnalog(POT_LENGTH, length);
+}
+
+// === POTENTIOMÈTRES ===
+
+static void test_pots_mapping_full_range() {
+  PotentiometerManager pots;
+  setPots(0, ADC_RESOLUTION, ADC_RESOLUTION / 2);
+  nativeSetMillis(1000);
+  TEST_ASSERT_TRUE(pots.updatePotentiometers());
+  TEST_ASSERT_EQUAL(-100, pots.getDirection());
+  TEST_ASSERT_EQUAL(100, pots.getTrim());
+  TEST_ASSERT_INT_WITHIN(1, 50, pots.getLineLength());
+}
+
+static void test_pots_mapping_uses_calibration() {
+  PotentiometerManager pots;
+  pots.setCalibrationValues(1000, 3000, 0, ADC_RESOLUTION, 1000, 3000);
+  setPots(2000, 0, 3000);
+  nativeSetMillis(1000);
+  pots.updatePotentiometers();
+  TEST_ASSERT_EQUAL(0, pots.getDirection());
+  TEST_ASSERT_EQUAL(100, pots.getLineLength());
+}
+
+static void test_pots_reads_are_scheduled() {
+  static TimerWheel wheel;
+  PotentiometerManager pots;
+  setPots(0, 0, 0);
+  nativeSetMillis(1000);
+  timerWheelInit(&wheel, millis());
+  TEST_ASSERT_TRUE(pots.scheduleReads(&wheel));
+  TEST_ASSERT_TRUE(pots.scheduleReads(&wheel));   // Déjà programmée : pas de doublon
+  TEST_ASSERT_EQUAL(1, timerWheelGetStats(&wheel).active);
+  TEST_ASSERT_EQUAL_UINT32(POT_READ_INTERVAL, timerWheelNextDelay(&wheel, millis()));
+
+  setPots(ADC_RESOLUTION, 0, 0);
+  nativeAdvanceMillis(POT_READ_INTERVAL - 10);
+  TEST_ASSERT_EQUAL(0, timerWheelAdvance(&wheel, millis()));
+  TEST_ASSERT_EQUAL(0, pots.getDirection());
+  nativeAdvanceMillis(10);
+  TEST_ASSERT_EQUAL(1, timerWheelAdvance(&wheel, millis()));
+  TEST_ASSERT_EQUAL(100, pots.getDirection());
+  TEST_ASSERT_EQUAL_UINT32(POT_READ_INTERVAL, timerWheelNextDelay(&wheel, millis()));
+}
+
+static void test_pots_change_flags_are_consumed() {
+  PotentiometerManager pots;
+  setPots(100, 200, 300);
+  nativeSetMillis(1000);
+  pots.updatePotentiometers();
+  TEST_ASSERT_TRUE(pots.hasDirectionChanged());
+  TEST_ASSERT_FALSE(pots.hasDirectionChanged());
+  nativeAdvanceMillis(POT_READ_INTERVAL);
+  pots.updatePotentiometers();
+  TEST_ASSERT_FALSE(pots.hasAnyPotChanged());
+}
+
+static void test_pots_manual_adjust_disables_autopilot() {
+  PotentiometerManager pots;
+  setPots(ADC_RESOLUTION / 2, ADC_RESOLUTION / 2, ADC_RESOLUTION / 2);
+  nativeSetMillis(1000);
+  pots.updatePotentiometers();
+  pots.setAutoPilotMode(true);
+
+  // Faible dérive : le pilote automatique reste actif
+  nativeSetAnalog(POT_DIRECTION, ADC_RESOLUTION / 2 + 40);
+  nativeAdvanceMillis(POT_READ_INTERVAL);
+  pots.updatePotentiometers();
+  pots.checkAutoPilotStatus();
+  TEST_ASSERT_TRUE(pots.isAutoPilotEnabled());
+
+  // Ajustement franc : reprise manuelle
+  nativeSetAnalog(POT_DIRECTION, ADC_RESOLUTION);
+  nativeAdvanceMillis(POT_READ_INTERVAL);
+  pots.updatePotentiometers();
+  pots.checkAutoPilotStatus();
+  TEST_ASSERT_FALSE(pots.isAutoPilotEnabled());
+}
+
+// === CALIBRATION PERSISTÉE ===
+
+static void test_calibration_round_trip() {
+  nativeNvs.clear();
+  CalibrationData calib;
+  dataStorageDefaultCalibration(&calib);
+  calib.potMin[0] = 120;
+  calib.potMax[0] = 3900;
+  calib.gyroBias[2] = -0.75f;
+  calib.flags = CALIB_FLAG_POTS | CALIB_FLAG_IMU;
+  TEST_ASSERT_TRUE(dataStorageSaveCalibration(&calib));
+
+  CalibrationData loaded;
+  TEST_ASSERT_TRUE(dataStorageLoadCalibration(&loaded));
+  TEST_ASSERT_EQUAL(120, loaded.potMin[0]);
+  TEST_ASSERT_EQUAL(3900, loaded.potMax[0]);
+  TEST_ASSERT_EQUAL_FLOAT(-0.75f, loaded.gyroBias[2]);
+  TEST_ASSERT_EQUAL_UINT32(calib.crc, loaded.crc);
+}
+
+static void test_calibration_corruption_is_rejected() {
+  nativeNvs.clear();
+  CalibrationData calib;
+  dataStorageDefaultCalibration(&calib);
+  calib.flags = CALIB_FLAG_POTS;
+  dataStorageSaveCalibration(&calib);
+
+  // Altérer un octet du bloc persisté
+  for (auto& entry : nativeNvs[CALIBRATION_NVS_NAMESPACE]) {
+    entry.second[12] ^= 0x5A;
+  }
+
+  CalibrationData loaded;
+  TEST_ASSERT_FALSE(dataStorageLoadCalibration(&loaded));
+}
+
+static void test_calibration_missing_on_cold_boot() {
+  nativeNvs.clear();
+  CalibrationData loaded;
+  TEST_ASSERT_FALSE(dataStorageLoadCalibration(&loaded));
+}
+
+static void test_pots_calibration_is_persisted() {
+  nativeNvs.clear();
+  PotentiometerManager pots;
+  setPots(ADC_RESOLUTION / 2, ADC_RESOLUTION / 2, ADC_RESOLUTION / 2);
+  nativeSetMillis(1000);
+  pots.calibrate();
+
+  CalibrationData loaded;
+  TEST_ASSERT_TRUE(dataStorageLoadCalibration(&loaded));
+  TEST_ASSERT_TRUE(loaded.flags & CALIB_FLAG_POTS);
+  TEST_ASSERT_EQUAL(ADC_RESOLUTION / 2 - 50, loaded.potMin[0]);
+  TEST_ASSERT_EQUAL(ADC_RESOLUTION / 2 + 50, loaded.potMax[0]);
+}
+
+static void test_crc32_reference_value() {
+  // Valeur de référence CRC-32 (IEEE 802.3) de "123456789"
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926, dataStorageCrc32("123456789", 9));
+}
+
+void runSensorTests() {
+  RUN_TEST(test_pots_mapping_full_range);
+  RUN_TEST(test_pots_mapping_uses_calibration);
+  RUN_TEST(test_pots_reads_are_scheduled);
+  RUN_TEST(test_pots_change_flags_are_consumed);
+  RUN_TEST(test_pots_manual_adjust_disables_autopilot);
+  RUN_TEST(test_calibration_round_trip);
+  RUN_TEST(test_calibration_corruption_is_rejected);
+  RUN_TEST(test_calibration_missing_on_cold_boot);
+  RUN_TEST(test_pots_calibration_is_persisted);
+  RUN_TEST(test_crc32_reference_value);
+}
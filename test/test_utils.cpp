@@ -0,0 +1,1385 @@
+/*
+  -----------------------
+  Kite PiloteV3 - Tests unitaires des utilitaires
+  -----------------------
+  
+  Banc de micro-benchmarks : statistiques, référence et comparaison.
+  Injection de fautes : détection et récupération mesurées par canal.
+  Profilage du démarrage : chronologie, étape bloquée et référence.
+  Roue de temporisateurs : échéances exactes à tous les niveaux, périodes,
+  désarmement et passage de millis() par zéro.
+  Compression Gorilla : restitution exacte, bloc plein et taux de compression.
+  Analyse vibratoire : pic et bande d'une sinusoïde, anomalie, retard et budget.
+  Stockage des sessions : écriture d'un bloc à sa limite, recherche dans
+  l'index, aperçus comparés à un calcul exhaustif et rotation.
+*/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "utils/benchmark.h"
+#include "utils/error_manager.h"
+#include "utils/health_monitor.h"
+#include "utils/fault_injection.h"
+#include "utils/boot_profiler.h"
+#include "utils/timer_wheel.h"
+#include "utils/message_bus.h"
+#include "utils/param_server.h"
+#include "utils/gorilla.h"
+#include "utils/vibration.h"
+#include "utils/task_snapshot.h"
+#include "utils/lifetime_stats.h"
+#include "utils/session_storage.h"
+#include "core/hot_path.h"
+#include <Preferences.h>
+#include <math.h>
+#include <sys/stat.h>
+#ifdef NATIVE_BUILD
+#include <atomic>
+#include <thread>
+#endif
+
+#define TEST_BASELINE_PATH "test_benchmark_baseline.txt"
+#define TEST_BOOT_BASELINE_PATH "test_boot_baseline.txt"
+
+// === MICRO-BENCHMARKS ===
+
+static void spinWork(void* context) {
+  volatile uint32_t* counter = (volatile uint32_t*)context;
+  for (int i = 0; i < 200; i++) {
+    (*counter)++;
+  }
+}
+
+static void countPrepare(void* context) {
+  (*(uint32_t*)context)++;
+}
+
+static void test_benchmark_statistics_are_ordered() {
+  volatile uint32_t counter = 0;
+  BenchmarkCase benchCase = {"spin", spinWork, nullptr, nullptr, (void*)&counter, 64};
+  BenchmarkResult result;
+  TEST_ASSERT_TRUE(benchmarkRun(benchCase, &result));
+  TEST_ASSERT_EQUAL_UINT32(64, result.iterations);
+  TEST_ASSERT_TRUE(result.min <= result.median);
+  TEST_ASSERT_TRUE(result.median <= result.p99);
+  TEST_ASSERT_TRUE(result.p99 <= result.max);
+  TEST_ASSERT_EQUAL_STRING("spin", result.name);
+}
+
+static void test_benchmark_prepare_runs_each_iteration() {
+  uint32_t prepared = 0;
+  BenchmarkCase benchCase = {"prepare", countPrepare, countPrepare, nullptr, &prepared, 10};
+  BenchmarkResult result;
+  benchmarkRun(benchCase, &result);
+  TEST_ASSERT_EQUAL_UINT32(2 * (10 + BENCHMARK_WARMUP_ITERATIONS), prepared);
+}
+
+static void test_benchmark_rejects_invalid_case() {
+  BenchmarkCase benchCase = {"invalid", nullptr, nullptr, nullptr, nullptr, 0};
+  BenchmarkResult result;
+  TEST_ASSERT_FALSE(benchmarkRun(benchCase, &result));
+}
+
+static void test_benchmark_compare_verdicts() {
+  BenchmarkBaselineEntry baseline[1] = {{"case", 1000, 1200}};
+  BenchmarkResult result = {};
+  strcpy(result.name, "case");
+  float delta = 0.0f;
+
+  result.median = 1050;
+  TEST_ASSERT_EQUAL(BENCH_UNCHANGED, benchmarkCompare(result, baseline, 1, &delta));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, delta);
+  result.median = 1200;
+  TEST_ASSERT_EQUAL(BENCH_REGRESSED, benchmarkCompare(result, baseline, 1));
+  result.median = 500;
+  TEST_ASSERT_EQUAL(BENCH_IMPROVED, benchmarkCompare(result, baseline, 1));
+
+  strcpy(result.name, "other");
+  TEST_ASSERT_EQUAL(BENCH_NEW, benchmarkCompare(result, baseline, 1));
+}
+
+static void test_benchmark_compare_ignores_small_absolute_delta() {
+  BenchmarkBaselineEntry baseline[1] = {{"tiny", 10, 12}};
+  BenchmarkResult result = {};
+  strcpy(result.name, "tiny");
+  result.median = 10 + BENCHMARK_MIN_DELTA - 1;
+  TEST_ASSERT_EQUAL(BENCH_UNCHANGED, benchmarkCompare(result, baseline, 1));
+}
+
+static void test_benchmark_baseline_round_trip() {
+  BenchmarkResult results[2] = {};
+  strcpy(results[0].name, "first");
+  results[0].median = 123;
+  results[0].p99 = 456;
+  strcpy(results[1].name, "second");
+  results[1].median = 789;
+  results[1].p99 = 1011;
+  TEST_ASSERT_TRUE(benchmarkSaveBaseline(TEST_BASELINE_PATH, results, 2));
+
+  BenchmarkBaselineEntry entries[4];
+  TEST_ASSERT_EQUAL(2, benchmarkLoadBaseline(TEST_BASELINE_PATH, entries, 4));
+  TEST_ASSERT_EQUAL_STRING("second", entries[1].name);
+  TEST_ASSERT_EQUAL_UINT32(789, entries[1].median);
+  TEST_ASSERT_EQUAL_UINT32(1011, entries[1].p99);
+  remove(TEST_BASELINE_PATH);
+}
+
+static void test_benchmark_baseline_other_unit_is_ignored() {
+  FILE* file = fopen(TEST_BASELINE_PATH, "w");
+  TEST_ASSERT_NOT_NULL(file);
+  fprintf(file, "unit furlongs\ncase 1 2\n");
+  fclose(file);
+
+  BenchmarkBaselineEntry entries[4];
+  TEST_ASSERT_EQUAL(-1, benchmarkLoadBaseline(TEST_BASELINE_PATH, entries, 4));
+  remove(TEST_BASELINE_PATH);
+}
+
+// === INJECTION DE FAUTES ===
+
+static int displayRecoveries = 0;
+
+static bool countDisplayRecovery() {
+  displayRecoveries++;
+  return false;
+}
+
+static void resetFaultInjection() {
+  ErrorManager::getInstance()->clearErrorHistory();
+  faultInjectionInit();
+  healthMonitorInit();
+}
+
+static const FaultEvent& firstFaultEvent() {
+  const FaultEvent* events = nullptr;
+  faultInjectionGetEvents(&events);
+  return events[0];
+}
+
+/**
+ * Fait tourner le scénario pendant duration ms : surveillance toutes les
+ * HEALTH_CHECK_INTERVAL ms, tickCallback à chaque pas de 50 ms
+ */
+static void runFaultScenario(unsigned long duration, void (*tickCallback)(unsigned long)) {
+  faultInjectionStart();
+  for (unsigned long t = 50; t <= duration; t += 50) {
+    nativeAdvanceMillis(50);
+    tickCallback(t);
+    if (t % HEALTH_CHECK_INTERVAL == 0) {
+      faultInjectionUpdate();
+      healthMonitorUpdate();
+    }
+  }
+}
+
+static void imuTick(unsigned long t) {
+  float elevation = 40.0f + 5.0f * sinf(t / 300.0f);
+  healthMonitorCheckSensor(HEALTH_SENSOR_IMU, FAULT_FILTER_SENSOR(FAULT_SENSOR_IMU, 0, elevation));
+}
+
+static void displayTick(unsigned long t) {
+  if (t % 100 == 0) {
+    healthMonitorReportBus(HEALTH_BUS_DISPLAY, !FAULT_I2C_NAK_ACTIVE(LCD_I2C_ADDR));
+  }
+}
+
+static void controlTaskTick(unsigned long t) {
+  (void)t;
+  if (!FAULT_TASK_STALLED(FAULT_TASK_CONTROL)) {
+    healthMonitorHeartbeat(HEALTH_TASK_CONTROL);
+  }
+}
+
+static void idleTick(unsigned long t) {
+  (void)t;
+}
+
+static void test_fault_script_parsing() {
+  resetFaultInjection();
+  const char* script =
+    "# temps type cible durée amplitude\n"
+    "2000 i2c_nak 0x27 1500\n"
+    "\n"
+    "5000 stuck imu 2000   # IMU figée\n"
+    "9000 noise wind 2000 4.5\n"
+    "12000 stall control 800\n"
+    "15000 heap - 3000 8192\n";
+  TEST_ASSERT_EQUAL(5, faultInjectionParseScript(script));
+
+  const FaultEvent* events = nullptr;
+  TEST_ASSERT_EQUAL(5, faultInjectionGetEvents(&events));
+  TEST_ASSERT_EQUAL(FAULT_I2C_NAK, events[0].type);
+  TEST_ASSERT_EQUAL_UINT8(0x27, events[0].target);
+  TEST_ASSERT_EQUAL(HEALTH_BUS_DISPLAY, events[0].channel);
+  TEST_ASSERT_EQUAL(HEALTH_SENSOR_IMU, events[1].channel);
+  TEST_ASSERT_EQUAL_FLOAT(4.5f, events[2].amplitude);
+  TEST_ASSERT_EQUAL(HEALTH_TASK_CONTROL, events[3].channel);
+  TEST_ASSERT_EQUAL_UINT32(8192, (uint32_t)events[4].amplitude);
+
+  TEST_ASSERT_EQUAL(-1, faultInjectionParseScript("100 stuck gps 1000\n"));
+  TEST_ASSERT_EQUAL(-1, faultInjectionParseScript("100 melt imu 1000\n"));
+}
+
+static void test_fault_stuck_imu_detected_and_recovered() {
+  resetFaultInjection();
+  faultInjectionAdd(FAULT_SENSOR_STUCK, FAULT_SENSOR_IMU, 500, 1000, 0);
+  runFaultScenario(3000, imuTick);
+
+  const FaultEvent& event = firstFaultEvent();
+  TEST_ASSERT_TRUE(event.detected);
+  TEST_ASSERT_TRUE(event.recovered);
+  TEST_ASSERT_TRUE(healthMonitorIsHealthy(HEALTH_SENSOR_IMU));
+  // HEALTH_SENSOR_STUCK_SAMPLES lectures de 50 ms, puis HEALTH_PLAUSIBLE_SAMPLES
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_SENSOR_STUCK_SAMPLES * 50, event.detectedAt - event.injectedAt);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_PLAUSIBLE_SAMPLES * 50, event.recoveredAt - event.clearedAt);
+}
+
+static void test_fault_noisy_imu_detected() {
+  resetFaultInjection();
+  faultInjectionAdd(FAULT_SENSOR_NOISE, FAULT_SENSOR_IMU, 500, 1000, 40.0f);
+  runFaultScenario(3000, imuTick);
+
+  const FaultEvent& event = firstFaultEvent();
+  TEST_ASSERT_TRUE(event.detected);
+  TEST_ASSERT_TRUE(event.recovered);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(200, event.detectedAt - event.injectedAt);
+}
+
+static void test_fault_i2c_nak_triggers_reinitialize() {
+  resetFaultInjection();
+  displayRecoveries = 0;
+  healthMonitorSetRecoveryAction(HEALTH_BUS_DISPLAY, countDisplayRecovery);
+  faultInjectionAdd(FAULT_I2C_NAK, LCD_I2C_ADDR, 500, 1500, 0);
+  runFaultScenario(3000, displayTick);
+  healthMonitorSetRecoveryAction(HEALTH_BUS_DISPLAY, nullptr);
+
+  const FaultEvent& event = firstFaultEvent();
+  TEST_ASSERT_TRUE(event.detected);
+  TEST_ASSERT_TRUE(event.recovered);
+  // Stratégie REINITIALIZE : action au signalement puis toutes les HEALTH_RECOVERY_INTERVAL ms
+  TEST_ASSERT_GREATER_OR_EQUAL(2, displayRecoveries);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_BUS_FAILURES * 100, event.detectedAt - event.injectedAt);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(100, event.recoveredAt - event.clearedAt);
+}
+
+static void test_fault_task_stall_detected() {
+  resetFaultInjection();
+  faultInjectionAdd(FAULT_TASK_STALL, FAULT_TASK_CONTROL, 500, 1000, 0);
+  runFaultScenario(3000, controlTaskTick);
+
+  const FaultEvent& event = firstFaultEvent();
+  TEST_ASSERT_TRUE(event.detected);
+  TEST_ASSERT_TRUE(event.recovered);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(HEALTH_TASK_TIMEOUT, event.detectedAt - event.injectedAt);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_TASK_TIMEOUT + HEALTH_CHECK_INTERVAL, event.detectedAt - event.injectedAt);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_CHECK_INTERVAL, event.recoveredAt - event.clearedAt);
+}
+
+static void test_fault_heap_exhaustion_detected_and_released() {
+  resetFaultInjection();
+  uint32_t freeHeap = ESP.getFreeHeap();
+  faultInjectionAdd(FAULT_HEAP_EXHAUSTION, 0, 500, 1000, 8192);
+  runFaultScenario(3000, idleTick);
+
+  const FaultEvent& event = firstFaultEvent();
+  TEST_ASSERT_TRUE(event.detected);
+  TEST_ASSERT_TRUE(event.recovered);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_CHECK_INTERVAL, event.detectedAt - event.injectedAt);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEALTH_CHECK_INTERVAL, event.recoveredAt - event.clearedAt);
+  TEST_ASSERT_EQUAL_UINT32(freeHeap, ESP.getFreeHeap());
+}
+
+// === PROFILAGE DU DÉMARRAGE ===
+
+/**
+ * Démarrage simulé : "hardware" (300 ms) contient "lcd" (lcdMs), puis "wifi" (200 ms)
+ */
+static void simulateBoot(unsigned long lcdMs) {
+  bootProfilerBegin();
+  uint8_t hardware = bootProfilerStepBegin("hardware");
+  nativeAdvanceMillis(300 - lcdMs);
+  uint8_t lcd = bootProfilerStepBegin("lcd");
+  nativeAdvanceMillis(lcdMs);
+  bootProfilerStepEnd(lcd);
+  bootProfilerStepEnd(hardware);
+  uint8_t wifi = bootProfilerStepBegin("wifi");
+  nativeAdvanceMillis(200);
+  bootProfilerStepEnd(wifi);
+  bootProfilerFinish();
+}
+
+static void test_boot_profiler_nested_timeline() {
+  simulateBoot(100);
+  const BootTimeline* timeline = bootProfilerGetTimeline();
+
+  TEST_ASSERT_TRUE(timeline->complete);
+  TEST_ASSERT_EQUAL(3, timeline->stepCount);
+  TEST_ASSERT_EQUAL_STRING("lcd", timeline->steps[1].name);
+  TEST_ASSERT_EQUAL(1, timeline->steps[1].depth);
+  TEST_ASSERT_EQUAL(0, timeline->steps[2].depth);
+  TEST_ASSERT_EQUAL_UINT32(300000, timeline->steps[0].endUs - timeline->steps[0].startUs);
+  TEST_ASSERT_EQUAL_UINT32(100000, timeline->steps[1].endUs - timeline->steps[1].startUs);
+  TEST_ASSERT_EQUAL_UINT32(500000, timeline->totalUs);
+  bootProfilerPrintWaterfall(timeline);
+}
+
+static void test_boot_profiler_reports_stalled_step() {
+  simulateBoot(100);
+  uint32_t bootCount = bootProfilerGetTimeline()->bootCount;
+
+  // Démarrage interrompu dans "lcd" puis redémarrage à chaud
+  nativeSetMillis(0);
+  bootProfilerBegin();
+  bootProfilerStepBegin("hardware");
+  bootProfilerStepBegin("lcd");
+  nativeSetMillis(0);
+  bootProfilerBegin();
+
+  const BootTimeline* previous = bootProfilerGetPreviousTimeline();
+  TEST_ASSERT_NOT_NULL(previous);
+  TEST_ASSERT_FALSE(previous->complete);
+  TEST_ASSERT_EQUAL_STRING("lcd", bootProfilerStalledStep(previous));
+  TEST_ASSERT_NULL(bootProfilerStalledStep(bootProfilerGetTimeline()));
+  TEST_ASSERT_EQUAL_UINT32(bootCount + 2, bootProfilerGetTimeline()->bootCount);
+}
+
+static void test_boot_profiler_flags_regression() {
+  remove(TEST_BOOT_BASELINE_PATH);
+  simulateBoot(100);
+  TEST_ASSERT_EQUAL(0, bootProfilerCompareBaseline(bootProfilerGetTimeline(), TEST_BOOT_BASELINE_PATH, false));
+
+  // Même démarrage : aucune régression ; LCD 100 -> 250 ms dans
+  // une étape "hardware" de durée constante : seule "lcd" régresse
+  nativeSetMillis(0);
+  simulateBoot(100);
+  TEST_ASSERT_EQUAL(0, bootProfilerCompareBaseline(bootProfilerGetTimeline(), TEST_BOOT_BASELINE_PATH, false));
+  nativeSetMillis(0);
+  simulateBoot(250);
+  TEST_ASSERT_EQUAL(1, bootProfilerCompareBaseline(bootProfilerGetTimeline(), TEST_BOOT_BASELINE_PATH, false));
+  remove(TEST_BOOT_BASELINE_PATH);
+}
+
+// === ROUE DE TEMPORISATEURS ===
+
+// Journal des rappels : identifiant et instant d'exécution
+typedef struct {
+  int ids[16];                  // 16 premiers rappels
+  uint32_t times[16];
+  int count;
+  int perId[4];
+  TimerWheel* wheel;
+  TimerHandle handle;
+} TimerLog;
+
+static TimerLog timerLog;
+static uint32_t timerNow;
+
+static void logTimer(void* context) {
+  int id = (int)(intptr_t)context;
+  if (timerLog.count < 16) {
+    timerLog.ids[timerLog.count] = id;
+    timerLog.times[timerLog.count] = timerNow;
+  }
+  timerLog.count++;
+  timerLog.perId[id]++;
+}
+
+static void cancelSelf(void* context) {
+  logTimer(context);
+  TEST_ASSERT_TRUE(timerWheelCancel(timerLog.wheel, timerLog.handle));
+}
+
+// Avance milliseconde par milliseconde, comme une tâche qui ne dormirait pas
+static void advanceTimersTo(TimerWheel* wheel, uint32_t endMs) {
+  while ((int32_t)(endMs - timerNow) > 0) {
+    timerNow++;
+    timerWheelAdvance(wheel, timerNow);
+  }
+}
+
+static void startTimerTest(TimerWheel* wheel, uint32_t nowMs) {
+  memset(&timerLog, 0, sizeof(timerLog));
+  timerLog.wheel = wheel;
+  timerNow = nowMs;
+  timerWheelInit(wheel, nowMs);
+}
+
+static void test_timer_wheel_fires_on_time_at_every_level() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 1000);
+  // Niveau 0, 1, 2 et débordement, armés dans le désordre
+  timerWheelSchedule(&wheel, 5000, 0, logTimer, (void*)2);
+  timerWheelSchedule(&wheel, 300000, 0, logTimer, (void*)3);
+  timerWheelSchedule(&wheel, 5, 0, logTimer, (void*)0);
+  timerWheelSchedule(&wheel, 70, 0, logTimer, (void*)1);
+
+  advanceTimersTo(&wheel, 1000 + 300000);
+  TEST_ASSERT_EQUAL(4, timerLog.count);
+  const uint32_t expected[] = {1005, 1070, 6000, 301000};
+  for (int i = 0; i < 4; i++) {
+    TEST_ASSERT_EQUAL(i, timerLog.ids[i]);
+    TEST_ASSERT_EQUAL_UINT32(expected[i], timerLog.times[i]);
+  }
+  TimerWheelStats stats = timerWheelGetStats(&wheel);
+  TEST_ASSERT_EQUAL(0, stats.active);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.maxLatenessMs);
+  TEST_ASSERT_TRUE(stats.cascaded > 0);
+}
+
+static void test_timer_wheel_periodic_skips_missed_periods() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 0);
+  timerWheelSchedule(&wheel, 50, 50, logTimer, (void*)0);
+  advanceTimersTo(&wheel, 500);
+  TEST_ASSERT_EQUAL(10, timerLog.count);
+  TEST_ASSERT_EQUAL_UINT32(500, timerLog.times[9]);
+
+  // Tâche bloquée 230 ms : une seule exécution, puis retour sur la grille
+  timerNow = 730;
+  TEST_ASSERT_EQUAL(1, timerWheelAdvance(&wheel, timerNow));
+  TimerWheelStats stats = timerWheelGetStats(&wheel);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.missed);
+  TEST_ASSERT_EQUAL_UINT32(180, stats.maxLatenessMs);
+  TEST_ASSERT_EQUAL_UINT32(20, timerWheelNextDelay(&wheel, timerNow));
+  advanceTimersTo(&wheel, 750);
+  TEST_ASSERT_EQUAL(12, timerLog.count);
+}
+
+static void test_timer_wheel_cancel_and_stale_handles() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 0);
+  TimerHandle cancelled = timerWheelSchedule(&wheel, 100, 0, logTimer, (void*)0);
+  TEST_ASSERT_TRUE(timerWheelIsActive(&wheel, cancelled));
+  TEST_ASSERT_TRUE(timerWheelCancel(&wheel, cancelled));
+  TEST_ASSERT_FALSE(timerWheelCancel(&wheel, cancelled));
+
+  // L'emplacement réutilisé n'obéit pas à l'ancien identifiant
+  TimerHandle reused = timerWheelSchedule(&wheel, 100, 0, logTimer, (void*)1);
+  TEST_ASSERT_FALSE(timerWheelCancel(&wheel, cancelled));
+  TEST_ASSERT_TRUE(timerWheelIsActive(&wheel, reused));
+
+  // Un temporisateur périodique se désarme depuis son propre rappel
+  timerLog.handle = timerWheelSchedule(&wheel, 30, 30, cancelSelf, (void*)2);
+  advanceTimersTo(&wheel, 200);
+  TEST_ASSERT_EQUAL(2, timerLog.count);
+  TEST_ASSERT_EQUAL(2, timerLog.ids[0]);
+  TEST_ASSERT_EQUAL(1, timerLog.ids[1]);
+  TEST_ASSERT_FALSE(timerWheelIsActive(&wheel, reused));
+  TEST_ASSERT_EQUAL(0, timerWheelGetStats(&wheel).active);
+
+  // Roue pleine : armement refusé
+  for (int i = 0; i < TIMER_WHEEL_MAX_TIMERS; i++) {
+    TEST_ASSERT_TRUE(timerWheelSchedule(&wheel, 10, 0, logTimer, (void*)3) != TIMER_HANDLE_NONE);
+  }
+  TEST_ASSERT_EQUAL(TIMER_HANDLE_NONE, timerWheelSchedule(&wheel, 10, 0, logTimer, (void*)3));
+  TEST_ASSERT_EQUAL(1, timerWheelGetStats(&wheel).exhausted);
+}
+
+static void test_timer_wheel_fired_one_shot_handle_is_stale() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 0);
+  TimerHandle fired = timerWheelSchedule(&wheel, 10, 0, logTimer, (void*)0);
+  advanceTimersTo(&wheel, 10);
+  TEST_ASSERT_EQUAL(1, timerLog.count);
+  TEST_ASSERT_FALSE(timerWheelIsActive(&wheel, fired));
+
+  // L'emplacement libéré à l'échéance est réutilisé sous un autre identifiant
+  TimerHandle reused = timerWheelSchedule(&wheel, 10, 0, logTimer, (void*)1);
+  TEST_ASSERT_TRUE(reused != fired);
+  TEST_ASSERT_FALSE(timerWheelCancel(&wheel, fired));
+  advanceTimersTo(&wheel, 20);
+  TEST_ASSERT_EQUAL(1, timerLog.perId[1]);
+}
+
+static void test_timer_wheel_next_delay_and_long_sleep() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 0);
+  TEST_ASSERT_EQUAL_UINT32(TIMER_WHEEL_MAX_IDLE_MS, timerWheelNextDelay(&wheel, 0));
+  timerWheelSchedule(&wheel, 250, 250, logTimer, (void*)0);
+  timerWheelSchedule(&wheel, DISPLAY_CHECK_INTERVAL, DISPLAY_CHECK_INTERVAL, logTimer, (void*)1);
+
+  // Sommeil exact jusqu'aux échéances : aucun réveil inutile
+  int wakeups = 0;
+  while (timerNow < DISPLAY_CHECK_INTERVAL) {
+    uint32_t delay = timerWheelNextDelay(&wheel, timerNow);
+    TEST_ASSERT_TRUE(delay > 0);
+    timerNow += delay;
+    timerWheelAdvance(&wheel, timerNow);
+    wakeups++;
+  }
+  TEST_ASSERT_EQUAL(DISPLAY_CHECK_INTERVAL / 250, timerLog.perId[0]);
+  TEST_ASSERT_EQUAL(1, timerLog.perId[1]);
+  TEST_ASSERT_EQUAL(DISPLAY_CHECK_INTERVAL / 250, wakeups);
+  TEST_ASSERT_EQUAL_UINT32(0, timerWheelGetStats(&wheel).maxLatenessMs);
+}
+
+static void test_timer_wheel_survives_millis_wrap() {
+  static TimerWheel wheel;
+  startTimerTest(&wheel, 0xFFFFFF00UL);
+  timerWheelSchedule(&wheel, 0x80, 0, logTimer, (void*)0);
+  timerWheelSchedule(&wheel, 0x200, 0, logTimer, (void*)1);
+  timerWheelSchedule(&wheel, 10000, 0, logTimer, (void*)2);
+  advanceTimersTo(&wheel, 20000);
+  TEST_ASSERT_EQUAL(3, timerLog.count);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFF80UL, timerLog.times[0]);
+  TEST_ASSERT_EQUAL_UINT32(0x100, timerLog.times[1]);
+  TEST_ASSERT_EQUAL_UINT32(10000 - 0x100, timerLog.times[2]);
+}
+
+// === BUS DE MESSAGES ===
+
+static void test_bus_fan_out_shares_one_block() {
+  busInit();
+  BusSubscriber* autopilot = busSubscribe(BUS_TOPIC_IMU, 4, "autopilot");
+  BusSubscriber* recorder = busSubscribe(BUS_TOPIC_IMU, 4, "recorder");
+  BusSubscriber* telemetry = busSubscribe(BUS_TOPIC_IMU, 4, "telemetry");
+  BusSubscriber* logs = busSubscribe(BUS_TOPIC_LOG, 4, "logs");
+  TEST_ASSERT_NOT_NULL(telemetry);
+
+  BusMessage* msg = busAcquire(BUS_TOPIC_IMU, sizeof(float));
+  TEST_ASSERT_NOT_NULL(msg);
+  *static_cast<float*>(busPayload(msg)) = 12.5f;
+  TEST_ASSERT_EQUAL(3, busPublish(msg));
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS - 1, busFreeBlocks());
+  TEST_ASSERT_NULL(busReceive(logs, 0));
+
+  // Les trois abonnés reçoivent le même bloc, rendu au pool par le dernier
+  BusSubscriber* subs[] = {autopilot, recorder, telemetry};
+  for (int i = 0; i < 3; i++) {
+    BusMessage* received = busReceive(subs[i], 0);
+    TEST_ASSERT_TRUE(received == msg);
+    TEST_ASSERT_EQUAL_UINT32(1, received->sequence);
+    TEST_ASSERT_EQUAL_FLOAT(12.5f, *static_cast<float*>(busPayload(received)));
+    busRelease(received);
+  }
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS, busFreeBlocks());
+}
+
+static void test_bus_full_queue_drops_without_leaking() {
+  busInit();
+  BusSubscriber* slow = busSubscribe(BUS_TOPIC_IMU, 2, "slow");
+  BusSubscriber* fast = busSubscribe(BUS_TOPIC_IMU, 8, "fast");
+  for (int i = 0; i < 5; i++) {
+    busPublishCopy(BUS_TOPIC_IMU, &i, sizeof(i));
+    busRelease(busReceive(fast, 0));
+  }
+  BusTopicStats stats = busGetTopicStats(BUS_TOPIC_IMU);
+  TEST_ASSERT_EQUAL_UINT32(5, stats.published);
+  TEST_ASSERT_EQUAL_UINT32(7, stats.delivered);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.dropped);
+  TEST_ASSERT_EQUAL_UINT32(3, slow->dropped);
+
+  // Seuls les messages en attente chez l'abonné lent occupent le pool
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS - 2, busFreeBlocks());
+  BusMessage* msg;
+  int expected = 0;
+  while ((msg = busReceive(slow, 0)) != nullptr) {
+    TEST_ASSERT_EQUAL(expected++, *static_cast<int*>(busPayload(msg)));
+    busRelease(msg);
+  }
+  TEST_ASSERT_EQUAL(2, expected);
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS, busFreeBlocks());
+}
+
+static void test_bus_pool_exhaustion_and_retain() {
+  busInit();
+  TEST_ASSERT_NULL(busSubscribe(BUS_TOPIC_COUNT, 1, "invalide"));
+  TEST_ASSERT_NULL(busAcquire(BUS_TOPIC_LOG, BUS_BLOCK_SIZE + 1));
+
+  // Sans abonné, la publication rend aussitôt le bloc
+  TEST_ASSERT_EQUAL(0, busPublishCopy(BUS_TOPIC_LOG, "x", 1));
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS, busFreeBlocks());
+
+  BusSubscriber* logs = busSubscribe(BUS_TOPIC_LOG, BUS_POOL_BLOCKS, "logs");
+
+  Message message = {LOG_LEVEL_WARNING, "TEST", "pool"};
+  for (int i = 0; i < BUS_POOL_BLOCKS; i++) {
+    TEST_ASSERT_EQUAL(1, busPublishCopy(BUS_TOPIC_LOG, &message, sizeof(message)));
+  }
+  TEST_ASSERT_EQUAL(0, busFreeBlocks());
+  TEST_ASSERT_EQUAL(-1, busPublishCopy(BUS_TOPIC_LOG, &message, sizeof(message)));
+  TEST_ASSERT_EQUAL_UINT32(2, busGetTopicStats(BUS_TOPIC_LOG).exhausted);
+
+  // Une référence retenue garde le bloc au-delà du traitement
+  BusMessage* kept = busReceive(logs, 0);
+  busRetain(kept);
+  busRelease(kept);
+  TEST_ASSERT_EQUAL(0, busFreeBlocks());
+  TEST_ASSERT_EQUAL_STRING("pool", static_cast<Message*>(busPayload(kept))->message);
+  busRelease(kept);
+  TEST_ASSERT_EQUAL(1, busFreeBlocks());
+}
+
+static void test_bus_topic_rate() {
+  nativeSetMillis(0);
+  busInit();
+  // Abonné qui ne consomme pas : sa file reste pleine, le débit publié est inchangé
+  busSubscribe(BUS_TOPIC_IMU, 4, "recorder");
+  BusSubscriber* logs = busSubscribe(BUS_TOPIC_LOG, 1, "logs");
+  for (uint32_t t = 0; t < 2000; t += SESSION_SAMPLE_INTERVAL) {
+    nativeSetMillis(t);
+    busPublishCopy(BUS_TOPIC_IMU, &t, sizeof(t));
+  }
+  nativeSetMillis(2000);
+  BusTopicStats stats = busGetTopicStats(BUS_TOPIC_IMU);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 1000.0f / SESSION_SAMPLE_INTERVAL, stats.rateHz);
+  TEST_ASSERT_EQUAL_UINT32(20 * sizeof(uint32_t), stats.bytes);
+  TEST_ASSERT_EQUAL(0.0f, busGetTopicStats(BUS_TOPIC_LOG).rateHz);
+  TEST_ASSERT_NULL(busReceive(logs, 0));
+  TEST_ASSERT_EQUAL(BUS_POOL_BLOCKS - 4, busFreeBlocks());
+
+  // Sujet silencieux depuis plus d'une fenêtre : débit nul
+  nativeSetMillis(4500);
+  TEST_ASSERT_EQUAL(0.0f, busGetTopicStats(BUS_TOPIC_IMU).rateHz);
+}
+
+// === SERVEUR DE PARAMÈTRES ===
+
+// Jeu de paramètres dont la cohérence se vérifie (champs liés)
+typedef struct {
+  uint32_t value;
+  uint32_t complement;
+  float gain;
+} TestParams;
+
+static TestParams makeTestParams(uint32_t value) {
+  TestParams params = {value, ~value, value * 0.5f};
+  return params;
+}
+
+static uint32_t publishTestParams(ParamServer* server, uint32_t value) {
+  TestParams params = makeTestParams(value);
+  return paramServerPublish(server, &params);
+}
+
+static bool isConsistent(const TestParams* params) {
+  return params->complement == ~params->value && params->gain == params->value * 0.5f;
+}
+
+static void test_param_server_snapshot_survives_grace_period() {
+  static ParamServer server;
+  TestParams initial = makeTestParams(1);
+  TEST_ASSERT_TRUE(paramServerInit(&server, &initial, sizeof(initial)));
+  int control = paramServerRegisterReader(&server);
+  int recorder = paramServerRegisterReader(&server);
+
+  uint32_t version = 0;
+  const TestParams* held = (const TestParams*)paramServerRead(&server, control, &version);
+  TEST_ASSERT_EQUAL_UINT32(1, version);
+  publishTestParams(&server, 2);
+  const TestParams* heldByRecorder = (const TestParams*)paramServerRead(&server, recorder, nullptr);
+
+  // Réglages successifs : les instantanés tenus restent intacts, les autres sont recyclés
+  for (uint32_t v = 3; v <= 12; v++) {
+    TEST_ASSERT_EQUAL_UINT32(v, publishTestParams(&server, v));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, held->value);
+  TEST_ASSERT_EQUAL_UINT32(2, heldByRecorder->value);
+  ParamServerStats stats = paramServerGetStats(&server);
+  TEST_ASSERT_EQUAL_UINT32(11, stats.published);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.busy);
+  TEST_ASSERT_TRUE(stats.reclaimed >= 8);
+
+  // Cycle suivant : la dernière version
+  held = (const TestParams*)paramServerRead(&server, control, &version);
+  TEST_ASSERT_EQUAL_UINT32(12, version);
+  TEST_ASSERT_EQUAL_UINT32(12, held->value);
+  TestParams copy;
+  TEST_ASSERT_EQUAL_UINT32(12, paramServerCopy(&server, &copy));
+  TEST_ASSERT_TRUE(isConsistent(&copy));
+
+  // Lecteur inactif : son ancien instantané peut être recyclé
+  paramServerRelease(&server, recorder);
+  for (uint32_t v = 13; v <= 20; v++) {
+    publishTestParams(&server, v);
+  }
+  TEST_ASSERT_EQUAL_UINT32(12, held->value);
+  TEST_ASSERT_TRUE(heldByRecorder->value != 2);
+}
+
+static void test_param_server_rejects_oversized_set_and_extra_readers() {
+  static ParamServer server;
+  uint8_t big[PARAM_SERVER_MAX_SIZE + 1] = {};
+  TEST_ASSERT_FALSE(paramServerInit(&server, big, sizeof(big)));
+  TEST_ASSERT_TRUE(paramServerInit(&server, big, PARAM_SERVER_MAX_SIZE));
+  for (int i = 0; i < PARAM_SERVER_MAX_READERS; i++) {
+    TEST_ASSERT_EQUAL(i, paramServerRegisterReader(&server));
+  }
+  TEST_ASSERT_EQUAL(PARAM_READER_NONE, paramServerRegisterReader(&server));
+}
+
+#ifdef NATIVE_BUILD
+static void test_param_server_concurrent_reads_never_tear() {
+  static ParamServer server;
+  TestParams initial = makeTestParams(0);
+  paramServerInit(&server, &initial, sizeof(initial));
+  int reader = paramServerRegisterReader(&server);
+  std::atomic<bool> done(false);
+  uint32_t torn = 0;
+  uint32_t backwards = 0;
+  std::atomic<uint32_t> reads(0);
+
+  // Boucle de contrôle : un instantané par cycle, versions croissantes
+  std::thread control([&]() {
+    uint32_t lastVersion = 0;
+    while (!done.load()) {
+      uint32_t version = 0;
+      const TestParams* params = (const TestParams*)paramServerRead(&server, reader, &version);
+      for (int check = 0; check < 4; check++) {
+        torn += isConsistent(params) ? 0 : 1;
+      }
+      backwards += version < lastVersion ? 1 : 0;
+      lastVersion = version;
+      reads++;
+    }
+  });
+  // Publications tant que le lecteur n'a pas fait assez de cycles concurrents
+  for (uint32_t v = 1; v <= 20000 || reads.load() < 1000; v++) {
+    publishTestParams(&server, v);
+  }
+  done.store(true);
+  control.join();
+
+  TEST_ASSERT_EQUAL_UINT32(0, torn);
+  TEST_ASSERT_EQUAL_UINT32(0, backwards);
+  TEST_ASSERT_EQUAL_UINT32(0, paramServerGetStats(&server).busy);
+}
+#endif
+
+// === COMPRESSION GORILLA ===
+
+#define TEST_GORILLA_CHANNELS 4
+
+static void test_gorilla_round_trip_is_exact() {
+  // Cas limites : valeurs identiques, signes, NaN, infinis, sauts d'horloge
+  const uint32_t times[] = {1000, 1010, 1020, 1020, 1031, 1040, 1300, 70000, 70010, 4000000000u, 4000000010u};
+  const int count = sizeof(times) / sizeof(times[0]);
+  float values[count][TEST_GORILLA_CHANNELS];
+  for (int i = 0; i < count; i++) {
+    values[i][0] = 12.5f;
+    values[i][1] = (i % 2) ? -0.001f * i : 1e6f * i;
+    values[i][2] = (i == 3) ? NAN : (i == 5) ? INFINITY : 3.14159f + i;
+    values[i][3] = -0.0f + (i > 7 ? 1e-30f : 0.0f);
+  }
+
+  uint8_t block[256];
+  GorillaEncoder encoder;
+  gorillaEncoderInit(&encoder, block, sizeof(block), TEST_GORILLA_CHANNELS);
+  for (int i = 0; i < count; i++) {
+    TEST_ASSERT_TRUE(gorillaEncoderAppend(&encoder, times[i], values[i]));
+  }
+
+  GorillaDecoder decoder;
+  gorillaDecoderInit(&decoder, block, gorillaEncoderSize(&encoder), TEST_GORILLA_CHANNELS, encoder.count);
+  for (int i = 0; i < count; i++) {
+    uint32_t ts = 0;
+    float decoded[TEST_GORILLA_CHANNELS];
+    TEST_ASSERT_TRUE(gorillaDecoderNext(&decoder, &ts, decoded));
+    TEST_ASSERT_EQUAL_UINT32(times[i], ts);
+    TEST_ASSERT_EQUAL_MEMORY(values[i], decoded, sizeof(decoded));
+  }
+  uint32_t ts;
+  float decoded[TEST_GORILLA_CHANNELS];
+  TEST_ASSERT_FALSE(gorillaDecoderNext(&decoder, &ts, decoded));
+  TEST_ASSERT_FALSE(decoder.error);
+
+  // Bloc tronqué : erreur, pas de lecture hors du tampon
+  gorillaDecoderInit(&decoder, block, gorillaEncoderSize(&encoder) / 2, TEST_GORILLA_CHANNELS, encoder.count);
+  int decodedCount = 0;
+  while (gorillaDecoderNext(&decoder, &ts, decoded)) {
+    decodedCount++;
+  }
+  TEST_ASSERT_TRUE(decoder.error);
+  TEST_ASSERT_TRUE(decodedCount < count);
+}
+
+static void test_gorilla_full_block_rejects_without_change() {
+  uint8_t block[64];
+  GorillaEncoder encoder;
+  gorillaEncoderInit(&encoder, block, sizeof(block), TEST_GORILLA_CHANNELS);
+  float values[TEST_GORILLA_CHANNELS] = {0.0f, 0.0f, 0.0f, 0.0f};
+  uint32_t ts = 0;
+  int appended = 0;
+  while (gorillaEncoderAppend(&encoder, ts, values)) {
+    appended++;
+    ts += 10;
+    values[appended % TEST_GORILLA_CHANNELS] += 0.37f;
+  }
+
+  // Refus : le bloc et son état ne bougent pas
+  uint8_t before[sizeof(block)];
+  memcpy(before, block, sizeof(block));
+  size_t size = gorillaEncoderSize(&encoder);
+  TEST_ASSERT_FALSE(gorillaEncoderAppend(&encoder, ts, values));
+  TEST_ASSERT_EQUAL(appended, encoder.count);
+  TEST_ASSERT_EQUAL(size, gorillaEncoderSize(&encoder));
+  TEST_ASSERT_EQUAL_MEMORY(before, block, sizeof(block));
+  TEST_ASSERT_TRUE(size <= sizeof(block));
+
+  GorillaDecoder decoder;
+  gorillaDecoderInit(&decoder, block, size, TEST_GORILLA_CHANNELS, encoder.count);
+  float decoded[TEST_GORILLA_CHANNELS];
+  int decodedCount = 0;
+  while (gorillaDecoderNext(&decoder, &ts, decoded)) {
+    decodedCount++;
+  }
+  TEST_ASSERT_EQUAL(appended, decodedCount);
+  TEST_ASSERT_FALSE(decoder.error);
+}
+
+static void test_gorilla_compresses_regular_flight_data() {
+  // 100 Hz, attitude lente, longueur de ligne constante, direction entière
+  static uint8_t block[4080];
+  GorillaEncoder encoder;
+  gorillaEncoderInit(&encoder, block, sizeof(block), TEST_GORILLA_CHANNELS);
+  for (uint32_t i = 0; i < 200; i++) {
+    float values[TEST_GORILLA_CHANNELS] = {
+      20.0f * sinf(i * 0.01f), 2500.0f, roundf(30.0f * sinf(i * 0.005f)), 8.0f
+    };
+    TEST_ASSERT_TRUE(gorillaEncoderAppend(&encoder, 5000 + i * 10, values));
+  }
+  // Brut : 4 + 4 * 4 = 20 octets par échantillon
+  float bytesPerSample = (float)gorillaEncoderSize(&encoder) / encoder.count;
+  TEST_ASSERT_TRUE(bytesPerSample < 6.0f);
+}
+
+// === ANALYSE VIBRATOIRE ===
+
+/**
+ * Pousse des échantillons : gravité sur z, sinusoïde optionnelle, bruit faible
+ */
+static void pushVibration(int count, float hz, float amplitude, uint32_t* index) {
+  for (int i = 0; i < count; i++, (*index)++) {
+    float t = (float)*index / VIBRATION_SAMPLE_RATE_HZ;
+    float noise = 0.004f * (float)(((*index * 2654435761u) >> 24) & 0xFF) / 255.0f;
+    float accel[3] = {0.0f, 0.0f, 1.0f + amplitude * sinf(2.0f * (float)M_PI * hz * t) + noise};
+    vibrationPushSample(accel);
+  }
+}
+
+static void test_vibration_sinusoid_peak_and_band() {
+  vibrationInit();
+  uint32_t index = 0;
+  pushVibration(VIBRATION_FFT_SIZE, 25.3f, 0.3f, &index);
+  TEST_ASSERT_EQUAL(1, vibrationProcess(UINT32_MAX));
+
+  VibrationStatus status;
+  vibrationGetStatus(&status);
+  TEST_ASSERT_EQUAL_UINT32(1, status.blocks);
+  TEST_ASSERT_FLOAT_WITHIN(0.2f, 25.3f, status.peakHz[0]);
+  TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.3f, status.peakAmplitude[0]);
+  // Valeur efficace d'une sinusoïde : amplitude / racine de 2, dans la bande des lignes
+  TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.3f / sqrtf(2.0f), status.bandRms[VIBRATION_BAND_LINES]);
+  TEST_ASSERT_TRUE(status.bandRms[VIBRATION_BAND_SERVO] < 0.03f);
+  TEST_ASSERT_TRUE(status.learning);
+}
+
+static void test_vibration_flutter_raises_and_clears_anomaly() {
+  vibrationInit();
+  uint32_t index = 0;
+  // Apprentissage sur une oscillation de pilotage modérée
+  pushVibration(VIBRATION_FFT_SIZE, 1.0f, 0.1f, &index);
+  vibrationProcess(UINT32_MAX);
+  for (int i = 0; i < VIBRATION_LEARN_BLOCKS; i++) {
+    pushVibration(VIBRATION_HOP, 1.0f, 0.1f, &index);
+    vibrationProcess(UINT32_MAX);
+  }
+  TEST_ASSERT_FALSE(vibrationIsAnomalous());
+
+  // Flottement des lignes : confirmé après VIBRATION_ANOMALY_BLOCKS blocs anormaux
+  int blocksToDetect = 0;
+  while (!vibrationIsAnomalous() && blocksToDetect < 10) {
+    pushVibration(VIBRATION_HOP, 18.0f, 0.5f, &index);
+    vibrationProcess(UINT32_MAX);
+    blocksToDetect++;
+  }
+  TEST_ASSERT_TRUE(vibrationIsAnomalous());
+  TEST_ASSERT_TRUE(blocksToDetect >= VIBRATION_ANOMALY_BLOCKS);
+  VibrationStatus status;
+  vibrationGetStatus(&status);
+  TEST_ASSERT_EQUAL(VIBRATION_BAND_LINES, status.anomalyBand);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 18.0f, status.peakHz[0]);
+
+  // Retour au calme
+  for (int i = 0; i < 4; i++) {
+    pushVibration(VIBRATION_HOP, 1.0f, 0.1f, &index);
+    vibrationProcess(UINT32_MAX);
+  }
+  TEST_ASSERT_FALSE(vibrationIsAnomalous());
+}
+
+static void test_vibration_lag_skips_and_budget_limits() {
+  vibrationInit();
+  uint32_t index = 0;
+
+  // Budget épuisé : un seul bloc par appel
+  pushVibration(VIBRATION_FFT_SIZE + 2 * VIBRATION_HOP, 0.0f, 0.0f, &index);
+  TEST_ASSERT_EQUAL(1, vibrationProcess(0));
+  TEST_ASSERT_EQUAL(2, vibrationProcess(UINT32_MAX));
+  TEST_ASSERT_EQUAL(0, vibrationProcess(UINT32_MAX));
+
+  // Analyse en retard de plus d'un anneau : reprise au bloc le plus récent
+  pushVibration(3 * VIBRATION_RING_SIZE, 0.0f, 0.0f, &index);
+  TEST_ASSERT_EQUAL(1, vibrationProcess(UINT32_MAX));
+  VibrationStatus status;
+  vibrationGetStatus(&status);
+  TEST_ASSERT_EQUAL_UINT32(4, status.blocks);
+  TEST_ASSERT_TRUE(status.skipped > 0);
+  TEST_ASSERT_EQUAL_UINT32(0, status.overruns);
+}
+
+
+// === INSTANTANÉ DES TÂCHES ===
+
+static void setNativeTask(int index, const char* name, UBaseType_t number, eTaskState state,
+                          UBaseType_t priority, BaseType_t core, uint32_t runTime, uint32_t stack) {
+  TaskStatus_t& status = nativeTaskStatus[index];
+  status.xHandle = &nativeTaskStatus[index];
+  status.pcTaskName = name;
+  status.xTaskNumber = number;
+  status.eCurrentState = state;
+  status.uxCurrentPriority = priority;
+  status.ulRunTimeCounter = runTime;
+  status.usStackHighWaterMark = stack;
+  status.xCoreID = core;
+}
+
+static void test_task_snapshot_deltas_order_and_json() {
+  // Compteurs proches du passage à zéro, tâches rendues dans le désordre
+  nativeTaskCount = 2;
+  setNativeTask(0, "Control", 7, eBlocked, 1, tskNO_AFFINITY, 0xFFFFF000u, 2048);
+  setNativeTask(1, "IDLE0", 2, eReady, 0, 0, 0xFFFF0000u, 900);
+  nativeTotalRunTime = 0xFFFF8000u;
+  TEST_ASSERT_TRUE(taskSnapshotCapture(1000));
+
+  // 2 s plus tard : 1 000 000 unités, Control 100 000, IDLE0 800 000, nouvelle tâche
+  nativeTaskCount = 3;
+  nativeTaskStatus[0].ulRunTimeCounter = 0xFFFFF000u + 100000;
+  nativeTaskStatus[1].ulRunTimeCounter = 0xFFFF0000u + 800000;
+  setNativeTask(2, "a_very_long_task_name", 9, eRunning, 3, 1, 50000, 512);
+  nativeTotalRunTime = 0xFFFF8000u + 1000000;
+  TEST_ASSERT_TRUE(taskSnapshotCapture(3000));
+
+  TaskSnapshot snapshot;
+  TEST_ASSERT_TRUE(taskSnapshotGetLatest(&snapshot));
+  TEST_ASSERT_EQUAL_UINT32(2000, snapshot.intervalMs);
+  TEST_ASSERT_EQUAL_UINT32(1000000, snapshot.runTimeTotal);
+  TEST_ASSERT_EQUAL(3, snapshot.taskCount);
+  TEST_ASSERT_EQUAL_STRING("IDLE0", snapshot.tasks[0].name);
+  TEST_ASSERT_EQUAL(0, snapshot.tasks[0].core);
+  TEST_ASSERT_EQUAL_UINT32(800000, snapshot.tasks[0].runTime);
+  TEST_ASSERT_EQUAL(800, snapshot.tasks[0].cpuPermille);
+  TEST_ASSERT_EQUAL_STRING("Control", snapshot.tasks[1].name);
+  TEST_ASSERT_EQUAL(-1, snapshot.tasks[1].core);
+  TEST_ASSERT_EQUAL(100, snapshot.tasks[1].cpuPermille);
+  TEST_ASSERT_EQUAL(eBlocked, snapshot.tasks[1].state);
+  TEST_ASSERT_EQUAL_UINT32(2048, snapshot.tasks[1].stackFreeBytes);
+  // Nouvelle tâche : tout son temps depuis sa création, nom tronqué
+  TEST_ASSERT_EQUAL_STRING("a_very_long_tas", snapshot.tasks[2].name);
+  TEST_ASSERT_EQUAL(50, snapshot.tasks[2].cpuPermille);
+
+  char json[TASK_SNAPSHOT_JSON_SIZE];
+  size_t length = taskSnapshotToJson(&snapshot, json, sizeof(json));
+  TEST_ASSERT_TRUE(length > 0);
+  TEST_ASSERT_EQUAL(strlen(json), length);
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"intervalMs\":2000"));
+  TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Control\",\"state\":\"blocked\",\"priority\":1,\"core\":-1,"
+                                    "\"stackFree\":2048,\"runTime\":100000,\"cpuPermille\":100}"));
+  TEST_ASSERT_EQUAL_STRING("]}", json + length - 2);
+  TEST_ASSERT_EQUAL(0, taskSnapshotToJson(&snapshot, json, 64));
+
+  // Plus de tâches que le tableau : capture refusée, la précédente reste
+  nativeTaskCount = TASK_SNAPSHOT_MAX_TASKS + 1;
+  TEST_ASSERT_FALSE(taskSnapshotCapture(5000));
+  TEST_ASSERT_TRUE(taskSnapshotGetLatest(&snapshot));
+  TEST_ASSERT_EQUAL_UINT32(3000, snapshot.timestampMs);
+  nativeTaskCount = 0;
+}
+
+static void test_task_snapshot_json_fits_full_table() {
+  TaskSnapshot snapshot;
+  memset(&snapshot, 0, sizeof(snapshot));
+  snapshot.timestampMs = snapshot.intervalMs = snapshot.runTimeTotal = 0xFFFFFFFFu;
+  snapshot.taskCount = TASK_SNAPSHOT_MAX_TASKS;
+  for (int i = 0; i < TASK_SNAPSHOT_MAX_TASKS; i++) {
+    TaskSnapshotEntry& task = snapshot.tasks[i];
+    memset(task.name, 'x', TASK_SNAPSHOT_NAME_LENGTH - 1);
+    task.state = eSuspended;
+    task.priority = 255;
+    task.core = -1;
+    task.stackFreeBytes = task.runTime = 0xFFFFFFFFu;
+    task.cpuPermille = 1000;
+  }
+  static char json[TASK_SNAPSHOT_JSON_SIZE];
+  TEST_ASSERT_TRUE(taskSnapshotToJson(&snapshot, json, sizeof(json)) > 0);
+}
+
+// === COMPTEURS DE VIE ===
+
+static void test_lifetime_counters_survive_reboot_and_limit_writes() {
+  nativeNvs.erase(LIFETIME_NVS_NAMESPACE);
+  hotPathResetControlStats();
+  // Départ 5 min avant le passage à zéro de millis()
+  const uint32_t t0 = 0xFFFFFFFFu - 300000;
+  TEST_ASSERT_TRUE(lifetimeStatsInit(t0));
+  TEST_ASSERT_EQUAL_UINT32(1, lifetimeStatsGet().bootCount);
+  TEST_ASSERT_EQUAL_UINT32(1, lifetimeStatsGet().checkpointCount);
+
+  ErrorManager::getInstance()->reportError(ErrorCode::INVALID_PARAMETER, "TEST", "compteur de vie");
+  ErrorManager::getInstance()->reportError(ErrorCode::INVALID_PARAMETER, "TEST", "compteur de vie");
+  hotPathRecordControlCycle(0, 500);
+  hotPathRecordControlCycle(40000, 40900);
+
+  // 9 min au sol, vol de 3 min, 30 s au sol, vol de 18 s, 42 s au sol
+  int checkpoints = 0;
+  for (uint32_t t = 500; t <= 810000; t += 500) {
+    bool flying = (t > 540000 && t <= 720000) || (t > 750000 && t <= 768000);
+    lifetimeStatsAddEnergy(flying ? 0.0004f : -1.0f);
+    if (lifetimeStatsUpdate(t0 + t, flying)) {
+      checkpoints++;
+    }
+  }
+  // Échéance de 10 min, puis fin du premier vol ; la fin du second vol
+  // est trop proche de la sauvegarde précédente
+  TEST_ASSERT_EQUAL(2, checkpoints);
+
+  LifetimeCounters counters = lifetimeStatsGet();
+  TEST_ASSERT_EQUAL_UINT32(3, counters.checkpointCount);
+  TEST_ASSERT_EQUAL_UINT32(2, counters.flightCount);
+  TEST_ASSERT_EQUAL_UINT32(810000, (uint32_t)counters.uptimeMs);
+  TEST_ASSERT_EQUAL_UINT32(198000, (uint32_t)counters.flightMs);
+  TEST_ASSERT_UINT32_WITHIN(2, 158, (uint32_t)counters.energyMilliJoules);
+  TEST_ASSERT_EQUAL_UINT32(2, counters.errorCount);
+  TEST_ASSERT_EQUAL_UINT32(1, counters.controlOverruns);
+  TEST_ASSERT_EQUAL_UINT32(900, counters.worstControlWorkUs);
+  TEST_ASSERT_EQUAL_UINT32(40000, counters.worstControlPeriodUs);
+
+  // Redémarrage : compteurs repris, démarrage compté ; un rapport de
+  // contrôle remis à zéro ne fait pas reculer les cumuls
+  TEST_ASSERT_TRUE(lifetimeStatsCheckpoint());
+  hotPathResetControlStats();
+  TEST_ASSERT_TRUE(lifetimeStatsInit(100));
+  lifetimeStatsUpdate(600, false);
+  counters = lifetimeStatsGet();
+  TEST_ASSERT_EQUAL_UINT32(2, counters.bootCount);
+  TEST_ASSERT_EQUAL_UINT32(810500, (uint32_t)counters.uptimeMs);
+  TEST_ASSERT_EQUAL_UINT32(198000, (uint32_t)counters.flightMs);
+  TEST_ASSERT_EQUAL_UINT32(1, counters.controlOverruns);
+  TEST_ASSERT_EQUAL_UINT32(900, counters.worstControlWorkUs);
+  TEST_ASSERT_EQUAL_UINT32(5, counters.checkpointCount);
+
+  // Bloc corrompu : départ à zéro
+  nativeNvs[LIFETIME_NVS_NAMESPACE]["counters"][12] ^= 0x01;
+  lifetimeStatsInit(0);
+  TEST_ASSERT_EQUAL_UINT32(1, lifetimeStatsGet().bootCount);
+  TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)lifetimeStatsGet().uptimeMs);
+  ErrorManager::getInstance()->clearErrorHistory();
+}
+
+// === STOCKAGE DES SESSIONS ===
+
+// Échantillon pseudo-aléatoire (peu compressible : les blocs se remplissent vite)
+static void makeSessionSample(uint32_t index, uint32_t timestampMs, FlightSample* sample) {
+  uint32_t seed = index * 2654435761u + 12345;
+  sample->timestampMs = timestampMs;
+  for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+    seed = seed * 1103515245u + 12345;
+    sample->values[c] = (float)((seed >> 8) % 20000) / 100.0f - 100.0f;
+  }
+}
+
+static void clearSessions() {
+  SessionInfo sessions[SESSION_MAX_COUNT + 1];
+  int count = sessionStorageList(sessions, SESSION_MAX_COUNT + 1);
+  for (int i = 0; i < count; i++) {
+    sessionStorageDelete(sessions[i].id);
+  }
+}
+
+static int readSessionIndex(uint16_t id, SessionIndexEntry* entries, int maxEntries) {
+  char path[48];
+  snprintf(path, sizeof(path), "%s/%u.idx", SESSION_STORAGE_ROOT, id);
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return -1;
+  }
+  int count = (int)fread(entries, sizeof(SessionIndexEntry), maxEntries, file);
+  fclose(file);
+  return count;
+}
+
+static void test_session_chunk_flushes_at_block_boundary() {
+  TEST_ASSERT_TRUE(sessionStorageInit());
+  clearSessions();
+
+  // Capacité d'un bloc pour cette séquence, mesurée avec le même encodeur
+  static uint8_t block[SESSION_CHUNK_DATA_SIZE];
+  GorillaEncoder encoder;
+  gorillaEncoderInit(&encoder, block, sizeof(block), SESSION_CHANNEL_COUNT);
+  FlightSample sample;
+  uint32_t capacity = 0;
+  makeSessionSample(capacity, 1000 + capacity * SESSION_SAMPLE_INTERVAL, &sample);
+  while (gorillaEncoderAppend(&encoder, sample.timestampMs, sample.values)) {
+    capacity++;
+    makeSessionSample(capacity, 1000 + capacity * SESSION_SAMPLE_INTERVAL, &sample);
+  }
+  TEST_ASSERT_GREATER_THAN(10, capacity);
+
+  uint16_t id = sessionStorageStart();
+  TEST_ASSERT_TRUE(id != 0);
+  SessionInfo info;
+  for (uint32_t i = 0; i < capacity; i++) {
+    makeSessionSample(i, 1000 + i * SESSION_SAMPLE_INTERVAL, &sample);
+    TEST_ASSERT_TRUE(sessionStorageAppend(sample));
+  }
+  TEST_ASSERT_TRUE(sessionStorageGetInfo(id, &info));
+  TEST_ASSERT_EQUAL_UINT32(0, info.chunkCount);
+
+  // L'échantillon qui ne tient plus écrit le bloc et ouvre le suivant
+  makeSessionSample(capacity, 1000 + capacity * SESSION_SAMPLE_INTERVAL, &sample);
+  TEST_ASSERT_TRUE(sessionStorageAppend(sample));
+  TEST_ASSERT_TRUE(sessionStorageGetInfo(id, &info));
+  TEST_ASSERT_EQUAL_UINT32(1, info.chunkCount);
+
+  SessionIndexEntry entries[16];
+  TEST_ASSERT_EQUAL(1, readSessionIndex(id, entries, 16));
+  TEST_ASSERT_EQUAL_UINT32(1000, entries[0].firstTs);
+  TEST_ASSERT_EQUAL_UINT32(1000 + (capacity - 1) * SESSION_SAMPLE_INTERVAL, entries[0].lastTs);
+  TEST_ASSERT_EQUAL_UINT32(0, entries[0].offset);
+  TEST_ASSERT_EQUAL_UINT32(capacity, entries[0].count);
+
+  // Plusieurs blocs : index contigu, un secteur par bloc
+  uint32_t total = capacity + 1;
+  for (; total < capacity * 4; total++) {
+    makeSessionSample(total, 1000 + total * SESSION_SAMPLE_INTERVAL, &sample);
+    TEST_ASSERT_TRUE(sessionStorageAppend(sample));
+  }
+  TEST_ASSERT_TRUE(sessionStorageStop());
+  TEST_ASSERT_TRUE(sessionStorageGetInfo(id, &info));
+  TEST_ASSERT_EQUAL_UINT32(total, info.sampleCount);
+
+  int entryCount = readSessionIndex(id, entries, 16);
+  TEST_ASSERT_EQUAL_UINT32(info.chunkCount, (uint32_t)entryCount);
+  TEST_ASSERT_GREATER_OR_EQUAL(4, entryCount);
+  uint32_t counted = 0;
+  for (int k = 0; k < entryCount; k++) {
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)k * SESSION_CHUNK_SIZE, entries[k].offset);
+    TEST_ASSERT_EQUAL_UINT32(1000 + counted * SESSION_SAMPLE_INTERVAL, entries[k].firstTs);
+    counted += entries[k].count;
+    TEST_ASSERT_EQUAL_UINT32(1000 + (counted - 1) * SESSION_SAMPLE_INTERVAL, entries[k].lastTs);
+  }
+  TEST_ASSERT_EQUAL_UINT32(total, counted);
+
+  char path[48];
+  snprintf(path, sizeof(path), "%s/%u.dat", SESSION_STORAGE_ROOT, id);
+  struct stat st;
+  TEST_ASSERT_EQUAL(0, stat(path, &st));
+  TEST_ASSERT_EQUAL_UINT32(info.chunkCount * SESSION_CHUNK_SIZE, (uint32_t)st.st_size);
+
+  TEST_ASSERT_TRUE(sessionStorageDelete(id));
+}
+
+static void test_session_read_range_seeks_to_chunk() {
+  TEST_ASSERT_TRUE(sessionStorageInit());
+  clearSessions();
+
+  const uint32_t sampleCount = 2000;
+  uint16_t id = sessionStorageStart();
+  TEST_ASSERT_TRUE(id != 0);
+  FlightSample sample;
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    makeSessionSample(i, 50000 + i * SESSION_SAMPLE_INTERVAL, &sample);
+    TEST_ASSERT_TRUE(sessionStorageAppend(sample));
+  }
+  TEST_ASSERT_TRUE(sessionStorageStop());
+
+  SessionIndexEntry entries[64];
+  int entryCount = readSessionIndex(id, entries, 64);
+  TEST_ASSERT_GREATER_OR_EQUAL(8, entryCount);
+
+  // Plage à cheval sur deux blocs au milieu de la session
+  const SessionIndexEntry& middle = entries[entryCount / 2];
+  uint32_t fromMs = middle.lastTs - 5 * SESSION_SAMPLE_INTERVAL;
+  uint32_t toMs = middle.lastTs + 5 * SESSION_SAMPLE_INTERVAL;
+  FlightSample samples[32];
+  int found = sessionStorageReadRange(id, fromMs, toMs, samples, 32);
+  TEST_ASSERT_EQUAL(11, found);
+  uint32_t first = (fromMs - 50000) / SESSION_SAMPLE_INTERVAL;
+  for (int i = 0; i < found; i++) {
+    FlightSample expected;
+    makeSessionSample(first + i, 50000 + (first + i) * SESSION_SAMPLE_INTERVAL, &expected);
+    TEST_ASSERT_EQUAL_UINT32(expected.timestampMs, samples[i].timestampMs);
+    TEST_ASSERT_EQUAL_MEMORY(expected.values, samples[i].values, sizeof(expected.values));
+  }
+
+  // Blocs précédents corrompus : seule une recherche qui les saute réussit
+  char path[48];
+  snprintf(path, sizeof(path), "%s/%u.dat", SESSION_STORAGE_ROOT, id);
+  FILE* data = fopen(path, "r+b");
+  TEST_ASSERT_NOT_NULL(data);
+  const uint32_t badMagic = 0;
+  for (int k = 0; k < entryCount / 2; k++) {
+    fseek(data, entries[k].offset, SEEK_SET);
+    fwrite(&badMagic, sizeof(badMagic), 1, data);
+  }
+  fclose(data);
+  TEST_ASSERT_EQUAL(11, sessionStorageReadRange(id, fromMs, toMs, samples, 32));
+  TEST_ASSERT_EQUAL_UINT32(fromMs, samples[0].timestampMs);
+
+  // Horodatage entre deux échantillons : le suivant ; hors session : rien
+  found = sessionStorageReadRange(id, middle.firstTs + 1, middle.firstTs + SESSION_SAMPLE_INTERVAL, samples, 32);
+  TEST_ASSERT_EQUAL(1, found);
+  TEST_ASSERT_EQUAL_UINT32(middle.firstTs + SESSION_SAMPLE_INTERVAL, samples[0].timestampMs);
+  TEST_ASSERT_EQUAL(0, sessionStorageReadRange(id, 1000, 49999, samples, 32));
+  TEST_ASSERT_EQUAL(0, sessionStorageReadRange(id, 50000 + sampleCount * SESSION_SAMPLE_INTERVAL, 0xFFFFFFFFu, samples, 32));
+
+  TEST_ASSERT_TRUE(sessionStorageDelete(id));
+}
+
+static void test_session_overviews_match_brute_force() {
+  TEST_ASSERT_TRUE(sessionStorageInit());
+  clearSessions();
+
+  // 150 s de vol, une coupure de 25 s, début non aligné sur les seaux
+  const uint32_t sampleCount = 1500;
+  const uint32_t startTs = 12345;
+  static FlightSample recorded[sampleCount];
+  uint16_t id = sessionStorageStart();
+  TEST_ASSERT_TRUE(id != 0);
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    uint32_t ts = startTs + i * SESSION_SAMPLE_INTERVAL + (i >= 700 ? 25000 : 0);
+    makeSessionSample(i, ts, &recorded[i]);
+    TEST_ASSERT_TRUE(sessionStorageAppend(recorded[i]));
+  }
+  TEST_ASSERT_TRUE(sessionStorageStop());
+
+  SessionInfo info;
+  TEST_ASSERT_TRUE(sessionStorageGetInfo(id, &info));
+  static SessionOverviewBucket buckets[256];
+  for (uint8_t level = 0; level < SESSION_OVERVIEW_LEVELS; level++) {
+    uint32_t duration = sessionStorageBucketDuration(level);
+    int count = sessionStorageReadOverview(id, level, 0, 0xFFFFFFFFu, buckets, 256);
+    TEST_ASSERT_EQUAL_UINT32(info.bucketCount[level], (uint32_t)count);
+
+    // Référence : tranches alignées sur le début, les tranches vides sont absentes
+    int expectedCount = 0;
+    uint32_t i = 0;
+    while (i < sampleCount) {
+      uint32_t bucketStart = startTs + (recorded[i].timestampMs - startTs) / duration * duration;
+      float minValue[SESSION_CHANNEL_COUNT];
+      float maxValue[SESSION_CHANNEL_COUNT];
+      double sum[SESSION_CHANNEL_COUNT] = {0};
+      uint32_t n = 0;
+      for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+        minValue[c] = recorded[i].values[c];
+        maxValue[c] = recorded[i].values[c];
+      }
+      for (; i < sampleCount && recorded[i].timestampMs < bucketStart + duration; i++, n++) {
+        for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+          minValue[c] = fminf(minValue[c], recorded[i].values[c]);
+          maxValue[c] = fmaxf(maxValue[c], recorded[i].values[c]);
+          sum[c] += recorded[i].values[c];
+        }
+      }
+
+      TEST_ASSERT_LESS_THAN(count, expectedCount);
+      const SessionOverviewBucket& bucket = buckets[expectedCount++];
+      TEST_ASSERT_EQUAL_UINT32(bucketStart, bucket.startTs);
+      TEST_ASSERT_EQUAL_UINT32(recorded[i - 1].timestampMs, bucket.lastTs);
+      TEST_ASSERT_EQUAL_UINT32(n, bucket.count);
+      for (int c = 0; c < SESSION_CHANNEL_COUNT; c++) {
+        TEST_ASSERT_EQUAL_FLOAT(minValue[c], bucket.minValue[c]);
+        TEST_ASSERT_EQUAL_FLOAT(maxValue[c], bucket.maxValue[c]);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, (float)(sum[c] / n), bucket.meanValue[c]);
+      }
+    }
+    TEST_ASSERT_EQUAL(expectedCount, count);
+  }
+
+  // Lecture partielle : premier seau contenant fromMs
+  uint32_t fromMs = startTs + 45500;
+  int count = sessionStorageReadOverview(id, 1, fromMs, fromMs + 20000, buckets, 256);
+  TEST_ASSERT_EQUAL(3, count);
+  TEST_ASSERT_EQUAL_UINT32(startTs + 40000, buckets[0].startTs);
+
+  TEST_ASSERT_TRUE(sessionStorageDelete(id));
+}
+
+static void test_session_rotation_removes_oldest() {
+  TEST_ASSERT_TRUE(sessionStorageInit());
+  clearSessions();
+
+  uint16_t ids[SESSION_MAX_COUNT + 1];
+  FlightSample sample;
+  for (int s = 0; s <= SESSION_MAX_COUNT; s++) {
+    ids[s] = sessionStorageStart();
+    TEST_ASSERT_TRUE(ids[s] != 0);
+    makeSessionSample(s, 1000, &sample);
+    TEST_ASSERT_TRUE(sessionStorageAppend(sample));
+    TEST_ASSERT_TRUE(sessionStorageStop());
+  }
+
+  SessionInfo sessions[SESSION_MAX_COUNT + 1];
+  TEST_ASSERT_EQUAL(SESSION_MAX_COUNT, sessionStorageList(sessions, SESSION_MAX_COUNT + 1));
+  SessionInfo info;
+  TEST_ASSERT_FALSE(sessionStorageGetInfo(ids[0], &info));
+  for (int s = 1; s <= SESSION_MAX_COUNT; s++) {
+    TEST_ASSERT_TRUE(ids[s] > ids[s - 1]);
+    TEST_ASSERT_TRUE(sessionStorageGetInfo(ids[s], &info));
+    TEST_ASSERT_EQUAL_UINT32(1, info.sampleCount);
+  }
+  FlightSample samples[4];
+  TEST_ASSERT_EQUAL(-1, sessionStorageReadRange(ids[0], 0, 0xFFFFFFFFu, samples, 4));
+
+  clearSessions();
+  TEST_ASSERT_EQUAL(0, sessionStorageList(sessions, SESSION_MAX_COUNT + 1));
+}
+
+void runUtilsTests() {
+  RUN_TEST(test_benchmark_statistics_are_ordered);
+  RUN_TEST(test_benchmark_prepare_runs_each_iteration);
+  RUN_TEST(test_benchmark_rejects_invalid_case);
+  RUN_TEST(test_benchmark_compare_verdicts);
+  RUN_TEST(test_benchmark_compare_ignores_small_absolute_delta);
+  RUN_TEST(test_benchmark_baseline_round_trip);
+  RUN_TEST(test_benchmark_baseline_other_unit_is_ignored);
+  RUN_TEST(test_fault_script_parsing);
+  RUN_TEST(test_fault_stuck_imu_detected_and_recovered);
+  RUN_TEST(test_fault_noisy_imu_detected);
+  RUN_TEST(test_fault_i2c_nak_triggers_reinitialize);
+  RUN_TEST(test_fault_task_stall_detected);
+  RUN_TEST(test_fault_heap_exhaustion_detected_and_released);
+  RUN_TEST(test_boot_profiler_nested_timeline);
+  RUN_TEST(test_boot_profiler_reports_stalled_step);
+  RUN_TEST(test_boot_profiler_flags_regression);
+  RUN_TEST(test_timer_wheel_fires_on_time_at_every_level);
+  RUN_TEST(test_timer_wheel_periodic_skips_missed_periods);
+  RUN_TEST(test_timer_wheel_cancel_and_stale_handles);
+  RUN_TEST(test_timer_wheel_fired_one_shot_handle_is_stale);
+  RUN_TEST(test_timer_wheel_next_delay_and_long_sleep);
+  RUN_TEST(test_timer_wheel_survives_millis_wrap);
+  RUN_TEST(test_bus_fan_out_shares_one_block);
+  RUN_TEST(test_bus_full_queue_drops_without_leaking);
+  RUN_TEST(test_bus_pool_exhaustion_and_retain);
+  RUN_TEST(test_bus_topic_rate);
+  RUN_TEST(test_param_server_snapshot_survives_grace_period);
+  RUN_TEST(test_param_server_rejects_oversized_set_and_extra_readers);
+  RUN_TEST(test_gorilla_round_trip_is_exact);
+  RUN_TEST(test_gorilla_full_block_rejects_without_change);
+  RUN_TEST(test_gorilla_compresses_regular_flight_data);
+  RUN_TEST(test_vibration_sinusoid_peak_and_band);
+  RUN_TEST(test_vibration_flutter_raises_and_clears_anomaly);
+  RUN_TEST(test_vibration_lag_skips_and_budget_limits);
+  RUN_TEST(test_task_snapshot_deltas_order_and_json);
+  RUN_TEST(test_task_snapshot_json_fits_full_table);
+  RUN_TEST(test_lifetime_counters_survive_reboot_and_limit_writes);
+  RUN_TEST(test_session_chunk_flushes_at_block_boundary);
+  RUN_TEST(test_session_read_range_seeks_to_chunk);
+  RUN_TEST(test_session_overviews_match_brute_force);
+  RUN_TEST(test_session_rotation_removes_oldest);
+#ifdef NATIVE_BUILD
+  RUN_TEST(test_param_server_concurrent_reads_never_tear);
+#endif
+}